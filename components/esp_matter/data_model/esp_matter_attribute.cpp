@@ -16,6 +16,7 @@
 #include <esp_matter_attribute.h>
 #include <esp_matter.h>
 #include <esp_matter_core.h>
+#include <cluster_select/esp_matter_cluster_select.h>
 #include <app/clusters/mode-base-server/mode-base-cluster-objects.h>
 
 static const char *TAG = "esp_matter_attribute";
@@ -43,6 +44,7 @@ attribute_t *create_feature_map(cluster_t *cluster, uint32_t value)
 } /* attribute */
 } /* global */
 
+#if ESP_MATTER_CLUSTER_SELECTED(descriptor)
 namespace descriptor {
 namespace attribute {
 
@@ -85,7 +87,9 @@ attribute_t *create_endpoint_unique_id(cluster_t *cluster, uint8_t *value, uint1
 #endif
 } /* attribute */
 } /* descriptor */
+#endif // ESP_MATTER_CLUSTER_SELECTED(descriptor)
 
+#if ESP_MATTER_CLUSTER_SELECTED(actions)
 namespace actions {
 namespace attribute {
 
@@ -109,7 +113,9 @@ attribute_t *create_setup_url(cluster_t *cluster, char *value, uint16_t length)
 
 } /* attribute */
 } /* actions */
+#endif // ESP_MATTER_CLUSTER_SELECTED(actions)
 
+#if ESP_MATTER_CLUSTER_SELECTED(access_control)
 namespace access_control {
 namespace attribute {
 
@@ -159,7 +165,9 @@ attribute_t *create_arl(cluster_t *cluster, uint8_t *value, uint16_t length, uin
 #endif
 } /* attribute */
 } /* access_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(access_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(basic_information)
 namespace basic_information {
 namespace attribute {
 
@@ -312,7 +320,9 @@ attribute_t *create_configuration_version(cluster_t *cluster, uint32_t value)
 
 } /* attribute */
 } /* basic_information */
+#endif // ESP_MATTER_CLUSTER_SELECTED(basic_information)
 
+#if ESP_MATTER_CLUSTER_SELECTED(binding)
 namespace binding {
 namespace attribute {
 
@@ -325,7 +335,9 @@ attribute_t *create_binding(cluster_t *cluster, uint8_t *value, uint16_t length,
 
 } /* attribute */
 } /* binding */
+#endif // ESP_MATTER_CLUSTER_SELECTED(binding)
 
+#if ESP_MATTER_CLUSTER_SELECTED(ota_software_update_requestor)
 namespace ota_software_update_requestor {
 namespace attribute {
 
@@ -356,7 +368,9 @@ attribute_t *create_update_state_progress(cluster_t *cluster, nullable<uint8_t>
 
 } /* attribute */
 } /* ota_software_update_requestor */
+#endif // ESP_MATTER_CLUSTER_SELECTED(ota_software_update_requestor)
 
+#if ESP_MATTER_CLUSTER_SELECTED(general_commissioning)
 namespace general_commissioning {
 namespace attribute {
 
@@ -424,7 +438,9 @@ attribute_t *create_tc_update_deadline(cluster_t *cluster, nullable<uint32_t> va
 
 } /* attribute */
 } /* general_commissioning */
+#endif // ESP_MATTER_CLUSTER_SELECTED(general_commissioning)
 
+#if ESP_MATTER_CLUSTER_SELECTED(network_commissioning)
 namespace network_commissioning {
 namespace attribute {
 
@@ -496,7 +512,9 @@ attribute_t *create_thread_version(cluster_t *cluster, uint16_t value)
 
 } /* attribute */
 } /* network_commissioning */
+#endif // ESP_MATTER_CLUSTER_SELECTED(network_commissioning)
 
+#if ESP_MATTER_CLUSTER_SELECTED(general_diagnostics)
 namespace general_diagnostics {
 namespace attribute {
 
@@ -556,7 +574,9 @@ attribute_t *create_test_event_triggers_enabled(cluster_t *cluster, bool value)
 
 } /* attribute */
 } /* general_diagnostics */
+#endif // ESP_MATTER_CLUSTER_SELECTED(general_diagnostics)
 
+#if ESP_MATTER_CLUSTER_SELECTED(software_diagnostics)
 namespace software_diagnostics {
 namespace attribute {
 
@@ -586,7 +606,9 @@ attribute_t *create_current_heap_used(cluster_t *cluster, uint64_t value)
 
 } /* attribute */
 } /* software_diagnostics */
+#endif // ESP_MATTER_CLUSTER_SELECTED(software_diagnostics)
 
+#if ESP_MATTER_CLUSTER_SELECTED(administrator_commissioning)
 namespace administrator_commissioning {
 namespace attribute {
 
@@ -610,7 +632,9 @@ attribute_t *create_admin_vendor_id(cluster_t *cluster, uint16_t value)
 
 } /* attribute */
 } /* administrator_commissioning */
+#endif // ESP_MATTER_CLUSTER_SELECTED(administrator_commissioning)
 
+#if ESP_MATTER_CLUSTER_SELECTED(operational_credentials)
 namespace operational_credentials {
 namespace attribute {
 
@@ -652,7 +676,9 @@ attribute_t *create_current_fabric_index(cluster_t *cluster, uint8_t value)
 
 } /* attribute */
 } /* operational_credentials */
+#endif // ESP_MATTER_CLUSTER_SELECTED(operational_credentials)
 
+#if ESP_MATTER_CLUSTER_SELECTED(group_key_management)
 namespace group_key_management {
 namespace attribute {
 
@@ -683,7 +709,9 @@ attribute_t *create_max_group_keys_per_fabric(cluster_t *cluster, uint16_t value
 
 } /* attribute */
 } /* group_key_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(group_key_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(icd_management)
 namespace icd_management {
 namespace attribute {
 attribute_t *create_idle_mode_duration(cluster_t *cluster, uint32_t value)
@@ -753,7 +781,9 @@ attribute_t *create_maximum_check_in_backoff(cluster_t *cluster, uint32_t value)
 
 } /* attribute */
 } /* icd_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(icd_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(wifi_network_diagnostics)
 namespace wifi_network_diagnostics {
 namespace attribute {
 
@@ -837,7 +867,9 @@ attribute_t *create_overrun_count(cluster_t *cluster, nullable<uint64_t> value)
 
 } /* attribute */
 } /* wifi_network_diagnostics */
+#endif // ESP_MATTER_CLUSTER_SELECTED(wifi_network_diagnostics)
 
+#if ESP_MATTER_CLUSTER_SELECTED(thread_network_diagnostics)
 namespace thread_network_diagnostics {
 namespace attribute {
 
@@ -1244,7 +1276,9 @@ attribute_t *create_delay(cluster_t *cluster, nullable<uint32_t> value)
 
 } /* attribute */
 } /* thread_network_diagnostics */
+#endif // ESP_MATTER_CLUSTER_SELECTED(thread_network_diagnostics)
 
+#if ESP_MATTER_CLUSTER_SELECTED(ethernet_network_diagnostics)
 namespace ethernet_network_diagnostics {
 namespace attribute {
 
@@ -1304,7 +1338,9 @@ attribute_t *create_time_since_reset(cluster_t *cluster, uint64_t value)
 
 } /* attribute */
 } /* ethernet_network_diagnostics */
+#endif // ESP_MATTER_CLUSTER_SELECTED(ethernet_network_diagnostics)
 
+#if ESP_MATTER_CLUSTER_SELECTED(bridged_device_basic_information)
 namespace bridged_device_basic_information {
 namespace attribute {
 
@@ -1420,7 +1456,9 @@ attribute_t *create_configuration_version(cluster_t *cluster, uint32_t value)
 
 } /* attribute */
 } /* bridged_device_basic_information */
+#endif // ESP_MATTER_CLUSTER_SELECTED(bridged_device_basic_information)
 
+#if ESP_MATTER_CLUSTER_SELECTED(user_label)
 namespace user_label {
 namespace attribute {
 
@@ -1433,7 +1471,9 @@ attribute_t *create_label_list(cluster_t *cluster, uint8_t *value, uint16_t leng
 
 } /* attribute */
 } /* user_label */
+#endif // ESP_MATTER_CLUSTER_SELECTED(user_label)
 
+#if ESP_MATTER_CLUSTER_SELECTED(fixed_label)
 namespace fixed_label {
 namespace attribute {
 
@@ -1445,7 +1485,9 @@ attribute_t *create_label_list(cluster_t *cluster, uint8_t *value, uint16_t leng
 
 } /* attribute */
 } /* fixed_label */
+#endif // ESP_MATTER_CLUSTER_SELECTED(fixed_label)
 
+#if ESP_MATTER_CLUSTER_SELECTED(identify)
 namespace identify {
 namespace attribute {
 
@@ -1463,7 +1505,9 @@ attribute_t *create_identify_type(cluster_t *cluster, uint8_t value)
 
 } /* attribute */
 } /* identify */
+#endif // ESP_MATTER_CLUSTER_SELECTED(identify)
 
+#if ESP_MATTER_CLUSTER_SELECTED(groups)
 namespace groups {
 namespace attribute {
 
@@ -1475,7 +1519,9 @@ attribute_t *create_name_support(cluster_t *cluster, uint8_t value)
 
 } /* attribute */
 } /* groups */
+#endif // ESP_MATTER_CLUSTER_SELECTED(groups)
 
+#if ESP_MATTER_CLUSTER_SELECTED(scenes_management)
 namespace scenes_management {
 namespace attribute {
 attribute_t *create_scene_table_size(cluster_t *cluster, uint16_t value)
@@ -1492,7 +1538,9 @@ attribute_t *create_fabric_scene_info(cluster_t *cluster, const uint8_t * value,
 
 } /* attribute */
 } /* scenes_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(scenes_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(on_off)
 namespace on_off {
 namespace attribute {
 
@@ -1531,7 +1579,9 @@ attribute_t *create_start_up_on_off(cluster_t *cluster, nullable<uint8_t> value)
 
 } /* attribute */
 } /* on_off */
+#endif // ESP_MATTER_CLUSTER_SELECTED(on_off)
 
+#if ESP_MATTER_CLUSTER_SELECTED(level_control)
 namespace level_control {
 namespace attribute {
 
@@ -1627,7 +1677,9 @@ attribute_t *create_start_up_current_level(cluster_t *cluster, nullable<uint8_t>
 
 } /* attribute */
 } /* level_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(level_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(color_control)
 namespace color_control {
 namespace attribute {
 
@@ -1873,7 +1925,9 @@ attribute_t *create_primary_n_intensity(cluster_t *cluster, nullable<uint8_t> va
 
 } /* attribute */
 } /* color_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(color_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(fan_control)
 namespace fan_control {
 namespace attribute {
 
@@ -1950,7 +2004,9 @@ attribute_t *create_airflow_direction(cluster_t *cluster, uint8_t value)
 
 } /* attribute */
 } /* fan_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(fan_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(thermostat)
 namespace thermostat {
 namespace attribute {
 
@@ -2303,7 +2359,9 @@ attribute_t *create_setpoint_hold_expiry_timestamp(cluster_t *cluster, nullable<
 
 } /* attribute */
 } /* thermostat */
+#endif // ESP_MATTER_CLUSTER_SELECTED(thermostat)
 
+#if ESP_MATTER_CLUSTER_SELECTED(thermostat_user_interface_configuration)
 namespace thermostat_user_interface_configuration {
 namespace attribute {
 
@@ -2327,7 +2385,9 @@ attribute_t *create_schedule_programming_visibility(cluster_t *cluster, uint8_t
 
 } /* attribute */
 } /* thermostat_user_interface_configuration */
+#endif // ESP_MATTER_CLUSTER_SELECTED(thermostat_user_interface_configuration)
 
+#if ESP_MATTER_CLUSTER_SELECTED(air_quality)
 namespace air_quality {
 namespace attribute {
 
@@ -2339,7 +2399,9 @@ attribute_t *create_air_quality(cluster_t *cluster, uint8_t value)
 
 } /* attribute */
 } /* air_quality */
+#endif // ESP_MATTER_CLUSTER_SELECTED(air_quality)
 
+#if ESP_MATTER_CLUSTER_SELECTED(resource_monitoring)
 namespace resource_monitoring {
 namespace attribute {
 
@@ -2382,7 +2444,9 @@ attribute_t *create_replacement_product_list(cluster_t *cluster, uint8_t *value,
 
 } /* attribute */
 } /* resource_monitoring */
+#endif // ESP_MATTER_CLUSTER_SELECTED(resource_monitoring)
 
+#if ESP_MATTER_CLUSTER_SELECTED(concentration_measurement)
 namespace concentration_measurement {
 namespace attribute {
 attribute_t *create_measured_value(cluster_t *cluster, nullable<float> value)
@@ -2453,7 +2517,9 @@ attribute_t *create_level_value(cluster_t *cluster, uint8_t value)
 
 } /* attribute */
 } /* concentration_measurement */
+#endif // ESP_MATTER_CLUSTER_SELECTED(concentration_measurement)
 
+#if ESP_MATTER_CLUSTER_SELECTED(operational_state)
 namespace operational_state {
 namespace attribute {
 attribute_t *create_phase_list(cluster_t *cluster, uint8_t *value, uint16_t length, uint16_t count)
@@ -2494,7 +2560,9 @@ attribute_t *create_operational_error(cluster_t *cluster, uint8_t *value, uint16
 
 } /* attribute */
 } /* operational_state */
+#endif // ESP_MATTER_CLUSTER_SELECTED(operational_state)
 
+#if ESP_MATTER_CLUSTER_SELECTED(laundry_washer_controls)
 namespace laundry_washer_controls {
 namespace attribute {
 
@@ -2525,7 +2593,9 @@ attribute_t *create_supported_rinses(cluster_t *cluster, uint8_t *value, uint16_
 }
 } /* attribute */
 } /* laundry_washer_controls */
+#endif // ESP_MATTER_CLUSTER_SELECTED(laundry_washer_controls)
 
+#if ESP_MATTER_CLUSTER_SELECTED(laundry_dryer_controls)
 namespace laundry_dryer_controls {
 namespace attribute {
 attribute_t *create_supported_dryness_levels(cluster_t *cluster, uint8_t *value, uint16_t length, uint16_t count)
@@ -2543,7 +2613,9 @@ attribute_t *create_selected_dryness_level(cluster_t *cluster, nullable<uint8_t>
 
 } /* attribute */
 } /* laundry_dryer_controls */
+#endif // ESP_MATTER_CLUSTER_SELECTED(laundry_dryer_controls)
 
+#if ESP_MATTER_CLUSTER_SELECTED(smoke_co_alarm)
 namespace smoke_co_alarm {
 namespace attribute {
 attribute_t *create_expressed_state(cluster_t *cluster, uint8_t value)
@@ -2626,7 +2698,9 @@ attribute_t *create_expiry_date(cluster_t *cluster, uint32_t value)
 
 } /* attribute */
 } /* smoke_co_alarm */
+#endif // ESP_MATTER_CLUSTER_SELECTED(smoke_co_alarm)
 
+#if ESP_MATTER_CLUSTER_SELECTED(door_lock)
 namespace door_lock {
 namespace attribute {
 
@@ -2932,7 +3006,9 @@ attribute_t *create_number_of_aliro_endpoint_keys_supported(cluster_t *cluster,
 
 } /* attribute */
 } /* door_lock */
+#endif // ESP_MATTER_CLUSTER_SELECTED(door_lock)
 
+#if ESP_MATTER_CLUSTER_SELECTED(window_covering)
 namespace window_covering {
 namespace attribute {
 
@@ -3026,7 +3102,9 @@ attribute_t *create_safety_status(cluster_t *cluster, uint16_t value)
 
 } /* attribute */
 } /* window_covering */
+#endif // ESP_MATTER_CLUSTER_SELECTED(window_covering)
 
+#if ESP_MATTER_CLUSTER_SELECTED(switch_cluster)
 namespace switch_cluster {
 namespace attribute {
 
@@ -3050,6 +3128,7 @@ attribute_t *create_multi_press_max(cluster_t *cluster, uint8_t value)
 
 } /* attribute */
 } /* switch_cluster */
+#endif // ESP_MATTER_CLUSTER_SELECTED(switch_cluster)
 
 namespace temperature_measurement {
 namespace attribute {
@@ -3112,6 +3191,7 @@ attribute_t *create_tolerance(cluster_t *cluster, nullable<uint16_t> value)
 } /* attribute */
 } /* relative_humidity_measurement */
 
+#if ESP_MATTER_CLUSTER_SELECTED(occupancy_sensing)
 namespace occupancy_sensing {
 namespace attribute {
 
@@ -3201,7 +3281,9 @@ attribute_t *create_physical_contact_unoccupied_to_occupied_threshold(cluster_t
 
 } /* attribute */
 } /* occupancy_sensing */
+#endif // ESP_MATTER_CLUSTER_SELECTED(occupancy_sensing)
 
+#if ESP_MATTER_CLUSTER_SELECTED(boolean_state)
 namespace boolean_state {
 namespace attribute {
 
@@ -3213,7 +3295,9 @@ attribute_t *create_state_value(cluster_t *cluster, bool value)
 
 } /* attribute */
 } /* boolean_state */
+#endif // ESP_MATTER_CLUSTER_SELECTED(boolean_state)
 
+#if ESP_MATTER_CLUSTER_SELECTED(boolean_state_configuration)
 namespace boolean_state_configuration {
 namespace attribute {
 attribute_t *create_current_sensitivity_level(cluster_t *cluster, uint8_t value)
@@ -3266,7 +3350,9 @@ attribute_t *create_sensor_fault(cluster_t *cluster, uint8_t value)
 
 } /* attribute */
 } /* boolean_state_configuration */
+#endif // ESP_MATTER_CLUSTER_SELECTED(boolean_state_configuration)
 
+#if ESP_MATTER_CLUSTER_SELECTED(localization_configuration)
 namespace localization_configuration {
 namespace attribute {
 
@@ -3286,7 +3372,9 @@ attribute_t *create_supported_locales(cluster_t *cluster, uint8_t *value, uint16
 
 } /* attribute */
 } /* localization_configuration */
+#endif // ESP_MATTER_CLUSTER_SELECTED(localization_configuration)
 
+#if ESP_MATTER_CLUSTER_SELECTED(unit_localization)
 namespace unit_localization {
 namespace attribute {
 
@@ -3305,7 +3393,9 @@ attribute_t *create_supported_temperature_units(cluster_t *cluster, uint8_t *val
 
 } /* attribute */
 } /* unit_localization */
+#endif // ESP_MATTER_CLUSTER_SELECTED(unit_localization)
 
+#if ESP_MATTER_CLUSTER_SELECTED(time_format_localization)
 namespace time_format_localization {
 namespace attribute {
 
@@ -3331,6 +3421,7 @@ attribute_t *create_supported_calendar_types(cluster_t *cluster, uint8_t *value,
 
 } /* attribute */
 } /* time_format_localization */
+#endif // ESP_MATTER_CLUSTER_SELECTED(time_format_localization)
 
 namespace illuminance_measurement {
 namespace attribute {
@@ -3463,6 +3554,7 @@ attribute_t *create_tolerance(cluster_t *cluster, uint16_t value, uint16_t min,
 } /* attribute */
 } /* flow_measurement */
 
+#if ESP_MATTER_CLUSTER_SELECTED(pump_configuration_and_control)
 namespace pump_configuration_and_control {
 namespace attribute {
 
@@ -3582,7 +3674,9 @@ attribute_t *create_control_mode(cluster_t *cluster, uint8_t value)
 }
 } /* attribute */
 } /* pump_configuration_and_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(pump_configuration_and_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(mode_select)
 namespace mode_select {
 namespace attribute {
 
@@ -3621,7 +3715,9 @@ attribute_t *create_on_mode(cluster_t *cluster, nullable<uint8_t> value)
 
 } /* attribute */
 } /* mode_select */
+#endif // ESP_MATTER_CLUSTER_SELECTED(mode_select)
 
+#if ESP_MATTER_CLUSTER_SELECTED(power_source)
 namespace power_source {
 namespace attribute {
 
@@ -3843,7 +3939,9 @@ attribute_t *create_endpoint_list(cluster_t *cluster, uint8_t * value, uint16_t
 
 } /* attribute */
 } /* power_source */
+#endif // ESP_MATTER_CLUSTER_SELECTED(power_source)
 
+#if ESP_MATTER_CLUSTER_SELECTED(temperature_control)
 namespace temperature_control {
 namespace attribute {
 attribute_t *create_temperature_setpoint(cluster_t *cluster, int16_t value)
@@ -3879,7 +3977,9 @@ attribute_t *create_supported_temperature_levels(cluster_t *cluster, uint8_t * v
 
 } /* attribute */
 } /* temperature_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(temperature_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(refrigerator_alarm)
 namespace refrigerator_alarm {
 namespace attribute {
 attribute_t *create_mask(cluster_t *cluster, uint32_t value)
@@ -3899,7 +3999,9 @@ attribute_t *create_supported(cluster_t *cluster, uint32_t value)
 
 } /* attribute */
 } /* refrigerator_alarm */
+#endif // ESP_MATTER_CLUSTER_SELECTED(refrigerator_alarm)
 
+#if ESP_MATTER_CLUSTER_SELECTED(mode_base)
 namespace mode_base {
 namespace attribute {
 
@@ -3924,7 +4026,9 @@ attribute_t *create_on_mode(cluster_t *cluster, nullable<uint8_t> value)
 }
 } /* attribute */
 } /* mode_base */
+#endif // ESP_MATTER_CLUSTER_SELECTED(mode_base)
 
+#if ESP_MATTER_CLUSTER_SELECTED(power_topology)
 namespace power_topology {
 namespace attribute {
 
@@ -3940,7 +4044,9 @@ attribute_t *create_active_endpoints(cluster_t *cluster, const uint8_t * value,
 
 } /* attribute */
 } /* power_topology */
+#endif // ESP_MATTER_CLUSTER_SELECTED(power_topology)
 
+#if ESP_MATTER_CLUSTER_SELECTED(electrical_power_measurement)
 namespace electrical_power_measurement {
 namespace attribute {
 attribute_t *create_power_mode(cluster_t *cluster, uint8_t value)
@@ -4040,7 +4146,9 @@ attribute_t *create_neutral_current(cluster_t *cluster, nullable<int64_t> value)
 
 } /* attribute */
 } /* electrical_power_measurement */
+#endif // ESP_MATTER_CLUSTER_SELECTED(electrical_power_measurement)
 
+#if ESP_MATTER_CLUSTER_SELECTED(electrical_energy_measurement)
 namespace electrical_energy_measurement {
 namespace attribute {
 attribute_t *create_accuracy(cluster_t *cluster, const uint8_t* value, uint16_t length, uint16_t count)
@@ -4081,7 +4189,9 @@ attribute_t *create_cumulative_energy_reset(cluster_t *cluster, const uint8_t* v
 
 } /* attribute */
 } /* electrical_energy_measurement */
+#endif // ESP_MATTER_CLUSTER_SELECTED(electrical_energy_measurement)
 
+#if ESP_MATTER_CLUSTER_SELECTED(energy_evse)
 namespace energy_evse {
 namespace attribute {
 
@@ -4203,7 +4313,9 @@ attribute_t *create_session_energy_discharged(cluster_t *cluster, nullable<int64
 
 } /* attribute */
 } /* energy_evse */
+#endif // ESP_MATTER_CLUSTER_SELECTED(energy_evse)
 
+#if ESP_MATTER_CLUSTER_SELECTED(microwave_oven_control)
 namespace microwave_oven_control {
 namespace attribute {
 attribute_t *create_cook_time(cluster_t *cluster, uint32_t value)
@@ -4253,7 +4365,9 @@ attribute_t *create_watt_rating(cluster_t *cluster, uint16_t value)
 
 } /* attribute */
 } /* microwave_oven_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(microwave_oven_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(valve_configuration_and_control)
 namespace valve_configuration_and_control {
 namespace attribute {
 attribute_t *create_open_duration(cluster_t *cluster, nullable<uint32_t> value)
@@ -4313,7 +4427,9 @@ attribute_t *create_level_step(cluster_t *cluster, const uint8_t value)
 
 } /* attribute */
 } /* valve_configuration_and_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(valve_configuration_and_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(device_energy_management)
 namespace device_energy_management {
 namespace attribute {
 attribute_t *create_esa_type(cluster_t *cluster, const uint8_t value)
@@ -4358,7 +4474,9 @@ attribute_t *create_opt_out_state(cluster_t *cluster, uint8_t value)
 
 } /* attribute */
 } /* device_energy_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(device_energy_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(application_basic)
 namespace application_basic {
 namespace attribute {
 attribute_t *create_vendor_name(cluster_t *cluster, char *value, uint16_t length)
@@ -4414,7 +4532,9 @@ attribute_t *create_allowed_vendor_list(cluster_t *cluster, uint8_t *value, uint
 
 } /* attribute */
 } /* application_basic */
+#endif // ESP_MATTER_CLUSTER_SELECTED(application_basic)
 
+#if ESP_MATTER_CLUSTER_SELECTED(thread_border_router_management)
 namespace thread_border_router_management {
 namespace attribute {
 
@@ -4456,7 +4576,9 @@ attribute_t *create_pending_dataset_timestamp(cluster_t *cluster, nullable<uint6
 
 } /* attribute */
 } /* thread_border_router_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(thread_border_router_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(wifi_network_management)
 namespace wifi_network_management {
 namespace attribute {
 attribute_t *create_ssid(cluster_t *cluster, uint8_t *value, uint16_t length)
@@ -4473,7 +4595,9 @@ attribute_t *create_passphrase_surrogate(cluster_t *cluster, nullable<uint64_t>
 
 } /* attribute */
 } /* wifi_network_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(wifi_network_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(thread_network_directory)
 namespace thread_network_directory {
 namespace attribute {
 attribute_t *create_preferred_extended_pan_id(cluster_t *cluster, uint8_t *value, uint16_t length)
@@ -4496,7 +4620,9 @@ attribute_t *create_thread_network_table_size(cluster_t *cluster, uint8_t value)
 
 } /* attribute */
 } /* thread_network_directory */
+#endif // ESP_MATTER_CLUSTER_SELECTED(thread_network_directory)
 
+#if ESP_MATTER_CLUSTER_SELECTED(service_area)
 namespace service_area {
 namespace attribute {
 attribute_t *create_supported_areas(cluster_t *cluster, uint8_t *value, uint16_t length, uint16_t count)
@@ -4537,7 +4663,9 @@ attribute_t *create_progress(cluster_t *cluster, uint8_t *value, uint16_t length
 
 } /* attribute */
 } /* service_area */
+#endif // ESP_MATTER_CLUSTER_SELECTED(service_area)
 
+#if ESP_MATTER_CLUSTER_SELECTED(water_heater_management)
 namespace water_heater_management {
 namespace attribute {
 attribute_t *create_heater_types(cluster_t *cluster, uint8_t value)
@@ -4578,7 +4706,9 @@ attribute_t *create_boost_state(cluster_t *cluster, uint8_t value)
 
 } /* attribute */
 } /* water_heater_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(water_heater_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(energy_preference)
 namespace energy_preference {
 namespace attribute {
 attribute_t *create_energy_balances(cluster_t *cluster, uint8_t *value, uint16_t length, uint16_t count)
@@ -4613,7 +4743,9 @@ attribute_t *create_current_low_power_mode_sensitivity(cluster_t *cluster, uint8
 
 } /* attribute */
 } /* energy_preference */
+#endif // ESP_MATTER_CLUSTER_SELECTED(energy_preference)
 
+#if ESP_MATTER_CLUSTER_SELECTED(commissioner_control)
 namespace commissioner_control {
 namespace attribute {
 attribute_t *create_supported_device_categories(cluster_t *cluster, uint32_t value)
@@ -4624,7 +4756,9 @@ attribute_t *create_supported_device_categories(cluster_t *cluster, uint32_t val
 
 } /* attribute */
 } /* commissioner_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(commissioner_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(ecosystem_information)
 namespace ecosystem_information {
 namespace attribute {
 attribute_t *create_device_directory(cluster_t *cluster, uint8_t *value, uint16_t length, uint16_t count)
@@ -4641,7 +4775,9 @@ attribute_t *create_location_directory(cluster_t *cluster, uint8_t *value, uint1
 
 } /* attribute */
 } /* ecosystem_information */
+#endif // ESP_MATTER_CLUSTER_SELECTED(ecosystem_information)
 
+#if ESP_MATTER_CLUSTER_SELECTED(time_synchronization)
 namespace time_synchronization {
 namespace attribute {
 attribute_t *create_utc_time(cluster_t *cluster, nullable<uint64_t> value)
@@ -4730,7 +4866,9 @@ attribute_t *create_supports_dns_resolve(cluster_t *cluster, bool value)
 
 } /* attribute */
 } /* time_synchronization */
+#endif // ESP_MATTER_CLUSTER_SELECTED(time_synchronization)
 
+#if ESP_MATTER_CLUSTER_SELECTED(camera_av_stream_management)
 namespace camera_av_stream_management {
 namespace attribute {
 attribute_t *create_max_concurrent_encoders(cluster_t *cluster, uint8_t value)
@@ -4899,7 +5037,9 @@ attribute_t *create_status_light_brightness(cluster_t *cluster, uint8_t value)
 }
 } /* attribute */
 } /*Camera Av Stream management*/
+#endif // ESP_MATTER_CLUSTER_SELECTED(camera_av_stream_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(webrtc_transport_provider)
 namespace webrtc_transport_provider {
 namespace attribute {
 attribute_t *create_current_sessions(cluster_t *cluster, uint8_t *value, uint16_t length, uint16_t count)
@@ -4908,7 +5048,9 @@ attribute_t *create_current_sessions(cluster_t *cluster, uint8_t *value, uint16_
 }
 } /* attribute */
 }/*webrtc transport provider*/
+#endif // ESP_MATTER_CLUSTER_SELECTED(webrtc_transport_provider)
 
+#if ESP_MATTER_CLUSTER_SELECTED(webrtc_transport_requestor)
 namespace webrtc_transport_requestor {
 namespace attribute {
 attribute_t *create_current_sessions(cluster_t *cluster, uint8_t *value, uint16_t length, uint16_t count)
@@ -4917,7 +5059,9 @@ attribute_t *create_current_sessions(cluster_t *cluster, uint8_t *value, uint16_
 }
 } /* attribute */
 }/*webrtc transport requestor*/
+#endif // ESP_MATTER_CLUSTER_SELECTED(webrtc_transport_requestor)
 
+#if ESP_MATTER_CLUSTER_SELECTED(chime)
 namespace chime {
 namespace attribute {
 attribute_t *create_installed_chime_sounds(cluster_t *cluster, uint8_t *value, uint16_t length, uint16_t count)
@@ -4941,7 +5085,9 @@ attribute_t *create_enabled(cluster_t *cluster, bool value)
 } /* attribute */
 
 } /* chime */
+#endif // ESP_MATTER_CLUSTER_SELECTED(chime)
 
+#if ESP_MATTER_CLUSTER_SELECTED(closure_control)
 namespace closure_control {
 namespace attribute {
 attribute_t *create_countdown_time(cluster_t *cluster, nullable<uint32_t> value)
@@ -4983,7 +5129,9 @@ attribute_t *create_latch_control_modes(cluster_t *cluster, uint8_t value)
 } /* attribute */
 
 } /* closure_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(closure_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(closure_dimension)
 namespace closure_dimension {
 namespace attribute {
 attribute_t *create_current_state(cluster_t *cluster, uint8_t *value, uint16_t length, uint16_t count)
@@ -5061,7 +5209,9 @@ attribute_t *create_latch_control_modes(cluster_t *cluster, uint8_t value)
 } /* attribute */
 
 } /* closure_dimension */
+#endif // ESP_MATTER_CLUSTER_SELECTED(closure_dimension)
 
+#if ESP_MATTER_CLUSTER_SELECTED(camera_av_settings_user_level_management)
 namespace camera_av_settings_user_level_management {
 namespace attribute {
 attribute_t *create_mptz_position(cluster_t *cluster, uint8_t *value, uint16_t length, uint16_t count)
@@ -5127,7 +5277,9 @@ attribute_t *create_movement_state(cluster_t *cluster, uint8_t value)
 } /* attribute */
 
 } /* camera_av_settings_user_level_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(camera_av_settings_user_level_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(push_av_stream_transport)
 namespace push_av_stream_transport {
 namespace attribute {
 attribute_t *create_supported_formats(cluster_t *cluster, uint8_t *value, uint16_t length, uint16_t count)
@@ -5145,7 +5297,9 @@ attribute_t *create_current_connections(cluster_t *cluster, uint8_t *value, uint
 } /* attribute */
 
 } /* push_av_stream_transport */
+#endif // ESP_MATTER_CLUSTER_SELECTED(push_av_stream_transport)
 
+#if ESP_MATTER_CLUSTER_SELECTED(commodity_tariff)
 namespace commodity_tariff {
 namespace attribute {
 attribute_t *create_tariff_info(cluster_t *cluster, uint8_t *value, uint16_t length, uint16_t count)
@@ -5264,7 +5418,9 @@ attribute_t *create_default_randomization_type(cluster_t *cluster, nullable<uint
 
 } /* attribute */
 } /* commodity_tariff */
+#endif // ESP_MATTER_CLUSTER_SELECTED(commodity_tariff)
 
+#if ESP_MATTER_CLUSTER_SELECTED(commodity_price)
 namespace commodity_price {
 namespace attribute {
 attribute_t *create_tariff_unit(cluster_t *cluster, uint8_t value)
@@ -5293,7 +5449,9 @@ attribute_t *create_price_forecast(cluster_t *cluster, uint8_t *value, uint16_t
 
 } /* attribute */
 } /* commodity_price */
+#endif // ESP_MATTER_CLUSTER_SELECTED(commodity_price)
 
+#if ESP_MATTER_CLUSTER_SELECTED(commodity_metering)
 namespace commodity_metering {
 namespace attribute {
 attribute_t *create_metered_quantity(cluster_t *cluster, uint8_t *value, uint16_t length, uint16_t count)
@@ -5323,7 +5481,9 @@ attribute_t *create_maximum_metered_quantities(cluster_t *cluster, nullable<uint
 } /* attribute */
 
 } /* commodity_metering */
+#endif // ESP_MATTER_CLUSTER_SELECTED(commodity_metering)
 
+#if ESP_MATTER_CLUSTER_SELECTED(electrical_grid_conditions)
 namespace electrical_grid_conditions {
 namespace attribute {
 attribute_t *create_local_generation_available(cluster_t *cluster, nullable<bool> value)
@@ -5347,7 +5507,9 @@ attribute_t *create_forecast_conditions(cluster_t *cluster, uint8_t *value, uint
 } /* attribute */
 
 } /* electrical_grid_conditions */
+#endif // ESP_MATTER_CLUSTER_SELECTED(electrical_grid_conditions)
 
+#if ESP_MATTER_CLUSTER_SELECTED(meter_identification)
 namespace meter_identification {
 namespace attribute {
 attribute_t *create_meter_type(cluster_t *cluster, nullable<uint8_t> value)
@@ -5383,7 +5545,9 @@ attribute_t *create_power_threshold(cluster_t *cluster, uint8_t *value, uint16_t
 } /* attribute */
 
 } /* meter_identification */
+#endif // ESP_MATTER_CLUSTER_SELECTED(meter_identification)
 
+#if ESP_MATTER_CLUSTER_SELECTED(soil_measurement)
 namespace soil_measurement {
 namespace attribute {
 attribute_t *create_soil_moisture_measurement_limits(cluster_t *cluster, uint8_t *value, uint16_t length, uint16_t count)
@@ -5401,7 +5565,9 @@ attribute_t *create_soil_moisture_measured_value(cluster_t *cluster, nullable<ui
 } /* attribute */
 
 } /* soil_measurement */
+#endif // ESP_MATTER_CLUSTER_SELECTED(soil_measurement)
 
+#if ESP_MATTER_CLUSTER_SELECTED(zone_management)
 namespace zone_management {
 namespace attribute {
 attribute_t *create_max_user_defined_zones(cluster_t *cluster, uint8_t value)
@@ -5449,6 +5615,7 @@ attribute_t *create_two_d_cartesian_max(cluster_t *cluster, uint8_t *value, uint
 } /* attribute */
 
 } /* zone_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(zone_management)
 
 } /* cluster */
 } /* esp_matter */
@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <esp_log.h>
 #include <esp_matter.h>
+#include <esp_matter_attr_val_codec.h>
 #include <esp_matter_attribute_utils.h>
 #include <esp_matter_console.h>
 #include <esp_matter_core.h>
@@ -522,50 +523,7 @@ namespace attribute {
 
 bool val_is_null(esp_matter_attr_val_t *val)
 {
-    switch (val->type) {
-    case ESP_MATTER_VAL_TYPE_NULLABLE_BOOLEAN:
-        return chip::app::NumericAttributeTraits<bool>::IsNullValue(*(uint8_t *)(&(val->val.b)));
-        break;
-    case ESP_MATTER_VAL_TYPE_NULLABLE_INTEGER:
-        return chip::app::NumericAttributeTraits<int>::IsNullValue(val->val.i);
-        break;
-    case ESP_MATTER_VAL_TYPE_NULLABLE_UINT8:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_ENUM8:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_BITMAP8:
-        return chip::app::NumericAttributeTraits<uint8_t>::IsNullValue(val->val.u8);
-        break;
-    case ESP_MATTER_VAL_TYPE_NULLABLE_UINT16:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_ENUM16:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_BITMAP16:
-        return chip::app::NumericAttributeTraits<uint16_t>::IsNullValue(val->val.u16);
-        break;
-    case ESP_MATTER_VAL_TYPE_NULLABLE_UINT32:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_BITMAP32:
-        return chip::app::NumericAttributeTraits<uint32_t>::IsNullValue(val->val.u32);
-        break;
-    case ESP_MATTER_VAL_TYPE_NULLABLE_UINT64:
-        return chip::app::NumericAttributeTraits<uint64_t>::IsNullValue(val->val.u64);
-        break;
-    case ESP_MATTER_VAL_TYPE_NULLABLE_INT8:
-        return chip::app::NumericAttributeTraits<int8_t>::IsNullValue(val->val.i8);
-        break;
-    case ESP_MATTER_VAL_TYPE_NULLABLE_INT16:
-        return chip::app::NumericAttributeTraits<int16_t>::IsNullValue(val->val.i16);
-        break;
-    case ESP_MATTER_VAL_TYPE_NULLABLE_INT32:
-        return chip::app::NumericAttributeTraits<int32_t>::IsNullValue(val->val.i32);
-        break;
-    case ESP_MATTER_VAL_TYPE_NULLABLE_INT64:
-        return chip::app::NumericAttributeTraits<int64_t>::IsNullValue(val->val.i64);
-        break;
-    case ESP_MATTER_VAL_TYPE_NULLABLE_FLOAT:
-        return chip::app::NumericAttributeTraits<float>::IsNullValue(val->val.f);
-        break;
-    default:
-        return false;
-        break;
-    }
-    return false;
+    return codec::is_null(*val);
 }
 
 void val_print(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id, esp_matter_attr_val_t *val, bool is_read)
@@ -672,61 +630,7 @@ bool val_compare(const esp_matter_attr_val_t *val1, const esp_matter_attr_val_t
     if (val1->type != val2->type) {
         return false;
     }
-    switch ((val1->type & (~ESP_MATTER_VAL_NULLABLE_BASE))) {
-    case ESP_MATTER_VAL_TYPE_CHAR_STRING:
-    case ESP_MATTER_VAL_TYPE_OCTET_STRING:
-    case ESP_MATTER_VAL_TYPE_LONG_CHAR_STRING:
-    case ESP_MATTER_VAL_TYPE_LONG_OCTET_STRING: {
-        uint16_t null_len =
-            (val1->type == ESP_MATTER_VAL_TYPE_CHAR_STRING || val1->type == ESP_MATTER_VAL_TYPE_OCTET_STRING) ? UINT8_MAX : UINT16_MAX;
-        if (val1->val.a.s != val2->val.a.s) {
-            return false;
-        }
-        if (val1->val.a.s == null_len || val1->val.a.s == 0) {
-            return true;
-        }
-        return memcmp(val1->val.a.b, val2->val.a.b, val1->val.a.s) == 0;
-        break;
-    }
-    case ESP_MATTER_VAL_TYPE_UINT8:
-    case ESP_MATTER_VAL_TYPE_ENUM8:
-    case ESP_MATTER_VAL_TYPE_BITMAP8:
-        return val1->val.u8 == val2->val.u8;
-        break;
-    case ESP_MATTER_VAL_TYPE_UINT16:
-    case ESP_MATTER_VAL_TYPE_ENUM16:
-    case ESP_MATTER_VAL_TYPE_BITMAP16:
-        return val1->val.u16 == val2->val.u16;
-        break;
-    case ESP_MATTER_VAL_TYPE_UINT32:
-    case ESP_MATTER_VAL_TYPE_BITMAP32:
-        return val1->val.u32 == val2->val.u32;
-        break;
-    case ESP_MATTER_VAL_TYPE_UINT64:
-        return val1->val.u64 == val2->val.u64;
-        break;
-    case ESP_MATTER_VAL_TYPE_INT8:
-        return val1->val.i8 == val2->val.i8;
-        break;
-    case ESP_MATTER_VAL_TYPE_INT16:
-        return val1->val.i16 == val2->val.i16;
-        break;
-    case ESP_MATTER_VAL_TYPE_INT32:
-        return val1->val.i32 == val2->val.i32;
-        break;
-    case ESP_MATTER_VAL_TYPE_INT64:
-        return val1->val.i64 == val2->val.i64;
-        break;
-    case ESP_MATTER_VAL_TYPE_BOOLEAN:
-        return val1->val.b == val2->val.b;
-        break;
-    case ESP_MATTER_VAL_TYPE_FLOAT:
-        return val1->val.f == val2->val.f;
-        break;
-    default:
-        ESP_LOGE(TAG, "Unsupported type to compare");
-    }
-    return false;
+    return codec::equal(*val1, *val2);
 }
 
 } /* attribute */
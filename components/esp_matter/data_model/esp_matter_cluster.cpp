@@ -23,6 +23,7 @@
 #include <esp_matter_delegate_callbacks.h>
 #include <esp_matter_cluster_revisions.h>
 #include <esp_matter_attribute_bounds.h>
+#include <cluster_select/esp_matter_cluster_select.h>
 
 #include <app-common/zap-generated/callback.h>
 #include <app-common/zap-generated/cluster-enums.h>
@@ -123,6 +124,7 @@ cluster_t *create_default_binding_cluster(endpoint_t *endpoint)
     return binding::create(endpoint, &config, CLUSTER_FLAG_SERVER);
 }
 
+#if ESP_MATTER_CLUSTER_SELECTED(descriptor)
 namespace descriptor {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -154,7 +156,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* descriptor */
+#endif // ESP_MATTER_CLUSTER_SELECTED(descriptor)
 
+#if ESP_MATTER_CLUSTER_SELECTED(actions)
 namespace actions {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -188,7 +192,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* actions */
+#endif // ESP_MATTER_CLUSTER_SELECTED(actions)
 
+#if ESP_MATTER_CLUSTER_SELECTED(access_control)
 namespace access_control {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -222,7 +228,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* access_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(access_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(basic_information)
 namespace basic_information {
 const function_generic_t * function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -272,7 +280,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* basic_information */
+#endif // ESP_MATTER_CLUSTER_SELECTED(basic_information)
 
+#if ESP_MATTER_CLUSTER_SELECTED(binding)
 namespace binding {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -300,7 +310,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* binding */
+#endif // ESP_MATTER_CLUSTER_SELECTED(binding)
 
+#if ESP_MATTER_CLUSTER_SELECTED(ota_software_update_provider)
 namespace ota_software_update_provider {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -338,7 +350,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* ota_software_update_provider */
+#endif // ESP_MATTER_CLUSTER_SELECTED(ota_software_update_provider)
 
+#if ESP_MATTER_CLUSTER_SELECTED(ota_software_update_requestor)
 namespace ota_software_update_requestor {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -379,7 +393,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* ota_software_update_requestor */
+#endif // ESP_MATTER_CLUSTER_SELECTED(ota_software_update_requestor)
 
+#if ESP_MATTER_CLUSTER_SELECTED(general_commissioning)
 namespace general_commissioning {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -424,7 +440,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* general_commissioning */
+#endif // ESP_MATTER_CLUSTER_SELECTED(general_commissioning)
 
+#if ESP_MATTER_CLUSTER_SELECTED(network_commissioning)
 namespace network_commissioning {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -488,7 +506,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* network_commissioning */
+#endif // ESP_MATTER_CLUSTER_SELECTED(network_commissioning)
 
+#if ESP_MATTER_CLUSTER_SELECTED(general_diagnostics)
 namespace general_diagnostics {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -527,7 +547,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* general_diagnostics */
+#endif // ESP_MATTER_CLUSTER_SELECTED(general_diagnostics)
 
+#if ESP_MATTER_CLUSTER_SELECTED(administrator_commissioning)
 namespace administrator_commissioning {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -563,7 +585,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* administrator_commissioning */
+#endif // ESP_MATTER_CLUSTER_SELECTED(administrator_commissioning)
 
+#if ESP_MATTER_CLUSTER_SELECTED(operational_credentials)
 namespace operational_credentials {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -614,7 +638,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* operational_credentials */
+#endif // ESP_MATTER_CLUSTER_SELECTED(operational_credentials)
 
+#if ESP_MATTER_CLUSTER_SELECTED(group_key_management)
 namespace group_key_management {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -651,7 +677,9 @@ cluster_t *create(endpoint_t *endpoint, uint8_t flags)
     return cluster;
 }
 } /* group_key_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(group_key_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(wifi_network_diagnostics)
 namespace wifi_network_diagnostics {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -685,7 +713,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* wifi_network_diagnostics */
+#endif // ESP_MATTER_CLUSTER_SELECTED(wifi_network_diagnostics)
 
+#if ESP_MATTER_CLUSTER_SELECTED(thread_network_diagnostics)
 namespace thread_network_diagnostics {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -728,7 +758,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* thread_network_diagnostics */
+#endif // ESP_MATTER_CLUSTER_SELECTED(thread_network_diagnostics)
 
+#if ESP_MATTER_CLUSTER_SELECTED(ethernet_network_diagnostics)
 namespace ethernet_network_diagnostics {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -754,7 +786,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* ethernet_network_diagnostics */
+#endif // ESP_MATTER_CLUSTER_SELECTED(ethernet_network_diagnostics)
 
+#if ESP_MATTER_CLUSTER_SELECTED(time_synchronization)
 namespace time_synchronization {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -793,7 +827,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* time_synchronization */
+#endif // ESP_MATTER_CLUSTER_SELECTED(time_synchronization)
 
+#if ESP_MATTER_CLUSTER_SELECTED(unit_localization)
 namespace unit_localization {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -820,7 +856,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* unit_localization */
+#endif // ESP_MATTER_CLUSTER_SELECTED(unit_localization)
 
+#if ESP_MATTER_CLUSTER_SELECTED(bridged_device_basic_information)
 namespace bridged_device_basic_information {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -853,7 +891,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* bridged_device_basic_information */
+#endif // ESP_MATTER_CLUSTER_SELECTED(bridged_device_basic_information)
 
+#if ESP_MATTER_CLUSTER_SELECTED(power_source)
 namespace power_source {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -901,7 +941,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* power_source */
+#endif // ESP_MATTER_CLUSTER_SELECTED(power_source)
 
+#if ESP_MATTER_CLUSTER_SELECTED(icd_management)
 namespace icd_management {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -931,7 +973,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
 }
 
 } /* icd_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(icd_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(user_label)
 namespace user_label {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -960,7 +1004,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* user_label */
+#endif // ESP_MATTER_CLUSTER_SELECTED(user_label)
 
+#if ESP_MATTER_CLUSTER_SELECTED(fixed_label)
 namespace fixed_label {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -989,7 +1035,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* fixed_label */
+#endif // ESP_MATTER_CLUSTER_SELECTED(fixed_label)
 
+#if ESP_MATTER_CLUSTER_SELECTED(identify)
 namespace identify {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -1025,7 +1073,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* identify */
+#endif // ESP_MATTER_CLUSTER_SELECTED(identify)
 
+#if ESP_MATTER_CLUSTER_SELECTED(groups)
 namespace groups {
 const function_generic_t function_list[] = {
     (function_generic_t)emberAfGroupsClusterServerInitCallback,
@@ -1070,7 +1120,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* groups */
+#endif // ESP_MATTER_CLUSTER_SELECTED(groups)
 
+#if ESP_MATTER_CLUSTER_SELECTED(scenes_management)
 namespace scenes_management {
 const function_generic_t *function_list = nullptr;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -1119,7 +1171,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* scenes_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(scenes_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(on_off)
 namespace on_off {
 const function_generic_t function_list[] = {
     (function_generic_t)emberAfOnOffClusterServerInitCallback,
@@ -1156,7 +1210,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* on_off */
+#endif // ESP_MATTER_CLUSTER_SELECTED(on_off)
 
+#if ESP_MATTER_CLUSTER_SELECTED(level_control)
 namespace level_control {
 const function_generic_t function_list[] = {
     (function_generic_t)emberAfLevelControlClusterServerInitCallback,
@@ -1202,7 +1258,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* level_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(level_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(color_control)
 namespace color_control {
 const function_generic_t function_list[] = {
     (function_generic_t)emberAfColorControlClusterServerInitCallback,
@@ -1247,7 +1305,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* color_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(color_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(fan_control)
 namespace fan_control {
 const function_generic_t function_list[] = {
     (function_generic_t)MatterFanControlClusterServerAttributeChangedCallback,
@@ -1292,7 +1352,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* fan_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(fan_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(thermostat)
 namespace thermostat {
 const function_generic_t function_list[] = {
     (function_generic_t)emberAfThermostatClusterServerInitCallback,
@@ -1378,7 +1440,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* thermostat */
+#endif // ESP_MATTER_CLUSTER_SELECTED(thermostat)
 
+#if ESP_MATTER_CLUSTER_SELECTED(thermostat_user_interface_configuration)
 namespace thermostat_user_interface_configuration {
 const function_generic_t function_list[] = {
     (function_generic_t)MatterThermostatClusterServerPreAttributeChangedCallback,
@@ -1414,7 +1478,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* thermostat_user_interface_configuration */
+#endif // ESP_MATTER_CLUSTER_SELECTED(thermostat_user_interface_configuration)
 
+#if ESP_MATTER_CLUSTER_SELECTED(air_quality)
 namespace air_quality {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -1443,7 +1509,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* air_quality */
+#endif // ESP_MATTER_CLUSTER_SELECTED(air_quality)
 
+#if ESP_MATTER_CLUSTER_SELECTED(resource_monitoring)
 namespace resource_monitoring {
 typedef void (*delegate_init_cb_t)(void *, uint16_t);
 
@@ -1477,7 +1545,9 @@ static cluster_t *create(endpoint_t *endpoint, T *config, uint8_t flags, uint32_
     return cluster;
 }
 } /* resource_monitoring */
+#endif // ESP_MATTER_CLUSTER_SELECTED(resource_monitoring)
 
+#if ESP_MATTER_CLUSTER_SELECTED(hepa_filter_monitoring)
 namespace hepa_filter_monitoring {
 cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
 {
@@ -1489,7 +1559,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* hepa_filter_monitoring */
+#endif // ESP_MATTER_CLUSTER_SELECTED(hepa_filter_monitoring)
 
+#if ESP_MATTER_CLUSTER_SELECTED(activated_carbon_filter_monitoring)
 namespace activated_carbon_filter_monitoring {
 cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
 {
@@ -1501,7 +1573,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* activated_carbon_filter_monitoring */
+#endif // ESP_MATTER_CLUSTER_SELECTED(activated_carbon_filter_monitoring)
 
+#if ESP_MATTER_CLUSTER_SELECTED(concentration_measurement)
 namespace concentration_measurement {
 
 cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags, uint32_t cluster_id)
@@ -1556,7 +1630,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags, uint32_
 }
 
 } // concentration_measurement
+#endif // ESP_MATTER_CLUSTER_SELECTED(concentration_measurement)
 
+#if ESP_MATTER_CLUSTER_SELECTED(carbon_monoxide_concentration_measurement)
 namespace carbon_monoxide_concentration_measurement {
 
 cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
@@ -1565,7 +1641,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
 }
 
 } /* carbon_monoxide_concentration_measurement */
+#endif // ESP_MATTER_CLUSTER_SELECTED(carbon_monoxide_concentration_measurement)
 
+#if ESP_MATTER_CLUSTER_SELECTED(carbon_dioxide_concentration_measurement)
 namespace carbon_dioxide_concentration_measurement {
 
 cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
@@ -1574,7 +1652,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
 }
 
 } /* carbon_dioxide_concentration_measurement */
+#endif // ESP_MATTER_CLUSTER_SELECTED(carbon_dioxide_concentration_measurement)
 
+#if ESP_MATTER_CLUSTER_SELECTED(nitrogen_dioxide_concentration_measurement)
 namespace nitrogen_dioxide_concentration_measurement {
 
 cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
@@ -1583,7 +1663,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
 }
 
 } /* nitrogen_dioxide_concentration_measurement */
+#endif // ESP_MATTER_CLUSTER_SELECTED(nitrogen_dioxide_concentration_measurement)
 
+#if ESP_MATTER_CLUSTER_SELECTED(ozone_concentration_measurement)
 namespace ozone_concentration_measurement {
 
 cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
@@ -1592,7 +1674,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
 }
 
 } /* ozone_concentration_measurement */
+#endif // ESP_MATTER_CLUSTER_SELECTED(ozone_concentration_measurement)
 
+#if ESP_MATTER_CLUSTER_SELECTED(formaldehyde_concentration_measurement)
 namespace formaldehyde_concentration_measurement {
 
 cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
@@ -1601,7 +1685,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
 }
 
 } /* formaldehyde_concentration_measurement */
+#endif // ESP_MATTER_CLUSTER_SELECTED(formaldehyde_concentration_measurement)
 
+#if ESP_MATTER_CLUSTER_SELECTED(pm1_concentration_measurement)
 namespace pm1_concentration_measurement {
 
 cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
@@ -1610,7 +1696,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
 }
 
 } /* pm1_concentration_measurement */
+#endif // ESP_MATTER_CLUSTER_SELECTED(pm1_concentration_measurement)
 
+#if ESP_MATTER_CLUSTER_SELECTED(pm25_concentration_measurement)
 namespace pm25_concentration_measurement {
 
 cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
@@ -1619,7 +1707,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
 }
 
 } /* pm25_concentration_measurement */
+#endif // ESP_MATTER_CLUSTER_SELECTED(pm25_concentration_measurement)
 
+#if ESP_MATTER_CLUSTER_SELECTED(pm10_concentration_measurement)
 namespace pm10_concentration_measurement {
 
 cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
@@ -1628,7 +1718,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
 }
 
 } /* pm10_concentration_measurement */
+#endif // ESP_MATTER_CLUSTER_SELECTED(pm10_concentration_measurement)
 
+#if ESP_MATTER_CLUSTER_SELECTED(radon_concentration_measurement)
 namespace radon_concentration_measurement {
 
 cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
@@ -1637,7 +1729,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
 }
 
 } /* radon_concentration_measurement */
+#endif // ESP_MATTER_CLUSTER_SELECTED(radon_concentration_measurement)
 
+#if ESP_MATTER_CLUSTER_SELECTED(total_volatile_organic_compounds_concentration_measurement)
 namespace total_volatile_organic_compounds_concentration_measurement {
 
 cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
@@ -1645,7 +1739,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return concentration_measurement::create(endpoint, config, flags, TotalVolatileOrganicCompoundsConcentrationMeasurement::Id);
 }
 } /* total_volatile_organic_compounds_concentration_measurement */
+#endif // ESP_MATTER_CLUSTER_SELECTED(total_volatile_organic_compounds_concentration_measurement)
 
+#if ESP_MATTER_CLUSTER_SELECTED(operational_state)
 namespace operational_state {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -1684,7 +1780,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* operational_state */
+#endif // ESP_MATTER_CLUSTER_SELECTED(operational_state)
 
+#if ESP_MATTER_CLUSTER_SELECTED(laundry_washer_mode)
 namespace laundry_washer_mode {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -1720,7 +1818,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* laundry_washer_mode */
+#endif // ESP_MATTER_CLUSTER_SELECTED(laundry_washer_mode)
 
+#if ESP_MATTER_CLUSTER_SELECTED(laundry_washer_controls)
 namespace laundry_washer_controls {
 
 const function_generic_t function_list[] = {
@@ -1770,7 +1870,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* laundry_washer_controls */
+#endif // ESP_MATTER_CLUSTER_SELECTED(laundry_washer_controls)
 
+#if ESP_MATTER_CLUSTER_SELECTED(laundry_dryer_controls)
 namespace laundry_dryer_controls {
 
 const function_generic_t function_list[] = {
@@ -1810,7 +1912,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* laundry_dryer_controls */
+#endif // ESP_MATTER_CLUSTER_SELECTED(laundry_dryer_controls)
 
+#if ESP_MATTER_CLUSTER_SELECTED(dish_washer_mode)
 namespace dish_washer_mode {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -1846,7 +1950,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* dish_washer_mode */
+#endif // ESP_MATTER_CLUSTER_SELECTED(dish_washer_mode)
 
+#if ESP_MATTER_CLUSTER_SELECTED(dish_washer_alarm)
 namespace dish_washer_alarm {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -1877,7 +1983,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* dish_washer_alarm */
+#endif // ESP_MATTER_CLUSTER_SELECTED(dish_washer_alarm)
 
+#if ESP_MATTER_CLUSTER_SELECTED(smoke_co_alarm)
 namespace smoke_co_alarm {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -1929,7 +2037,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* smoke_co_alarm */
+#endif // ESP_MATTER_CLUSTER_SELECTED(smoke_co_alarm)
 
+#if ESP_MATTER_CLUSTER_SELECTED(door_lock)
 namespace door_lock {
 const function_generic_t function_list[] = {
     (function_generic_t)emberAfDoorLockClusterInitCallback,
@@ -1985,7 +2095,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* door_lock */
+#endif // ESP_MATTER_CLUSTER_SELECTED(door_lock)
 
+#if ESP_MATTER_CLUSTER_SELECTED(window_covering)
 namespace window_covering {
 const function_generic_t function_list[] = {
     (function_generic_t)MatterWindowCoveringClusterServerAttributeChangedCallback,
@@ -2052,7 +2164,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* window_covering */
+#endif // ESP_MATTER_CLUSTER_SELECTED(window_covering)
 
+#if ESP_MATTER_CLUSTER_SELECTED(switch_cluster)
 namespace switch_cluster {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -2114,6 +2228,7 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* switch_cluster */
+#endif // ESP_MATTER_CLUSTER_SELECTED(switch_cluster)
 
 namespace temperature_measurement {
 const function_generic_t *function_list = NULL;
@@ -2187,6 +2302,7 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
 }
 } /* relative_humidity_measurement */
 
+#if ESP_MATTER_CLUSTER_SELECTED(occupancy_sensing)
 namespace occupancy_sensing {
 const function_generic_t *function_list = nullptr;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -2255,7 +2371,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* occupancy_sensing */
+#endif // ESP_MATTER_CLUSTER_SELECTED(occupancy_sensing)
 
+#if ESP_MATTER_CLUSTER_SELECTED(boolean_state)
 namespace boolean_state {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -2291,7 +2409,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* boolean_state */
+#endif // ESP_MATTER_CLUSTER_SELECTED(boolean_state)
 
+#if ESP_MATTER_CLUSTER_SELECTED(boolean_state_configuration)
 namespace boolean_state_configuration {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -2326,7 +2446,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* boolean_state_configuration */
+#endif // ESP_MATTER_CLUSTER_SELECTED(boolean_state_configuration)
 
+#if ESP_MATTER_CLUSTER_SELECTED(localization_configuration)
 namespace localization_configuration {
 const function_generic_t function_list[] = {
     (function_generic_t)emberAfLocalizationConfigurationClusterServerInitCallback,
@@ -2365,7 +2487,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
 }
 
 } /* localization_configuration */
+#endif // ESP_MATTER_CLUSTER_SELECTED(localization_configuration)
 
+#if ESP_MATTER_CLUSTER_SELECTED(time_format_localization)
 namespace time_format_localization {
 const function_generic_t function_list[] = {
     (function_generic_t)emberAfTimeFormatLocalizationClusterServerInitCallback,
@@ -2402,6 +2526,7 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* time_format_localization */
+#endif // ESP_MATTER_CLUSTER_SELECTED(time_format_localization)
 
 namespace illuminance_measurement {
 const function_generic_t *function_list = NULL;
@@ -2510,6 +2635,7 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
 }
 } /* flow_measurement */
 
+#if ESP_MATTER_CLUSTER_SELECTED(pump_configuration_and_control)
 namespace pump_configuration_and_control {
 const function_generic_t function_list[] = {
     (function_generic_t)emberAfPumpConfigurationAndControlClusterServerInitCallback,
@@ -2580,7 +2706,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* pump_configuration_and_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(pump_configuration_and_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(mode_select)
 namespace mode_select {
 const function_generic_t function_list[] = {
     (function_generic_t)emberAfModeSelectClusterServerInitCallback,
@@ -2625,7 +2753,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* mode_select */
+#endif // ESP_MATTER_CLUSTER_SELECTED(mode_select)
 
+#if ESP_MATTER_CLUSTER_SELECTED(diagnostic_logs)
 namespace diagnostic_logs {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -2663,7 +2793,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* diagnostic_logs */
+#endif // ESP_MATTER_CLUSTER_SELECTED(diagnostic_logs)
 
+#if ESP_MATTER_CLUSTER_SELECTED(software_diagnostics)
 namespace software_diagnostics {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -2690,7 +2822,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* software_diagnostics */
+#endif // ESP_MATTER_CLUSTER_SELECTED(software_diagnostics)
 
+#if ESP_MATTER_CLUSTER_SELECTED(temperature_control)
 namespace temperature_control {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -2734,7 +2868,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* temperature_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(temperature_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(refrigerator_alarm)
 namespace refrigerator_alarm {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -2766,7 +2902,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* refrigerator_alarm */
+#endif // ESP_MATTER_CLUSTER_SELECTED(refrigerator_alarm)
 
+#if ESP_MATTER_CLUSTER_SELECTED(refrigerator_and_tcc_mode)
 namespace refrigerator_and_tcc_mode {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -2804,7 +2942,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* refrigerator_and_tcc_mode */
+#endif // ESP_MATTER_CLUSTER_SELECTED(refrigerator_and_tcc_mode)
 
+#if ESP_MATTER_CLUSTER_SELECTED(rvc_run_mode)
 namespace rvc_run_mode {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -2842,7 +2982,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* rvc_run_mode */
+#endif // ESP_MATTER_CLUSTER_SELECTED(rvc_run_mode)
 
+#if ESP_MATTER_CLUSTER_SELECTED(rvc_clean_mode)
 namespace rvc_clean_mode {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -2879,7 +3021,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* rvc_clean_mode */
+#endif // ESP_MATTER_CLUSTER_SELECTED(rvc_clean_mode)
 
+#if ESP_MATTER_CLUSTER_SELECTED(microwave_oven_mode)
 namespace microwave_oven_mode {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -2912,7 +3056,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* microwave_oven_mode */
+#endif // ESP_MATTER_CLUSTER_SELECTED(microwave_oven_mode)
 
+#if ESP_MATTER_CLUSTER_SELECTED(microwave_oven_control)
 namespace microwave_oven_control {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -2964,7 +3110,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* microwave_oven_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(microwave_oven_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(rvc_operational_state)
 namespace rvc_operational_state {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -2997,7 +3145,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* rvc_operational_state */
+#endif // ESP_MATTER_CLUSTER_SELECTED(rvc_operational_state)
 
+#if ESP_MATTER_CLUSTER_SELECTED(keypad_input)
 namespace keypad_input {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -3032,7 +3182,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* keypad_input */
+#endif // ESP_MATTER_CLUSTER_SELECTED(keypad_input)
 
+#if ESP_MATTER_CLUSTER_SELECTED(power_topology)
 namespace power_topology {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -3081,7 +3233,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* power_topology */
+#endif // ESP_MATTER_CLUSTER_SELECTED(power_topology)
 
+#if ESP_MATTER_CLUSTER_SELECTED(electrical_power_measurement)
 namespace electrical_power_measurement {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -3138,7 +3292,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* electrical_power_measurement */
+#endif // ESP_MATTER_CLUSTER_SELECTED(electrical_power_measurement)
 
+#if ESP_MATTER_CLUSTER_SELECTED(electrical_energy_measurement)
 namespace electrical_energy_measurement {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -3185,7 +3341,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* electrical_energy_measurement */
+#endif // ESP_MATTER_CLUSTER_SELECTED(electrical_energy_measurement)
 
+#if ESP_MATTER_CLUSTER_SELECTED(energy_evse_mode)
 namespace energy_evse_mode {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -3222,7 +3380,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* energy_evse_mode */
+#endif // ESP_MATTER_CLUSTER_SELECTED(energy_evse_mode)
 
+#if ESP_MATTER_CLUSTER_SELECTED(energy_evse)
 namespace energy_evse {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -3264,7 +3424,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* energy_evse */
+#endif // ESP_MATTER_CLUSTER_SELECTED(energy_evse)
 
+#if ESP_MATTER_CLUSTER_SELECTED(valve_configuration_and_control)
 namespace valve_configuration_and_control {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -3309,7 +3471,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* valve_configuration_and_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(valve_configuration_and_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(device_energy_management)
 namespace device_energy_management {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -3377,7 +3541,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* device_energy_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(device_energy_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(device_energy_management_mode)
 namespace device_energy_management_mode {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -3414,7 +3580,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* device_energy_management_mode */
+#endif // ESP_MATTER_CLUSTER_SELECTED(device_energy_management_mode)
 
+#if ESP_MATTER_CLUSTER_SELECTED(application_basic)
 namespace application_basic {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -3452,7 +3620,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* application_basic */
+#endif // ESP_MATTER_CLUSTER_SELECTED(application_basic)
 
+#if ESP_MATTER_CLUSTER_SELECTED(thread_border_router_management)
 namespace thread_border_router_management {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -3494,7 +3664,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
 }
 
 } /* thread_border_router_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(thread_border_router_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(wifi_network_management)
 namespace wifi_network_management {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -3528,7 +3700,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
 }
 
 } /* wifi_network_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(wifi_network_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(thread_network_directory)
 namespace thread_network_directory {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -3564,7 +3738,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* thread_network_directory */
+#endif // ESP_MATTER_CLUSTER_SELECTED(thread_network_directory)
 
+#if ESP_MATTER_CLUSTER_SELECTED(service_area)
 namespace service_area {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -3601,7 +3777,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* service_area */
+#endif // ESP_MATTER_CLUSTER_SELECTED(service_area)
 
+#if ESP_MATTER_CLUSTER_SELECTED(water_heater_management)
 namespace water_heater_management {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -3641,7 +3819,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
 }
 
 } /* water_heater_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(water_heater_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(water_heater_mode)
 namespace water_heater_mode {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -3681,7 +3861,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* water_heater_mode */
+#endif // ESP_MATTER_CLUSTER_SELECTED(water_heater_mode)
 
+#if ESP_MATTER_CLUSTER_SELECTED(energy_preference)
 namespace energy_preference {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -3729,7 +3911,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* energy_preference */
+#endif // ESP_MATTER_CLUSTER_SELECTED(energy_preference)
 
+#if ESP_MATTER_CLUSTER_SELECTED(commissioner_control)
 namespace commissioner_control {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -3771,7 +3955,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* commissioner_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(commissioner_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(ecosystem_information)
 namespace ecosystem_information {
 const function_generic_t *function_list = NULL;
 const int function_flags = CLUSTER_FLAG_NONE;
@@ -3800,7 +3986,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /* ecosystem_information */
+#endif // ESP_MATTER_CLUSTER_SELECTED(ecosystem_information)
 
+#if ESP_MATTER_CLUSTER_SELECTED(camera_av_stream_management)
 namespace camera_av_stream_management {
 
 const function_generic_t *function_list = NULL;
@@ -3881,7 +4069,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /*camera av stream management*/
+#endif // ESP_MATTER_CLUSTER_SELECTED(camera_av_stream_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(webrtc_transport_provider)
 namespace webrtc_transport_provider {
 const function_generic_t *function_list = NULL;
 
@@ -3922,7 +4112,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /*webrtc transport provider*/
+#endif // ESP_MATTER_CLUSTER_SELECTED(webrtc_transport_provider)
 
+#if ESP_MATTER_CLUSTER_SELECTED(webrtc_transport_requestor)
 namespace webrtc_transport_requestor {
 const function_generic_t *function_list = NULL;
 
@@ -3959,6 +4151,7 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
     return cluster;
 }
 } /*webrtc transport requestor*/
+#endif // ESP_MATTER_CLUSTER_SELECTED(webrtc_transport_requestor)
 
 // namespace binary_input_basic {
 //     // ToDo
@@ -4024,6 +4217,7 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
 //     // ToDo
 // } /* audio_output */
 
+#if ESP_MATTER_CLUSTER_SELECTED(chime)
 namespace chime {
 const function_generic_t *function_list = NULL;
 
@@ -4062,7 +4256,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
 }
 
 } /* chime */
+#endif // ESP_MATTER_CLUSTER_SELECTED(chime)
 
+#if ESP_MATTER_CLUSTER_SELECTED(closure_control)
 namespace closure_control {
 const function_generic_t *function_list = NULL;
 
@@ -4145,7 +4341,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
 }
 
 } /* closure_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(closure_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(closure_dimension)
 namespace closure_dimension {
 const function_generic_t *function_list = NULL;
 
@@ -4215,7 +4413,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
 }
 
 } /* closure_dimension */
+#endif // ESP_MATTER_CLUSTER_SELECTED(closure_dimension)
 
+#if ESP_MATTER_CLUSTER_SELECTED(camera_av_settings_user_level_management)
 namespace camera_av_settings_user_level_management {
 const function_generic_t *function_list = NULL;
 
@@ -4270,7 +4470,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
 }
 
 } /* camera_av_settings_user_level_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(camera_av_settings_user_level_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(push_av_stream_transport)
 namespace push_av_stream_transport {
 const function_generic_t *function_list = NULL;
 
@@ -4320,7 +4522,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
 }
 
 } /* push_av_stream_transport */
+#endif // ESP_MATTER_CLUSTER_SELECTED(push_av_stream_transport)
 
+#if ESP_MATTER_CLUSTER_SELECTED(commodity_tariff)
 namespace commodity_tariff {
 const function_generic_t *function_list = NULL;
 
@@ -4399,7 +4603,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
 }
 
 } /* commodity_tariff */
+#endif // ESP_MATTER_CLUSTER_SELECTED(commodity_tariff)
 
+#if ESP_MATTER_CLUSTER_SELECTED(commodity_price)
 namespace commodity_price {
 const function_generic_t *function_list = NULL;
 
@@ -4435,7 +4641,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
 }
 
 } /* commodity_price */
+#endif // ESP_MATTER_CLUSTER_SELECTED(commodity_price)
 
+#if ESP_MATTER_CLUSTER_SELECTED(commodity_metering)
 namespace commodity_metering {
 const function_generic_t *function_list = NULL;
 
@@ -4468,7 +4676,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
 }
 
 } /* commodity_metering */
+#endif // ESP_MATTER_CLUSTER_SELECTED(commodity_metering)
 
+#if ESP_MATTER_CLUSTER_SELECTED(electrical_grid_conditions)
 namespace electrical_grid_conditions {
 const function_generic_t *function_list = NULL;
 
@@ -4503,7 +4713,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
 }
 
 } /* electrical_grid_conditions */
+#endif // ESP_MATTER_CLUSTER_SELECTED(electrical_grid_conditions)
 
+#if ESP_MATTER_CLUSTER_SELECTED(meter_identification)
 namespace meter_identification {
 const function_generic_t *function_list = NULL;
 
@@ -4538,7 +4750,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
 }
 
 } /* meter_identification */
+#endif // ESP_MATTER_CLUSTER_SELECTED(meter_identification)
 
+#if ESP_MATTER_CLUSTER_SELECTED(soil_measurement)
 namespace soil_measurement {
 const function_generic_t *function_list = NULL;
 
@@ -4571,7 +4785,9 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
 }
 
 } /* soil_measurement */
+#endif // ESP_MATTER_CLUSTER_SELECTED(soil_measurement)
 
+#if ESP_MATTER_CLUSTER_SELECTED(zone_management)
 namespace zone_management {
 const function_generic_t *function_list = NULL;
 
@@ -4614,6 +4830,7 @@ cluster_t *create(endpoint_t *endpoint, config_t *config, uint8_t flags)
 }
 
 } /* zone_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(zone_management)
 
 } /* cluster */
 } /* esp_matter */
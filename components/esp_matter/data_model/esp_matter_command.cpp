@@ -16,6 +16,7 @@
 #include <esp_matter.h>
 #include <esp_matter_command.h>
 #include <esp_matter_core.h>
+#include <cluster_select/esp_matter_cluster_select.h>
 
 #include <app-common/zap-generated/callback.h>
 #include <app/InteractionModelEngine.h>
@@ -70,6 +71,7 @@ void dispatch_single_cluster_command(const ConcreteCommandPath &command_path, TL
 } /* command */
 } /* esp_matter */
 
+#if ESP_MATTER_CLUSTER_SELECTED(ota_software_update_requestor)
 static esp_err_t esp_matter_command_callback_announce_ota_provider(const ConcreteCommandPath &command_path,
                                                                    TLVReader &tlv_data, void *opaque_ptr)
 {
@@ -81,7 +83,9 @@ static esp_err_t esp_matter_command_callback_announce_ota_provider(const Concret
     }
     return ESP_OK;
 }
+#endif // ESP_MATTER_CLUSTER_SELECTED(ota_software_update_requestor)
 
+#if ESP_MATTER_CLUSTER_SELECTED(groups)
 static esp_err_t esp_matter_command_callback_add_group(const ConcreteCommandPath &command_path, TLVReader &tlv_data,
                                                        void *opaque_ptr)
 {
@@ -159,7 +163,9 @@ static esp_err_t esp_matter_command_callback_add_group_if_identifying(const Conc
     }
     return ESP_OK;
 }
+#endif // ESP_MATTER_CLUSTER_SELECTED(groups)
 
+#if ESP_MATTER_CLUSTER_SELECTED(on_off)
 static esp_err_t esp_matter_command_callback_off(const ConcreteCommandPath &command_path, TLVReader &tlv_data,
                                                  void *opaque_ptr)
 {
@@ -225,7 +231,9 @@ static esp_err_t esp_matter_command_callback_on_with_timed_off(const ConcreteCom
     }
     return ESP_OK;
 }
+#endif // ESP_MATTER_CLUSTER_SELECTED(on_off)
 
+#if ESP_MATTER_CLUSTER_SELECTED(level_control)
 static esp_err_t esp_matter_command_callback_move_to_level(const ConcreteCommandPath &command_path, TLVReader &tlv_data,
                                                            void *opaque_ptr)
 {
@@ -314,7 +322,9 @@ static esp_err_t esp_matter_command_callback_stop_with_on_off(const ConcreteComm
     }
     return ESP_OK;
 }
+#endif // ESP_MATTER_CLUSTER_SELECTED(level_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(color_control)
 static esp_err_t esp_matter_command_callback_move_to_hue(const ConcreteCommandPath &command_path, TLVReader &tlv_data,
                                                          void *opaque_ptr)
 {
@@ -532,7 +542,9 @@ static esp_err_t esp_matter_command_callback_step_color(const ConcreteCommandPat
     }
     return ESP_OK;
 }
+#endif // ESP_MATTER_CLUSTER_SELECTED(color_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(smoke_co_alarm)
 static esp_err_t esp_matter_command_callback_self_test_request(const ConcreteCommandPath &command_path, TLVReader &tlv_data,
                                                                void *opaque_ptr)
 {
@@ -543,7 +555,9 @@ static esp_err_t esp_matter_command_callback_self_test_request(const ConcreteCom
     }
     return ESP_OK;
 }
+#endif // ESP_MATTER_CLUSTER_SELECTED(smoke_co_alarm)
 
+#if ESP_MATTER_CLUSTER_SELECTED(door_lock)
 static esp_err_t esp_matter_command_callback_lock_door(const ConcreteCommandPath &command_path, TLVReader &tlv_data,
                                                        void *opaque_ptr)
 {
@@ -774,7 +788,9 @@ static esp_err_t esp_matter_command_callback_clear_aliro_reader_config(const Con
     }
     return ESP_OK;
 }
+#endif // ESP_MATTER_CLUSTER_SELECTED(door_lock)
 
+#if ESP_MATTER_CLUSTER_SELECTED(thermostat)
 static esp_err_t esp_matter_command_callback_setpoint_raise_lower(const ConcreteCommandPath &command_path,
                                                                   TLVReader &tlv_data, void *opaque_ptr)
 {
@@ -818,7 +834,9 @@ static esp_err_t esp_matter_command_callback_set_active_preset_request(const Con
     }
     return ESP_OK;
 }
+#endif // ESP_MATTER_CLUSTER_SELECTED(thermostat)
 
+#if ESP_MATTER_CLUSTER_SELECTED(thread_network_diagnostics)
 static esp_err_t esp_matter_command_callback_thread_reset_counts(const ConcreteCommandPath &command_path,
                                                                  TLVReader &tlv_data, void *opaque_ptr)
 {
@@ -829,7 +847,9 @@ static esp_err_t esp_matter_command_callback_thread_reset_counts(const ConcreteC
     }
     return ESP_OK;
 }
+#endif // ESP_MATTER_CLUSTER_SELECTED(thread_network_diagnostics)
 
+#if ESP_MATTER_CLUSTER_SELECTED(window_covering)
 static esp_err_t esp_matter_command_callback_up_or_open(const ConcreteCommandPath &command_path, TLVReader &tlv_data,
                                                         void *opaque_ptr)
 {
@@ -884,7 +904,9 @@ static esp_err_t esp_matter_command_callback_go_to_tilt_percentage(const Concret
     }
     return ESP_OK;
 }
+#endif // ESP_MATTER_CLUSTER_SELECTED(window_covering)
 
+#if ESP_MATTER_CLUSTER_SELECTED(mode_select)
 static esp_err_t esp_matter_command_callback_change_to_mode(const ConcreteCommandPath &command_path, TLVReader &tlv_data, void *opaque_ptr)
 {
     chip::app::Clusters::ModeSelect::Commands::ChangeToMode::DecodableType command_data;
@@ -894,7 +916,9 @@ static esp_err_t esp_matter_command_callback_change_to_mode(const ConcreteComman
     }
     return ESP_OK;
 }
+#endif // ESP_MATTER_CLUSTER_SELECTED(mode_select)
 
+#if ESP_MATTER_CLUSTER_SELECTED(temperature_control)
 static esp_err_t esp_matter_command_callback_set_temperature(const ConcreteCommandPath &command_path, TLVReader &tlv_data, void *opaque_ptr)
 {
     chip::app::Clusters::TemperatureControl::Commands::SetTemperature::DecodableType command_data;
@@ -904,7 +928,9 @@ static esp_err_t esp_matter_command_callback_set_temperature(const ConcreteComma
     }
     return ESP_OK;
 }
+#endif // ESP_MATTER_CLUSTER_SELECTED(temperature_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(fan_control)
 static esp_err_t esp_matter_command_callback_fan_step(const ConcreteCommandPath &command_path, TLVReader &tlv_data, void *opaque_ptr)
 {
     chip::app::Clusters::FanControl::Commands::Step::DecodableType command_data;
@@ -914,7 +940,9 @@ static esp_err_t esp_matter_command_callback_fan_step(const ConcreteCommandPath
     }
     return ESP_OK;
 }
+#endif // ESP_MATTER_CLUSTER_SELECTED(fan_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(actions)
 static esp_err_t esp_matter_command_callback_instance_action(const ConcreteCommandPath &command_path,
                                                              TLVReader &tlv_data, void *opaque_ptr)
 {
@@ -1046,7 +1074,9 @@ static esp_err_t esp_matter_command_callback_disable_action_with_duration(const
 
     return ESP_OK;
 }
+#endif // ESP_MATTER_CLUSTER_SELECTED(actions)
 
+#if ESP_MATTER_CLUSTER_SELECTED(access_control)
 #if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
 static esp_err_t esp_matter_command_callback_review_fabric_restrictions(const ConcreteCommandPath &command_path, TLVReader &tlv_data, void *opaque_ptr)
 {
@@ -1058,7 +1088,9 @@ static esp_err_t esp_matter_command_callback_review_fabric_restrictions(const Co
     return ESP_OK;
 }
 #endif // CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
+#endif // ESP_MATTER_CLUSTER_SELECTED(access_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(keypad_input)
 static esp_err_t esp_matter_command_callback_send_key(const ConcreteCommandPath &command_path, TLVReader &tlv_data, void *opaque_ptr)
 {
     chip::app::Clusters::KeypadInput::Commands::SendKey::DecodableType command_data;
@@ -1068,7 +1100,9 @@ static esp_err_t esp_matter_command_callback_send_key(const ConcreteCommandPath
     }
     return ESP_OK;
 }
+#endif // ESP_MATTER_CLUSTER_SELECTED(keypad_input)
 
+#if ESP_MATTER_CLUSTER_SELECTED(valve_configuration_and_control)
 static esp_err_t esp_matter_command_callback_open(const ConcreteCommandPath &command_path, TLVReader &tlv_data, void *opaque_ptr)
 {
     chip::app::Clusters::ValveConfigurationAndControl::Commands::Open::DecodableType command_data;
@@ -1088,10 +1122,12 @@ static esp_err_t esp_matter_command_callback_close(const ConcreteCommandPath &co
     }
     return ESP_OK;
 }
+#endif // ESP_MATTER_CLUSTER_SELECTED(valve_configuration_and_control)
 
 namespace esp_matter {
 namespace cluster {
 
+#if ESP_MATTER_CLUSTER_SELECTED(actions)
 namespace actions {
 namespace command {
 command_t *create_instant_action(cluster_t *cluster)
@@ -1168,7 +1204,9 @@ command_t *create_disable_action_with_duration(cluster_t *cluster)
 
 } /* command */
 } /* actions */
+#endif // ESP_MATTER_CLUSTER_SELECTED(actions)
 
+#if ESP_MATTER_CLUSTER_SELECTED(access_control)
 namespace access_control {
 namespace command {
 command_t *create_review_fabric_restrictions(cluster_t *cluster)
@@ -1189,7 +1227,9 @@ command_t *create_review_fabric_restrictions_response(cluster_t *cluster)
 
 } /* command */
 } /* access_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(access_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(bridged_device_basic_information)
 namespace bridged_device_basic_information {
 namespace command {
 command_t *create_keep_active(cluster_t *cluster)
@@ -1201,7 +1241,9 @@ command_t *create_keep_active(cluster_t *cluster)
 
 } /* command */
 } /* bridged_device_basic_information */
+#endif // ESP_MATTER_CLUSTER_SELECTED(bridged_device_basic_information)
 
+#if ESP_MATTER_CLUSTER_SELECTED(thread_network_diagnostics)
 namespace thread_network_diagnostics {
 namespace command {
 
@@ -1213,7 +1255,9 @@ command_t *create_reset_counts(cluster_t *cluster)
 
 } /* command */
 } /* thread_network_diagnostics */
+#endif // ESP_MATTER_CLUSTER_SELECTED(thread_network_diagnostics)
 
+#if ESP_MATTER_CLUSTER_SELECTED(wifi_network_diagnostics)
 namespace wifi_network_diagnostics {
 namespace command {
 
@@ -1224,7 +1268,9 @@ command_t *create_reset_counts(cluster_t *cluster)
 
 } /* command */
 } /* wifi_network_diagnostics */
+#endif // ESP_MATTER_CLUSTER_SELECTED(wifi_network_diagnostics)
 
+#if ESP_MATTER_CLUSTER_SELECTED(ethernet_network_diagnostics)
 namespace ethernet_network_diagnostics {
 namespace command {
 
@@ -1236,7 +1282,9 @@ command_t *create_reset_counts(cluster_t *cluster)
 
 } /* command */
 } /* ethernet_network_diagnostics */
+#endif // ESP_MATTER_CLUSTER_SELECTED(ethernet_network_diagnostics)
 
+#if ESP_MATTER_CLUSTER_SELECTED(diagnostic_logs)
 namespace diagnostic_logs {
 namespace command {
 
@@ -1254,7 +1302,9 @@ command_t *create_retrieve_logs_response(cluster_t *cluster)
 
 } /* command */
 } /* diagnostic_logs */
+#endif // ESP_MATTER_CLUSTER_SELECTED(diagnostic_logs)
 
+#if ESP_MATTER_CLUSTER_SELECTED(general_diagnostics)
 namespace general_diagnostics {
 namespace command {
 
@@ -1284,7 +1334,9 @@ command_t *create_payload_test_response(cluster_t *cluster)
 
 } /* command */
 } /* general_diagnostics */
+#endif // ESP_MATTER_CLUSTER_SELECTED(general_diagnostics)
 
+#if ESP_MATTER_CLUSTER_SELECTED(software_diagnostics)
 namespace software_diagnostics {
 namespace command {
 
@@ -1296,7 +1348,9 @@ command_t *create_reset_watermarks(cluster_t *cluster)
 
 } /* command */
 } /* software_diagnostics */
+#endif // ESP_MATTER_CLUSTER_SELECTED(software_diagnostics)
 
+#if ESP_MATTER_CLUSTER_SELECTED(group_key_management)
 namespace group_key_management {
 namespace command {
 
@@ -1338,7 +1392,9 @@ command_t *create_key_set_read_all_indices_response(cluster_t *cluster)
 
 } /* command */
 } /* group_key_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(group_key_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(general_commissioning)
 namespace general_commissioning {
 namespace command {
 
@@ -1392,7 +1448,9 @@ command_t *create_set_tc_acknowledgements_response(cluster_t *cluster)
 
 } /* command */
 } /* general_commissioning */
+#endif // ESP_MATTER_CLUSTER_SELECTED(general_commissioning)
 
+#if ESP_MATTER_CLUSTER_SELECTED(network_commissioning)
 namespace network_commissioning {
 namespace command {
 
@@ -1452,7 +1510,9 @@ command_t *create_connect_network_response(cluster_t *cluster)
 
 } /* command */
 } /* network_commissioning */
+#endif // ESP_MATTER_CLUSTER_SELECTED(network_commissioning)
 
+#if ESP_MATTER_CLUSTER_SELECTED(administrator_commissioning)
 namespace administrator_commissioning {
 namespace command {
 
@@ -1476,7 +1536,9 @@ command_t *create_revoke_commissioning(cluster_t *cluster)
 
 } /* command */
 } /* administrator_commissioning */
+#endif // ESP_MATTER_CLUSTER_SELECTED(administrator_commissioning)
 
+#if ESP_MATTER_CLUSTER_SELECTED(operational_credentials)
 namespace operational_credentials {
 namespace command {
 
@@ -1572,7 +1634,9 @@ command_t *create_sign_vid_verification_response(cluster_t *cluster)
 
 } /* command */
 } /* operational_credentials */
+#endif // ESP_MATTER_CLUSTER_SELECTED(operational_credentials)
 
+#if ESP_MATTER_CLUSTER_SELECTED(ota_software_update_provider)
 namespace ota_software_update_provider {
 namespace command {
 
@@ -1608,7 +1672,9 @@ command_t *create_apply_update_response(cluster_t *cluster)
 
 } /* command */
 } /* ota_software_update_provider */
+#endif // ESP_MATTER_CLUSTER_SELECTED(ota_software_update_provider)
 
+#if ESP_MATTER_CLUSTER_SELECTED(ota_software_update_requestor)
 namespace ota_software_update_requestor {
 namespace command {
 
@@ -1620,7 +1686,9 @@ command_t *create_announce_ota_provider(cluster_t *cluster)
 
 } /* command */
 } /* ota_software_update_requestor */
+#endif // ESP_MATTER_CLUSTER_SELECTED(ota_software_update_requestor)
 
+#if ESP_MATTER_CLUSTER_SELECTED(identify)
 namespace identify {
 namespace command {
 
@@ -1638,7 +1706,9 @@ command_t *create_trigger_effect(cluster_t *cluster)
 
 } /* command */
 } /* identify */
+#endif // ESP_MATTER_CLUSTER_SELECTED(identify)
 
+#if ESP_MATTER_CLUSTER_SELECTED(groups)
 namespace groups {
 namespace command {
 
@@ -1702,7 +1772,9 @@ command_t *create_remove_group_response(cluster_t *cluster)
 
 } /* command */
 } /* groups */
+#endif // ESP_MATTER_CLUSTER_SELECTED(groups)
 
+#if ESP_MATTER_CLUSTER_SELECTED(icd_management)
 namespace icd_management {
 namespace command {
 command_t *create_register_client(cluster_t *cluster)
@@ -1736,7 +1808,9 @@ command_t *create_stay_active_response(cluster_t *cluster)
 
 } /* command */
 } /* icd_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(icd_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(scenes_management)
 namespace scenes_management {
 namespace command {
 
@@ -1820,7 +1894,9 @@ command_t *create_copy_scene_response(cluster_t *cluster)
 
 } /* command */
 } /* scenes_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(scenes_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(on_off)
 namespace on_off {
 namespace command {
 
@@ -1862,7 +1938,9 @@ command_t *create_on_with_timed_off(cluster_t *cluster)
 
 } /* command */
 } /* on_off */
+#endif // ESP_MATTER_CLUSTER_SELECTED(on_off)
 
+#if ESP_MATTER_CLUSTER_SELECTED(level_control)
 namespace level_control {
 namespace command {
 
@@ -1923,7 +2001,9 @@ command_t *create_move_to_closest_frequency(cluster_t *cluster)
 
 } /* command */
 } /* level_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(level_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(color_control)
 namespace color_control {
 namespace command {
 
@@ -2043,7 +2123,9 @@ command_t *create_color_loop_set(cluster_t *cluster)
 
 } /* command */
 } /* color_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(color_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(thermostat)
 namespace thermostat {
 namespace command {
 
@@ -2078,7 +2160,9 @@ command_t *create_atomic_response(cluster_t *cluster)
 
 } /* command */
 } /* thermostat */
+#endif // ESP_MATTER_CLUSTER_SELECTED(thermostat)
 
+#if ESP_MATTER_CLUSTER_SELECTED(operational_state)
 namespace operational_state {
 namespace command {
 command_t *create_pause(cluster_t *cluster)
@@ -2108,7 +2192,9 @@ command_t *create_operational_command_response(cluster_t *cluster)
 }
 } /* command */
 } /* operational_state */
+#endif // ESP_MATTER_CLUSTER_SELECTED(operational_state)
 
+#if ESP_MATTER_CLUSTER_SELECTED(smoke_co_alarm)
 namespace smoke_co_alarm {
 namespace command {
 
@@ -2120,7 +2206,9 @@ command_t *create_self_test_request(cluster_t *cluster)
 
 } /* command */
 } /* smoke_co_alarm */
+#endif // ESP_MATTER_CLUSTER_SELECTED(smoke_co_alarm)
 
+#if ESP_MATTER_CLUSTER_SELECTED(door_lock)
 namespace door_lock {
 namespace command {
 
@@ -2288,7 +2376,9 @@ command_t *create_clear_aliro_reader_config(cluster_t *cluster)
 
 } /* command */
 } /* door_lock */
+#endif // ESP_MATTER_CLUSTER_SELECTED(door_lock)
 
+#if ESP_MATTER_CLUSTER_SELECTED(window_covering)
 namespace window_covering {
 namespace command {
 
@@ -2324,7 +2414,9 @@ command_t *create_go_to_tilt_percentage(cluster_t *cluster)
 
 } /* command */
 } /* window_covering */
+#endif // ESP_MATTER_CLUSTER_SELECTED(window_covering)
 
+#if ESP_MATTER_CLUSTER_SELECTED(mode_select)
 namespace mode_select {
 namespace command {
 
@@ -2335,7 +2427,9 @@ command_t *create_change_to_mode(cluster_t *cluster)
 
 } /* command */
 } /* mode_select */
+#endif // ESP_MATTER_CLUSTER_SELECTED(mode_select)
 
+#if ESP_MATTER_CLUSTER_SELECTED(temperature_control)
 namespace temperature_control {
 namespace command {
 
@@ -2347,7 +2441,9 @@ command_t *create_set_temperature(cluster_t *cluster)
 
 } /* command */
 } /* temperature_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(temperature_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(fan_control)
 namespace fan_control {
 namespace command {
 command_t *create_step(cluster_t *cluster)
@@ -2358,7 +2454,9 @@ command_t *create_step(cluster_t *cluster)
 
 } /* command */
 } /* fan_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(fan_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(resource_monitoring)
 namespace resource_monitoring {
 namespace command {
 command_t *create_reset_condition(cluster_t *cluster)
@@ -2368,7 +2466,9 @@ command_t *create_reset_condition(cluster_t *cluster)
 
 } /* command */
 } /* resource_monitoring */
+#endif // ESP_MATTER_CLUSTER_SELECTED(resource_monitoring)
 
+#if ESP_MATTER_CLUSTER_SELECTED(mode_base)
 namespace mode_base {
 namespace command {
 
@@ -2385,7 +2485,9 @@ command_t *create_change_to_mode_response(cluster_t *cluster)
 
 } /* command */
 } /* mode_base */
+#endif // ESP_MATTER_CLUSTER_SELECTED(mode_base)
 
+#if ESP_MATTER_CLUSTER_SELECTED(keypad_input)
 namespace keypad_input {
 namespace command {
 
@@ -2401,7 +2503,9 @@ command_t *create_send_key_response(cluster_t *cluster)
 
 } /* command */
 } /* keypad_input */
+#endif // ESP_MATTER_CLUSTER_SELECTED(keypad_input)
 
+#if ESP_MATTER_CLUSTER_SELECTED(boolean_state_configuration)
 namespace boolean_state_configuration {
 namespace command {
 command_t *create_suppress_alarm(cluster_t *cluster)
@@ -2416,7 +2520,9 @@ command_t *create_enable_disable_alarm(cluster_t *cluster)
 
 } /* command */
 } /* boolean_state_configuration */
+#endif // ESP_MATTER_CLUSTER_SELECTED(boolean_state_configuration)
 
+#if ESP_MATTER_CLUSTER_SELECTED(energy_evse)
 namespace energy_evse {
 namespace command {
 
@@ -2462,7 +2568,9 @@ command_t *create_get_targets_response(cluster_t *cluster)
 
 } /* command */
 } /* energy_evse */
+#endif // ESP_MATTER_CLUSTER_SELECTED(energy_evse)
 
+#if ESP_MATTER_CLUSTER_SELECTED(microwave_oven_control)
 namespace microwave_oven_control {
 namespace command {
 
@@ -2478,7 +2586,9 @@ command_t *create_add_more_time(cluster_t *cluster)
 
 } /* command */
 } /* microwave_oven_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(microwave_oven_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(valve_configuration_and_control)
 namespace valve_configuration_and_control {
 namespace command {
 
@@ -2494,7 +2604,9 @@ command_t *create_close(cluster_t *cluster)
 
 } /* command */
 } /* valve_configuration_and_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(valve_configuration_and_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(device_energy_management)
 namespace device_energy_management {
 namespace command {
 command_t *create_power_adjust_request(cluster_t *cluster)
@@ -2539,7 +2651,9 @@ command_t *create_cancel_request(cluster_t *cluster)
 
 } /* command */
 } /* device_energy_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(device_energy_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(thread_border_router_management)
 namespace thread_border_router_management {
 namespace command {
 
@@ -2575,7 +2689,9 @@ command_t *create_set_pending_dataset_request(cluster_t *cluster)
 
 } /* command */
 } /* thread_border_router_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(thread_border_router_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(wifi_network_management)
 namespace wifi_network_management {
 namespace command {
 
@@ -2593,7 +2709,9 @@ command_t *create_network_passphrase_response(cluster_t *cluster)
 
 } /* command */
 } /* wifi_network_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(wifi_network_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(thread_network_directory)
 namespace thread_network_directory {
 namespace command {
 
@@ -2623,7 +2741,9 @@ command_t *create_operational_dataset_response(cluster_t *cluster)
 
 } /* command */
 } /* thread_network_directory */
+#endif // ESP_MATTER_CLUSTER_SELECTED(thread_network_directory)
 
+#if ESP_MATTER_CLUSTER_SELECTED(service_area)
 namespace service_area {
 namespace command {
 
@@ -2649,7 +2769,9 @@ command_t *create_skip_area_response(cluster_t *cluster)
 
 } /* command */
 } /* service_area */
+#endif // ESP_MATTER_CLUSTER_SELECTED(service_area)
 
+#if ESP_MATTER_CLUSTER_SELECTED(water_heater_management)
 namespace water_heater_management {
 namespace command {
 
@@ -2667,7 +2789,9 @@ command_t *create_cancel_boost(cluster_t *cluster)
 
 } /* command */
 } /* water_heater_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(water_heater_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(commissioner_control)
 namespace commissioner_control {
 namespace command {
 
@@ -2691,7 +2815,9 @@ command_t *create_reverse_open_commissioning_window(cluster_t *cluster)
 
 } /* command */
 } /* commissioner_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(commissioner_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(time_synchronization)
 namespace time_synchronization {
 namespace command {
 
@@ -2733,7 +2859,9 @@ command_t *create_set_default_ntp(cluster_t *cluster)
 
 } /* command */
 } /* time_synchronization */
+#endif // ESP_MATTER_CLUSTER_SELECTED(time_synchronization)
 
+#if ESP_MATTER_CLUSTER_SELECTED(camera_av_stream_management)
 namespace camera_av_stream_management {
 namespace command {
 
@@ -2810,7 +2938,9 @@ command_t *create_capture_snapshot_response(cluster_t *cluster)
 
 } /* command */
 } /*camera av stream management*/
+#endif // ESP_MATTER_CLUSTER_SELECTED(camera_av_stream_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(webrtc_transport_provider)
 namespace webrtc_transport_provider {
 namespace command {
 
@@ -2851,7 +2981,9 @@ command_t *create_end_session(cluster_t *cluster)
 
 } /* command */
 }/*webrtc_transport_provider*/
+#endif // ESP_MATTER_CLUSTER_SELECTED(webrtc_transport_provider)
 
+#if ESP_MATTER_CLUSTER_SELECTED(webrtc_transport_requestor)
 namespace webrtc_transport_requestor {
 namespace command {
 
@@ -2877,7 +3009,9 @@ command_t *create_end(cluster_t *cluster)
 
 } /* command */
 }/*webrtc_transport_requestor*/
+#endif // ESP_MATTER_CLUSTER_SELECTED(webrtc_transport_requestor)
 
+#if ESP_MATTER_CLUSTER_SELECTED(chime)
 namespace chime {
 namespace command {
 command_t *create_play_chime_sound(cluster_t *cluster)
@@ -2888,7 +3022,9 @@ command_t *create_play_chime_sound(cluster_t *cluster)
 
 } /* command */
 } /* chime */
+#endif // ESP_MATTER_CLUSTER_SELECTED(chime)
 
+#if ESP_MATTER_CLUSTER_SELECTED(closure_control)
 namespace closure_control {
 namespace command {
 command_t *create_stop(cluster_t *cluster)
@@ -2911,7 +3047,9 @@ command_t *create_calibrate(cluster_t *cluster)
 
 } /* command */
 } /* closure_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(closure_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(closure_dimension)
 namespace closure_dimension {
 namespace command {
 command_t *create_set_target(cluster_t *cluster)
@@ -2928,7 +3066,9 @@ command_t *create_step(cluster_t *cluster)
 
 } /* command */
 } /* closure_dimension */
+#endif // ESP_MATTER_CLUSTER_SELECTED(closure_dimension)
 
+#if ESP_MATTER_CLUSTER_SELECTED(camera_av_settings_user_level_management)
 namespace camera_av_settings_user_level_management {
 namespace command {
 command_t *create_mptz_set_position(cluster_t *cluster)
@@ -2975,7 +3115,9 @@ command_t *create_dptz_relative_move(cluster_t *cluster)
 
 } /* command */
 } /* camera_av_settings_user_level_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(camera_av_settings_user_level_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(push_av_stream_transport)
 namespace push_av_stream_transport {
 namespace command {
 command_t *create_allocate_push_transport(cluster_t *cluster)
@@ -3028,7 +3170,9 @@ command_t *create_find_transport_response(cluster_t *cluster)
 
 } /* command */
 } /* push_av_stream_transport */
+#endif // ESP_MATTER_CLUSTER_SELECTED(push_av_stream_transport)
 
+#if ESP_MATTER_CLUSTER_SELECTED(commodity_tariff)
 namespace commodity_tariff {
 namespace command {
 command_t *create_get_tariff_component(cluster_t *cluster)
@@ -3057,7 +3201,9 @@ command_t *create_get_day_entry_response(cluster_t *cluster)
 
 } /* command */
 } /* commodity_tariff */
+#endif // ESP_MATTER_CLUSTER_SELECTED(commodity_tariff)
 
+#if ESP_MATTER_CLUSTER_SELECTED(commodity_price)
 namespace commodity_price {
 namespace command {
 command_t *create_get_detailed_price_request(cluster_t *cluster)
@@ -3086,7 +3232,9 @@ command_t *create_get_detailed_forecast_response(cluster_t *cluster)
 
 } /* command */
 } /* commodity_price */
+#endif // ESP_MATTER_CLUSTER_SELECTED(commodity_price)
 
+#if ESP_MATTER_CLUSTER_SELECTED(zone_management)
 namespace zone_management {
 namespace command {
 command_t *create_two_d_cartesian_zone(cluster_t *cluster)
@@ -3127,6 +3275,7 @@ command_t *create_remove_trigger(cluster_t *cluster)
 
 } /* command */
 } /* zone_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(zone_management)
 
 } /* cluster */
 } /* esp_matter */
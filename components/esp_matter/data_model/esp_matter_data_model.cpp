@@ -18,15 +18,20 @@
 #include <esp_err.h>
 #include <esp_log.h>
 #include <esp_matter.h>
+#include <esp_matter_attr_val_codec.h>
 #include <esp_matter_attribute_utils.h>
 #include <esp_matter_core.h>
 #include <esp_matter_data_model.h>
 #include <esp_matter_data_model_priv.h>
 #include <esp_matter_data_model_provider.h>
+#include <esp_matter_delegate_callbacks.h>
 #include <esp_matter_attr_data_buffer.h>
 #include <esp_matter_mem.h>
 #include <esp_matter_nvs.h>
+#include <esp_matter_startup_profiler.h>
+#include <esp_matter_trace.h>
 #include <esp_random.h>
+#include <freertos/FreeRTOS.h>
 #include <nvs_flash.h>
 #include <singly_linked_list.h>
 
@@ -66,9 +71,15 @@ struct _attribute_base_t {
     struct _attribute_base_t *next;
 };
 
+/* Bounds of one attribute, min and max have the type of the attribute. Stored in the per cluster bounds table. */
+typedef struct _attribute_bounds {
+    esp_matter_val_t min;
+    esp_matter_val_t max;
+} _attribute_bounds_t;
+
 struct _attribute_t : public _attribute_base_t {
     esp_matter_val_t attribute_val;
-    esp_matter_attr_bounds_t *bounds;
+    _attribute_bounds_t *bounds; /* Points into the bounds_table of the cluster, valid if ATTRIBUTE_FLAG_MIN_MAX */
     uint16_t endpoint_id;
     uint32_t cluster_id;
     attribute::callback_t override_callback;
@@ -103,6 +114,20 @@ typedef struct _cluster {
                                      _internal_attribute_t. When operating attribute_list, do check the flags first! */
     _command_t *command_list;
     _event_t *event_list;
+    _attribute_bounds_t *bounds_table; /* Bounds of all the attributes of the cluster, one allocation per cluster */
+    uint16_t bounds_count;
+    uint16_t bounds_capacity;
+    /* Cached results of cluster::get_attribute_mask() and get_command_mask(), valid for the id list and count they
+       were computed for. Creating or destroying an attribute or a command drops the cache. */
+    const uint32_t *attribute_mask_ids;
+    uint32_t attribute_mask;
+    uint8_t attribute_mask_count;
+    uint8_t command_mask_count;
+    const uint32_t *command_mask_ids;
+    uint32_t command_mask;
+#if CONFIG_ESP_MATTER_MEM_STATS
+    esp_matter_mem_stats_t mem_stats;
+#endif
     struct _cluster *next;
 } _cluster_t;
 
@@ -124,6 +149,9 @@ typedef struct _endpoint {
     uint8_t semantic_tag_count;
     chip::app::DataModel::Provider::SemanticTag semantic_tags[ESP_MATTER_MAX_SEMANTIC_TAG_COUNT];
     _cluster_t *cluster_list;
+#if CONFIG_ESP_MATTER_MEM_STATS
+    esp_matter_mem_stats_t mem_stats;
+#endif
     struct _endpoint *next;
 } _endpoint_t;
 
@@ -139,6 +167,27 @@ inline bool is_wildcard_cluster_id(uint32_t cluster_id)
     return cluster_id == chip::kInvalidClusterId;
 }
 
+/* Stats which the allocations of an endpoint or a cluster are accounted to */
+template <typename T>
+inline esp_matter_mem_stats_t *get_mem_stats(T *owner)
+{
+#if CONFIG_ESP_MATTER_MEM_STATS
+    return owner ? &owner->mem_stats : nullptr;
+#else
+    return nullptr;
+#endif
+}
+
+/* Size of the buffer allocated for a string attribute value, 0 if there is no buffer */
+inline size_t get_val_buf_size(esp_matter_val_type_t type, const esp_matter_val_t &val)
+{
+    if (!val.a.b) {
+        return 0;
+    }
+    bool null_reserve = type == ESP_MATTER_VAL_TYPE_LONG_CHAR_STRING || type == ESP_MATTER_VAL_TYPE_CHAR_STRING;
+    return val.a.s + (null_reserve ? 1 : 0);
+}
+
 // Treat 0xFFFF as wildcard endpoint
 inline bool is_wildcard_endpoint_id(uint16_t endpoint_id)
 {
@@ -213,9 +262,60 @@ esp_err_t read_min_unused_endpoint_id()
 
 namespace endpoint {
 
+/* Number of distinct parent endpoints tracked in a batch, beyond that the PartsList of every endpoint is reported */
+constexpr uint8_t k_max_batch_parent_count = 8;
+
+typedef struct endpoint_batch {
+    uint16_t depth;
+    bool parts_list_changed;
+    bool parent_overflow;
+    bool min_unused_endpoint_id_dirty;
+    uint8_t parent_count;
+    chip::EndpointId parents[k_max_batch_parent_count];
+} endpoint_batch_t;
+
+/* Endpoints are created and enabled from the application tasks as well as the Matter task */
+static endpoint_batch_t endpoint_batch;
+static portMUX_TYPE endpoint_batch_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/* Must be called with endpoint_batch_lock held */
+static void add_batch_parent(chip::EndpointId parent_endpoint_id)
+{
+    for (uint8_t i = 0; i < endpoint_batch.parent_count; ++i) {
+        if (endpoint_batch.parents[i] == parent_endpoint_id) {
+            return;
+        }
+    }
+    if (endpoint_batch.parent_count < k_max_batch_parent_count) {
+        endpoint_batch.parents[endpoint_batch.parent_count++] = parent_endpoint_id;
+    } else {
+        endpoint_batch.parent_overflow = true;
+    }
+}
+
 static void report_parts_list_change_internal(endpoint_t *endpoint)
 {
+    // Walk the parents outside of the critical section, one more than the batch can track marks an overflow
+    chip::EndpointId parents[k_max_batch_parent_count + 1];
+    uint8_t parent_count = 0;
     chip::EndpointId parent_endpoint_id = endpoint::get_parent_endpoint_id(endpoint);
+    while (parent_endpoint_id != chip::kInvalidEndpointId && parent_count < k_max_batch_parent_count + 1) {
+        parents[parent_count++] = parent_endpoint_id;
+        parent_endpoint_id = endpoint::get_parent_endpoint_id(endpoint::get(parent_endpoint_id));
+    }
+
+    taskENTER_CRITICAL(&endpoint_batch_lock);
+    bool batched = endpoint_batch.depth > 0;
+    if (batched) {
+        endpoint_batch.parts_list_changed = true;
+        for (uint8_t i = 0; i < parent_count; ++i) {
+            add_batch_parent(parents[i]);
+        }
+    }
+    taskEXIT_CRITICAL(&endpoint_batch_lock);
+    VerifyOrReturn(!batched);
+
+    parent_endpoint_id = endpoint::get_parent_endpoint_id(endpoint);
     while (parent_endpoint_id != chip::kInvalidEndpointId) {
         MatterReportingAttributeChangeCallback(parent_endpoint_id, chip::app::Clusters::Descriptor::Id,
                                                chip::app::Clusters::Descriptor::Attributes::PartsList::Id);
@@ -225,6 +325,58 @@ static void report_parts_list_change_internal(endpoint_t *endpoint)
                                                             chip::app::Clusters::Descriptor::Attributes::PartsList::Id);
 }
 
+esp_err_t begin_batch()
+{
+    taskENTER_CRITICAL(&endpoint_batch_lock);
+    endpoint_batch.depth++;
+    taskEXIT_CRITICAL(&endpoint_batch_lock);
+    return ESP_OK;
+}
+
+esp_err_t end_batch()
+{
+    // Take the state of the outermost batch and reset it, then report without holding the critical section
+    taskENTER_CRITICAL(&endpoint_batch_lock);
+    if (endpoint_batch.depth == 0) {
+        taskEXIT_CRITICAL(&endpoint_batch_lock);
+        ESP_LOGE(TAG, "No endpoint batch in progress");
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (--endpoint_batch.depth > 0) {
+        taskEXIT_CRITICAL(&endpoint_batch_lock);
+        return ESP_OK;
+    }
+    endpoint_batch_t batch = endpoint_batch;
+    endpoint_batch.parts_list_changed = false;
+    endpoint_batch.parent_overflow = false;
+    endpoint_batch.min_unused_endpoint_id_dirty = false;
+    endpoint_batch.parent_count = 0;
+    taskEXIT_CRITICAL(&endpoint_batch_lock);
+
+    if (batch.min_unused_endpoint_id_dirty) {
+        node::store_min_unused_endpoint_id();
+    }
+    if (batch.parts_list_changed) {
+        esp_matter::lock::ScopedChipStackLock lock(portMAX_DELAY);
+        if (batch.parent_overflow) {
+            endpoint_t *endpoint = get_first(node::get());
+            while (endpoint) {
+                MatterReportingAttributeChangeCallback(endpoint::get_id(endpoint), chip::app::Clusters::Descriptor::Id,
+                                                       chip::app::Clusters::Descriptor::Attributes::PartsList::Id);
+                endpoint = get_next(endpoint);
+            }
+        } else {
+            for (uint8_t i = 0; i < batch.parent_count; ++i) {
+                MatterReportingAttributeChangeCallback(batch.parents[i], chip::app::Clusters::Descriptor::Id,
+                                                       chip::app::Clusters::Descriptor::Attributes::PartsList::Id);
+            }
+            MatterReportingAttributeChangeCallback(/* endpoint = */ 0, chip::app::Clusters::Descriptor::Id,
+                                                                    chip::app::Clusters::Descriptor::Attributes::PartsList::Id);
+        }
+    }
+    return ESP_OK;
+}
+
 esp_err_t disable(endpoint_t *endpoint)
 {
     VerifyOrReturnError(endpoint, ESP_ERR_INVALID_ARG, ESP_LOGE(TAG, "Endpoint cannot be NULL"));
@@ -266,10 +418,10 @@ static esp_err_t init_identification(endpoint_t *endpoint)
     return ESP_OK;
 }
 
-static void invoke_init_callbacks_internal(endpoint_t *endpoint)
+static void invoke_init_callbacks_internal(endpoint_t *endpoint, cluster_t *cluster)
 {
-    cluster_t *cluster = cluster::get_first(endpoint);
     while (cluster) {
+        startup_profiler::ScopedPhase phase("cluster_init", endpoint::get_id(endpoint), cluster::get_id(cluster));
         /* Delegate server init callback */
         cluster::delegate_init_callback_t delegate_init_callback = cluster::get_delegate_init_callback(cluster);
         if (delegate_init_callback) {
@@ -312,12 +464,13 @@ esp_err_t enable(endpoint_t *endpoint)
 {
     VerifyOrReturnError(endpoint, ESP_ERR_INVALID_ARG, ESP_LOGE(TAG, "Endpoint cannot be NULL"));
     _endpoint_t *current_endpoint = (_endpoint_t *)endpoint;
+    startup_profiler::ScopedPhase phase("endpoint_enable", current_endpoint->endpoint_id);
     current_endpoint->enabled = true;
     init_identification(endpoint);
     {
         // Use the lock instead of schedule lambda to ensure the callbacks are invoked before esp_matter::start() returns.
         esp_matter::lock::ScopedChipStackLock lock(portMAX_DELAY);
-        invoke_init_callbacks_internal(endpoint);
+        invoke_init_callbacks_internal(endpoint, cluster::get_first(endpoint));
         // Mark the endpoint as dirty so that the data model provider will report the attribute changes.
         MatterReportingAttributeChangeCallback(endpoint::get_id(endpoint));
         report_parts_list_change_internal(endpoint);
@@ -325,18 +478,34 @@ esp_err_t enable(endpoint_t *endpoint)
     return ESP_OK;
 }
 
+esp_err_t init_clusters(endpoint_t *endpoint, cluster_t *first_cluster)
+{
+    VerifyOrReturnError(endpoint, ESP_ERR_INVALID_ARG, ESP_LOGE(TAG, "Endpoint cannot be NULL"));
+    VerifyOrReturnError(((_endpoint_t *)endpoint)->enabled, ESP_ERR_INVALID_STATE,
+                        ESP_LOGE(TAG, "Endpoint 0x%04" PRIx16 " is not enabled", endpoint::get_id(endpoint)));
+    VerifyOrReturnError(first_cluster, ESP_OK);
+    {
+        esp_matter::lock::ScopedChipStackLock lock(portMAX_DELAY);
+        invoke_init_callbacks_internal(endpoint, first_cluster);
+        // The ServerList and the DeviceTypeList of the descriptor changed as well
+        MatterReportingAttributeChangeCallback(endpoint::get_id(endpoint));
+    }
+    return ESP_OK;
+}
+
 esp_err_t enable_all()
 {
     node_t *node = node::get();
     /* Not returning error, since the node will not be initialized for application using the data model from zap */
     VerifyOrReturnError(node, ESP_OK);
 
+    begin_batch();
     endpoint_t *endpoint = get_first(node);
     while (endpoint) {
         enable(endpoint);
         endpoint = get_next(endpoint);
     }
-    return ESP_OK;
+    return end_batch();
 }
 
 bool is_attribute_enabled(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id)
@@ -353,7 +522,7 @@ bool is_command_enabled(uint16_t endpoint_id, uint32_t cluster_id, uint32_t comm
 
 bool is_enabled(endpoint_t *endpoint)
 {
-    VerifyOrReturnError(endpoint, ESP_ERR_INVALID_ARG, ESP_LOGE(TAG, "Endpoint cannot be NULL"));
+    VerifyOrReturnValue(endpoint, false, ESP_LOGE(TAG, "Endpoint cannot be NULL"));
     _endpoint_t *current_endpoint = (_endpoint_t *)endpoint;
     return current_endpoint->enabled;
 }
@@ -382,183 +551,18 @@ esp_err_t execute_callback(callback_type_t type, uint16_t endpoint_id, uint32_t
     return ESP_OK;
 }
 
-/**
- * Check whether the attribute value is in the range of attribute bounds
- *
- * @param[in] val Attribute value.
- * @param[in] bounds Attribute bounds.
- *
- * @return 0 if val is in the range of attribute bounds.
- * @return 1 if val is more than bounds.max
- * @return -1 if val is less than bounds.min
- * @return -2 if val type is wrong
- */
-static int compare_attr_val_with_bounds(esp_matter_attr_val_t val, esp_matter_attr_bounds_t bounds)
-{
-    switch (val.type) {
-    case ESP_MATTER_VAL_TYPE_UINT8:
-    case ESP_MATTER_VAL_TYPE_ENUM8:
-    case ESP_MATTER_VAL_TYPE_BITMAP8:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_UINT8:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_ENUM8:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_BITMAP8: {
-        using Traits = chip::app::NumericAttributeTraits<uint8_t>;
-        if ((val.type & ESP_MATTER_VAL_NULLABLE_BASE) && Traits::IsNullValue(val.val.u8)) {
-            return 0;
-        }
-        if (val.val.u8 < bounds.min.val.u8) {
-            return -1;
-        } else if (val.val.u8 > bounds.max.val.u8) {
-            return 1;
-        } else {
-            return 0;
-        }
-        break;
-    }
-    case ESP_MATTER_VAL_TYPE_UINT16:
-    case ESP_MATTER_VAL_TYPE_ENUM16:
-    case ESP_MATTER_VAL_TYPE_BITMAP16:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_UINT16:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_ENUM16:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_BITMAP16: {
-        using Traits = chip::app::NumericAttributeTraits<uint16_t>;
-        if ((val.type & ESP_MATTER_VAL_NULLABLE_BASE) && Traits::IsNullValue(val.val.u16)) {
-            return 0;
-        }
-        if (val.val.u16 < bounds.min.val.u16) {
-            return -1;
-        } else if (val.val.u16 > bounds.max.val.u16) {
-            return 1;
-        } else {
-            return 0;
-        }
-        break;
-    }
-    case ESP_MATTER_VAL_TYPE_UINT32:
-    case ESP_MATTER_VAL_TYPE_BITMAP32:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_UINT32:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_BITMAP32: {
-        using Traits = chip::app::NumericAttributeTraits<uint32_t>;
-        if ((val.type & ESP_MATTER_VAL_NULLABLE_BASE) && Traits::IsNullValue(val.val.u32)) {
-            return 0;
-        }
-        if (val.val.u32 < bounds.min.val.u32) {
-            return -1;
-        } else if (val.val.u32 > bounds.max.val.u32) {
-            return 1;
-        } else {
-            return 0;
-        }
-        break;
-    }
-    case ESP_MATTER_VAL_TYPE_UINT64:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_UINT64: {
-        using Traits = chip::app::NumericAttributeTraits<uint64_t>;
-        if ((val.type & ESP_MATTER_VAL_NULLABLE_BASE) && Traits::IsNullValue(val.val.u64)) {
-            return 0;
-        }
-        if (val.val.u64 < bounds.min.val.u64) {
-            return -1;
-        } else if (val.val.u64 > bounds.max.val.u64) {
-            return 1;
-        } else {
-            return 0;
-        }
-        break;
-    }
-    case ESP_MATTER_VAL_TYPE_INT8:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_INT8: {
-        using Traits = chip::app::NumericAttributeTraits<int8_t>;
-        if ((val.type & ESP_MATTER_VAL_NULLABLE_BASE) && Traits::IsNullValue(val.val.i8)) {
-            return 0;
-        }
-        if (val.val.i8 < bounds.min.val.i8) {
-            return -1;
-        } else if (val.val.i8 > bounds.max.val.i8) {
-            return 1;
-        } else {
-            return 0;
-        }
-        break;
-    }
-    case ESP_MATTER_VAL_TYPE_INT16:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_INT16: {
-        using Traits = chip::app::NumericAttributeTraits<int16_t>;
-        if ((val.type & ESP_MATTER_VAL_NULLABLE_BASE) && Traits::IsNullValue(val.val.i16)) {
-            return 0;
-        }
-        if (val.val.i16 < bounds.min.val.i16) {
-            return -1;
-        } else if (val.val.i16 > bounds.max.val.i16) {
-            return 1;
-        } else {
-            return 0;
-        }
-        break;
-    }
-    case ESP_MATTER_VAL_TYPE_INT32:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_INT32: {
-        using Traits = chip::app::NumericAttributeTraits<int32_t>;
-        if ((val.type & ESP_MATTER_VAL_NULLABLE_BASE) && Traits::IsNullValue(val.val.i32)) {
-            return 0;
-        }
-        if (val.val.i32 < bounds.min.val.i32) {
-            return -1;
-        } else if (val.val.i32 > bounds.max.val.i32) {
-            return 1;
-        } else {
-            return 0;
-        }
-        break;
-    }
-    case ESP_MATTER_VAL_TYPE_INT64:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_INT64: {
-        using Traits = chip::app::NumericAttributeTraits<int64_t>;
-        if ((val.type & ESP_MATTER_VAL_NULLABLE_BASE) && Traits::IsNullValue(val.val.i64)) {
-            return 0;
-        }
-        if (val.val.i64 < bounds.min.val.i64) {
-            return -1;
-        } else if (val.val.i64 > bounds.max.val.i64) {
-            return 1;
-        } else {
-            return 0;
-        }
-        break;
-    }
-    case ESP_MATTER_VAL_TYPE_FLOAT:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_FLOAT: {
-        using Traits = chip::app::NumericAttributeTraits<float>;
-        if ((val.type & ESP_MATTER_VAL_NULLABLE_BASE) && Traits::IsNullValue(val.val.f)) {
-            return 0;
-        }
-        if (val.val.f < bounds.min.val.f) {
-            return -1;
-        } else if (val.val.f > bounds.max.val.f) {
-            return 1;
-        } else {
-            return 0;
-        }
-        break;
-    }
-    default:
-        ESP_LOGE(TAG, "Failed to compare_attr_val_with_bounds as the attribute value type is wrong");
-        break;
-    }
-    return -2;
-}
-
 static esp_err_t bound_attribute_val(attribute_t *attribute)
 {
     _attribute_t *current_attribute = (_attribute_t *)attribute;
     esp_matter_attr_val_t temp_val;
     temp_val.type = current_attribute->attribute_val_type;
     temp_val.val = current_attribute->attribute_val;
-    int compare_result = compare_attr_val_with_bounds(temp_val, *current_attribute->bounds);
+    int compare_result =
+        codec::compare_with_bounds(temp_val, current_attribute->bounds->min, current_attribute->bounds->max);
     if (compare_result == 1) {
-        current_attribute->attribute_val = current_attribute->bounds->max.val;
+        current_attribute->attribute_val = current_attribute->bounds->max;
     } else if (compare_result == -1) {
-        current_attribute->attribute_val = current_attribute->bounds->min.val;
+        current_attribute->attribute_val = current_attribute->bounds->min;
     } else if (compare_result != 0) {
         return ESP_ERR_INVALID_ARG;
     }
@@ -581,7 +585,8 @@ attribute_t *create(cluster_t *cluster, uint32_t attribute_id, uint16_t flags, e
 
     if (flags & ATTRIBUTE_FLAG_MANAGED_INTERNALLY) {
         /* Create */
-        attribute = (_attribute_t *)esp_matter_mem_calloc(1, sizeof(_attribute_base_t));
+        attribute = (_attribute_t *)esp_matter_mem_calloc_tagged(
+            get_mem_stats(current_cluster), ESP_MATTER_MEM_CATEGORY_ATTRIBUTE, 1, sizeof(_attribute_base_t));
         if (!attribute) {
             return nullptr;
         }
@@ -591,7 +596,8 @@ attribute_t *create(cluster_t *cluster, uint32_t attribute_id, uint16_t flags, e
         attribute->attribute_val_type = val.type;
         attribute->attribute_id = attribute_id;
     } else {
-        attribute = (_attribute_t *)esp_matter_mem_calloc(1, sizeof(_attribute_t));
+        attribute = (_attribute_t *)esp_matter_mem_calloc_tagged(
+            get_mem_stats(current_cluster), ESP_MATTER_MEM_CATEGORY_ATTRIBUTE, 1, sizeof(_attribute_t));
         if (!attribute) {
             return nullptr;
         }
@@ -617,6 +623,8 @@ attribute_t *create(cluster_t *cluster, uint32_t attribute_id, uint16_t flags, e
                 get_val_from_nvs(attribute->endpoint_id, attribute->cluster_id, attribute_id, temp_val);
             if (err == ESP_OK) {
                 attribute->attribute_val = temp_val.val;
+                esp_matter_mem_stats_add(get_mem_stats(current_cluster), ESP_MATTER_MEM_CATEGORY_ATTRIBUTE_VALUE,
+                                         get_val_buf_size(attribute->attribute_val_type, attribute->attribute_val));
                 attribute_updated = true;
             }
         }
@@ -627,17 +635,20 @@ attribute_t *create(cluster_t *cluster, uint32_t attribute_id, uint16_t flags, e
 
     /* Add */
     SinglyLinkedList<_attribute_base_t>::append(&current_cluster->attribute_list, attribute);
+    current_cluster->attribute_mask_ids = nullptr;
     return (attribute_t *)attribute;
 }
 
-static esp_err_t free_attribute(attribute_t *attribute)
+static esp_err_t free_attribute(_cluster_t *cluster, attribute_t *attribute)
 {
     VerifyOrReturnError(attribute, ESP_ERR_INVALID_ARG, ESP_LOGE(TAG, "Attribute cannot be NULL"));
     _attribute_t *current_attribute = (_attribute_t *)attribute;
+    esp_matter_mem_stats_t *mem_stats = get_mem_stats(cluster);
 
     if (current_attribute->flags & ATTRIBUTE_FLAG_MANAGED_INTERNALLY) {
         // For attribute managed internally, free as the _attribute_base_t pointer.
-        esp_matter_mem_free((_attribute_base_t *)attribute);
+        esp_matter_mem_free_tagged(mem_stats, ESP_MATTER_MEM_CATEGORY_ATTRIBUTE, (_attribute_base_t *)attribute,
+                                   sizeof(_attribute_base_t));
         return ESP_OK;
     }
 
@@ -648,7 +659,9 @@ static esp_err_t free_attribute(attribute_t *attribute)
             current_attribute->attribute_val_type == ESP_MATTER_VAL_TYPE_LONG_OCTET_STRING ||
             current_attribute->attribute_val_type == ESP_MATTER_VAL_TYPE_ARRAY) {
         /* Free buf */
-        esp_matter_mem_free(current_attribute->attribute_val.a.b);
+        esp_matter_mem_free_tagged(
+            mem_stats, ESP_MATTER_MEM_CATEGORY_ATTRIBUTE_VALUE, current_attribute->attribute_val.a.b,
+            get_val_buf_size(current_attribute->attribute_val_type, current_attribute->attribute_val));
     }
 
     /* Erase the persistent data */
@@ -658,10 +671,29 @@ static esp_err_t free_attribute(attribute_t *attribute)
     }
 
     /* Free */
-    esp_matter_mem_free(current_attribute);
+    esp_matter_mem_free_tagged(mem_stats, ESP_MATTER_MEM_CATEGORY_ATTRIBUTE, current_attribute, sizeof(_attribute_t));
     return ESP_OK;
 }
 
+/* Release the bounds entry of an attribute removed from the cluster, the last entry of the table takes its place */
+static void free_bounds_entry(_cluster_t *cluster, _attribute_bounds_t *bounds)
+{
+    VerifyOrReturn(bounds && cluster->bounds_count > 0);
+    _attribute_bounds_t *last_bounds = &cluster->bounds_table[cluster->bounds_count - 1];
+    if (bounds != last_bounds) {
+        *bounds = *last_bounds;
+        for (_attribute_base_t *attribute = cluster->attribute_list; attribute; attribute = attribute->next) {
+            _attribute_t *current_attribute = (_attribute_t *)attribute;
+            if (!(attribute->flags & ATTRIBUTE_FLAG_MANAGED_INTERNALLY) &&
+                    (attribute->flags & ATTRIBUTE_FLAG_MIN_MAX) && current_attribute->bounds == last_bounds) {
+                current_attribute->bounds = bounds;
+                break;
+            }
+        }
+    }
+    cluster->bounds_count--;
+}
+
 esp_err_t destroy(cluster_t *cluster, attribute_t *attribute)
 {
     VerifyOrReturnError(cluster && attribute, ESP_ERR_INVALID_ARG, ESP_LOGE(TAG, "Cluster or attribute cannot be NULL"));
@@ -675,7 +707,12 @@ esp_err_t destroy(cluster_t *cluster, attribute_t *attribute)
 
     VerifyOrReturnError(*current_attribute, ESP_ERR_NOT_FOUND, ESP_LOGE(TAG, "Attribute not found in the cluster"));
     *current_attribute = target_attribute->next;
-    return free_attribute(attribute);
+    current_cluster->attribute_mask_ids = nullptr;
+    if (!(target_attribute->flags & ATTRIBUTE_FLAG_MANAGED_INTERNALLY) &&
+            (target_attribute->flags & ATTRIBUTE_FLAG_MIN_MAX)) {
+        free_bounds_entry(current_cluster, ((_attribute_t *)attribute)->bounds);
+    }
+    return free_attribute(current_cluster, attribute);
 }
 
 attribute_t *get(cluster_t *cluster, uint32_t attribute_id)
@@ -745,13 +782,15 @@ esp_err_t set_val_internal(attribute_t *attribute, esp_matter_attr_val_t *val, b
     // As we know that this is esp-matter managed attribute, we can safely log the path
     ESP_LOGD(TAG, "setting attribute value for: 0x%x:0x%" PRIx32 ":0x%" PRIx32, current_attribute->endpoint_id,
              current_attribute->cluster_id, current_attribute->attribute_id);
+    ESP_MATTER_TRACE_SCOPE(ATTRIBUTE_SET_VAL, current_attribute->endpoint_id, current_attribute->cluster_id,
+                           current_attribute->attribute_id);
 
     VerifyOrReturnError(current_attribute->attribute_val_type == val->type, ESP_ERR_INVALID_ARG,
                         ESP_LOGE(TAG, "Different value type : Expected Type : %u Attempted Type: %u",
                                  current_attribute->attribute_val_type, val->type));
 
     if ((current_attribute->flags & ATTRIBUTE_FLAG_MIN_MAX) && current_attribute->bounds) {
-        if (compare_attr_val_with_bounds(*val, *current_attribute->bounds) != 0) {
+        if (codec::compare_with_bounds(*val, current_attribute->bounds->min, current_attribute->bounds->max) != 0) {
             return ESP_ERR_INVALID_ARG;
         }
     }
@@ -776,23 +815,29 @@ esp_err_t set_val_internal(attribute_t *attribute, esp_matter_attr_val_t *val, b
             ? UINT8_MAX
             : UINT16_MAX;
         if (val->val.a.s > 0) {
+            esp_matter_mem_stats_t *mem_stats = nullptr;
+#if CONFIG_ESP_MATTER_MEM_STATS
+            mem_stats = get_mem_stats(
+                (_cluster_t *)cluster::get(current_attribute->endpoint_id, current_attribute->cluster_id));
+#endif
             uint8_t *new_buf = nullptr;
             if (val->val.a.s != null_len) {
                 if (val->val.a.s > current_attribute->attribute_val.a.max) {
                     return ESP_ERR_NO_MEM;
                 }
-                /* Free old buf */
-                esp_matter_mem_free(current_attribute->attribute_val.a.b);
-                current_attribute->attribute_val.a.b = nullptr;
-
                 bool null_reserve =
                     val->type == ESP_MATTER_VAL_TYPE_LONG_CHAR_STRING || val->type == ESP_MATTER_VAL_TYPE_CHAR_STRING;
                 /* Alloc new buf */
-                new_buf = (uint8_t *)esp_matter_mem_calloc(1, val->val.a.s + (null_reserve ? 1 : 0));
+                new_buf = (uint8_t *)esp_matter_mem_calloc_tagged(mem_stats, ESP_MATTER_MEM_CATEGORY_ATTRIBUTE_VALUE, 1,
+                                                                  val->val.a.s + (null_reserve ? 1 : 0));
                 VerifyOrReturnError(new_buf, ESP_ERR_NO_MEM, ESP_LOGE(TAG, "Could not allocate new buffer"));
                 /* Copy to new buf and assign */
                 memcpy(new_buf, val->val.a.b, val->val.a.s);
             }
+            /* Free old buf, also when the new value is null */
+            esp_matter_mem_free_tagged(
+                mem_stats, ESP_MATTER_MEM_CATEGORY_ATTRIBUTE_VALUE, current_attribute->attribute_val.a.b,
+                get_val_buf_size(current_attribute->attribute_val_type, current_attribute->attribute_val));
             current_attribute->attribute_val.a.b = new_buf;
             current_attribute->attribute_val.a.s = val->val.a.s;
             current_attribute->attribute_val.a.t = val->val.a.t;
@@ -906,6 +951,7 @@ static esp_err_t get_val_from_tlv_data(const uint8_t *tlv_data, uint32_t tlv_len
         uint32_t bytes_to_copy = (is_type_string ? val->val.a.s + 1 : val->val.a.s);
 
         if (val->val.a.b && bytes_to_copy > 0) {
+            // Not accounted in the memory stats, the caller owns the buffer and frees it with esp_matter_mem_free()
             uint8_t *new_buf = (uint8_t *)esp_matter_mem_calloc(sizeof(uint8_t), bytes_to_copy);
             VerifyOrReturnError(new_buf != nullptr, ESP_ERR_NO_MEM);
             memcpy(new_buf, val->val.a.b, bytes_to_copy);
@@ -1131,6 +1177,51 @@ esp_err_t set_val(attribute_t *attribute, esp_matter_attr_val_t *val, bool call_
     return set_val(endpoint_id, cluster_id, attribute_id, val, call_callbacks);
 }
 
+static bool is_bounds_supported(esp_matter_val_type_t type)
+{
+    return type != ESP_MATTER_VAL_TYPE_CHAR_STRING && type != ESP_MATTER_VAL_TYPE_LONG_CHAR_STRING &&
+           type != ESP_MATTER_VAL_TYPE_OCTET_STRING && type != ESP_MATTER_VAL_TYPE_LONG_OCTET_STRING &&
+           type != ESP_MATTER_VAL_TYPE_ARRAY && type != ESP_MATTER_VAL_TYPE_BOOLEAN &&
+           type != ESP_MATTER_VAL_TYPE_NULLABLE_BOOLEAN;
+}
+
+/* Get a free entry in the bounds table of the cluster. When the table is full, it is reallocated with room for all
+ * the attributes of the cluster which support bounds, so that a cluster normally ends up with a single allocation. */
+static _attribute_bounds_t *alloc_bounds_entry(_cluster_t *cluster)
+{
+    if (cluster->bounds_count >= cluster->bounds_capacity) {
+        uint16_t capacity = 0;
+        for (_attribute_base_t *attribute = cluster->attribute_list; attribute; attribute = attribute->next) {
+            if (!(attribute->flags & ATTRIBUTE_FLAG_MANAGED_INTERNALLY) &&
+                    is_bounds_supported(attribute->attribute_val_type)) {
+                capacity++;
+            }
+        }
+        if (capacity <= cluster->bounds_count) {
+            capacity = cluster->bounds_count + 1;
+        }
+        _attribute_bounds_t *table = (_attribute_bounds_t *)esp_matter_mem_calloc_tagged(
+            get_mem_stats(cluster), ESP_MATTER_MEM_CATEGORY_BOUNDS, capacity, sizeof(_attribute_bounds_t));
+        VerifyOrReturnValue(table, nullptr);
+        if (cluster->bounds_table) {
+            memcpy(table, cluster->bounds_table, cluster->bounds_count * sizeof(_attribute_bounds_t));
+            /* Move the bounds pointers of the attributes to the new table */
+            for (_attribute_base_t *attribute = cluster->attribute_list; attribute; attribute = attribute->next) {
+                _attribute_t *current_attribute = (_attribute_t *)attribute;
+                if (!(attribute->flags & ATTRIBUTE_FLAG_MANAGED_INTERNALLY) &&
+                        (attribute->flags & ATTRIBUTE_FLAG_MIN_MAX) && current_attribute->bounds) {
+                    current_attribute->bounds = table + (current_attribute->bounds - cluster->bounds_table);
+                }
+            }
+            esp_matter_mem_free_tagged(get_mem_stats(cluster), ESP_MATTER_MEM_CATEGORY_BOUNDS, cluster->bounds_table,
+                                       cluster->bounds_capacity * sizeof(_attribute_bounds_t));
+        }
+        cluster->bounds_table = table;
+        cluster->bounds_capacity = capacity;
+    }
+    return &cluster->bounds_table[cluster->bounds_count++];
+}
+
 esp_err_t add_bounds(attribute_t *attribute, esp_matter_attr_val_t min, esp_matter_attr_val_t max)
 {
     VerifyOrReturnError(attribute, ESP_ERR_INVALID_ARG, ESP_LOGE(TAG, "Attribute cannot be NULL"));
@@ -1140,12 +1231,7 @@ esp_err_t add_bounds(attribute_t *attribute, esp_matter_attr_val_t min, esp_matt
                         "Attribute is not managed by esp matter data model");
 
     /* Check if bounds can be set */
-    if (current_attribute->attribute_val_type == ESP_MATTER_VAL_TYPE_CHAR_STRING ||
-            current_attribute->attribute_val_type == ESP_MATTER_VAL_TYPE_LONG_CHAR_STRING ||
-            current_attribute->attribute_val_type == ESP_MATTER_VAL_TYPE_OCTET_STRING ||
-            current_attribute->attribute_val_type == ESP_MATTER_VAL_TYPE_LONG_OCTET_STRING ||
-            current_attribute->attribute_val_type == ESP_MATTER_VAL_TYPE_ARRAY ||
-            current_attribute->attribute_val_type == ESP_MATTER_VAL_TYPE_BOOLEAN) {
+    if (!is_bounds_supported(current_attribute->attribute_val_type)) {
         ESP_LOGE(TAG, "Bounds cannot be set for string/array/boolean type attributes");
         return ESP_ERR_INVALID_ARG;
     }
@@ -1153,14 +1239,19 @@ esp_err_t add_bounds(attribute_t *attribute, esp_matter_attr_val_t min, esp_matt
                         ESP_ERR_INVALID_ARG,
                         ESP_LOGE(TAG, "Cannot set bounds because of val type mismatch: expected: %d, min: %d, max: %d",
                                  current_attribute->attribute_val_type, min.type, max.type));
-    current_attribute->bounds = (esp_matter_attr_bounds_t *)esp_matter_mem_calloc(1, sizeof(esp_matter_attr_bounds_t));
-    if (!current_attribute->bounds) {
-        ESP_LOGE(TAG, "Failed to allocate bounds for attribute");
-        return ESP_ERR_NO_MEM;
+    /* The add_bounds callbacks run again each time the endpoint is enabled, reuse the existing entry in that case */
+    if (!(current_attribute->flags & ATTRIBUTE_FLAG_MIN_MAX) || !current_attribute->bounds) {
+        _cluster_t *cluster = (_cluster_t *)cluster::get(current_attribute->endpoint_id, current_attribute->cluster_id);
+        VerifyOrReturnError(cluster, ESP_ERR_INVALID_STATE, ESP_LOGE(TAG, "Cluster of the attribute not found"));
+        current_attribute->bounds = alloc_bounds_entry(cluster);
+        if (!current_attribute->bounds) {
+            ESP_LOGE(TAG, "Failed to allocate bounds for attribute");
+            return ESP_ERR_NO_MEM;
+        }
     }
     current_attribute->flags |= ATTRIBUTE_FLAG_MIN_MAX;
-    current_attribute->bounds->min = min;
-    current_attribute->bounds->max = max;
+    current_attribute->bounds->min = min.val;
+    current_attribute->bounds->max = max.val;
     return bound_attribute_val(attribute);
 }
 
@@ -1182,7 +1273,10 @@ esp_err_t get_bounds(attribute_t *attribute, esp_matter_attr_bounds_t *bounds)
                  current_attribute->endpoint_id, current_attribute->cluster_id, current_attribute->attribute_id);
         return ESP_ERR_INVALID_ARG;
     }
-    *bounds = *current_attribute->bounds;
+    bounds->min.type = current_attribute->attribute_val_type;
+    bounds->min.val = current_attribute->bounds->min;
+    bounds->max.type = current_attribute->attribute_val_type;
+    bounds->max.val = current_attribute->bounds->max;
     return ESP_OK;
 }
 
@@ -1259,7 +1353,8 @@ command_t *create(cluster_t *cluster, uint32_t command_id, uint8_t flags, callba
     }
 
     /* Allocate */
-    _command_t *command = (_command_t *)esp_matter_mem_calloc(1, sizeof(_command_t));
+    _command_t *command = (_command_t *)esp_matter_mem_calloc_tagged(
+        get_mem_stats(current_cluster), ESP_MATTER_MEM_CATEGORY_COMMAND, 1, sizeof(_command_t));
     VerifyOrReturnValue(command, NULL, ESP_LOGE(TAG, "Couldn't allocate _command_t"));
 
     /* Set */
@@ -1270,6 +1365,7 @@ command_t *create(cluster_t *cluster, uint32_t command_id, uint8_t flags, callba
 
     /* Add */
     SinglyLinkedList<_command_t>::append(&current_cluster->command_list, command);
+    current_cluster->command_mask_ids = nullptr;
     return (command_t *)command;
 }
 
@@ -1278,7 +1374,9 @@ esp_err_t destroy(cluster_t *cluster, command_t *command)
     VerifyOrReturnError(cluster && command, ESP_ERR_INVALID_ARG, ESP_LOGE(TAG, "Cluster or command cannot be NULL"));
     _cluster_t *current_cluster = (_cluster_t *)cluster;
     _command_t *current_command = (_command_t *)command;
+    esp_matter_mem_stats_sub(get_mem_stats(current_cluster), ESP_MATTER_MEM_CATEGORY_COMMAND, sizeof(_command_t));
     SinglyLinkedList<_command_t>::remove(&current_cluster->command_list, current_command);
+    current_cluster->command_mask_ids = nullptr;
     return ESP_OK;
 }
 
@@ -1379,7 +1477,8 @@ event_t *create(cluster_t *cluster, uint32_t event_id)
     }
 
     /* Allocate */
-    _event_t *event = (_event_t *)esp_matter_mem_calloc(1, sizeof(_event_t));
+    _event_t *event = (_event_t *)esp_matter_mem_calloc_tagged(get_mem_stats(current_cluster),
+                                                               ESP_MATTER_MEM_CATEGORY_EVENT, 1, sizeof(_event_t));
     VerifyOrReturnValue(event, NULL, ESP_LOGE(TAG, "Couldn't allocate _event_t"));
 
     /* Set */
@@ -1395,6 +1494,7 @@ esp_err_t destroy(cluster_t *cluster, event_t *event)
     VerifyOrReturnError(cluster && event, ESP_ERR_INVALID_ARG, ESP_LOGE(TAG, "Cluster or event cannot be NULL"));
     _cluster_t *current_cluster = (_cluster_t *)cluster;
     _event_t *current_event = (_event_t *)event;
+    esp_matter_mem_stats_sub(get_mem_stats(current_cluster), ESP_MATTER_MEM_CATEGORY_EVENT, sizeof(_event_t));
     SinglyLinkedList<_event_t>::remove(&current_cluster->event_list, current_event);
     return ESP_OK;
 }
@@ -1471,6 +1571,16 @@ cluster_t *create(endpoint_t *endpoint, uint32_t cluster_id, uint8_t flags)
     cluster->plugin_server_init_callback = nullptr;
     cluster->init_callback = nullptr;
     cluster->shutdown_callback = nullptr;
+    cluster->bounds_table = nullptr;
+    cluster->bounds_count = 0;
+    cluster->bounds_capacity = 0;
+    cluster->attribute_mask_ids = nullptr;
+    cluster->attribute_mask = 0;
+    cluster->attribute_mask_count = 0;
+    cluster->command_mask_ids = nullptr;
+    cluster->command_mask = 0;
+    cluster->command_mask_count = 0;
+    esp_matter_mem_stats_add(get_mem_stats(cluster), ESP_MATTER_MEM_CATEGORY_CLUSTER, sizeof(_cluster_t));
 
     /* Add */
     SinglyLinkedList<_cluster_t>::append(&current_endpoint->cluster_list, cluster);
@@ -1483,20 +1593,28 @@ esp_err_t destroy(cluster_t *cluster)
     _cluster_t *current_cluster = (_cluster_t *)cluster;
 
     /* Parse and delete all commands */
+    esp_matter_mem_stats_sub(get_mem_stats(current_cluster), ESP_MATTER_MEM_CATEGORY_COMMAND,
+                             SinglyLinkedList<_command_t>::count(current_cluster->command_list) * sizeof(_command_t));
     SinglyLinkedList<_command_t>::delete_list(&current_cluster->command_list);
 
     /* Parse and delete all attributes */
     _attribute_base_t *attribute = current_cluster->attribute_list;
     while (attribute) {
         _attribute_base_t *next_attribute = attribute->next;
-        attribute::free_attribute((attribute_t *)attribute);
+        attribute::free_attribute(current_cluster, (attribute_t *)attribute);
         attribute = next_attribute;
     }
 
     /* Parse and delete all events */
+    esp_matter_mem_stats_sub(get_mem_stats(current_cluster), ESP_MATTER_MEM_CATEGORY_EVENT,
+                             SinglyLinkedList<_event_t>::count(current_cluster->event_list) * sizeof(_event_t));
     SinglyLinkedList<_event_t>::delete_list(&current_cluster->event_list);
 
     /* Free */
+    esp_matter_mem_free_tagged(get_mem_stats(current_cluster), ESP_MATTER_MEM_CATEGORY_BOUNDS,
+                               current_cluster->bounds_table,
+                               current_cluster->bounds_capacity * sizeof(_attribute_bounds_t));
+    esp_matter_mem_stats_sub(get_mem_stats(current_cluster), ESP_MATTER_MEM_CATEGORY_CLUSTER, sizeof(_cluster_t));
     esp_matter_mem_free(current_cluster);
     return ESP_OK;
 }
@@ -1566,6 +1684,48 @@ esp_err_t increase_data_version(cluster_t *cluster)
     return ESP_OK;
 }
 
+static uint32_t get_id_mask(uint32_t id, const uint32_t *ids, uint8_t count)
+{
+    for (uint8_t i = 0; i < count; i++) {
+        if (ids[i] == id) {
+            return (uint32_t)1 << i;
+        }
+    }
+    return 0;
+}
+
+uint32_t get_attribute_mask(cluster_t *cluster, const uint32_t *attribute_ids, uint8_t count)
+{
+    VerifyOrReturnValue(cluster && attribute_ids && count <= 32, 0, ESP_LOGE(TAG, "Invalid arguments"));
+    _cluster_t *current_cluster = (_cluster_t *)cluster;
+    if (current_cluster->attribute_mask_ids != attribute_ids || current_cluster->attribute_mask_count != count) {
+        uint32_t mask = 0;
+        for (_attribute_base_t *attribute = current_cluster->attribute_list; attribute; attribute = attribute->next) {
+            mask |= get_id_mask(attribute->attribute_id, attribute_ids, count);
+        }
+        current_cluster->attribute_mask = mask;
+        current_cluster->attribute_mask_ids = attribute_ids;
+        current_cluster->attribute_mask_count = count;
+    }
+    return current_cluster->attribute_mask;
+}
+
+uint32_t get_command_mask(cluster_t *cluster, const uint32_t *command_ids, uint8_t count)
+{
+    VerifyOrReturnValue(cluster && command_ids && count <= 32, 0, ESP_LOGE(TAG, "Invalid arguments"));
+    _cluster_t *current_cluster = (_cluster_t *)cluster;
+    if (current_cluster->command_mask_ids != command_ids || current_cluster->command_mask_count != count) {
+        uint32_t mask = 0;
+        for (_command_t *command = current_cluster->command_list; command; command = command->next) {
+            mask |= get_id_mask(command->command_id, command_ids, count);
+        }
+        current_cluster->command_mask = mask;
+        current_cluster->command_mask_ids = command_ids;
+        current_cluster->command_mask_count = count;
+    }
+    return current_cluster->command_mask;
+}
+
 void *get_delegate_impl(cluster_t *cluster)
 {
     VerifyOrReturnValue(cluster, NULL, ESP_LOGE(TAG, "Cluster cannot be NULL."));
@@ -1688,6 +1848,7 @@ endpoint_t *create(node_t *node, uint8_t flags, void *priv_data)
     /* Allocate */
     _endpoint_t *endpoint = (_endpoint_t *)esp_matter_mem_calloc(1, sizeof(_endpoint_t));
     VerifyOrReturnValue(endpoint, NULL, ESP_LOGE(TAG, "Couldn't allocate _endpoint_t"));
+    esp_matter_mem_stats_add(get_mem_stats(endpoint), ESP_MATTER_MEM_CATEGORY_ENDPOINT, sizeof(_endpoint_t));
 
     /* Set */
     endpoint->endpoint_id = current_node->min_unused_endpoint_id++;
@@ -1700,7 +1861,15 @@ endpoint_t *create(node_t *node, uint8_t flags, void *priv_data)
     endpoint->enabled = true;
     /* Store */
     if (esp_matter::is_started()) {
-        node::store_min_unused_endpoint_id();
+        taskENTER_CRITICAL(&endpoint_batch_lock);
+        bool batched = endpoint_batch.depth > 0;
+        if (batched) {
+            endpoint_batch.min_unused_endpoint_id_dirty = true;
+        }
+        taskEXIT_CRITICAL(&endpoint_batch_lock);
+        if (!batched) {
+            node::store_min_unused_endpoint_id();
+        }
     }
 
     /* Add */
@@ -1730,6 +1899,7 @@ endpoint_t *resume(node_t *node, uint8_t flags, uint16_t endpoint_id, void *priv
     /* Allocate */
     _endpoint_t *endpoint = (_endpoint_t *)esp_matter_mem_calloc(1, sizeof(_endpoint_t));
     VerifyOrReturnValue(endpoint, NULL, ESP_LOGE(TAG, "Couldn't allocate _endpoint_t"));
+    esp_matter_mem_stats_add(get_mem_stats(endpoint), ESP_MATTER_MEM_CATEGORY_ENDPOINT, sizeof(_endpoint_t));
 
     /* Set */
     endpoint->endpoint_id = endpoint_id;
@@ -1790,6 +1960,8 @@ esp_err_t destroy(node_t *node, endpoint_t *endpoint)
             }
             cluster = cluster::get_next(cluster);
         }
+        /* The pooled mode and operational state instances of the endpoint go back to their pools */
+        cluster::delegate_cb::ReleaseEndpointInstances(endpoint::get_id(endpoint));
     }
 
     /* Parse and delete all clusters */
@@ -1814,6 +1986,7 @@ esp_err_t destroy(node_t *node, endpoint_t *endpoint)
         chip::Platform::Delete(current_endpoint->identify);
         current_endpoint->identify = NULL;
     }
+    esp_matter_mem_stats_sub(get_mem_stats(current_endpoint), ESP_MATTER_MEM_CATEGORY_ENDPOINT, sizeof(_endpoint_t));
     esp_matter_mem_free(current_endpoint);
 
     return ESP_OK;
@@ -2123,6 +2296,24 @@ esp_err_t destroy()
     return destroy_raw();
 }
 
+esp_err_t memory_report(memory_report_callback_t callback, void *context)
+{
+#if CONFIG_ESP_MATTER_MEM_STATS
+    VerifyOrReturnError(callback, ESP_ERR_INVALID_ARG, ESP_LOGE(TAG, "Callback cannot be NULL"));
+    VerifyOrReturnError(node, ESP_ERR_INVALID_STATE, ESP_LOGE(TAG, "Node does not exist"));
+    for (_endpoint_t *endpoint = node->endpoint_list; endpoint; endpoint = endpoint->next) {
+        callback(endpoint->endpoint_id, kInvalidClusterId, endpoint->mem_stats, context);
+        for (_cluster_t *cluster = endpoint->cluster_list; cluster; cluster = cluster->next) {
+            callback(endpoint->endpoint_id, cluster->cluster_id, cluster->mem_stats, context);
+        }
+    }
+    return ESP_OK;
+#else
+    ESP_LOGE(TAG, "Enable CONFIG_ESP_MATTER_MEM_STATS for the memory report");
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
 uint32_t get_server_cluster_endpoint_count(uint32_t cluster_id)
 {
     return endpoint::get_cluster_count(chip::kInvalidEndpointId, cluster_id, CLUSTER_FLAG_SERVER);
@@ -15,6 +15,7 @@
 #pragma once
 #include <esp_err.h>
 #include <esp_matter_attribute_utils.h>
+#include <esp_matter_mem.h>
 #include <app/data-model-provider/Provider.h>
 #include "app/ConcreteCommandPath.h"
 #include "app/server-cluster/ServerClusterInterface.h"
@@ -171,6 +172,33 @@ uint32_t get_server_cluster_endpoint_count(uint32_t cluster_id);
  */
 uint32_t get_client_cluster_endpoint_count(uint32_t cluster_id);
 
+/** Memory report callback
+ *
+ * @param[in] endpoint_id Endpoint ID.
+ * @param[in] cluster_id Cluster ID, or chip::kInvalidClusterId for the memory of the endpoint itself.
+ * @param[in] stats Live and peak bytes by category.
+ * @param[in] context Context passed to memory_report().
+ */
+typedef void (*memory_report_callback_t)(uint16_t endpoint_id, uint32_t cluster_id,
+                                         const esp_matter_mem_stats_t &stats, void *context);
+
+/** Memory report of the data model
+ *
+ * Call the callback with the memory accounted to each endpoint and then to each cluster of the endpoint. The node
+ * wide totals are available with esp_matter_mem_get_total_stats().
+ *
+ * @note: CONFIG_ESP_MATTER_MEM_STATS should be enabled. Memory allocated by the application or by the cluster
+ * delegates is not accounted.
+ *
+ * @param[in] callback Callback called for each endpoint and cluster.
+ * @param[in] context Context passed to the callback.
+ *
+ * @return ESP_OK on success.
+ * @return ESP_ERR_NOT_SUPPORTED if CONFIG_ESP_MATTER_MEM_STATS is not enabled.
+ * @return error in case of failure.
+ */
+esp_err_t memory_report(memory_report_callback_t callback, void *context);
+
 } /* node */
 
 namespace endpoint {
@@ -442,6 +470,19 @@ esp_err_t set_identify(uint16_t endpoint_id, void *identify);
  */
 esp_err_t enable(endpoint_t *endpoint);
 
+/** Initialize the clusters added to an enabled endpoint
+ *
+ * Invoke the init callbacks of the clusters starting from `first_cluster`, which have been added to the endpoint
+ * after it was enabled, and mark the endpoint as changed.
+ *
+ * @param[in] endpoint Endpoint handle.
+ * @param[in] first_cluster First cluster added after the endpoint was enabled, NULL if there is none.
+ *
+ * @return ESP_OK on success.
+ * @return error in case of failure.
+ */
+esp_err_t init_clusters(endpoint_t *endpoint, cluster_t *first_cluster);
+
 /** Check if attribute is enabled
  *
  * Check if the attribute of a cluster is enabled on an endpoint.
@@ -477,6 +518,28 @@ bool is_command_enabled(uint16_t endpoint_id, uint32_t cluster_id, uint32_t comm
  */
 esp_err_t disable(endpoint_t *endpoint);
 
+/** Begin a batch of endpoint changes
+ *
+ * Until the matching `end_batch()`, the PartsList change reports of the enabled and disabled endpoints and the store
+ * of the minimum unused endpoint id are deferred, so that creating or removing many endpoints, like the bridged
+ * endpoints of a bridge, results in one report per parent endpoint and one NVS commit. Batches can be nested, only
+ * the outermost one flushes the deferred work. The batch is shared by all the tasks, so the changes made by other
+ * tasks while it is in progress are deferred as well.
+ *
+ * @return ESP_OK on success.
+ * @return error in case of failure.
+ */
+esp_err_t begin_batch();
+
+/** End a batch of endpoint changes
+ *
+ * Report the PartsList changes and store the minimum unused endpoint id deferred since `begin_batch()`.
+ *
+ * @return ESP_OK on success.
+ * @return ESP_ERR_INVALID_STATE if there is no batch in progress.
+ */
+esp_err_t end_batch();
+
 /** Get whether an endpoint is enabled
  *
  * @param[in] endpoint Endpoint handle.
@@ -668,6 +731,32 @@ esp_err_t get_data_version(cluster_t *cluster, chip::DataVersion &data_version);
  */
 esp_err_t increase_data_version(cluster_t *cluster);
 
+/** Get the mask of the attributes of a list which exist on the cluster
+ *
+ * Bit n of the mask is set if the attribute attribute_ids[n] exists on the cluster. The attribute list of the
+ * cluster is walked once and the mask is cached on the cluster: the following calls with the same list return the
+ * cached mask, until an attribute is created on or destroyed from the cluster.
+ *
+ * @param[in] cluster Cluster handle.
+ * @param[in] attribute_ids Attribute IDs, a static table: the cache is keyed by its address and the count.
+ * @param[in] count Number of attribute IDs, up to 32.
+ *
+ * @return mask of the attributes which exist on the cluster.
+ */
+uint32_t get_attribute_mask(cluster_t *cluster, const uint32_t *attribute_ids, uint8_t count);
+
+/** Get the mask of the commands of a list which exist on the cluster
+ *
+ * Same as get_attribute_mask(), for the commands of the cluster.
+ *
+ * @param[in] cluster Cluster handle.
+ * @param[in] command_ids Command IDs, a static table: the cache is keyed by its address and the count.
+ * @param[in] count Number of command IDs, up to 32.
+ *
+ * @return mask of the commands which exist on the cluster.
+ */
+uint32_t get_command_mask(cluster_t *cluster, const uint32_t *command_ids, uint8_t count);
+
 /** Get delegate pointer
  *
  * Get the delegate pointer for the cluster.
@@ -936,6 +1025,9 @@ esp_err_t set_val(attribute_t *attribute, esp_matter_attr_val_t *val, bool call_
  * This API uses the DataModelProvider::ReadAttribute API to get the value of the attribute,
  * tries to read value from the supported storages, and then populates the value in esp_matter_attr_val_t.
  *
+ * @note For string and octet string types, `val->val.a.b` is allocated for the caller with esp_matter_mem_calloc()
+ * and is not accounted in the memory stats. Free it with esp_matter_mem_free().
+ *
  * @param[in] endpoint_id Endpoint id.
  * @param[in] cluster_id Cluster id.
  * @param[in] attribute_id Attribute id.
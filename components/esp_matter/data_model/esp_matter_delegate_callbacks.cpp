@@ -12,11 +12,14 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <esp_log.h>
 #include <inttypes.h>
+#include <string.h>
 #include <esp_matter_delegate_callbacks.h>
 #include <esp_matter_core.h>
 #include <esp_matter_feature.h>
 #include <esp_matter_data_model_priv.h>
+#include <cluster_select/esp_matter_cluster_select.h>
 #include <app/clusters/mode-base-server/mode-base-server.h>
 #include <app/clusters/energy-evse-server/energy-evse-server.h>
 #include <app/clusters/microwave-oven-control-server/microwave-oven-control-server.h>
@@ -46,7 +49,7 @@
 #include <app/clusters/commodity-price-server/commodity-price-server.h>
 #include <app/clusters/electrical-grid-conditions-server/electrical-grid-conditions-server.h>
 #include <app/clusters/meter-identification-server/meter-identification-server.h>
-#include <unordered_map>
+#include <lib/support/Pool.h>
 
 #include <clusters/ota_software_update_provider/integration.h>
 #include <clusters/push_av_stream_transport/integration.h>
@@ -62,13 +65,11 @@ using namespace chip::app::Clusters;
 namespace esp_matter {
 namespace cluster {
 
-static std::unordered_map<chip::EndpointId, ModeBase::Instance*> s_microwave_oven_mode_instances;
-static std::unordered_map<chip::EndpointId, OperationalState::Instance*> s_operational_state_instances;
+static const char *TAG = "esp_matter_delegate_cb";
 
-static uint32_t get_feature_map_value(uint16_t endpoint_id, uint32_t cluster_id)
+static uint32_t get_feature_map_value(cluster_t *cluster)
 {
-    uint32_t attribute_id = Globals::Attributes::FeatureMap::Id;
-    attribute_t *attribute = attribute::get(endpoint_id, cluster_id, attribute_id);
+    attribute_t *attribute = attribute::get(cluster, Globals::Attributes::FeatureMap::Id);
     VerifyOrReturnError(attribute, 0);
 
     esp_matter_attr_val_t val = esp_matter_invalid(nullptr);
@@ -76,107 +77,252 @@ static uint32_t get_feature_map_value(uint16_t endpoint_id, uint32_t cluster_id)
     return val.val.u32;
 }
 
-// Cluster-specific optional attributes handlers
-chip::BitMask<EnergyEvse::OptionalAttributes> get_energy_evse_enabled_optional_attributes(uint16_t endpoint_id)
+static uint32_t get_feature_map_value(uint16_t endpoint_id, uint32_t cluster_id)
 {
-    chip::BitMask<EnergyEvse::OptionalAttributes> optional_attrs = 0;
-
-    if (endpoint::is_attribute_enabled(endpoint_id, EnergyEvse::Id, EnergyEvse::Attributes::UserMaximumChargeCurrent::Id)) {
-        optional_attrs.Set(EnergyEvse::OptionalAttributes::kSupportsUserMaximumChargingCurrent);
-    }
-
-    if (endpoint::is_attribute_enabled(endpoint_id, EnergyEvse::Id, EnergyEvse::Attributes::RandomizationDelayWindow::Id)) {
-        optional_attrs.Set(EnergyEvse::OptionalAttributes::kSupportsRandomizationWindow);
-    }
-
-    if (endpoint::is_attribute_enabled(endpoint_id, EnergyEvse::Id, EnergyEvse::Attributes::ApproximateEVEfficiency::Id)) {
-        optional_attrs.Set(EnergyEvse::OptionalAttributes::kSupportsApproximateEvEfficiency);
-    }
-
-    return optional_attrs;
+    cluster_t *cluster = cluster::get(endpoint_id, cluster_id);
+    VerifyOrReturnError(cluster, 0);
+    return get_feature_map_value(cluster);
 }
 
-chip::BitMask<ElectricalPowerMeasurement::OptionalAttributes> get_electrical_power_measurement_enabled_optional_attributes(uint16_t endpoint_id)
+// Map the mask of the ids which exist on the cluster to the optional attributes or commands of the cluster server.
+// ids[n] is the id of flags[n], the ids table is static so that the mask stays cached on the cluster.
+template <typename T, size_t N>
+static chip::BitMask<T> get_enabled_optional_flags(uint32_t id_mask, const T (&flags)[N])
 {
-    chip::BitMask<ElectricalPowerMeasurement::OptionalAttributes> optional_attrs = 0;
-
-    // Check for various optional attributes
-    if (endpoint::is_attribute_enabled(endpoint_id, ElectricalPowerMeasurement::Id, ElectricalPowerMeasurement::Attributes::Ranges::Id)) {
-        optional_attrs.Set(ElectricalPowerMeasurement::OptionalAttributes::kOptionalAttributeRanges);
-    }
-
-    if (endpoint::is_attribute_enabled(endpoint_id, ElectricalPowerMeasurement::Id, ElectricalPowerMeasurement::Attributes::Voltage::Id)) {
-        optional_attrs.Set(ElectricalPowerMeasurement::OptionalAttributes::kOptionalAttributeVoltage);
-    }
-
-    if (endpoint::is_attribute_enabled(endpoint_id, ElectricalPowerMeasurement::Id, ElectricalPowerMeasurement::Attributes::ActiveCurrent::Id)) {
-        optional_attrs.Set(ElectricalPowerMeasurement::OptionalAttributes::kOptionalAttributeActiveCurrent);
-    }
-
-    if (endpoint::is_attribute_enabled(endpoint_id, ElectricalPowerMeasurement::Id, ElectricalPowerMeasurement::Attributes::ReactiveCurrent::Id)) {
-        optional_attrs.Set(ElectricalPowerMeasurement::OptionalAttributes::kOptionalAttributeReactiveCurrent);
-    }
-
-    if (endpoint::is_attribute_enabled(endpoint_id, ElectricalPowerMeasurement::Id, ElectricalPowerMeasurement::Attributes::ApparentCurrent::Id)) {
-        optional_attrs.Set(ElectricalPowerMeasurement::OptionalAttributes::kOptionalAttributeApparentCurrent);
-    }
-
-    if (endpoint::is_attribute_enabled(endpoint_id, ElectricalPowerMeasurement::Id, ElectricalPowerMeasurement::Attributes::ReactivePower::Id)) {
-        optional_attrs.Set(ElectricalPowerMeasurement::OptionalAttributes::kOptionalAttributeReactivePower);
-    }
-
-    if (endpoint::is_attribute_enabled(endpoint_id, ElectricalPowerMeasurement::Id, ElectricalPowerMeasurement::Attributes::ApparentPower::Id)) {
-        optional_attrs.Set(ElectricalPowerMeasurement::OptionalAttributes::kOptionalAttributeApparentPower);
-    }
-
-    if (endpoint::is_attribute_enabled(endpoint_id, ElectricalPowerMeasurement::Id, ElectricalPowerMeasurement::Attributes::RMSVoltage::Id)) {
-        optional_attrs.Set(ElectricalPowerMeasurement::OptionalAttributes::kOptionalAttributeRMSVoltage);
-    }
-
-    if (endpoint::is_attribute_enabled(endpoint_id, ElectricalPowerMeasurement::Id, ElectricalPowerMeasurement::Attributes::RMSCurrent::Id)) {
-        optional_attrs.Set(ElectricalPowerMeasurement::OptionalAttributes::kOptionalAttributeRMSCurrent);
-    }
-
-    if (endpoint::is_attribute_enabled(endpoint_id, ElectricalPowerMeasurement::Id, ElectricalPowerMeasurement::Attributes::RMSPower::Id)) {
-        optional_attrs.Set(ElectricalPowerMeasurement::OptionalAttributes::kOptionalAttributeRMSPower);
-    }
-
-    if (endpoint::is_attribute_enabled(endpoint_id, ElectricalPowerMeasurement::Id, ElectricalPowerMeasurement::Attributes::Frequency::Id)) {
-        optional_attrs.Set(ElectricalPowerMeasurement::OptionalAttributes::kOptionalAttributeFrequency);
+    chip::BitMask<T> enabled_flags = 0;
+    for (size_t i = 0; i < N; i++) {
+        if (id_mask & ((uint32_t)1 << i)) {
+            enabled_flags.Set(flags[i]);
+        }
     }
+    return enabled_flags;
+}
 
-    if (endpoint::is_attribute_enabled(endpoint_id, ElectricalPowerMeasurement::Id, ElectricalPowerMeasurement::Attributes::PowerFactor::Id)) {
-        optional_attrs.Set(ElectricalPowerMeasurement::OptionalAttributes::kOptionalAttributePowerFactor);
-    }
+// Cluster-specific optional attributes handlers
+static const uint32_t k_energy_evse_optional_attribute_ids[] = {
+    EnergyEvse::Attributes::UserMaximumChargeCurrent::Id,
+    EnergyEvse::Attributes::RandomizationDelayWindow::Id,
+    EnergyEvse::Attributes::ApproximateEVEfficiency::Id,
+};
+
+static const EnergyEvse::OptionalAttributes k_energy_evse_optional_attributes[] = {
+    EnergyEvse::OptionalAttributes::kSupportsUserMaximumChargingCurrent,
+    EnergyEvse::OptionalAttributes::kSupportsRandomizationWindow,
+    EnergyEvse::OptionalAttributes::kSupportsApproximateEvEfficiency,
+};
+
+static chip::BitMask<EnergyEvse::OptionalAttributes> get_energy_evse_enabled_optional_attributes(cluster_t *cluster)
+{
+    uint32_t id_mask = cluster::get_attribute_mask(cluster, k_energy_evse_optional_attribute_ids,
+                                                   chip::ArraySize(k_energy_evse_optional_attribute_ids));
+    return get_enabled_optional_flags(id_mask, k_energy_evse_optional_attributes);
+}
+
+static const uint32_t k_electrical_power_measurement_optional_attribute_ids[] = {
+    ElectricalPowerMeasurement::Attributes::Ranges::Id,
+    ElectricalPowerMeasurement::Attributes::Voltage::Id,
+    ElectricalPowerMeasurement::Attributes::ActiveCurrent::Id,
+    ElectricalPowerMeasurement::Attributes::ReactiveCurrent::Id,
+    ElectricalPowerMeasurement::Attributes::ApparentCurrent::Id,
+    ElectricalPowerMeasurement::Attributes::ReactivePower::Id,
+    ElectricalPowerMeasurement::Attributes::ApparentPower::Id,
+    ElectricalPowerMeasurement::Attributes::RMSVoltage::Id,
+    ElectricalPowerMeasurement::Attributes::RMSCurrent::Id,
+    ElectricalPowerMeasurement::Attributes::RMSPower::Id,
+    ElectricalPowerMeasurement::Attributes::Frequency::Id,
+    ElectricalPowerMeasurement::Attributes::PowerFactor::Id,
+    ElectricalPowerMeasurement::Attributes::NeutralCurrent::Id,
+};
+
+static const ElectricalPowerMeasurement::OptionalAttributes k_electrical_power_measurement_optional_attributes[] = {
+    ElectricalPowerMeasurement::OptionalAttributes::kOptionalAttributeRanges,
+    ElectricalPowerMeasurement::OptionalAttributes::kOptionalAttributeVoltage,
+    ElectricalPowerMeasurement::OptionalAttributes::kOptionalAttributeActiveCurrent,
+    ElectricalPowerMeasurement::OptionalAttributes::kOptionalAttributeReactiveCurrent,
+    ElectricalPowerMeasurement::OptionalAttributes::kOptionalAttributeApparentCurrent,
+    ElectricalPowerMeasurement::OptionalAttributes::kOptionalAttributeReactivePower,
+    ElectricalPowerMeasurement::OptionalAttributes::kOptionalAttributeApparentPower,
+    ElectricalPowerMeasurement::OptionalAttributes::kOptionalAttributeRMSVoltage,
+    ElectricalPowerMeasurement::OptionalAttributes::kOptionalAttributeRMSCurrent,
+    ElectricalPowerMeasurement::OptionalAttributes::kOptionalAttributeRMSPower,
+    ElectricalPowerMeasurement::OptionalAttributes::kOptionalAttributeFrequency,
+    ElectricalPowerMeasurement::OptionalAttributes::kOptionalAttributePowerFactor,
+    ElectricalPowerMeasurement::OptionalAttributes::kOptionalAttributeNeutralCurrent,
+};
+
+static chip::BitMask<ElectricalPowerMeasurement::OptionalAttributes>
+get_electrical_power_measurement_enabled_optional_attributes(cluster_t *cluster)
+{
+    uint32_t id_mask = cluster::get_attribute_mask(cluster, k_electrical_power_measurement_optional_attribute_ids,
+                                                   chip::ArraySize(k_electrical_power_measurement_optional_attribute_ids));
+    return get_enabled_optional_flags(id_mask, k_electrical_power_measurement_optional_attributes);
+}
 
-    if (endpoint::is_attribute_enabled(endpoint_id, ElectricalPowerMeasurement::Id, ElectricalPowerMeasurement::Attributes::NeutralCurrent::Id)) {
-        optional_attrs.Set(ElectricalPowerMeasurement::OptionalAttributes::kOptionalAttributeNeutralCurrent);
+// Cluster-specific optional commands handlers
+static const uint32_t k_energy_evse_optional_command_ids[] = {
+    EnergyEvse::Commands::StartDiagnostics::Id,
+};
+
+static const EnergyEvse::OptionalCommands k_energy_evse_optional_commands[] = {
+    EnergyEvse::OptionalCommands::kSupportsStartDiagnostics,
+};
+
+static chip::BitMask<EnergyEvse::OptionalCommands> get_energy_evse_enabled_optional_commands(cluster_t *cluster)
+{
+    uint32_t id_mask = cluster::get_command_mask(cluster, k_energy_evse_optional_command_ids,
+                                                 chip::ArraySize(k_energy_evse_optional_command_ids));
+    return get_enabled_optional_flags(id_mask, k_energy_evse_optional_commands);
+}
+
+// Registry of the mode and operational state cluster server instances. The instances are shared with the clusters
+// which depend on them, like MicrowaveOvenControl, whose instance is kept in the same registry entry. They come from
+// static pools sized by Kconfig, and are found by endpoint, in a fixed table indexed by the endpoint id, and by
+// cluster slot. The pools and the table are only built when a cluster which uses them is selected.
+#define ESP_MATTER_MODE_INSTANCE_POOL                                                                                  \
+    (ESP_MATTER_CLUSTER_SELECTED(laundry_washer_mode) || ESP_MATTER_CLUSTER_SELECTED(dish_washer_mode) ||               \
+     ESP_MATTER_CLUSTER_SELECTED(refrigerator_and_tcc_mode) || ESP_MATTER_CLUSTER_SELECTED(rvc_run_mode) ||             \
+     ESP_MATTER_CLUSTER_SELECTED(rvc_clean_mode) || ESP_MATTER_CLUSTER_SELECTED(water_heater_mode) ||                   \
+     ESP_MATTER_CLUSTER_SELECTED(energy_evse_mode) || ESP_MATTER_CLUSTER_SELECTED(microwave_oven_mode))
+#define ESP_MATTER_OPERATIONAL_STATE_INSTANCE_POOL (ESP_MATTER_CLUSTER_SELECTED(operational_state))
+// One MicrowaveOvenControl instance per operational state instance, at most
+#define ESP_MATTER_MICROWAVE_OVEN_CONTROL_INSTANCE_POOL                                                                \
+    (ESP_MATTER_CLUSTER_SELECTED(microwave_oven_control) && ESP_MATTER_MODE_INSTANCE_POOL &&                           \
+     ESP_MATTER_OPERATIONAL_STATE_INSTANCE_POOL)
+
+#if ESP_MATTER_MODE_INSTANCE_POOL || ESP_MATTER_OPERATIONAL_STATE_INSTANCE_POOL
+static const uint32_t k_mode_cluster_ids[] = {
+    LaundryWasherMode::Id,
+    DishwasherMode::Id,
+    RefrigeratorAndTemperatureControlledCabinetMode::Id,
+    RvcRunMode::Id,
+    RvcCleanMode::Id,
+    WaterHeaterMode::Id,
+    EnergyEvseMode::Id,
+    MicrowaveOvenMode::Id,
+};
+
+static constexpr uint8_t k_mode_slot_count = chip::ArraySize(k_mode_cluster_ids);
+#if ESP_MATTER_MODE_INSTANCE_POOL
+static constexpr uint16_t k_mode_instance_pool_size = CONFIG_ESP_MATTER_MODE_INSTANCE_POOL_SIZE;
+#else
+static constexpr uint16_t k_mode_instance_pool_size = 0;
+#endif
+#if ESP_MATTER_OPERATIONAL_STATE_INSTANCE_POOL
+static constexpr uint16_t k_operational_state_instance_pool_size = CONFIG_ESP_MATTER_OPERATIONAL_STATE_INSTANCE_POOL_SIZE;
+#else
+static constexpr uint16_t k_operational_state_instance_pool_size = 0;
+#endif
+static constexpr uint16_t k_instance_registry_size = k_mode_instance_pool_size + k_operational_state_instance_pool_size;
+
+typedef struct {
+    bool used;
+    chip::EndpointId endpoint_id;
+    ModeBase::Instance *mode_instances[k_mode_slot_count];
+    OperationalState::Instance *operational_state_instance;
+#if ESP_MATTER_MICROWAVE_OVEN_CONTROL_INSTANCE_POOL
+    MicrowaveOvenControl::Instance *microwave_oven_control_instance;
+#endif
+} instance_registry_entry_t;
+
+static instance_registry_entry_t s_instance_registry[k_instance_registry_size];
+#if ESP_MATTER_MODE_INSTANCE_POOL
+static chip::ObjectPool<ModeBase::Instance, k_mode_instance_pool_size, chip::ObjectPoolMem::kInline>
+    s_mode_instance_pool;
+#endif
+#if ESP_MATTER_OPERATIONAL_STATE_INSTANCE_POOL
+static chip::ObjectPool<OperationalState::Instance, k_operational_state_instance_pool_size,
+                        chip::ObjectPoolMem::kInline> s_operational_state_instance_pool;
+#endif
+#if ESP_MATTER_MICROWAVE_OVEN_CONTROL_INSTANCE_POOL
+static chip::ObjectPool<MicrowaveOvenControl::Instance, k_operational_state_instance_pool_size,
+                        chip::ObjectPoolMem::kInline> s_microwave_oven_control_instance_pool;
+#endif
+
+// Endpoint ids are mostly allocated in sequence, so the entry of an endpoint is usually the first one probed. The
+// entry is only claimed by the caller once its instance is created, a failed creation does not use up the table.
+static instance_registry_entry_t *find_instance_registry_entry(chip::EndpointId endpoint_id)
+{
+    instance_registry_entry_t *free_entry = nullptr;
+    for (uint16_t i = 0; i < k_instance_registry_size; i++) {
+        instance_registry_entry_t *entry = &s_instance_registry[(endpoint_id + i) % k_instance_registry_size];
+        if (entry->used && entry->endpoint_id == endpoint_id) {
+            return entry;
+        }
+        if (!entry->used && !free_entry) {
+            free_entry = entry;
+        }
     }
-
-    return optional_attrs;
+    VerifyOrReturnValue(free_entry, nullptr, ESP_LOGE(TAG, "Instance registry is full, cannot add endpoint %u",
+                                                       endpoint_id));
+    return free_entry;
 }
 
-// Cluster-specific optional commands handlers
-chip::BitMask<EnergyEvse::OptionalCommands> get_energy_evse_enabled_optional_commands(uint16_t endpoint_id)
+static void claim_instance_registry_entry(instance_registry_entry_t *entry, chip::EndpointId endpoint_id)
 {
-    chip::BitMask<EnergyEvse::OptionalCommands> optional_cmds = 0;
+    entry->used = true;
+    entry->endpoint_id = endpoint_id;
+}
+#endif // ESP_MATTER_MODE_INSTANCE_POOL || ESP_MATTER_OPERATIONAL_STATE_INSTANCE_POOL
 
-    if (endpoint::is_command_enabled(endpoint_id, EnergyEvse::Id, EnergyEvse::Commands::StartDiagnostics::Id)) {
-        optional_cmds.Set(EnergyEvse::OptionalCommands::kSupportsStartDiagnostics);
+#if ESP_MATTER_MODE_INSTANCE_POOL
+static uint8_t get_mode_slot(uint32_t cluster_id)
+{
+    uint8_t slot = 0;
+    while (slot < k_mode_slot_count && k_mode_cluster_ids[slot] != cluster_id) {
+        slot++;
     }
-
-    return optional_cmds;
+    return slot;
+}
+
+// Get the instance of a mode cluster, create it if it does not exist yet
+static ModeBase::Instance *get_mode_instance(ModeBase::Delegate *delegate, uint16_t endpoint_id, uint32_t cluster_id)
+{
+    uint8_t slot = get_mode_slot(cluster_id);
+    VerifyOrReturnValue(slot < k_mode_slot_count, nullptr);
+    instance_registry_entry_t *entry = find_instance_registry_entry(endpoint_id);
+    VerifyOrReturnValue(entry, nullptr);
+    if (!entry->mode_instances[slot]) {
+        uint32_t feature_map = get_feature_map_value(endpoint_id, cluster_id);
+        ModeBase::Instance *instance = s_mode_instance_pool.CreateObject(delegate, endpoint_id, cluster_id,
+                                                                         feature_map);
+        VerifyOrReturnValue(instance, nullptr,
+                            ESP_LOGE(TAG, "No free mode instance for cluster 0x%08" PRIX32 " on endpoint %u, increase "
+                                     "CONFIG_ESP_MATTER_MODE_INSTANCE_POOL_SIZE", cluster_id, endpoint_id));
+        claim_instance_registry_entry(entry, endpoint_id);
+        entry->mode_instances[slot] = instance;
+    }
+    return entry->mode_instances[slot];
+}
+#endif // ESP_MATTER_MODE_INSTANCE_POOL
+
+#if ESP_MATTER_OPERATIONAL_STATE_INSTANCE_POOL
+// Get the instance of the operational state cluster, create it if it does not exist yet
+static OperationalState::Instance *get_operational_state_instance(OperationalState::Delegate *delegate,
+                                                                  uint16_t endpoint_id)
+{
+    instance_registry_entry_t *entry = find_instance_registry_entry(endpoint_id);
+    VerifyOrReturnValue(entry, nullptr);
+    if (!entry->operational_state_instance) {
+        OperationalState::Instance *instance = s_operational_state_instance_pool.CreateObject(delegate, endpoint_id);
+        VerifyOrReturnValue(instance, nullptr,
+                            ESP_LOGE(TAG, "No free operational state instance on endpoint %u, increase "
+                                     "CONFIG_ESP_MATTER_OPERATIONAL_STATE_INSTANCE_POOL_SIZE", endpoint_id));
+        claim_instance_registry_entry(entry, endpoint_id);
+        entry->operational_state_instance = instance;
+    }
+    return entry->operational_state_instance;
 }
+#endif // ESP_MATTER_OPERATIONAL_STATE_INSTANCE_POOL
 
 namespace delegate_cb {
 
+#if ESP_MATTER_MODE_INSTANCE_POOL
 void InitModeDelegate(void *delegate, uint16_t endpoint_id, uint32_t cluster_id)
 {
     VerifyOrReturn(delegate != nullptr);
-    static ModeBase::Instance * modeInstance = nullptr;
     ModeBase::Delegate *mode_delegate = static_cast<ModeBase::Delegate*>(delegate);
-    uint32_t feature_map = get_feature_map_value(endpoint_id, cluster_id);
-    modeInstance = new ModeBase::Instance(mode_delegate, endpoint_id, cluster_id, feature_map);
+    ModeBase::Instance *modeInstance = get_mode_instance(mode_delegate, endpoint_id, cluster_id);
+    VerifyOrReturn(modeInstance != nullptr);
     (void)modeInstance->Init();
 }
 
@@ -217,19 +363,10 @@ void EnergyEvseModeDelegateInitCB(void *delegate, uint16_t endpoint_id)
 
 void MicrowaveOvenModeDelegateInitCB(void *delegate, uint16_t endpoint_id)
 {
-    VerifyOrReturn(delegate != nullptr);
-    ModeBase::Delegate *mode_delegate = static_cast<ModeBase::Delegate*>(delegate);
-    ModeBase::Instance * modeInstance = nullptr;
-    // Create new instance of MicrowaveOvenMode if not found in the map, otherwise use existing instance.
-    if (s_microwave_oven_mode_instances.find(endpoint_id) == s_microwave_oven_mode_instances.end()) {
-        uint32_t feature_map = get_feature_map_value(endpoint_id, MicrowaveOvenMode::Id);
-        modeInstance = new ModeBase::Instance(mode_delegate, endpoint_id, MicrowaveOvenMode::Id, feature_map);
-        s_microwave_oven_mode_instances[endpoint_id] = modeInstance;
-    } else {
-        modeInstance = s_microwave_oven_mode_instances[endpoint_id];
-    }
-    (void)modeInstance->Init();
+    // The instance may already exist, created by the MicrowaveOvenControl delegate init.
+    InitModeDelegate(delegate, endpoint_id, MicrowaveOvenMode::Id);
 }
+#endif // ESP_MATTER_MODE_INSTANCE_POOL
 
 void DeviceEnergyManagementModeDelegateInitCB(void *delegate, uint16_t endpoint_id)
 {
@@ -245,9 +382,11 @@ void EnergyEvseDelegateInitCB(void *delegate, uint16_t endpoint_id)
     VerifyOrReturn(delegate != nullptr);
     static EnergyEvse::Instance * energyEvseInstance = nullptr;
     EnergyEvse::Delegate *energy_evse_delegate = static_cast<EnergyEvse::Delegate*>(delegate);
-    uint32_t feature_map = get_feature_map_value(endpoint_id, EnergyEvse::Id);
-    chip::BitMask<EnergyEvse::OptionalAttributes> optional_attrs = get_energy_evse_enabled_optional_attributes(endpoint_id);
-    chip::BitMask<EnergyEvse::OptionalCommands> optional_cmds = get_energy_evse_enabled_optional_commands(endpoint_id);
+    cluster_t *cluster = cluster::get(endpoint_id, EnergyEvse::Id);
+    VerifyOrReturn(cluster != nullptr);
+    uint32_t feature_map = get_feature_map_value(cluster);
+    chip::BitMask<EnergyEvse::OptionalAttributes> optional_attrs = get_energy_evse_enabled_optional_attributes(cluster);
+    chip::BitMask<EnergyEvse::OptionalCommands> optional_cmds = get_energy_evse_enabled_optional_commands(cluster);
     energyEvseInstance = new EnergyEvse::Instance(endpoint_id, *energy_evse_delegate, chip::BitMask<EnergyEvse::Feature, uint32_t>(feature_map),
                                                   optional_attrs, optional_cmds);
     (void)energyEvseInstance->Init();
@@ -261,49 +400,48 @@ void MicrowaveOvenControlDelegateInitCB(void *delegate, uint16_t endpoint_id)
     cluster = cluster::get(endpoint_id, OperationalState::Id);
     OperationalState::Delegate *operational_state_delegate = static_cast<OperationalState::Delegate*>(get_delegate_impl(cluster));
     VerifyOrReturn(delegate != nullptr && microwave_oven_mode_delegate != nullptr && operational_state_delegate != nullptr);
-    ModeBase::Instance* microwaveOvenModeInstance = nullptr;
-    OperationalState::Instance* operationalStateInstance = nullptr;
-
-    // Create new instance of MicrowaveOvenMode if not found in the map, otherwise use existing instance.
-    if (s_microwave_oven_mode_instances.find(endpoint_id) == s_microwave_oven_mode_instances.end()) {
-        uint32_t feature_map = get_feature_map_value(endpoint_id, MicrowaveOvenMode::Id);
-        microwaveOvenModeInstance = new ModeBase::Instance(microwave_oven_mode_delegate, endpoint_id, MicrowaveOvenMode::Id, feature_map);
-        s_microwave_oven_mode_instances[endpoint_id] = microwaveOvenModeInstance;
-    } else {
-        microwaveOvenModeInstance = s_microwave_oven_mode_instances[endpoint_id];
-    }
 
-    // Create new instance of OperationalState if not found in the map, otherwise use existing instance.
-    if (s_operational_state_instances.find(endpoint_id) == s_operational_state_instances.end()) {
-        operationalStateInstance = new OperationalState::Instance(operational_state_delegate, endpoint_id);
-        s_operational_state_instances[endpoint_id] = operationalStateInstance;
-    } else {
-        operationalStateInstance = s_operational_state_instances[endpoint_id];
-    }
-
-    // Create MicrowaveOvenControl instance
-    static MicrowaveOvenControl::Instance * microwaveOvenControlInstance = nullptr;
+#if ESP_MATTER_MICROWAVE_OVEN_CONTROL_INSTANCE_POOL
+    // Use the MicrowaveOvenMode and OperationalState instances of the endpoint, they are created if their own
+    // delegate init has not run yet.
+    ModeBase::Instance *microwaveOvenModeInstance = get_mode_instance(microwave_oven_mode_delegate, endpoint_id,
+                                                                      MicrowaveOvenMode::Id);
+    OperationalState::Instance *operationalStateInstance = get_operational_state_instance(operational_state_delegate,
+                                                                                          endpoint_id);
+    VerifyOrReturn(microwaveOvenModeInstance != nullptr && operationalStateInstance != nullptr);
+
+    // The MicrowaveOvenControl instance refers to both, it goes in the same registry entry
+    instance_registry_entry_t *entry = find_instance_registry_entry(endpoint_id);
+    VerifyOrReturn(entry != nullptr);
+    VerifyOrReturn(entry->microwave_oven_control_instance == nullptr,
+                   ESP_LOGW(TAG, "MicrowaveOvenControl instance of endpoint %u already exists", endpoint_id));
     MicrowaveOvenControl::Delegate *microwave_oven_control_delegate = static_cast<MicrowaveOvenControl::Delegate*>(delegate);
     uint32_t feature_map = get_feature_map_value(endpoint_id, MicrowaveOvenControl::Id);
-    microwaveOvenControlInstance = new MicrowaveOvenControl::Instance(microwave_oven_control_delegate, endpoint_id, MicrowaveOvenControl::Id, feature_map,
-                                                                      *operationalStateInstance, *microwaveOvenModeInstance);
+    MicrowaveOvenControl::Instance *microwaveOvenControlInstance = s_microwave_oven_control_instance_pool.CreateObject(
+        microwave_oven_control_delegate, endpoint_id, MicrowaveOvenControl::Id, feature_map, *operationalStateInstance,
+        *microwaveOvenModeInstance);
+    VerifyOrReturn(microwaveOvenControlInstance != nullptr,
+                   ESP_LOGE(TAG, "No free MicrowaveOvenControl instance on endpoint %u, increase "
+                            "CONFIG_ESP_MATTER_OPERATIONAL_STATE_INSTANCE_POOL_SIZE", endpoint_id));
+    entry->microwave_oven_control_instance = microwaveOvenControlInstance;
     (void)microwaveOvenControlInstance->Init();
+#else
+    ESP_LOGE(TAG, "MicrowaveOvenControl needs the MicrowaveOvenMode and OperationalState clusters to be selected");
+#endif
 }
 
+#if ESP_MATTER_OPERATIONAL_STATE_INSTANCE_POOL
 void OperationalStateDelegateInitCB(void *delegate, uint16_t endpoint_id)
 {
     VerifyOrReturn(delegate != nullptr);
-    static OperationalState::Instance * operationalStateInstance = nullptr;
     OperationalState::Delegate *operational_state_delegate = static_cast<OperationalState::Delegate*>(delegate);
-    // Create new instance of OperationalState if not found in the map, otherwise use existing instance.
-    if (s_operational_state_instances.find(endpoint_id) == s_operational_state_instances.end()) {
-        operationalStateInstance = new OperationalState::Instance(operational_state_delegate, endpoint_id);
-        s_operational_state_instances[endpoint_id] = operationalStateInstance;
-    } else {
-        operationalStateInstance = s_operational_state_instances[endpoint_id];
-    }
+    // The instance may already exist, created by the MicrowaveOvenControl delegate init.
+    OperationalState::Instance *operationalStateInstance = get_operational_state_instance(operational_state_delegate,
+                                                                                          endpoint_id);
+    VerifyOrReturn(operationalStateInstance != nullptr);
     (void)operationalStateInstance->Init();
 }
+#endif // ESP_MATTER_OPERATIONAL_STATE_INSTANCE_POOL
 
 void FanControlDelegateInitCB(void *delegate, uint16_t endpoint_id)
 {
@@ -395,8 +533,10 @@ void ElectricalPowerMeasurementDelegateInitCB(void *delegate, uint16_t endpoint_
     VerifyOrReturn(delegate != nullptr);
     static ElectricalPowerMeasurement::Instance * electricalPowerMeasurementInstance = nullptr;
     ElectricalPowerMeasurement::Delegate *electrical_power_measurement_delegate = static_cast<ElectricalPowerMeasurement::Delegate*>(delegate);
-    uint32_t feature_map = get_feature_map_value(endpoint_id, ElectricalPowerMeasurement::Id);
-    chip::BitMask<ElectricalPowerMeasurement::OptionalAttributes> optional_attrs = get_electrical_power_measurement_enabled_optional_attributes(endpoint_id);
+    cluster_t *cluster = cluster::get(endpoint_id, ElectricalPowerMeasurement::Id);
+    VerifyOrReturn(cluster != nullptr);
+    uint32_t feature_map = get_feature_map_value(cluster);
+    chip::BitMask<ElectricalPowerMeasurement::OptionalAttributes> optional_attrs = get_electrical_power_measurement_enabled_optional_attributes(cluster);
     electricalPowerMeasurementInstance = new ElectricalPowerMeasurement::Instance(endpoint_id, *electrical_power_measurement_delegate,
                                                                                   chip::BitMask<ElectricalPowerMeasurement::Feature, uint32_t>(feature_map), optional_attrs);
     (void)electricalPowerMeasurementInstance->Init();
@@ -591,6 +731,38 @@ void MeterIdentificationDelegateInitCB(void *delegate, uint16_t endpoint_id)
     LogErrorOnFailure(meter_identification_instance->Init());
 }
 
+void ReleaseEndpointInstances(uint16_t endpoint_id)
+{
+#if ESP_MATTER_MODE_INSTANCE_POOL || ESP_MATTER_OPERATIONAL_STATE_INSTANCE_POOL
+    for (uint16_t i = 0; i < k_instance_registry_size; i++) {
+        instance_registry_entry_t *entry = &s_instance_registry[i];
+        if (!entry->used || entry->endpoint_id != endpoint_id) {
+            continue;
+        }
+        // MicrowaveOvenControl refers to the mode and operational state instances, it goes first
+#if ESP_MATTER_MICROWAVE_OVEN_CONTROL_INSTANCE_POOL
+        if (entry->microwave_oven_control_instance) {
+            s_microwave_oven_control_instance_pool.ReleaseObject(entry->microwave_oven_control_instance);
+        }
+#endif
+#if ESP_MATTER_MODE_INSTANCE_POOL
+        for (uint8_t slot = 0; slot < k_mode_slot_count; slot++) {
+            if (entry->mode_instances[slot]) {
+                s_mode_instance_pool.ReleaseObject(entry->mode_instances[slot]);
+            }
+        }
+#endif
+#if ESP_MATTER_OPERATIONAL_STATE_INSTANCE_POOL
+        if (entry->operational_state_instance) {
+            s_operational_state_instance_pool.ReleaseObject(entry->operational_state_instance);
+        }
+#endif
+        memset(entry, 0, sizeof(*entry));
+        return;
+    }
+#endif
+}
+
 } // namespace delegate_cb
 } // namespace cluster
 } // namespace esp_matter
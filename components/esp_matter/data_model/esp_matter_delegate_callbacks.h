@@ -63,6 +63,10 @@ void CommodityTariffDelegateInitCB(void *delegate, uint16_t endpoint_id);
 void CommodityPriceDelegateInitCB(void *delegate, uint16_t endpoint_id);
 void ElectricalGridConditionsDelegateInitCB(void *delegate, uint16_t endpoint_id);
 void MeterIdentificationDelegateInitCB(void *delegate, uint16_t endpoint_id);
+
+/** Release the mode, operational state and microwave oven control cluster server instances of an endpoint, when it
+ *  is destroyed */
+void ReleaseEndpointInstances(uint16_t endpoint_id);
 } // namespace delegate_cb
 
 } // namespace cluster
@@ -14,16 +14,22 @@
 
 #include <esp_log.h>
 #include <esp_matter_event.h>
+#include <esp_matter_event_template.h>
+#include <freertos/FreeRTOS.h>
+#include <inttypes.h>
+#include <cluster_select/esp_matter_cluster_select.h>
 
-#include <app/clusters/switch-server/switch-server.h>
+#include <lib/support/CodeUtils.h>
 #include <platform/DeviceControlServer.h>
 
 using chip::EndpointId;
 using chip::DeviceLayer::DeviceControlServer;
 using namespace chip::app::Clusters;
+namespace payload_template = esp_matter::event::payload_template;
 
 namespace esp_matter {
 namespace cluster {
+#if ESP_MATTER_CLUSTER_SELECTED(access_control)
 namespace access_control {
 namespace event {
 event_t *create_access_control_entry_changed(cluster_t *cluster)
@@ -42,7 +48,9 @@ event_t *create_fabric_restriction_review_update(cluster_t *cluster)
 }
 } // namespace event
 } // namespace access_control
+#endif // ESP_MATTER_CLUSTER_SELECTED(access_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(power_source)
 namespace power_source {
 namespace event {
 event_t *create_wired_fault_change(cluster_t *cluster)
@@ -61,7 +69,9 @@ event_t *create_bat_charge_fault_change(cluster_t *cluster)
 }
 }
 }
+#endif // ESP_MATTER_CLUSTER_SELECTED(power_source)
 
+#if ESP_MATTER_CLUSTER_SELECTED(actions)
 namespace actions {
 namespace event {
 event_t *create_state_changed(cluster_t *cluster)
@@ -89,7 +99,9 @@ esp_err_t send_action_failed(EndpointId endpoint, uint16_t action_id, uint32_t i
 
 } // namespace event
 } // namespace actions
+#endif // ESP_MATTER_CLUSTER_SELECTED(actions)
 
+#if ESP_MATTER_CLUSTER_SELECTED(basic_information)
 namespace basic_information {
 namespace event {
 event_t *create_start_up(cluster_t *cluster)
@@ -114,7 +126,9 @@ event_t *create_reachable_changed(cluster_t *cluster)
 
 } // namespace event
 } // namespace basic_information
+#endif // ESP_MATTER_CLUSTER_SELECTED(basic_information)
 
+#if ESP_MATTER_CLUSTER_SELECTED(ota_software_update_requestor)
 namespace ota_software_update_requestor {
 namespace event {
 event_t *create_state_transition(cluster_t *cluster)
@@ -134,7 +148,9 @@ event_t *create_download_error(cluster_t *cluster)
 
 } // namespace event
 } // namespace ota_software_update_requestor
+#endif // ESP_MATTER_CLUSTER_SELECTED(ota_software_update_requestor)
 
+#if ESP_MATTER_CLUSTER_SELECTED(general_diagnostics)
 namespace general_diagnostics {
 namespace event {
 event_t *create_hardware_fault_change(cluster_t *cluster)
@@ -159,7 +175,9 @@ event_t *create_boot_reason(cluster_t *cluster)
 
 } // namespace event
 } // namespace general_diagnostics
+#endif // ESP_MATTER_CLUSTER_SELECTED(general_diagnostics)
 
+#if ESP_MATTER_CLUSTER_SELECTED(wifi_network_diagnostics)
 namespace wifi_network_diagnostics {
 namespace event {
 event_t *create_disconnection(cluster_t *cluster)
@@ -179,7 +197,9 @@ event_t *create_connection_status(cluster_t *cluster)
 
 } // namespace event
 } // namespace wifi_network_diagnostics
+#endif // ESP_MATTER_CLUSTER_SELECTED(wifi_network_diagnostics)
 
+#if ESP_MATTER_CLUSTER_SELECTED(thread_network_diagnostics)
 namespace thread_network_diagnostics {
 namespace event {
 event_t *create_connection_status(cluster_t *cluster)
@@ -194,7 +214,9 @@ event_t *create_network_fault_change(cluster_t *cluster)
 
 } // namespace event
 } // namespace thread_network_diagnostics
+#endif // ESP_MATTER_CLUSTER_SELECTED(thread_network_diagnostics)
 
+#if ESP_MATTER_CLUSTER_SELECTED(software_diagnostics)
 namespace software_diagnostics {
 namespace event {
 event_t *create_software_fault(cluster_t *cluster)
@@ -203,7 +225,9 @@ event_t *create_software_fault(cluster_t *cluster)
 }
 } // namespace event
 } // namespace software_diagnostics
+#endif // ESP_MATTER_CLUSTER_SELECTED(software_diagnostics)
 
+#if ESP_MATTER_CLUSTER_SELECTED(time_synchronization)
 namespace time_synchronization {
 namespace event {
 event_t *create_dst_table_empty(cluster_t *cluster)
@@ -233,7 +257,9 @@ event_t *create_missing_trusted_time_source(cluster_t *cluster)
 
 } // namespace event
 } // namespace time_synchronization
+#endif // ESP_MATTER_CLUSTER_SELECTED(time_synchronization)
 
+#if ESP_MATTER_CLUSTER_SELECTED(bridged_device_basic_information)
 namespace bridged_device_basic_information {
 namespace event {
 
@@ -264,7 +290,9 @@ event_t *create_active_changed(cluster_t *cluster)
 
 } // namespace event
 } // namespace bridged_device_basic_information
+#endif // ESP_MATTER_CLUSTER_SELECTED(bridged_device_basic_information)
 
+#if ESP_MATTER_CLUSTER_SELECTED(smoke_co_alarm)
 namespace smoke_co_alarm {
 namespace event {
 
@@ -325,7 +353,9 @@ event_t *create_all_clear(cluster_t *cluster)
 
 } // namespace event
 } // namespace smoke_co_alarm
+#endif // ESP_MATTER_CLUSTER_SELECTED(smoke_co_alarm)
 
+#if ESP_MATTER_CLUSTER_SELECTED(door_lock)
 namespace door_lock {
 namespace event {
 
@@ -386,7 +416,9 @@ esp_err_t send_lock_user_change()
 
 } // namespace event
 } // namespace door_lock
+#endif // ESP_MATTER_CLUSTER_SELECTED(door_lock)
 
+#if ESP_MATTER_CLUSTER_SELECTED(switch_cluster)
 namespace switch_cluster {
 namespace event {
 
@@ -425,51 +457,92 @@ event_t *create_multi_press_complete(cluster_t *cluster)
     return esp_matter::event::create(cluster, Switch::Events::MultiPressComplete::Id);
 }
 
+/* The switch events are emitted from pre-encoded payloads, a multi-press sequence does not encode each event. The
+ * template of an event is created on its first emission, a failed creation is retried on the next one. */
+static const char *TAG = "esp_matter_event";
+static portMUX_TYPE s_switch_template_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static esp_err_t emit_switch_event(payload_template::payload_template_t **event_template, uint32_t event_id,
+                                   EndpointId endpoint, const int64_t *values, uint8_t value_count)
+{
+    static const esp_matter_val_type_t field_types[] = {ESP_MATTER_VAL_TYPE_UINT8, ESP_MATTER_VAL_TYPE_UINT8};
+    taskENTER_CRITICAL(&s_switch_template_lock);
+    payload_template::payload_template_t *current = *event_template;
+    taskEXIT_CRITICAL(&s_switch_template_lock);
+    if (!current) {
+        payload_template::payload_template_t *created = payload_template::create(
+            Switch::Id, event_id, chip::app::PriorityLevel::Info, field_types, value_count);
+        VerifyOrReturnError(created, ESP_ERR_NO_MEM,
+                            ESP_LOGE(TAG, "Failed to create the template of switch event 0x%" PRIx32, event_id));
+        /* Another task may have created the template meanwhile, keep the first one */
+        taskENTER_CRITICAL(&s_switch_template_lock);
+        if (!*event_template) {
+            *event_template = created;
+            created = nullptr;
+        }
+        current = *event_template;
+        taskEXIT_CRITICAL(&s_switch_template_lock);
+        if (created) {
+            payload_template::destroy(created);
+        }
+    }
+    return payload_template::emit(current, endpoint, values, value_count);
+}
+
 esp_err_t send_switch_latched(EndpointId endpoint, uint8_t new_position)
 {
-    SwitchServer::Instance().OnSwitchLatch(endpoint, new_position);
-    return ESP_OK;
+    static payload_template::payload_template_t *event_template = nullptr;
+    int64_t values[] = {new_position};
+    return emit_switch_event(&event_template, Switch::Events::SwitchLatched::Id, endpoint, values, 1);
 }
 
 esp_err_t send_initial_press(EndpointId endpoint, uint8_t new_position)
 {
-    SwitchServer::Instance().OnInitialPress(endpoint, new_position);
-    return ESP_OK;
+    static payload_template::payload_template_t *event_template = nullptr;
+    int64_t values[] = {new_position};
+    return emit_switch_event(&event_template, Switch::Events::InitialPress::Id, endpoint, values, 1);
 }
 
 esp_err_t send_long_press(EndpointId endpoint, uint8_t new_position)
 {
-    SwitchServer::Instance().OnLongPress(endpoint, new_position);
-    return ESP_OK;
+    static payload_template::payload_template_t *event_template = nullptr;
+    int64_t values[] = {new_position};
+    return emit_switch_event(&event_template, Switch::Events::LongPress::Id, endpoint, values, 1);
 }
 
 esp_err_t send_short_release(EndpointId endpoint, uint8_t previous_position)
 {
-    SwitchServer::Instance().OnShortRelease(endpoint, previous_position);
-    return ESP_OK;
+    static payload_template::payload_template_t *event_template = nullptr;
+    int64_t values[] = {previous_position};
+    return emit_switch_event(&event_template, Switch::Events::ShortRelease::Id, endpoint, values, 1);
 }
 
 esp_err_t send_long_release(EndpointId endpoint, uint8_t previous_position)
 {
-    SwitchServer::Instance().OnLongRelease(endpoint, previous_position);
-    return ESP_OK;
+    static payload_template::payload_template_t *event_template = nullptr;
+    int64_t values[] = {previous_position};
+    return emit_switch_event(&event_template, Switch::Events::LongRelease::Id, endpoint, values, 1);
 }
 
 esp_err_t send_multi_press_ongoing(EndpointId endpoint, uint8_t new_position, uint8_t count)
 {
-    SwitchServer::Instance().OnMultiPressOngoing(endpoint, new_position, count);
-    return ESP_OK;
+    static payload_template::payload_template_t *event_template = nullptr;
+    int64_t values[] = {new_position, count};
+    return emit_switch_event(&event_template, Switch::Events::MultiPressOngoing::Id, endpoint, values, 2);
 }
 
 esp_err_t send_multi_press_complete(EndpointId endpoint, uint8_t new_position, uint8_t count)
 {
-    SwitchServer::Instance().OnMultiPressComplete(endpoint, new_position, count);
-    return ESP_OK;
+    static payload_template::payload_template_t *event_template = nullptr;
+    int64_t values[] = {new_position, count};
+    return emit_switch_event(&event_template, Switch::Events::MultiPressComplete::Id, endpoint, values, 2);
 }
 
 } // namespace event
 } // namespace switch_cluster
+#endif // ESP_MATTER_CLUSTER_SELECTED(switch_cluster)
 
+#if ESP_MATTER_CLUSTER_SELECTED(boolean_state)
 namespace boolean_state {
 namespace event {
 
@@ -480,7 +553,9 @@ event_t *create_state_change(cluster_t *cluster)
 
 } // namespace event
 } // namespace boolean_state
+#endif // ESP_MATTER_CLUSTER_SELECTED(boolean_state)
 
+#if ESP_MATTER_CLUSTER_SELECTED(boolean_state_configuration)
 namespace boolean_state_configuration {
 namespace event {
 
@@ -496,7 +571,9 @@ event_t *create_sensor_fault(cluster_t *cluster)
 
 } // namespace event
 } // namespace boolean_state_configuration
+#endif // ESP_MATTER_CLUSTER_SELECTED(boolean_state_configuration)
 
+#if ESP_MATTER_CLUSTER_SELECTED(operational_state)
 namespace operational_state {
 namespace event {
 
@@ -512,6 +589,8 @@ event_t *create_operation_completion(cluster_t *cluster)
 
 } // namespace event
 } // namespace operational_state
+#endif // ESP_MATTER_CLUSTER_SELECTED(operational_state)
+#if ESP_MATTER_CLUSTER_SELECTED(pump_configuration_and_control)
 namespace pump_configuration_and_control {
 namespace event {
 
@@ -707,7 +786,9 @@ esp_err_t send_turbine_operation()
 
 } // namespace event
 } // namespace pump_configuration_and_control
+#endif // ESP_MATTER_CLUSTER_SELECTED(pump_configuration_and_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(electrical_power_measurement)
 namespace electrical_power_measurement {
 namespace event {
 
@@ -717,7 +798,9 @@ event_t *create_measurement_period_ranges(cluster_t *cluster)
 }
 } // namespace event
 } // namespace electrical_power_measurement
+#endif // ESP_MATTER_CLUSTER_SELECTED(electrical_power_measurement)
 
+#if ESP_MATTER_CLUSTER_SELECTED(electrical_energy_measurement)
 namespace electrical_energy_measurement {
 namespace event {
 
@@ -732,7 +815,9 @@ event_t *create_periodic_energy_measured(cluster_t *cluster)
 }
 } // namespace event
 } // namespace electrical_energy_measurement
+#endif // ESP_MATTER_CLUSTER_SELECTED(electrical_energy_measurement)
 
+#if ESP_MATTER_CLUSTER_SELECTED(energy_evse)
 namespace energy_evse {
 namespace event {
 event_t *create_ev_connected(cluster_t *cluster)
@@ -767,7 +852,9 @@ event_t *create_rfid(cluster_t *cluster)
 
 } /* event */
 } /* energy_evse */
+#endif // ESP_MATTER_CLUSTER_SELECTED(energy_evse)
 
+#if ESP_MATTER_CLUSTER_SELECTED(valve_configuration_and_control)
 namespace valve_configuration_and_control {
 namespace event {
 event_t *create_valve_state_changed(cluster_t *cluster)
@@ -781,7 +868,9 @@ event_t *create_valve_fault(cluster_t *cluster)
 }
 } // namespace event
 } // namespace valve_configuration_and_control
+#endif // ESP_MATTER_CLUSTER_SELECTED(valve_configuration_and_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(device_energy_management)
 namespace device_energy_management {
 namespace event {
 event_t *create_power_adjust_start(cluster_t *cluster)
@@ -806,7 +895,9 @@ event_t *create_resumed(cluster_t *cluster)
 
 } // namespace event
 } // namespace device_energy_management
+#endif // ESP_MATTER_CLUSTER_SELECTED(device_energy_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(water_heater_management)
 namespace water_heater_management {
 namespace event {
 event_t *create_boost_started(cluster_t *cluster)
@@ -821,7 +912,9 @@ event_t *create_boost_ended(cluster_t *cluster)
 
 } // namespace event
 } // namespace water_heater_management
+#endif // ESP_MATTER_CLUSTER_SELECTED(water_heater_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(commissioner_control)
 namespace commissioner_control {
 namespace event {
 event_t *create_commissioning_request_result(cluster_t *cluster)
@@ -831,7 +924,9 @@ event_t *create_commissioning_request_result(cluster_t *cluster)
 
 } // namespace event
 } // namespace commissioner_control
+#endif // ESP_MATTER_CLUSTER_SELECTED(commissioner_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(occupancy_sensing)
 namespace occupancy_sensing {
 namespace event {
 event_t *create_occupancy_changed(cluster_t *cluster)
@@ -841,7 +936,9 @@ event_t *create_occupancy_changed(cluster_t *cluster)
 
 } // namespace event
 } // namespace occupancy_sensing
+#endif // ESP_MATTER_CLUSTER_SELECTED(occupancy_sensing)
 
+#if ESP_MATTER_CLUSTER_SELECTED(closure_control)
 namespace closure_control {
 namespace event {
 event_t *create_operational_error(cluster_t *cluster)
@@ -866,7 +963,9 @@ event_t *create_secure_state_changed(cluster_t *cluster)
 
 } // namespace event
 } // namespace closure_control
+#endif // ESP_MATTER_CLUSTER_SELECTED(closure_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(push_av_stream_transport)
 namespace push_av_stream_transport {
 namespace event {
 event_t *create_push_transport_begin(cluster_t *cluster)
@@ -881,7 +980,9 @@ event_t *create_push_transport_end(cluster_t *cluster)
 
 } // namespace event
 } // namespace push_av_stream_transport
+#endif // ESP_MATTER_CLUSTER_SELECTED(push_av_stream_transport)
 
+#if ESP_MATTER_CLUSTER_SELECTED(commodity_price)
 namespace commodity_price {
 namespace event {
 event_t *create_price_change(cluster_t *cluster)
@@ -891,7 +992,9 @@ event_t *create_price_change(cluster_t *cluster)
 
 } // namespace event
 } // namespace commodity_price
+#endif // ESP_MATTER_CLUSTER_SELECTED(commodity_price)
 
+#if ESP_MATTER_CLUSTER_SELECTED(electrical_grid_conditions)
 namespace electrical_grid_conditions {
 namespace event {
 event_t *create_current_conditions_changed(cluster_t *cluster)
@@ -901,7 +1004,9 @@ event_t *create_current_conditions_changed(cluster_t *cluster)
 
 } // namespace event
 } // namespace electrical_grid_conditions
+#endif // ESP_MATTER_CLUSTER_SELECTED(electrical_grid_conditions)
 
+#if ESP_MATTER_CLUSTER_SELECTED(zone_management)
 namespace zone_management {
 namespace event {
 event_t *create_zone_triggered(cluster_t *cluster)
@@ -916,6 +1021,7 @@ event_t *create_zone_stopped(cluster_t *cluster)
 
 } // namespace event
 } // namespace zone_management
+#endif // ESP_MATTER_CLUSTER_SELECTED(zone_management)
 
 } // namespace cluster
 } // namespace esp_matter
@@ -0,0 +1,372 @@
+// Copyright 2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <esp_check.h>
+#include <esp_log.h>
+#include <esp_matter_event_template.h>
+#include <esp_matter_mem.h>
+#include <freertos/FreeRTOS.h>
+#include <inttypes.h>
+#include <string.h>
+
+#include <app/EventLoggingDelegate.h>
+#include <app/EventManagement.h>
+#include <app/MessageDef/EventDataIB.h>
+#include <lib/core/TLV.h>
+#include <platform/CHIPDeviceLayer.h>
+
+using chip::EventNumber;
+using chip::app::EventManagement;
+using chip::app::EventOptions;
+using chip::app::PriorityLevel;
+
+static const char *TAG = "esp_matter_event_template";
+
+/* A field is encoded with a one byte context tag and at most 8 bytes of value, after its control byte. The payload
+ * also keeps the end of container of the structure, and the encoding needs one more byte for the structure start. */
+#define MAX_PAYLOAD_SIZE (esp_matter::event::payload_template::k_max_field_count * 10 + 1)
+#define MAX_ENCODED_SIZE (MAX_PAYLOAD_SIZE + 1)
+#define PENDING_EVENT_COUNT 16
+
+namespace esp_matter {
+namespace event {
+namespace payload_template {
+
+typedef struct {
+    esp_matter_val_type_t type;
+    /* Offset of the value, or of the control byte for a boolean */
+    uint8_t offset;
+    uint8_t width;
+} field_t;
+
+struct payload_template {
+    uint32_t cluster_id;
+    uint32_t event_id;
+    PriorityLevel priority;
+    uint8_t field_count;
+    field_t fields[k_max_field_count];
+    /* The members of the structure followed by its end of container, as PutPreEncodedContainer() expects them */
+    uint8_t payload_size;
+    uint8_t payload[MAX_PAYLOAD_SIZE];
+};
+
+/* A queued event does not refer to its template, so that the template can be destroyed while the event is queued */
+typedef struct {
+    uint32_t cluster_id;
+    uint32_t event_id;
+    PriorityLevel priority;
+    uint16_t endpoint_id;
+    uint8_t payload_size;
+    uint8_t payload[MAX_PAYLOAD_SIZE];
+} pending_event_t;
+
+static pending_event_t s_pending[PENDING_EVENT_COUNT];
+static uint8_t s_pending_head = 0;
+static uint8_t s_pending_count = 0;
+static bool s_flush_scheduled = false;
+static stats_t s_stats;
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/* Writes the patched payload as the data of the event */
+class PreEncodedEventLogger : public chip::app::EventLoggingDelegate {
+public:
+    PreEncodedEventLogger(const uint8_t *payload, uint8_t size) : m_payload(payload), m_size(size) {}
+
+    CHIP_ERROR WriteEvent(chip::TLV::TLVWriter &writer) override
+    {
+        return writer.PutPreEncodedContainer(chip::TLV::ContextTag(chip::to_underlying(chip::app::EventDataIB::Tag::kData)),
+                                             chip::TLV::kTLVType_Structure, m_payload, m_size);
+    }
+
+private:
+    const uint8_t *m_payload;
+    uint8_t m_size;
+};
+
+static CHIP_ERROR encode_field(chip::TLV::TLVWriter &writer, uint8_t tag, esp_matter_val_type_t type, field_t &field)
+{
+    chip::TLV::Tag context_tag = chip::TLV::ContextTag(tag);
+    uint32_t start = writer.GetLengthWritten();
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    /* The integers keep their full width, so that every value fits in place */
+    switch (type) {
+    case ESP_MATTER_VAL_TYPE_BOOLEAN:
+        err = writer.PutBoolean(context_tag, false);
+        field.width = 0;
+        break;
+    case ESP_MATTER_VAL_TYPE_INT8:
+        err = writer.Put(context_tag, static_cast<int8_t>(0), true);
+        field.width = 1;
+        break;
+    case ESP_MATTER_VAL_TYPE_UINT8:
+    case ESP_MATTER_VAL_TYPE_ENUM8:
+    case ESP_MATTER_VAL_TYPE_BITMAP8:
+        err = writer.Put(context_tag, static_cast<uint8_t>(0), true);
+        field.width = 1;
+        break;
+    case ESP_MATTER_VAL_TYPE_INT16:
+        err = writer.Put(context_tag, static_cast<int16_t>(0), true);
+        field.width = 2;
+        break;
+    case ESP_MATTER_VAL_TYPE_UINT16:
+    case ESP_MATTER_VAL_TYPE_ENUM16:
+    case ESP_MATTER_VAL_TYPE_BITMAP16:
+        err = writer.Put(context_tag, static_cast<uint16_t>(0), true);
+        field.width = 2;
+        break;
+    case ESP_MATTER_VAL_TYPE_INT32:
+        err = writer.Put(context_tag, static_cast<int32_t>(0), true);
+        field.width = 4;
+        break;
+    case ESP_MATTER_VAL_TYPE_UINT32:
+    case ESP_MATTER_VAL_TYPE_BITMAP32:
+        err = writer.Put(context_tag, static_cast<uint32_t>(0), true);
+        field.width = 4;
+        break;
+    case ESP_MATTER_VAL_TYPE_INT64:
+        err = writer.Put(context_tag, static_cast<int64_t>(0), true);
+        field.width = 8;
+        break;
+    case ESP_MATTER_VAL_TYPE_UINT64:
+        err = writer.Put(context_tag, static_cast<uint64_t>(0), true);
+        field.width = 8;
+        break;
+    default:
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
+    ReturnErrorOnFailure(err);
+
+    field.type = type;
+    field.offset = static_cast<uint8_t>(field.width ? writer.GetLengthWritten() - field.width : start);
+    return CHIP_NO_ERROR;
+}
+
+static bool is_in_range(esp_matter_val_type_t type, int64_t value)
+{
+    switch (type) {
+    case ESP_MATTER_VAL_TYPE_BOOLEAN:
+        return value == 0 || value == 1;
+    case ESP_MATTER_VAL_TYPE_INT8:
+        return value >= INT8_MIN && value <= INT8_MAX;
+    case ESP_MATTER_VAL_TYPE_UINT8:
+    case ESP_MATTER_VAL_TYPE_ENUM8:
+    case ESP_MATTER_VAL_TYPE_BITMAP8:
+        return value >= 0 && value <= UINT8_MAX;
+    case ESP_MATTER_VAL_TYPE_INT16:
+        return value >= INT16_MIN && value <= INT16_MAX;
+    case ESP_MATTER_VAL_TYPE_UINT16:
+    case ESP_MATTER_VAL_TYPE_ENUM16:
+    case ESP_MATTER_VAL_TYPE_BITMAP16:
+        return value >= 0 && value <= UINT16_MAX;
+    case ESP_MATTER_VAL_TYPE_INT32:
+        return value >= INT32_MIN && value <= INT32_MAX;
+    case ESP_MATTER_VAL_TYPE_UINT32:
+    case ESP_MATTER_VAL_TYPE_BITMAP32:
+        return value >= 0 && value <= UINT32_MAX;
+    case ESP_MATTER_VAL_TYPE_INT64:
+        return true;
+    case ESP_MATTER_VAL_TYPE_UINT64:
+        return value >= 0;
+    default:
+        return false;
+    }
+}
+
+static esp_err_t check_values(const payload_template_t *payload_template, const int64_t *values, uint8_t value_count)
+{
+    ESP_RETURN_ON_FALSE(payload_template, ESP_ERR_INVALID_ARG, TAG, "payload_template cannot be NULL");
+    ESP_RETURN_ON_FALSE(value_count == payload_template->field_count && (values || value_count == 0),
+                        ESP_ERR_INVALID_ARG, TAG, "Expected %u values", payload_template->field_count);
+    for (uint8_t i = 0; i < value_count; i++) {
+        ESP_RETURN_ON_FALSE(is_in_range(payload_template->fields[i].type, values[i]), ESP_ERR_INVALID_ARG, TAG,
+                            "Value %" PRId64 " of field %u does not fit its type %d", values[i], i,
+                            payload_template->fields[i].type);
+    }
+    return ESP_OK;
+}
+
+static void patch_field(uint8_t *payload, const field_t &field, int64_t value)
+{
+    if (field.type == ESP_MATTER_VAL_TYPE_BOOLEAN) {
+        /* The element types of false and true only differ in the lowest bit of the control byte */
+        payload[field.offset] = value ? (payload[field.offset] | 0x01) : (payload[field.offset] & ~0x01);
+        return;
+    }
+    /* TLV integers are little endian */
+    for (uint8_t i = 0; i < field.width; i++) {
+        payload[field.offset + i] = static_cast<uint8_t>(static_cast<uint64_t>(value) >> (8 * i));
+    }
+}
+
+/* Log all the queued events, the Matter stack lock is held once for the whole batch */
+static void flush_pending_events(intptr_t arg)
+{
+    pending_event_t event;
+    uint32_t logged = 0;
+    uint32_t dropped = 0;
+
+    while (true) {
+        taskENTER_CRITICAL(&s_lock);
+        if (s_pending_count == 0) {
+            s_flush_scheduled = false;
+            s_stats.log_count += logged;
+            s_stats.drop_count += dropped;
+            s_stats.batch_count++;
+            taskEXIT_CRITICAL(&s_lock);
+            break;
+        }
+        event = s_pending[s_pending_head];
+        s_pending_head = (s_pending_head + 1) % PENDING_EVENT_COUNT;
+        s_pending_count--;
+        taskEXIT_CRITICAL(&s_lock);
+
+        EventOptions options;
+        options.mPath = chip::app::ConcreteEventPath(event.endpoint_id, event.cluster_id, event.event_id);
+        options.mPriority = event.priority;
+        EventNumber event_number;
+        PreEncodedEventLogger logger(event.payload, event.payload_size);
+        CHIP_ERROR err = EventManagement::GetInstance().LogEvent(&logger, options, event_number);
+        if (err != CHIP_NO_ERROR) {
+            ESP_LOGE(TAG, "Failed to log event 0x%" PRIx32 " of cluster 0x%" PRIx32 " on endpoint %u: %" CHIP_ERROR_FORMAT,
+                     event.event_id, event.cluster_id, event.endpoint_id, err.Format());
+            dropped++;
+        } else {
+            logged++;
+        }
+    }
+}
+
+payload_template_t *create(uint32_t cluster_id, uint32_t event_id, PriorityLevel priority,
+                           const esp_matter_val_type_t *field_types, uint8_t field_count)
+{
+    ESP_RETURN_ON_FALSE(field_count <= k_max_field_count && (field_types || field_count == 0), NULL, TAG,
+                        "Invalid fields");
+
+    payload_template_t *payload_template = (payload_template_t *)esp_matter_mem_calloc(1, sizeof(payload_template_t));
+    ESP_RETURN_ON_FALSE(payload_template, NULL, TAG, "Failed to allocate the event template");
+    payload_template->cluster_id = cluster_id;
+    payload_template->event_id = event_id;
+    payload_template->priority = priority;
+    payload_template->field_count = field_count;
+
+    /* Context tags are only allowed inside a container, the fields are encoded in an anonymous structure */
+    uint8_t encoded[MAX_ENCODED_SIZE];
+    chip::TLV::TLVWriter writer;
+    chip::TLV::TLVType outer_type;
+    writer.Init(encoded, sizeof(encoded));
+    CHIP_ERROR err = writer.StartContainer(chip::TLV::AnonymousTag(), chip::TLV::kTLVType_Structure, outer_type);
+    for (uint8_t i = 0; i < field_count && err == CHIP_NO_ERROR; i++) {
+        err = encode_field(writer, i, field_types[i], payload_template->fields[i]);
+        if (err != CHIP_NO_ERROR) {
+            ESP_LOGE(TAG, "Failed to encode field %u of event 0x%" PRIx32 ", type: %d", i, event_id, field_types[i]);
+        }
+    }
+    if (err == CHIP_NO_ERROR) {
+        err = writer.EndContainer(outer_type);
+    }
+    if (err == CHIP_NO_ERROR) {
+        err = writer.Finalize();
+    }
+    if (err != CHIP_NO_ERROR) {
+        ESP_LOGE(TAG, "Failed to encode the payload of event 0x%" PRIx32 ": %" CHIP_ERROR_FORMAT, event_id,
+                 err.Format());
+        esp_matter_mem_free(payload_template);
+        return NULL;
+    }
+
+    /* Drop the control byte of the structure, the event logger writes the structure with its data tag */
+    payload_template->payload_size = static_cast<uint8_t>(writer.GetLengthWritten() - 1);
+    memcpy(payload_template->payload, encoded + 1, payload_template->payload_size);
+    for (uint8_t i = 0; i < field_count; i++) {
+        payload_template->fields[i].offset--;
+    }
+    return payload_template;
+}
+
+esp_err_t destroy(payload_template_t *payload_template)
+{
+    ESP_RETURN_ON_FALSE(payload_template, ESP_ERR_INVALID_ARG, TAG, "payload_template cannot be NULL");
+    esp_matter_mem_free(payload_template);
+    return ESP_OK;
+}
+
+esp_err_t get_payload(const payload_template_t *payload_template, const int64_t *values, uint8_t value_count,
+                      uint8_t *buf, size_t buf_size, size_t *payload_size)
+{
+    ESP_RETURN_ON_ERROR(check_values(payload_template, values, value_count), TAG, "Invalid values");
+    ESP_RETURN_ON_FALSE(buf && payload_size, ESP_ERR_INVALID_ARG, TAG, "buf and payload_size cannot be NULL");
+    ESP_RETURN_ON_FALSE(buf_size >= payload_template->payload_size, ESP_ERR_INVALID_SIZE, TAG,
+                        "Buffer too small, %u bytes needed", payload_template->payload_size);
+    memcpy(buf, payload_template->payload, payload_template->payload_size);
+    for (uint8_t i = 0; i < value_count; i++) {
+        patch_field(buf, payload_template->fields[i], values[i]);
+    }
+    *payload_size = payload_template->payload_size;
+    return ESP_OK;
+}
+
+esp_err_t emit(payload_template_t *payload_template, uint16_t endpoint_id, const int64_t *values, uint8_t value_count)
+{
+    ESP_RETURN_ON_ERROR(check_values(payload_template, values, value_count), TAG, "Invalid values");
+
+    bool schedule = false;
+    taskENTER_CRITICAL(&s_lock);
+    s_stats.emit_count++;
+    if (s_pending_count == PENDING_EVENT_COUNT) {
+        s_stats.drop_count++;
+        taskEXIT_CRITICAL(&s_lock);
+        ESP_LOGE(TAG, "Too many pending events, dropping event 0x%" PRIx32, payload_template->event_id);
+        return ESP_ERR_NO_MEM;
+    }
+    pending_event_t *event = &s_pending[(s_pending_head + s_pending_count) % PENDING_EVENT_COUNT];
+    event->cluster_id = payload_template->cluster_id;
+    event->event_id = payload_template->event_id;
+    event->priority = payload_template->priority;
+    event->endpoint_id = endpoint_id;
+    event->payload_size = payload_template->payload_size;
+    memcpy(event->payload, payload_template->payload, payload_template->payload_size);
+    for (uint8_t i = 0; i < value_count; i++) {
+        patch_field(event->payload, payload_template->fields[i], values[i]);
+    }
+    s_pending_count++;
+    schedule = !s_flush_scheduled;
+    s_flush_scheduled = true;
+    taskEXIT_CRITICAL(&s_lock);
+
+    if (schedule) {
+        CHIP_ERROR err = chip::DeviceLayer::PlatformMgr().ScheduleWork(flush_pending_events);
+        if (err != CHIP_NO_ERROR) {
+            taskENTER_CRITICAL(&s_lock);
+            s_flush_scheduled = false;
+            taskEXIT_CRITICAL(&s_lock);
+            ESP_LOGE(TAG, "Failed to schedule the event logging: %" CHIP_ERROR_FORMAT, err.Format());
+            return ESP_FAIL;
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t get_stats(stats_t *stats)
+{
+    ESP_RETURN_ON_FALSE(stats, ESP_ERR_INVALID_ARG, TAG, "stats cannot be NULL");
+    taskENTER_CRITICAL(&s_lock);
+    *stats = s_stats;
+    taskEXIT_CRITICAL(&s_lock);
+    return ESP_OK;
+}
+
+} // namespace payload_template
+} // namespace event
+} // namespace esp_matter
@@ -0,0 +1,126 @@
+// Copyright 2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <app/EventLoggingTypes.h>
+#include <esp_err.h>
+#include <esp_matter_attribute_utils.h>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace esp_matter {
+namespace event {
+namespace payload_template {
+
+/** Pre-encoded event payloads
+ *
+ * The payload of an event whose fields are all integers, enums, bitmaps or booleans is encoded once, when its
+ * template is created, with every field at its full width. Emitting the event copies the encoded payload and
+ * patches the field values in place, no TLV encoding is done per event.
+ *
+ * The emitted events are queued and logged together by one work item on the Matter thread, so a burst of events,
+ * such as a multi-press sequence, takes the Matter stack lock once.
+ */
+typedef struct payload_template payload_template_t;
+
+/** Maximum number of fields of a template */
+constexpr uint8_t k_max_field_count = 4;
+
+typedef struct stats {
+    /** Events queued by emit() */
+    uint32_t emit_count;
+    /** Events logged to the event log */
+    uint32_t log_count;
+    /** Events dropped, the queue was full or the event could not be logged */
+    uint32_t drop_count;
+    /** Work items which logged the queued events */
+    uint32_t batch_count;
+} stats_t;
+
+/** Create an event payload template
+ *
+ * @param[in] cluster_id cluster id of the event.
+ * @param[in] event_id event id.
+ * @param[in] priority priority of the event.
+ * @param[in] field_types types of the fields, in the order of their context tags from 0. Nullable types are not
+ *                        supported.
+ * @param[in] field_count number of fields, up to k_max_field_count.
+ *
+ * @return template handle on success.
+ * @return NULL in case of failure.
+ */
+payload_template_t *create(uint32_t cluster_id, uint32_t event_id, chip::app::PriorityLevel priority,
+                           const esp_matter_val_type_t *field_types, uint8_t field_count);
+
+/** Destroy an event payload template
+ *
+ * The events already emitted from the template are still logged. The template must not be used by emit() or
+ * get_payload() once it is destroyed.
+ *
+ * @param[in] payload_template template handle.
+ *
+ * @return ESP_OK on success.
+ * @return error in case of failure.
+ */
+esp_err_t destroy(payload_template_t *payload_template);
+
+/** Emit an event from its template
+ *
+ * Can be called from any task. The event is logged from the Matter thread, after the events emitted before it.
+ *
+ * @param[in] payload_template template handle.
+ * @param[in] endpoint_id endpoint of the event.
+ * @param[in] values values of the fields, in the order of the template fields. Each value must fit the type of
+ *                   its field, a boolean is 0 or 1.
+ * @param[in] value_count number of values, equal to the number of fields of the template.
+ *
+ * @return ESP_OK on success.
+ * @return ESP_ERR_INVALID_ARG if a value does not fit the type of its field.
+ * @return ESP_ERR_NO_MEM if the queue of the events to log is full.
+ * @return error in case of failure.
+ */
+esp_err_t emit(payload_template_t *payload_template, uint16_t endpoint_id, const int64_t *values, uint8_t value_count);
+
+/** Get the patched payload of an event
+ *
+ * The payload is the encoded fields followed by the end of container of the event data structure, without the
+ * control byte of the structure, as written by TLVWriter::PutPreEncodedContainer().
+ *
+ * @param[in] payload_template template handle.
+ * @param[in] values values of the fields, as for emit().
+ * @param[in] value_count number of values, equal to the number of fields of the template.
+ * @param[out] buf buffer for the payload.
+ * @param[in] buf_size size of the buffer.
+ * @param[out] payload_size size of the payload.
+ *
+ * @return ESP_OK on success.
+ * @return ESP_ERR_INVALID_ARG if a value does not fit the type of its field.
+ * @return ESP_ERR_INVALID_SIZE if the buffer is too small.
+ */
+esp_err_t get_payload(const payload_template_t *payload_template, const int64_t *values, uint8_t value_count,
+                      uint8_t *buf, size_t buf_size, size_t *payload_size);
+
+/** Get the counters of the emitted events
+ *
+ * @param[out] stats counters.
+ *
+ * @return ESP_OK on success.
+ * @return error in case of failure.
+ */
+esp_err_t get_stats(stats_t *stats);
+
+} // namespace payload_template
+} // namespace event
+} // namespace esp_matter
@@ -18,6 +18,7 @@
 #include <esp_matter.h>
 #include <esp_matter_feature.h>
 #include <esp_matter_data_model_priv.h>
+#include <cluster_select/esp_matter_cluster_select.h>
 
 #include <app-common/zap-generated/cluster-enums.h>
 
@@ -57,6 +58,7 @@ static uint32_t get_feature_map_value(cluster_t *cluster)
     return val.val.u32;
 }
 
+#if ESP_MATTER_CLUSTER_SELECTED(descriptor)
 namespace descriptor {
 namespace feature {
 namespace tag_list {
@@ -81,7 +83,9 @@ esp_err_t add(cluster_t *cluster)
 
 }
 }
+#endif // ESP_MATTER_CLUSTER_SELECTED(descriptor)
 
+#if ESP_MATTER_CLUSTER_SELECTED(access_control)
 namespace access_control {
 namespace feature {
 namespace extension {
@@ -140,7 +144,9 @@ esp_err_t add(cluster_t *cluster)
 
 }
 } /* access_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(access_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(bridged_device_basic_information)
 namespace bridged_device_basic_information {
 namespace feature {
 namespace bridged_icd_support {
@@ -168,7 +174,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* bridged_device_basic_information */
+#endif // ESP_MATTER_CLUSTER_SELECTED(bridged_device_basic_information)
 
+#if ESP_MATTER_CLUSTER_SELECTED(administrator_commissioning)
 namespace administrator_commissioning {
 namespace feature {
 namespace basic {
@@ -192,7 +200,9 @@ esp_err_t add(cluster_t *cluster)
 
 }
 } /* administrator_commissioning */
+#endif // ESP_MATTER_CLUSTER_SELECTED(administrator_commissioning)
 
+#if ESP_MATTER_CLUSTER_SELECTED(general_commissioning)
 namespace general_commissioning {
 namespace feature {
 namespace terms_and_conditions {
@@ -224,7 +234,9 @@ esp_err_t add(cluster_t *cluster)
 
 }
 } /* general_commissioning */
+#endif // ESP_MATTER_CLUSTER_SELECTED(general_commissioning)
 
+#if ESP_MATTER_CLUSTER_SELECTED(power_source)
 namespace power_source {
 namespace feature {
 namespace wired {
@@ -336,7 +348,9 @@ esp_err_t add(cluster_t *cluster, config_t *config)
 } /* replaceable */
 } /* feature */
 } /* power_source */
+#endif // ESP_MATTER_CLUSTER_SELECTED(power_source)
 
+#if ESP_MATTER_CLUSTER_SELECTED(scenes_management)
 namespace scenes_management {
 namespace feature {
 namespace scene_names {
@@ -357,7 +371,9 @@ esp_err_t add(cluster_t *cluster)
 } /* scene_names */
 } /* feature */
 } /* scenes_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(scenes_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(icd_management)
 namespace icd_management {
 namespace feature {
 namespace check_in_protocol_support {
@@ -457,7 +473,9 @@ esp_err_t add(cluster_t *cluster)
 } /* dynamic_sit_lit_support */
 } /* feature */
 } /* icd_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(icd_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(on_off)
 namespace on_off {
 namespace feature {
 namespace lighting {
@@ -532,7 +550,9 @@ esp_err_t add(cluster_t *cluster)
 } /* off_only */
 } /* feature */
 } /* on_off */
+#endif // ESP_MATTER_CLUSTER_SELECTED(on_off)
 
+#if ESP_MATTER_CLUSTER_SELECTED(level_control)
 namespace level_control {
 namespace feature {
 namespace on_off {
@@ -598,7 +618,9 @@ esp_err_t add(cluster_t *cluster, config_t *config)
 } /* frequency */
 } /* feature */
 } /* level_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(level_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(color_control)
 namespace color_control {
 namespace feature {
 
@@ -774,7 +796,9 @@ esp_err_t add(cluster_t *cluster, config_t *config)
 } /* color_loop */
 } /* feature */
 } /* color_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(color_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(window_covering)
 namespace window_covering {
 namespace feature {
 namespace lift {
@@ -880,7 +904,9 @@ esp_err_t add(cluster_t *cluster, config_t *config)
 } /* position_aware_tilt */
 } /* feature */
 } /* window_covering */
+#endif // ESP_MATTER_CLUSTER_SELECTED(window_covering)
 
+#if ESP_MATTER_CLUSTER_SELECTED(wifi_network_diagnostics)
 namespace wifi_network_diagnostics {
 namespace feature {
 
@@ -938,7 +964,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* wifi_network_diagnostics */
+#endif // ESP_MATTER_CLUSTER_SELECTED(wifi_network_diagnostics)
 
+#if ESP_MATTER_CLUSTER_SELECTED(thread_network_diagnostics)
 namespace thread_network_diagnostics {
 namespace feature {
 
@@ -1014,7 +1042,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* thread_network_diagnostics */
+#endif // ESP_MATTER_CLUSTER_SELECTED(thread_network_diagnostics)
 
+#if ESP_MATTER_CLUSTER_SELECTED(ethernet_network_diagnostics)
 namespace ethernet_network_diagnostics {
 namespace feature {
 
@@ -1063,7 +1093,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* ethernet_network_diagnostics */
+#endif // ESP_MATTER_CLUSTER_SELECTED(ethernet_network_diagnostics)
 
+#if ESP_MATTER_CLUSTER_SELECTED(air_quality)
 namespace air_quality {
 namespace feature {
 
@@ -1137,7 +1169,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* air_quality */
+#endif // ESP_MATTER_CLUSTER_SELECTED(air_quality)
 
+#if ESP_MATTER_CLUSTER_SELECTED(concentration_measurement)
 namespace concentration_measurement {
 namespace feature {
 
@@ -1270,7 +1304,9 @@ esp_err_t add(cluster_t *cluster, config_t *config)
 
 } /* feature */
 } /* concentration_measurement */
+#endif // ESP_MATTER_CLUSTER_SELECTED(concentration_measurement)
 
+#if ESP_MATTER_CLUSTER_SELECTED(resource_monitoring)
 namespace resource_monitoring {
 namespace feature {
 
@@ -1332,7 +1368,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* resource_monitoring */
+#endif // ESP_MATTER_CLUSTER_SELECTED(resource_monitoring)
 
+#if ESP_MATTER_CLUSTER_SELECTED(laundry_washer_controls)
 namespace laundry_washer_controls {
 namespace feature {
 
@@ -1380,7 +1418,9 @@ esp_err_t add(cluster_t *cluster, config_t *config)
 
 } /* feature */
 } /* laundry_washer_controls */
+#endif // ESP_MATTER_CLUSTER_SELECTED(laundry_washer_controls)
 
+#if ESP_MATTER_CLUSTER_SELECTED(smoke_co_alarm)
 namespace smoke_co_alarm {
 namespace feature {
 
@@ -1428,7 +1468,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* smoke_co_alarm */
+#endif // ESP_MATTER_CLUSTER_SELECTED(smoke_co_alarm)
 
+#if ESP_MATTER_CLUSTER_SELECTED(thermostat)
 namespace thermostat {
 namespace feature {
 
@@ -1615,7 +1657,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* thermostat */
+#endif // ESP_MATTER_CLUSTER_SELECTED(thermostat)
 
+#if ESP_MATTER_CLUSTER_SELECTED(switch_cluster)
 namespace switch_cluster {
 namespace feature {
 namespace latching_switch {
@@ -1751,7 +1795,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* switch_cluster */
+#endif // ESP_MATTER_CLUSTER_SELECTED(switch_cluster)
 
+#if ESP_MATTER_CLUSTER_SELECTED(unit_localization)
 namespace unit_localization {
 namespace feature {
 
@@ -1778,7 +1824,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* unit_localization */
+#endif // ESP_MATTER_CLUSTER_SELECTED(unit_localization)
 
+#if ESP_MATTER_CLUSTER_SELECTED(time_format_localization)
 namespace time_format_localization {
 namespace feature {
 
@@ -1809,7 +1857,9 @@ esp_err_t add(cluster_t *cluster, config_t *config)
 
 } /* feature */
 } /* time_format_localization */
+#endif // ESP_MATTER_CLUSTER_SELECTED(time_format_localization)
 
+#if ESP_MATTER_CLUSTER_SELECTED(mode_select)
 namespace mode_select {
 namespace feature {
 
@@ -1833,6 +1883,7 @@ esp_err_t add(cluster_t *cluster, config_t *config)
 
 } /* feature */
 } /* mode_select */
+#endif // ESP_MATTER_CLUSTER_SELECTED(mode_select)
 
 namespace pressure_measurement {
 namespace feature {
@@ -1862,6 +1913,7 @@ esp_err_t add(cluster_t *cluster, config_t *config)
 } /* feature */
 } /* pressure_measurement */
 
+#if ESP_MATTER_CLUSTER_SELECTED(general_diagnostics)
 namespace general_diagnostics {
 namespace feature {
 
@@ -1883,6 +1935,8 @@ esp_err_t add(cluster_t *cluster, config_t *config)
 } /* data_model_test */
 } /* feature */
 } /* general diagnostics */
+#endif // ESP_MATTER_CLUSTER_SELECTED(general_diagnostics)
+#if ESP_MATTER_CLUSTER_SELECTED(software_diagnostics)
 namespace software_diagnostics {
 namespace feature {
 
@@ -1912,7 +1966,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* software_diagnostics */
+#endif // ESP_MATTER_CLUSTER_SELECTED(software_diagnostics)
 
+#if ESP_MATTER_CLUSTER_SELECTED(temperature_control)
 namespace temperature_control {
 namespace feature {
 namespace temperature_number {
@@ -1997,7 +2053,9 @@ esp_err_t add(cluster_t *cluster, config_t *config)
 
 } /* feature */
 } /* temperature_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(temperature_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(fan_control)
 namespace fan_control {
 namespace feature {
 
@@ -2113,7 +2171,9 @@ esp_err_t add(cluster_t *cluster, config_t *config)
 
 } /* feature */
 } /* fan_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(fan_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(keypad_input)
 namespace keypad_input {
 namespace feature {
 
@@ -2167,7 +2227,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* keypad_input */
+#endif // ESP_MATTER_CLUSTER_SELECTED(keypad_input)
 
+#if ESP_MATTER_CLUSTER_SELECTED(boolean_state_configuration)
 namespace boolean_state_configuration {
 namespace feature {
 
@@ -2262,7 +2324,9 @@ esp_err_t add(cluster_t *cluster, config_t *config)
 
 } /* feature */
 } /* boolean_state_configuration */
+#endif // ESP_MATTER_CLUSTER_SELECTED(boolean_state_configuration)
 
+#if ESP_MATTER_CLUSTER_SELECTED(power_topology)
 namespace power_topology {
 namespace feature {
 
@@ -2342,7 +2406,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* power_topology */
+#endif // ESP_MATTER_CLUSTER_SELECTED(power_topology)
 
+#if ESP_MATTER_CLUSTER_SELECTED(electrical_power_measurement)
 namespace electrical_power_measurement {
 namespace feature {
 
@@ -2454,7 +2520,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* electrical_power_measurement */
+#endif // ESP_MATTER_CLUSTER_SELECTED(electrical_power_measurement)
 
+#if ESP_MATTER_CLUSTER_SELECTED(electrical_energy_measurement)
 namespace electrical_energy_measurement {
 namespace feature {
 
@@ -2542,7 +2610,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* electrical_energy_measurement */
+#endif // ESP_MATTER_CLUSTER_SELECTED(electrical_energy_measurement)
 
+#if ESP_MATTER_CLUSTER_SELECTED(door_lock)
 namespace door_lock {
 namespace feature {
 
@@ -2938,7 +3008,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* door_lock */
+#endif // ESP_MATTER_CLUSTER_SELECTED(door_lock)
 
+#if ESP_MATTER_CLUSTER_SELECTED(energy_evse)
 namespace energy_evse {
 namespace feature {
 namespace charging_preferences {
@@ -3053,7 +3125,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* energy_evse */
+#endif // ESP_MATTER_CLUSTER_SELECTED(energy_evse)
 
+#if ESP_MATTER_CLUSTER_SELECTED(microwave_oven_control)
 namespace microwave_oven_control {
 namespace feature {
 
@@ -3134,7 +3208,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* microwave_oven_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(microwave_oven_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(valve_configuration_and_control)
 namespace valve_configuration_and_control {
 namespace feature {
 
@@ -3177,7 +3253,9 @@ esp_err_t add(cluster_t *cluster, config_t *config)
 
 } /* feature */
 } /* valve_configuration_and_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(valve_configuration_and_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(device_energy_management)
 namespace device_energy_management {
 namespace feature {
 
@@ -3348,7 +3426,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* device_energy_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(device_energy_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(thread_border_router_management)
 namespace thread_border_router_management {
 namespace feature {
 
@@ -3373,7 +3453,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* thread_border_router_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(thread_border_router_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(service_area)
 namespace service_area {
 namespace feature {
 
@@ -3440,7 +3522,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* service_area */
+#endif // ESP_MATTER_CLUSTER_SELECTED(service_area)
 
+#if ESP_MATTER_CLUSTER_SELECTED(water_heater_management)
 namespace water_heater_management {
 namespace feature {
 
@@ -3491,7 +3575,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* water_heater_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(water_heater_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(energy_preference)
 namespace energy_preference {
 namespace feature {
 
@@ -3541,7 +3627,9 @@ esp_err_t add(cluster_t *cluster, config_t *config)
 
 } /* feature */
 } /* energy_preference */
+#endif // ESP_MATTER_CLUSTER_SELECTED(energy_preference)
 
+#if ESP_MATTER_CLUSTER_SELECTED(occupancy_sensing)
 namespace occupancy_sensing {
 namespace feature {
 
@@ -3692,7 +3780,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* occupancy_sensing */
+#endif // ESP_MATTER_CLUSTER_SELECTED(occupancy_sensing)
 
+#if ESP_MATTER_CLUSTER_SELECTED(pump_configuration_and_control)
 namespace pump_configuration_and_control {
 namespace feature {
 namespace constant_pressure {
@@ -3844,7 +3934,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* pump_configuration_and_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(pump_configuration_and_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(time_synchronization)
 namespace time_synchronization {
 namespace feature {
 
@@ -3964,7 +4056,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* time_synchronization */
+#endif // ESP_MATTER_CLUSTER_SELECTED(time_synchronization)
 
+#if ESP_MATTER_CLUSTER_SELECTED(camera_av_stream_management)
 namespace camera_av_stream_management {
 
 namespace feature {
@@ -4202,13 +4296,19 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* Camera AV Stream Management*/
+#endif // ESP_MATTER_CLUSTER_SELECTED(camera_av_stream_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(webrtc_transport_provider)
 namespace webrtc_transport_provider {
 }/*webrtc_transport_provider*/
+#endif // ESP_MATTER_CLUSTER_SELECTED(webrtc_transport_provider)
 
+#if ESP_MATTER_CLUSTER_SELECTED(webrtc_transport_requestor)
 namespace webrtc_transport_requestor {
 }/*webrtc_transport_requestor*/
+#endif // ESP_MATTER_CLUSTER_SELECTED(webrtc_transport_requestor)
 
+#if ESP_MATTER_CLUSTER_SELECTED(closure_control)
 namespace closure_control {
 namespace feature {
 namespace positioning {
@@ -4370,7 +4470,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* closure_control */
+#endif // ESP_MATTER_CLUSTER_SELECTED(closure_control)
 
+#if ESP_MATTER_CLUSTER_SELECTED(closure_dimension)
 namespace closure_dimension {
 namespace feature {
 namespace positioning {
@@ -4522,7 +4624,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* closure_dimension */
+#endif // ESP_MATTER_CLUSTER_SELECTED(closure_dimension)
 
+#if ESP_MATTER_CLUSTER_SELECTED(camera_av_settings_user_level_management)
 namespace camera_av_settings_user_level_management {
 namespace feature {
 namespace digital_ptz {
@@ -4641,7 +4745,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* camera_av_settings_user_level_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(camera_av_settings_user_level_management)
 
+#if ESP_MATTER_CLUSTER_SELECTED(push_av_stream_transport)
 namespace push_av_stream_transport {
 namespace feature {
 namespace per_zone_sensitivity {
@@ -4678,7 +4784,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* push_av_stream_transport */
+#endif // ESP_MATTER_CLUSTER_SELECTED(push_av_stream_transport)
 
+#if ESP_MATTER_CLUSTER_SELECTED(commodity_tariff)
 namespace commodity_tariff {
 namespace feature {
 namespace pricing {
@@ -4782,7 +4890,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* commodity_tariff */
+#endif // ESP_MATTER_CLUSTER_SELECTED(commodity_tariff)
 
+#if ESP_MATTER_CLUSTER_SELECTED(commodity_price)
 namespace commodity_price {
 namespace feature {
 namespace forecasting {
@@ -4805,7 +4915,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* commodity_price */
+#endif // ESP_MATTER_CLUSTER_SELECTED(commodity_price)
 
+#if ESP_MATTER_CLUSTER_SELECTED(electrical_grid_conditions)
 namespace electrical_grid_conditions {
 namespace feature {
 namespace forecasting {
@@ -4828,7 +4940,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* electrical_grid_conditions */
+#endif // ESP_MATTER_CLUSTER_SELECTED(electrical_grid_conditions)
 
+#if ESP_MATTER_CLUSTER_SELECTED(meter_identification)
 namespace meter_identification {
 namespace feature {
 namespace power_threshold {
@@ -4851,7 +4965,9 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* meter_identification */
+#endif // ESP_MATTER_CLUSTER_SELECTED(meter_identification)
 
+#if ESP_MATTER_CLUSTER_SELECTED(zone_management)
 namespace zone_management {
 namespace feature {
 namespace two_dimensional_cartesian_zone {
@@ -4936,6 +5052,7 @@ esp_err_t add(cluster_t *cluster)
 
 } /* feature */
 } /* zone_management */
+#endif // ESP_MATTER_CLUSTER_SELECTED(zone_management)
 
 } /* cluster */
 } /* esp_matter */
@@ -0,0 +1,242 @@
+// Copyright 2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <esp_check.h>
+#include <esp_log.h>
+#include <esp_matter_attribute_utils.h>
+#include <esp_matter_measurement.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <inttypes.h>
+#include <stdlib.h>
+
+#include <platform/CHIPDeviceLayer.h>
+
+static const char *TAG = "esp_matter_measurement";
+
+namespace esp_matter {
+namespace measurement {
+
+struct measurement {
+    config_t config;
+    portMUX_TYPE lock;
+    filter::state_t filter;
+    /* An update of the attribute is scheduled on the Matter thread, it writes the last published value */
+    bool update_scheduled;
+    /* Publish state before the scheduled update, restored if the update cannot be scheduled */
+    filter::state_t unscheduled_filter;
+    uint32_t unscheduled_publish_count;
+    stats_t stats;
+};
+
+static bool is_supported_type(esp_matter_val_type_t type)
+{
+    switch (type & ~ESP_MATTER_VAL_NULLABLE_BASE) {
+    case ESP_MATTER_VAL_TYPE_BOOLEAN:
+    case ESP_MATTER_VAL_TYPE_INTEGER:
+    case ESP_MATTER_VAL_TYPE_INT8:
+    case ESP_MATTER_VAL_TYPE_UINT8:
+    case ESP_MATTER_VAL_TYPE_INT16:
+    case ESP_MATTER_VAL_TYPE_UINT16:
+    case ESP_MATTER_VAL_TYPE_INT32:
+    case ESP_MATTER_VAL_TYPE_UINT32:
+    case ESP_MATTER_VAL_TYPE_INT64:
+    case ESP_MATTER_VAL_TYPE_UINT64:
+    case ESP_MATTER_VAL_TYPE_ENUM8:
+    case ESP_MATTER_VAL_TYPE_BITMAP8:
+    case ESP_MATTER_VAL_TYPE_BITMAP16:
+    case ESP_MATTER_VAL_TYPE_BITMAP32:
+    case ESP_MATTER_VAL_TYPE_ENUM16:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/* The value is written as is, so the attribute is updated without reading it first */
+static esp_matter_attr_val_t to_attr_val(esp_matter_val_type_t type, int64_t value)
+{
+    esp_matter_attr_val_t val = esp_matter_invalid(NULL);
+    val.type = type;
+    switch (type & ~ESP_MATTER_VAL_NULLABLE_BASE) {
+    case ESP_MATTER_VAL_TYPE_BOOLEAN:
+        val.val.b = value != 0;
+        break;
+    case ESP_MATTER_VAL_TYPE_INTEGER:
+        val.val.i = (int)value;
+        break;
+    case ESP_MATTER_VAL_TYPE_INT8:
+        val.val.i8 = (int8_t)value;
+        break;
+    case ESP_MATTER_VAL_TYPE_UINT8:
+    case ESP_MATTER_VAL_TYPE_ENUM8:
+    case ESP_MATTER_VAL_TYPE_BITMAP8:
+        val.val.u8 = (uint8_t)value;
+        break;
+    case ESP_MATTER_VAL_TYPE_INT16:
+        val.val.i16 = (int16_t)value;
+        break;
+    case ESP_MATTER_VAL_TYPE_UINT16:
+    case ESP_MATTER_VAL_TYPE_BITMAP16:
+    case ESP_MATTER_VAL_TYPE_ENUM16:
+        val.val.u16 = (uint16_t)value;
+        break;
+    case ESP_MATTER_VAL_TYPE_INT32:
+        val.val.i32 = (int32_t)value;
+        break;
+    case ESP_MATTER_VAL_TYPE_UINT32:
+    case ESP_MATTER_VAL_TYPE_BITMAP32:
+        val.val.u32 = (uint32_t)value;
+        break;
+    case ESP_MATTER_VAL_TYPE_INT64:
+        val.val.i64 = value;
+        break;
+    case ESP_MATTER_VAL_TYPE_UINT64:
+        val.val.u64 = (uint64_t)value;
+        break;
+    default:
+        break;
+    }
+    return val;
+}
+
+static void update_attribute(measurement_t *measurement)
+{
+    taskENTER_CRITICAL(&measurement->lock);
+    int64_t value = measurement->filter.published_value;
+    measurement->update_scheduled = false;
+    taskEXIT_CRITICAL(&measurement->lock);
+
+    esp_matter_attr_val_t val = to_attr_val(measurement->config.type, value);
+    esp_err_t err = attribute::update(measurement->config.endpoint_id, measurement->config.cluster_id,
+                                      measurement->config.attribute_id, &val);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to update ep: 0x%x, cluster: 0x%" PRIx32 ", att: 0x%" PRIx32 ", err: %d",
+                 measurement->config.endpoint_id, measurement->config.cluster_id, measurement->config.attribute_id,
+                 err);
+    }
+}
+
+measurement_t *create(const config_t *config)
+{
+    ESP_RETURN_ON_FALSE(config, NULL, TAG, "config cannot be NULL");
+    ESP_RETURN_ON_FALSE(is_supported_type(config->type), NULL, TAG, "Unsupported attribute type: %d", config->type);
+    ESP_RETURN_ON_FALSE(!config->max_interval_ms || config->max_interval_ms >= config->min_interval_ms, NULL, TAG,
+                        "max_interval_ms cannot be lower than min_interval_ms");
+
+    measurement_t *measurement = (measurement_t *)calloc(1, sizeof(measurement_t));
+    ESP_RETURN_ON_FALSE(measurement, NULL, TAG, "Failed to allocate the measurement");
+    measurement->config = *config;
+    measurement->lock = portMUX_INITIALIZER_UNLOCKED;
+    return measurement;
+}
+
+namespace filter {
+
+bool apply(const config_t *config, state_t *state, int64_t value, int64_t now_us, int64_t *out_value)
+{
+    if (config->average_count > 1) {
+        state->sample_sum += value;
+        if (++state->sample_count < config->average_count) {
+            return false;
+        }
+        value = state->sample_sum / state->sample_count;
+        state->sample_sum = 0;
+        state->sample_count = 0;
+    }
+
+    int64_t elapsed_ms = (now_us - state->publish_time_us) / 1000;
+    bool publish = false;
+    if (!state->has_published) {
+        publish = true;
+    } else if (value != state->published_value) {
+        uint64_t change = value > state->published_value ? value - state->published_value
+                                                         : state->published_value - value;
+        if (change >= config->deadband) {
+            publish = elapsed_ms >= config->min_interval_ms;
+        } else {
+            publish = config->max_interval_ms && elapsed_ms >= config->max_interval_ms;
+        }
+    }
+
+    if (publish) {
+        state->has_published = true;
+        state->published_value = value;
+        state->publish_time_us = now_us;
+        *out_value = value;
+    }
+    return publish;
+}
+
+} // namespace filter
+
+esp_err_t submit(measurement_t *measurement, int64_t value)
+{
+    ESP_RETURN_ON_FALSE(measurement, ESP_ERR_INVALID_ARG, TAG, "measurement cannot be NULL");
+    const config_t &config = measurement->config;
+    bool schedule = false;
+    int64_t now = esp_timer_get_time();
+
+    taskENTER_CRITICAL(&measurement->lock);
+    measurement->stats.sample_count++;
+    filter::state_t filter_before = measurement->filter;
+    int64_t published_value = 0;
+    if (filter::apply(&config, &measurement->filter, value, now, &published_value)) {
+        /* A value published before the scheduled update ran replaces the value it writes */
+        if (!measurement->update_scheduled) {
+            schedule = true;
+            measurement->update_scheduled = true;
+            measurement->unscheduled_filter = filter_before;
+            measurement->unscheduled_publish_count = measurement->stats.publish_count;
+        }
+        measurement->stats.publish_count++;
+    } else if (measurement->filter.sample_count == 0) {
+        /* Not a sample collected for the average */
+        measurement->stats.suppressed_count++;
+    }
+    taskEXIT_CRITICAL(&measurement->lock);
+
+    if (schedule) {
+        CHIP_ERROR err = chip::DeviceLayer::SystemLayer().ScheduleLambda([measurement]() {
+            update_attribute(measurement);
+        });
+        if (err != CHIP_NO_ERROR) {
+            /* Nothing was written, the values published since are compared again from the last written one. The
+             * samples collected for the next average are kept. */
+            taskENTER_CRITICAL(&measurement->lock);
+            measurement->update_scheduled = false;
+            measurement->filter.has_published = measurement->unscheduled_filter.has_published;
+            measurement->filter.published_value = measurement->unscheduled_filter.published_value;
+            measurement->filter.publish_time_us = measurement->unscheduled_filter.publish_time_us;
+            measurement->stats.publish_count = measurement->unscheduled_publish_count;
+            taskEXIT_CRITICAL(&measurement->lock);
+            ESP_LOGE(TAG, "Failed to schedule the update of ep: 0x%x, err: %" CHIP_ERROR_FORMAT, config.endpoint_id,
+                     err.Format());
+            return ESP_FAIL;
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t get_stats(measurement_t *measurement, stats_t *stats)
+{
+    ESP_RETURN_ON_FALSE(measurement && stats, ESP_ERR_INVALID_ARG, TAG, "Invalid arguments");
+    taskENTER_CRITICAL(&measurement->lock);
+    *stats = measurement->stats;
+    taskEXIT_CRITICAL(&measurement->lock);
+    return ESP_OK;
+}
+
+} // namespace measurement
+} // namespace esp_matter
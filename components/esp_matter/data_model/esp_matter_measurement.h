@@ -0,0 +1,126 @@
+// Copyright 2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <esp_err.h>
+#include <esp_matter_attribute_utils.h>
+#include <stdint.h>
+
+namespace esp_matter {
+namespace measurement {
+
+/** Measurement pipeline of one sensor attribute
+ *
+ * The sensor drivers submit their samples from any task. The samples are filtered before the data model is touched
+ * and only the values passing the filter are written to the attribute, from the Matter thread:
+ * - `average_count` samples are averaged into one value.
+ * - A value is published when it differs from the last published value by at least `deadband`, but not sooner than
+ *   `min_interval_ms` after the last publish. A change within the minimum interval is dropped, the first sample after
+ *   the interval is compared again.
+ * - A change smaller than `deadband` is published once `max_interval_ms` elapsed since the last publish.
+ * - The first value is always published.
+ */
+typedef struct measurement measurement_t;
+
+typedef struct config {
+    uint16_t endpoint_id;
+    uint32_t cluster_id;
+    uint32_t attribute_id;
+    /** Type of the attribute, only the boolean, integer, enum and bitmap types are supported */
+    esp_matter_val_type_t type;
+    /** Smallest change of the value which is published, in the attribute unit. 0 publishes every change */
+    uint32_t deadband;
+    /** Minimum time between two publishes, 0 for no limit */
+    uint32_t min_interval_ms;
+    /** Time after which a change smaller than the deadband is published, 0 to never publish it */
+    uint32_t max_interval_ms;
+    /** Number of samples averaged into one value, 0 or 1 for no averaging */
+    uint8_t average_count;
+} config_t;
+
+typedef struct stats {
+    /** Samples submitted */
+    uint32_t sample_count;
+    /** Values written to the attribute */
+    uint32_t publish_count;
+    /** Values dropped by the deadband or coalesced within the minimum interval */
+    uint32_t suppressed_count;
+} stats_t;
+
+/** Create a measurement pipeline
+ *
+ * @param[in] config configuration of the pipeline.
+ *
+ * @return measurement handle on success.
+ * @return NULL in case of failure.
+ */
+measurement_t *create(const config_t *config);
+
+/** Submit a sample, in the attribute unit
+ *
+ * Can be called from any task. The attribute is updated from the Matter thread when the value is published.
+ *
+ * @param[in] measurement measurement handle.
+ * @param[in] value sample value.
+ *
+ * @return ESP_OK on success.
+ * @return error in case of failure.
+ */
+esp_err_t submit(measurement_t *measurement, int64_t value);
+
+/** Filter of the measurement pipelines
+ *
+ * The averaging, deadband and interval filter that `submit()` runs, without the data model. It can be used to check
+ * a configuration against a series of samples.
+ */
+namespace filter {
+
+typedef struct state {
+    /** Samples of the average being collected */
+    int64_t sample_sum;
+    uint8_t sample_count;
+    /** Last published value */
+    bool has_published;
+    int64_t published_value;
+    int64_t publish_time_us;
+} state_t;
+
+/** Run a sample through the filter
+ *
+ * @param[in] config configuration of the pipeline.
+ * @param[inout] state state of the filter, zero initialized before the first sample.
+ * @param[in] value sample value.
+ * @param[in] now_us time of the sample, in microseconds.
+ * @param[out] out_value value to publish, set when true is returned. It is the average when averaging is configured.
+ *
+ * @return true if the value is published, the state then holds it as the last published value.
+ * @return false if the sample is collected for the average or the value is suppressed.
+ */
+bool apply(const config_t *config, state_t *state, int64_t value, int64_t now_us, int64_t *out_value);
+
+} // namespace filter
+
+/** Get the counters of a measurement pipeline
+ *
+ * @param[in] measurement measurement handle.
+ * @param[out] stats counters.
+ *
+ * @return ESP_OK on success.
+ * @return error in case of failure.
+ */
+esp_err_t get_stats(measurement_t *measurement, stats_t *stats);
+
+} // namespace measurement
+} // namespace esp_matter
@@ -0,0 +1,373 @@
+// Copyright 2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <esp_log.h>
+#include <esp_matter_attr_val_codec.h>
+#include <esp_matter_mem.h>
+
+#include <app/util/attribute-storage-null-handling.h>
+#include <lib/support/CodeUtils.h>
+
+#include <cstring>
+#include <limits>
+#include <utility>
+
+using chip::Protocols::InteractionModel::Status;
+
+static const char *TAG = "esp_matter_attr_val_codec";
+
+namespace esp_matter {
+namespace attribute {
+namespace codec {
+
+namespace {
+
+/* bool is stored as uint8_t by NumericAttributeTraits so that 0xFF can be used as the null value */
+template <typename T>
+inline bool is_null_value(const T &value)
+{
+    return chip::app::NumericAttributeTraits<T>::IsNullValue(value);
+}
+
+template <>
+inline bool is_null_value<bool>(const bool &value)
+{
+    return chip::app::NumericAttributeTraits<bool>::IsNullValue(*(const uint8_t *)&value);
+}
+
+template <typename T>
+inline void set_null_value(T &value)
+{
+    chip::app::NumericAttributeTraits<T>::SetNull(value);
+}
+
+template <>
+inline void set_null_value<bool>(bool &value)
+{
+    chip::app::NumericAttributeTraits<bool>::SetNull(*(uint8_t *)&value);
+}
+
+/* Traits of the numeric and boolean value types, `member` selects the element of esp_matter_val_t */
+template <typename T, T esp_matter_val_t::*member, bool nullable>
+struct numeric_val_traits {
+    using Traits = chip::app::NumericAttributeTraits<T>;
+    using StorageType = typename Traits::StorageType;
+
+    static bool is_null(const esp_matter_attr_val_t &val)
+    {
+        return nullable && is_null_value(val.val.*member);
+    }
+
+    static bool equal(const esp_matter_attr_val_t &val1, const esp_matter_attr_val_t &val2)
+    {
+        return val1.val.*member == val2.val.*member;
+    }
+
+    static int compare_with_bounds(const esp_matter_attr_val_t &val, const esp_matter_val_t &min,
+                                   const esp_matter_val_t &max)
+    {
+        if (is_null(val)) {
+            return 0;
+        }
+        if (val.val.*member < min.*member) {
+            return -1;
+        } else if (val.val.*member > max.*member) {
+            return 1;
+        }
+        return 0;
+    }
+
+    static CHIP_ERROR encode(const esp_matter_attr_val_t &val, chip::TLV::TLVWriter &writer, chip::TLV::Tag tag)
+    {
+        if (is_null(val)) {
+            return writer.PutNull(tag);
+        }
+        return writer.Put(tag, val.val.*member);
+    }
+
+    static CHIP_ERROR decode(esp_matter_attr_val_t &val, chip::TLV::TLVReader &reader)
+    {
+        if (nullable && reader.GetType() == chip::TLV::kTLVType_Null) {
+            set_null_value(val.val.*member);
+            return CHIP_NO_ERROR;
+        }
+        return reader.Get(val.val.*member);
+    }
+
+    static Status to_raw(const esp_matter_attr_val_t &val, uint8_t *buf, uint16_t buf_len)
+    {
+        if (buf_len < sizeof(StorageType) || !buf) {
+            return Status::ResourceExhausted;
+        }
+        StorageType storage;
+        if (is_null(val)) {
+            Traits::SetNull(storage);
+        } else {
+            Traits::WorkingToStorage(val.val.*member, storage);
+        }
+        memcpy(buf, &storage, sizeof(StorageType));
+        return Status::Success;
+    }
+
+    static Status from_raw(esp_matter_attr_val_t &val, const uint8_t *buf, bool /* is_nullable */)
+    {
+        StorageType storage;
+        memcpy(&storage, buf, sizeof(StorageType));
+        if (nullable && Traits::IsNullValue(storage)) {
+            set_null_value(val.val.*member);
+        } else {
+            val.val.*member = Traits::StorageToWorking(storage);
+        }
+        return Status::Success;
+    }
+};
+
+/* Traits of the string value types, the length prefix is 1 byte for short and 2 bytes for long strings */
+template <typename LenType, bool is_char_string>
+struct string_val_traits {
+    static constexpr LenType k_null_len = std::numeric_limits<LenType>::max();
+
+    static bool is_null(const esp_matter_attr_val_t &val)
+    {
+        return val.val.a.b == nullptr && val.val.a.s == k_null_len;
+    }
+
+    static bool equal(const esp_matter_attr_val_t &val1, const esp_matter_attr_val_t &val2)
+    {
+        if (val1.val.a.s != val2.val.a.s) {
+            return false;
+        }
+        if (val1.val.a.s == k_null_len || val1.val.a.s == 0) {
+            return true;
+        }
+        return memcmp(val1.val.a.b, val2.val.a.b, val1.val.a.s) == 0;
+    }
+
+    static CHIP_ERROR encode(const esp_matter_attr_val_t &val, chip::TLV::TLVWriter &writer, chip::TLV::Tag tag)
+    {
+        if (is_null(val)) {
+            return writer.PutNull(tag);
+        }
+        if (is_char_string) {
+            if (val.val.a.b == nullptr) {
+                return writer.PutString(tag, "");
+            }
+            return writer.PutString(tag, (const char *)val.val.a.b, val.val.a.s);
+        }
+        return writer.PutBytes(tag, val.val.a.b, val.val.a.s);
+    }
+
+    static CHIP_ERROR decode(esp_matter_attr_val_t &val, chip::TLV::TLVReader &reader)
+    {
+        if (reader.GetType() == chip::TLV::kTLVType_Null) {
+            val.val.a.b = nullptr;
+            val.val.a.s = k_null_len;
+            val.val.a.t = k_null_len;
+            return CHIP_NO_ERROR;
+        }
+        uint32_t len = reader.GetLength();
+        VerifyOrReturnError(len <= k_null_len, CHIP_ERROR_INVALID_ARGUMENT);
+        // One more byte for the null terminator of character strings, it also keeps empty octet strings allocatable
+        val.val.a.b = (uint8_t *)esp_matter_mem_calloc(len + 1, sizeof(uint8_t));
+        VerifyOrReturnError(val.val.a.b, CHIP_ERROR_NO_MEMORY);
+        if (is_char_string) {
+            ReturnErrorOnFailure(reader.GetString((char *)val.val.a.b, len + 1));
+        } else {
+            ReturnErrorOnFailure(reader.GetBytes(val.val.a.b, len));
+        }
+        val.val.a.s = len;
+        val.val.a.t = len + sizeof(LenType);
+        return CHIP_NO_ERROR;
+    }
+
+    static Status to_raw(const esp_matter_attr_val_t &val, uint8_t *buf, uint16_t buf_len)
+    {
+        // k_null_len is reserved for null value, only the length prefix is written for it
+        LenType len = val.val.a.s;
+        uint32_t raw_len = sizeof(LenType) + (len < k_null_len ? len : 0);
+        if (buf_len < raw_len || !buf) {
+            return Status::ResourceExhausted;
+        }
+        memcpy(buf, &len, sizeof(LenType));
+        if (len < k_null_len && len > 0) {
+            memcpy(buf + sizeof(LenType), val.val.a.b, len);
+        }
+        return Status::Success;
+    }
+
+    static Status from_raw(esp_matter_attr_val_t &val, const uint8_t *buf, bool is_nullable)
+    {
+        LenType len = 0;
+        memcpy(&len, buf, sizeof(LenType));
+        if (len == k_null_len) {
+            VerifyOrReturnValue(is_nullable, Status::InvalidValue);
+            val.val.a.b = nullptr;
+            val.val.a.t = k_null_len;
+        } else {
+            val.val.a.b = (uint8_t *)(buf + sizeof(LenType));
+            val.val.a.t = len + sizeof(LenType);
+        }
+        val.val.a.s = len;
+        return Status::Success;
+    }
+};
+
+template <typename ValTraits>
+constexpr val_ops_t make_ops(bool has_bounds = true)
+{
+    return val_ops_t{
+        .is_null = ValTraits::is_null,
+        .equal = ValTraits::equal,
+        .compare_with_bounds = has_bounds ? ValTraits::compare_with_bounds : nullptr,
+        .encode = ValTraits::encode,
+        .decode = ValTraits::decode,
+        .to_raw = ValTraits::to_raw,
+        .from_raw = ValTraits::from_raw,
+    };
+}
+
+template <typename T, T esp_matter_val_t::*member>
+constexpr val_ops_t make_numeric_ops(bool nullable, bool has_bounds = true)
+{
+    return nullable ? make_ops<numeric_val_traits<T, member, true>>(has_bounds)
+                    : make_ops<numeric_val_traits<T, member, false>>(has_bounds);
+}
+
+template <typename LenType, bool is_char_string>
+constexpr val_ops_t make_string_ops(bool nullable)
+{
+    using ValTraits = string_val_traits<LenType, is_char_string>;
+    // There are no nullable string types, the null string is represented by the null length.
+    return nullable ? val_ops_t{} : val_ops_t{
+        .is_null = ValTraits::is_null,
+        .equal = ValTraits::equal,
+        .compare_with_bounds = nullptr,
+        .encode = ValTraits::encode,
+        .decode = ValTraits::decode,
+        .to_raw = ValTraits::to_raw,
+        .from_raw = ValTraits::from_raw,
+    };
+}
+
+constexpr val_ops_t make_val_ops(size_t index)
+{
+    bool nullable = index >= k_base_val_type_count;
+    switch (index % k_base_val_type_count) {
+    case ESP_MATTER_VAL_TYPE_BOOLEAN:
+        return make_numeric_ops<bool, &esp_matter_val_t::b>(nullable, false /* has_bounds */);
+    case ESP_MATTER_VAL_TYPE_INTEGER:
+        // Only used by the application, it is never encoded or stored in the data model.
+        return nullable ? val_ops_t{.is_null = numeric_val_traits<int, &esp_matter_val_t::i, true>::is_null}
+                        : val_ops_t{.is_null = numeric_val_traits<int, &esp_matter_val_t::i, false>::is_null};
+    case ESP_MATTER_VAL_TYPE_FLOAT:
+        return make_numeric_ops<float, &esp_matter_val_t::f>(nullable);
+    case ESP_MATTER_VAL_TYPE_CHAR_STRING:
+        return make_string_ops<uint8_t, true>(nullable);
+    case ESP_MATTER_VAL_TYPE_OCTET_STRING:
+        return make_string_ops<uint8_t, false>(nullable);
+    case ESP_MATTER_VAL_TYPE_LONG_CHAR_STRING:
+        return make_string_ops<uint16_t, true>(nullable);
+    case ESP_MATTER_VAL_TYPE_LONG_OCTET_STRING:
+        return make_string_ops<uint16_t, false>(nullable);
+    case ESP_MATTER_VAL_TYPE_INT8:
+        return make_numeric_ops<int8_t, &esp_matter_val_t::i8>(nullable);
+    case ESP_MATTER_VAL_TYPE_UINT8:
+    case ESP_MATTER_VAL_TYPE_ENUM8:
+    case ESP_MATTER_VAL_TYPE_BITMAP8:
+        return make_numeric_ops<uint8_t, &esp_matter_val_t::u8>(nullable);
+    case ESP_MATTER_VAL_TYPE_INT16:
+        return make_numeric_ops<int16_t, &esp_matter_val_t::i16>(nullable);
+    case ESP_MATTER_VAL_TYPE_UINT16:
+    case ESP_MATTER_VAL_TYPE_ENUM16:
+    case ESP_MATTER_VAL_TYPE_BITMAP16:
+        return make_numeric_ops<uint16_t, &esp_matter_val_t::u16>(nullable);
+    case ESP_MATTER_VAL_TYPE_INT32:
+        return make_numeric_ops<int32_t, &esp_matter_val_t::i32>(nullable);
+    case ESP_MATTER_VAL_TYPE_UINT32:
+    case ESP_MATTER_VAL_TYPE_BITMAP32:
+        return make_numeric_ops<uint32_t, &esp_matter_val_t::u32>(nullable);
+    case ESP_MATTER_VAL_TYPE_INT64:
+        return make_numeric_ops<int64_t, &esp_matter_val_t::i64>(nullable);
+    case ESP_MATTER_VAL_TYPE_UINT64:
+        return make_numeric_ops<uint64_t, &esp_matter_val_t::u64>(nullable);
+    default:
+        // ESP_MATTER_VAL_TYPE_INVALID and ESP_MATTER_VAL_TYPE_ARRAY
+        break;
+    }
+    return val_ops_t{};
+}
+
+template <size_t... index>
+constexpr std::array<val_ops_t, sizeof...(index)> make_val_ops_table(std::index_sequence<index...>)
+{
+    return {{make_val_ops(index)...}};
+}
+
+} // namespace
+
+const std::array<val_ops_t, 2 * k_base_val_type_count> k_val_ops =
+    make_val_ops_table(std::make_index_sequence<2 * k_base_val_type_count>());
+
+bool is_null(const esp_matter_attr_val_t &val)
+{
+    const val_ops_t &ops = get_ops(val.type);
+    return ops.is_null && ops.is_null(val);
+}
+
+bool equal(const esp_matter_attr_val_t &val1, const esp_matter_attr_val_t &val2)
+{
+    const val_ops_t &ops = get_ops(val1.type);
+    VerifyOrReturnValue(ops.equal, false, ESP_LOGE(TAG, "Unsupported type to compare"));
+    return ops.equal(val1, val2);
+}
+
+int compare_with_bounds(const esp_matter_attr_val_t &val, const esp_matter_val_t &min, const esp_matter_val_t &max)
+{
+    const val_ops_t &ops = get_ops(val.type);
+    VerifyOrReturnValue(ops.compare_with_bounds, -2,
+                        ESP_LOGE(TAG, "Failed to compare_with_bounds as the attribute value type is wrong"));
+    return ops.compare_with_bounds(val, min, max);
+}
+
+CHIP_ERROR encode(const esp_matter_attr_val_t &val, chip::TLV::TLVWriter &writer, chip::TLV::Tag tag)
+{
+    const val_ops_t &ops = get_ops(val.type);
+    VerifyOrReturnError(ops.encode, CHIP_ERROR_INVALID_ARGUMENT);
+    return ops.encode(val, writer, tag);
+}
+
+CHIP_ERROR decode(esp_matter_attr_val_t &val, chip::TLV::TLVReader &reader)
+{
+    const val_ops_t &ops = get_ops(val.type);
+    VerifyOrReturnError(ops.decode, CHIP_ERROR_INVALID_ARGUMENT);
+    return ops.decode(val, reader);
+}
+
+Status to_raw(const esp_matter_attr_val_t &val, uint8_t *buf, uint16_t buf_len)
+{
+    const val_ops_t &ops = get_ops(val.type);
+    VerifyOrReturnValue(ops.to_raw, Status::InvalidDataType);
+    return ops.to_raw(val, buf, buf_len);
+}
+
+Status from_raw(esp_matter_attr_val_t &val, const uint8_t *buf, bool is_nullable)
+{
+    const val_ops_t &ops = get_ops(val.type);
+    VerifyOrReturnValue(ops.from_raw && buf, Status::InvalidDataType);
+    return ops.from_raw(val, buf, is_nullable);
+}
+
+} // namespace codec
+} // namespace attribute
+} // namespace esp_matter
@@ -0,0 +1,107 @@
+// Copyright 2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <esp_matter_attribute_utils.h>
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/TLV.h>
+#include <protocols/interaction_model/StatusCode.h>
+
+#include <array>
+#include <stdint.h>
+
+namespace esp_matter {
+namespace attribute {
+namespace codec {
+
+/**
+ * Operations on `esp_matter_attr_val_t` for one value type.
+ *
+ * One entry is generated per value type from the value type traits in esp_matter_attr_val_codec.cpp, so the TLV
+ * encode/decode, the comparisons and the ember raw buffer conversion cannot drift apart. An operation which is not
+ * supported by the value type is left as nullptr.
+ */
+typedef struct val_ops {
+    bool (*is_null)(const esp_matter_attr_val_t &val);
+    bool (*equal)(const esp_matter_attr_val_t &val1, const esp_matter_attr_val_t &val2);
+    int (*compare_with_bounds)(const esp_matter_attr_val_t &val, const esp_matter_val_t &min,
+                               const esp_matter_val_t &max);
+    CHIP_ERROR (*encode)(const esp_matter_attr_val_t &val, chip::TLV::TLVWriter &writer, chip::TLV::Tag tag);
+    CHIP_ERROR (*decode)(esp_matter_attr_val_t &val, chip::TLV::TLVReader &reader);
+    chip::Protocols::InteractionModel::Status (*to_raw)(const esp_matter_attr_val_t &val, uint8_t *buf,
+                                                        uint16_t buf_len);
+    chip::Protocols::InteractionModel::Status (*from_raw)(esp_matter_attr_val_t &val, const uint8_t *buf,
+                                                          bool is_nullable);
+} val_ops_t;
+
+/* Number of non-nullable value types, the nullable variants are stored right after them in the table */
+constexpr uint8_t k_base_val_type_count = ESP_MATTER_VAL_TYPE_LONG_OCTET_STRING + 1;
+
+extern const std::array<val_ops_t, 2 * k_base_val_type_count> k_val_ops;
+
+/** Get the operations of a value type, unknown types get the operations of ESP_MATTER_VAL_TYPE_INVALID */
+inline const val_ops_t &get_ops(esp_matter_val_type_t type)
+{
+    uint8_t base_type = type & ~ESP_MATTER_VAL_NULLABLE_BASE;
+    if (base_type >= k_base_val_type_count) {
+        return k_val_ops[ESP_MATTER_VAL_TYPE_INVALID];
+    }
+    return k_val_ops[(type & ESP_MATTER_VAL_NULLABLE_BASE) ? base_type + k_base_val_type_count : base_type];
+}
+
+/** Check whether the value holds the null value of its type
+ *
+ * @return true if the value type is nullable and the value is null.
+ */
+bool is_null(const esp_matter_attr_val_t &val);
+
+/** Check whether two values of the same type are equal
+ *
+ * @return true if the two values are the same.
+ * @return false if the values are different or the type cannot be compared.
+ */
+bool equal(const esp_matter_attr_val_t &val1, const esp_matter_attr_val_t &val2);
+
+/** Check whether the value is in the range [min, max], min and max are interpreted as values of type `val.type`
+ *
+ * @return 0 if val is in the range of bounds or is null.
+ * @return 1 if val is more than max
+ * @return -1 if val is less than min
+ * @return -2 if val type does not support bounds
+ */
+int compare_with_bounds(const esp_matter_attr_val_t &val, const esp_matter_val_t &min, const esp_matter_val_t &max);
+
+/** Encode the value with the given tag */
+CHIP_ERROR encode(const esp_matter_attr_val_t &val, chip::TLV::TLVWriter &writer, chip::TLV::Tag tag);
+
+/** Decode the value of type `val.type` from the reader
+ *
+ * @note For string types the buffer is allocated with `esp_matter_mem_calloc()` and is owned by the caller.
+ */
+CHIP_ERROR decode(esp_matter_attr_val_t &val, chip::TLV::TLVReader &reader);
+
+/** Convert the value to the ember attribute storage format */
+chip::Protocols::InteractionModel::Status to_raw(const esp_matter_attr_val_t &val, uint8_t *buf, uint16_t buf_len);
+
+/** Convert the ember attribute storage format to a value of type `val.type`
+ *
+ * @note For string types `val` points into `buf` and is only valid as long as `buf` is.
+ */
+chip::Protocols::InteractionModel::Status from_raw(esp_matter_attr_val_t &val, const uint8_t *buf, bool is_nullable);
+
+} // namespace codec
+} // namespace attribute
+} // namespace esp_matter
@@ -19,6 +19,7 @@
 #include <esp_matter_attribute_utils.h>
 #include <esp_matter_mem.h>
 #include <esp_matter_nvs.h>
+#include <esp_matter_trace.h>
 
 #include <lib/support/Base64.h>
 
@@ -325,6 +326,7 @@ static esp_err_t nvs_erase_val(const char *nvs_namespace, const char *attribute_
 
 esp_err_t get_val_from_nvs(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id, esp_matter_attr_val_t  &val)
 {
+    ESP_MATTER_TRACE_SCOPE(NVS_LOAD, endpoint_id, cluster_id, attribute_id);
     /* Get attribute key */
     char attribute_key[16] = {0};
     get_attribute_key(endpoint_id, cluster_id, attribute_id, attribute_key);
@@ -356,6 +358,7 @@ esp_err_t get_val_from_nvs(uint16_t endpoint_id, uint32_t cluster_id, uint32_t a
 
 esp_err_t store_val_in_nvs(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id, const esp_matter_attr_val_t  &val)
 {
+    ESP_MATTER_TRACE_SCOPE(NVS_STORE, endpoint_id, cluster_id, attribute_id);
     /* Get attribute key */
     char attribute_key[16] = {0};
     get_attribute_key(endpoint_id, cluster_id, attribute_id, attribute_key);
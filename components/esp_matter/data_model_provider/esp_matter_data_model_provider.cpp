@@ -19,6 +19,7 @@
 #include <esp_matter_data_model.h>
 #include <esp_matter_data_model_priv.h>
 #include <esp_matter_data_model_provider.h>
+#include <esp_matter_trace.h>
 
 #include <access/Privilege.h>
 #include <app-common/zap-generated/cluster-objects.h>
@@ -278,6 +279,8 @@ CHIP_ERROR provider::Shutdown()
 
 ActionReturnStatus provider::ReadAttribute(const ReadAttributeRequest &request, AttributeValueEncoder &encoder)
 {
+    ESP_MATTER_TRACE_SCOPE(ATTRIBUTE_READ, request.path.mEndpointId, request.path.mClusterId,
+                           request.path.mAttributeId);
     if (auto *cluster = mRegistry.Get(request.path); cluster != nullptr) {
         return cluster->ReadAttribute(request, encoder);
     }
@@ -300,6 +303,8 @@ ActionReturnStatus provider::ReadAttribute(const ReadAttributeRequest &request,
 
 ActionReturnStatus provider::WriteAttribute(const WriteAttributeRequest &request, AttributeValueDecoder &decoder)
 {
+    ESP_MATTER_TRACE_SCOPE(ATTRIBUTE_WRITE, request.path.mEndpointId, request.path.mClusterId,
+                           request.path.mAttributeId);
     attribute_t *attribute = attribute::get(request.path.mEndpointId, request.path.mClusterId,
                                             request.path.mAttributeId);
 
@@ -410,6 +415,8 @@ std::optional<ActionReturnStatus> provider::InvokeCommand(const InvokeRequest &r
                                                           chip::TLV::TLVReader &input_arguments,
                                                           CommandHandler *handler)
 {
+    ESP_MATTER_TRACE_SCOPE(COMMAND_INVOKE, request.path.mEndpointId, request.path.mClusterId,
+                           request.path.mCommandId);
     if (auto *cluster = mRegistry.Get(request.path); cluster != nullptr) {
         return cluster->InvokeCommand(request, input_arguments, handler);
     }
@@ -646,6 +653,7 @@ CHIP_ERROR provider::Attributes(const ConcreteClusterPath &path, ReadOnlyBufferB
 
 void provider::Temporary_ReportAttributeChanged(const AttributePathParams &path)
 {
+    ESP_MATTER_TRACE_SCOPE(REPORT_CHANGE, path.mEndpointId, path.mClusterId, path.mAttributeId);
     VerifyOrReturn(!path.HasWildcardEndpointId());
     // If the cluster is not wildcard, increase the data version
     if (!path.HasWildcardClusterId()) {
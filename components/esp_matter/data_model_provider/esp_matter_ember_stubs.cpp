@@ -17,6 +17,7 @@
  * these stub functions to make upstream code access our esp_matter data model instead of ember data model.
  */
 
+#include <esp_matter_attr_val_codec.h>
 #include <esp_matter_attribute_utils.h>
 #include <esp_matter_data_model.h>
 #include <esp_matter_data_model_priv.h>
@@ -48,343 +49,63 @@ esp_matter::endpoint_t *get_endpoint_at_index(uint16_t index)
     return ep;
 }
 
-Status get_raw_data_buffer_from_attr_val(const esp_matter_attr_val_t &val, uint8_t *dataPtr, uint16_t readLength)
-{
-    switch (val.type) {
-    case ESP_MATTER_VAL_TYPE_BOOLEAN:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_BOOLEAN: {
-        if (readLength < sizeof(bool) || !dataPtr) {
-            return chip::Protocols::InteractionModel::Status::ResourceExhausted;
-        }
-        using Traits = chip::app::NumericAttributeTraits<bool>;
-        if ((val.type & ESP_MATTER_VAL_NULLABLE_BASE) && Traits::IsNullValue(*(uint8_t *)(&(val.val.b)))) {
-            Traits::SetNull(*(uint8_t *)dataPtr);
-        } else {
-            Traits::WorkingToStorage(val.val.b, *dataPtr);
-        }
-        break;
-    }
-
-    case ESP_MATTER_VAL_TYPE_FLOAT:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_FLOAT: {
-        if (readLength < sizeof(float) || !dataPtr) {
-            return chip::Protocols::InteractionModel::Status::ResourceExhausted;
-        }
-        using Traits = chip::app::NumericAttributeTraits<float>;
-        if ((val.type & ESP_MATTER_VAL_NULLABLE_BASE) && Traits::IsNullValue(val.val.f)) {
-            Traits::SetNull(*(float *)dataPtr);
-        } else {
-            Traits::WorkingToStorage(val.val.f, *(float *)dataPtr);
-        }
-        break;
-    }
-
-    case ESP_MATTER_VAL_TYPE_OCTET_STRING:
-    case ESP_MATTER_VAL_TYPE_CHAR_STRING: {
-        if (readLength < val.val.a.t || !dataPtr) {
-            return chip::Protocols::InteractionModel::Status::ResourceExhausted;
-        }
-        uint8_t len = val.val.a.s;
-        memcpy(dataPtr, &len, sizeof(len));
-        // UINT8_MAX is reserved for null value
-        if (len < UINT8_MAX) {
-            memcpy(dataPtr + sizeof(len), val.val.a.b, len);
-        }
-        break;
-    }
-
-    case ESP_MATTER_VAL_TYPE_LONG_OCTET_STRING:
-    case ESP_MATTER_VAL_TYPE_LONG_CHAR_STRING: {
-        if (readLength < val.val.a.t || !dataPtr) {
-            return chip::Protocols::InteractionModel::Status::ResourceExhausted;
-        }
-        memcpy(dataPtr, &val.val.a.s, sizeof(val.val.a.s));
-        // UINT16_MAX is reserved for null value
-        if (val.val.a.s < UINT16_MAX) {
-            memcpy(dataPtr + sizeof(val.val.a.s), val.val.a.b, val.val.a.s);
-        }
-        break;
-    }
-
-    case ESP_MATTER_VAL_TYPE_INT8:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_INT8: {
-        if (readLength < sizeof(int8_t) || !dataPtr) {
-            return chip::Protocols::InteractionModel::Status::ResourceExhausted;
-        }
-        using Traits = chip::app::NumericAttributeTraits<int8_t>;
-        if ((val.type & ESP_MATTER_VAL_NULLABLE_BASE) && Traits::IsNullValue(val.val.i8)) {
-            Traits::SetNull(*(int8_t *)dataPtr);
-        } else {
-            Traits::WorkingToStorage(val.val.i8, *(int8_t *)dataPtr);
-        }
-        break;
-    }
-    case ESP_MATTER_VAL_TYPE_BITMAP8:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_BITMAP8:
-    case ESP_MATTER_VAL_TYPE_ENUM8:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_ENUM8:
-    case ESP_MATTER_VAL_TYPE_UINT8:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_UINT8: {
-        if (readLength < sizeof(uint8_t) || !dataPtr) {
-            return chip::Protocols::InteractionModel::Status::ResourceExhausted;
-        }
-        using Traits = chip::app::NumericAttributeTraits<uint8_t>;
-        if ((val.type & ESP_MATTER_VAL_NULLABLE_BASE) && Traits::IsNullValue(val.val.u8)) {
-            Traits::SetNull(*dataPtr);
-        } else {
-            Traits::WorkingToStorage(val.val.u8, *dataPtr);
-        }
-        break;
-    }
-
-    case ESP_MATTER_VAL_TYPE_INT16:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_INT16: {
-        if (readLength < sizeof(int16_t) || !dataPtr) {
-            return chip::Protocols::InteractionModel::Status::ResourceExhausted;
-        }
-        using Traits = chip::app::NumericAttributeTraits<int16_t>;
-        if ((val.type & ESP_MATTER_VAL_NULLABLE_BASE) && Traits::IsNullValue(val.val.i16)) {
-            Traits::SetNull(*(int16_t *)dataPtr);
-        } else {
-            Traits::WorkingToStorage(val.val.i16, *(int16_t *)dataPtr);
-        }
-        break;
-    }
-
-    case ESP_MATTER_VAL_TYPE_BITMAP16:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_BITMAP16:
-    case ESP_MATTER_VAL_TYPE_ENUM16:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_ENUM16:
-    case ESP_MATTER_VAL_TYPE_UINT16:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_UINT16: {
-        if (readLength < sizeof(uint16_t) || !dataPtr) {
-            return chip::Protocols::InteractionModel::Status::ResourceExhausted;
-        }
-        using Traits = chip::app::NumericAttributeTraits<uint16_t>;
-        if ((val.type & ESP_MATTER_VAL_NULLABLE_BASE) && Traits::IsNullValue(val.val.u16)) {
-            Traits::SetNull(*(uint16_t *)dataPtr);
-        } else {
-            Traits::WorkingToStorage(val.val.u16, *(uint16_t *)dataPtr);
-        }
-        break;
-    }
-
-    case ESP_MATTER_VAL_TYPE_INT32:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_INT32: {
-        if (readLength < sizeof(int32_t) || !dataPtr) {
-            return chip::Protocols::InteractionModel::Status::ResourceExhausted;
-        }
-        using Traits = chip::app::NumericAttributeTraits<int32_t>;
-        if ((val.type & ESP_MATTER_VAL_NULLABLE_BASE) && Traits::IsNullValue(val.val.i32)) {
-            Traits::SetNull(*(int32_t *)dataPtr);
-        } else {
-            Traits::WorkingToStorage(val.val.i32, *(int32_t *)dataPtr);
-        }
-        break;
-    }
-
-    case ESP_MATTER_VAL_TYPE_BITMAP32:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_BITMAP32:
-    case ESP_MATTER_VAL_TYPE_UINT32:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_UINT32: {
-        if (readLength < sizeof(uint32_t) || !dataPtr) {
-            return chip::Protocols::InteractionModel::Status::ResourceExhausted;
-        }
-        using Traits = chip::app::NumericAttributeTraits<uint32_t>;
-        if ((val.type & ESP_MATTER_VAL_NULLABLE_BASE) && Traits::IsNullValue(val.val.u32)) {
-            Traits::SetNull(*(uint32_t *)dataPtr);
-        } else {
-            Traits::WorkingToStorage(val.val.u32, *(uint32_t *)dataPtr);
-        }
-        break;
-    }
-
-    case ESP_MATTER_VAL_TYPE_INT64:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_INT64: {
-        if (readLength < sizeof(int64_t) || !dataPtr) {
-            return chip::Protocols::InteractionModel::Status::ResourceExhausted;
-        }
-        using Traits = chip::app::NumericAttributeTraits<int64_t>;
-        if ((val.type & ESP_MATTER_VAL_NULLABLE_BASE) && Traits::IsNullValue(val.val.i64)) {
-            Traits::SetNull(*(int64_t *)dataPtr);
-        } else {
-            Traits::WorkingToStorage(val.val.i64, *(int64_t *)dataPtr);
-        }
-        break;
-    }
-
-    case ESP_MATTER_VAL_TYPE_UINT64:
-    case ESP_MATTER_VAL_TYPE_NULLABLE_UINT64: {
-        if (readLength < sizeof(uint8_t) || !dataPtr) {
-            return chip::Protocols::InteractionModel::Status::ResourceExhausted;
-        }
-        using Traits = chip::app::NumericAttributeTraits<uint64_t>;
-        if ((val.type & ESP_MATTER_VAL_NULLABLE_BASE) && Traits::IsNullValue(val.val.u64)) {
-            Traits::SetNull(*(uint64_t *)dataPtr);
-        } else {
-            Traits::WorkingToStorage(val.val.u64, *(uint64_t *)dataPtr);
-        }
-        break;
-    }
-
-    default:
-        return chip::Protocols::InteractionModel::Status::InvalidDataType;
-    }
-    return chip::Protocols::InteractionModel::Status::Success;
-}
-
-Status get_attr_val_from_raw_data_buffer(uint8_t *value, EmberAfAttributeType dataType, esp_matter_attr_val_t &val,
-                                         bool is_nullable)
+esp_matter_val_type_t get_val_type_from_ember_attr_type(EmberAfAttributeType dataType, bool is_nullable)
 {
+    esp_matter_val_type_t val_type = ESP_MATTER_VAL_TYPE_INVALID;
     switch (dataType) {
-    case ZCL_BOOLEAN_ATTRIBUTE_TYPE: {
-        using Traits = chip::app::NumericAttributeTraits<bool>;
-        Traits::StorageType attribute_value;
-        memcpy((uint8_t *)&attribute_value, value, sizeof(Traits::StorageType));
-        val = esp_matter_bool(attribute_value);
+    case ZCL_BOOLEAN_ATTRIBUTE_TYPE:
+        val_type = ESP_MATTER_VAL_TYPE_BOOLEAN;
         break;
-    }
 
-    case ZCL_CHAR_STRING_ATTRIBUTE_TYPE: {
-        uint8_t data_count = 0;
-        memcpy(&data_count, &value[0], sizeof(uint8_t));
-        if (is_nullable && data_count == UINT8_MAX) {
-            val = esp_matter_char_str(nullptr, data_count);
-        } else if (data_count < UINT8_MAX) {
-            val = esp_matter_char_str((char *)(value + sizeof(uint8_t)), data_count);
-        }
-        break;
-    }
+    // There are no nullable string types, the nullable flag is passed to the codec instead.
+    case ZCL_CHAR_STRING_ATTRIBUTE_TYPE:
+        return ESP_MATTER_VAL_TYPE_CHAR_STRING;
 
-    case ZCL_LONG_CHAR_STRING_ATTRIBUTE_TYPE: {
-        uint16_t data_count = 0;
-        memcpy(&data_count, &value[0], sizeof(uint16_t));
-        if (is_nullable && data_count == UINT16_MAX) {
-            val = esp_matter_char_str(nullptr, data_count);
-        } else if (data_count < UINT16_MAX) {
-            val = esp_matter_long_char_str((char *)(value + sizeof(uint16_t)), data_count);
-        }
-        break;
-    }
+    case ZCL_LONG_CHAR_STRING_ATTRIBUTE_TYPE:
+        return ESP_MATTER_VAL_TYPE_LONG_CHAR_STRING;
 
     case ZCL_OCTET_STRING_ATTRIBUTE_TYPE:
     case ZCL_IPADR_ATTRIBUTE_TYPE:
     case ZCL_IPV4ADR_ATTRIBUTE_TYPE:
     case ZCL_IPV6ADR_ATTRIBUTE_TYPE:
     case ZCL_IPV6PRE_ATTRIBUTE_TYPE:
-    case ZCL_HWADR_ATTRIBUTE_TYPE: {
-        uint8_t data_count = 0;
-        memcpy(&data_count, &value[0], sizeof(uint8_t));
-        if (is_nullable && data_count == UINT8_MAX) {
-            val = esp_matter_char_str(nullptr, data_count);
-        } else if (data_count < UINT8_MAX) {
-            val = esp_matter_octet_str((value + sizeof(uint8_t)), data_count);
-        }
-        break;
-    }
+    case ZCL_HWADR_ATTRIBUTE_TYPE:
+        return ESP_MATTER_VAL_TYPE_OCTET_STRING;
 
-    case ZCL_LONG_OCTET_STRING_ATTRIBUTE_TYPE: {
-        uint16_t data_count = 0;
-        memcpy(&data_count, &value[0], sizeof(uint16_t));
-        if (is_nullable && data_count == UINT16_MAX) {
-            val = esp_matter_char_str(nullptr, data_count);
-        } else if (data_count < UINT16_MAX) {
-            val = esp_matter_long_octet_str((value + sizeof(uint16_t)), data_count);
-        }
-        break;
-    }
+    case ZCL_LONG_OCTET_STRING_ATTRIBUTE_TYPE:
+        return ESP_MATTER_VAL_TYPE_LONG_OCTET_STRING;
 
-    case ZCL_INT8S_ATTRIBUTE_TYPE: {
-        using Traits = chip::app::NumericAttributeTraits<int8_t>;
-        Traits::StorageType attribute_value;
-        memcpy((uint8_t *)&attribute_value, value, sizeof(Traits::StorageType));
-        if (is_nullable) {
-            if (Traits::IsNullValue(attribute_value)) {
-                val = esp_matter_nullable_int8(nullable<int8_t>());
-            } else {
-                val = esp_matter_nullable_int8(attribute_value);
-            }
-        } else {
-            val = esp_matter_int8(attribute_value);
-        }
+    case ZCL_INT8S_ATTRIBUTE_TYPE:
+        val_type = ESP_MATTER_VAL_TYPE_INT8;
         break;
-    }
 
     case ZCL_INT8U_ATTRIBUTE_TYPE:
     case ZCL_ACTION_ID_ATTRIBUTE_TYPE:
     case ZCL_TAG_ATTRIBUTE_TYPE:
     case ZCL_NAMESPACE_ATTRIBUTE_TYPE:
     case ZCL_FABRIC_IDX_ATTRIBUTE_TYPE:
-    case ZCL_PERCENT_ATTRIBUTE_TYPE: {
-        using Traits = chip::app::NumericAttributeTraits<uint8_t>;
-        Traits::StorageType attribute_value;
-        memcpy((uint8_t *)&attribute_value, value, sizeof(Traits::StorageType));
-        if (is_nullable) {
-            if (Traits::IsNullValue(attribute_value)) {
-                val = esp_matter_nullable_uint8(nullable<uint8_t>());
-            } else {
-                val = esp_matter_nullable_uint8(attribute_value);
-            }
-        } else {
-            val = esp_matter_uint8(attribute_value);
-        }
+    case ZCL_PERCENT_ATTRIBUTE_TYPE:
+        val_type = ESP_MATTER_VAL_TYPE_UINT8;
         break;
-    }
 
     case ZCL_INT16S_ATTRIBUTE_TYPE:
-    case ZCL_TEMPERATURE_ATTRIBUTE_TYPE: {
-        using Traits = chip::app::NumericAttributeTraits<int16_t>;
-        Traits::StorageType attribute_value;
-        memcpy((uint8_t *)&attribute_value, value, sizeof(Traits::StorageType));
-        if (is_nullable) {
-            if (Traits::IsNullValue(attribute_value)) {
-                val = esp_matter_nullable_int16(nullable<int16_t>());
-            } else {
-                val = esp_matter_nullable_int16(attribute_value);
-            }
-        } else {
-            val = esp_matter_int16(attribute_value);
-        }
+    case ZCL_TEMPERATURE_ATTRIBUTE_TYPE:
+        val_type = ESP_MATTER_VAL_TYPE_INT16;
         break;
-    }
 
     case ZCL_INT16U_ATTRIBUTE_TYPE:
     case ZCL_ENTRY_IDX_ATTRIBUTE_TYPE:
     case ZCL_GROUP_ID_ATTRIBUTE_TYPE:
     case ZCL_ENDPOINT_NO_ATTRIBUTE_TYPE:
     case ZCL_VENDOR_ID_ATTRIBUTE_TYPE:
-    case ZCL_PERCENT100THS_ATTRIBUTE_TYPE: {
-        using Traits = chip::app::NumericAttributeTraits<uint16_t>;
-        Traits::StorageType attribute_value;
-        memcpy((uint8_t *)&attribute_value, value, sizeof(Traits::StorageType));
-        if (is_nullable) {
-            if (Traits::IsNullValue(attribute_value)) {
-                val = esp_matter_nullable_uint16(nullable<uint16_t>());
-            } else {
-                val = esp_matter_nullable_uint16(attribute_value);
-            }
-        } else {
-            val = esp_matter_uint16(attribute_value);
-        }
+    case ZCL_PERCENT100THS_ATTRIBUTE_TYPE:
+        val_type = ESP_MATTER_VAL_TYPE_UINT16;
         break;
-    }
 
     case ZCL_INT32S_ATTRIBUTE_TYPE:
-    case ZCL_INT24S_ATTRIBUTE_TYPE: {
-        using Traits = chip::app::NumericAttributeTraits<int32_t>;
-        Traits::StorageType attribute_value;
-        memcpy((uint8_t *)&attribute_value, value, sizeof(Traits::StorageType));
-        if (is_nullable) {
-            if (Traits::IsNullValue(attribute_value)) {
-                val = esp_matter_nullable_int32(nullable<int32_t>());
-            } else {
-                val = esp_matter_nullable_int32(attribute_value);
-            }
-        } else {
-            val = esp_matter_int32(attribute_value);
-        }
+    case ZCL_INT24S_ATTRIBUTE_TYPE:
+        val_type = ESP_MATTER_VAL_TYPE_INT32;
         break;
-    }
 
     case ZCL_INT32U_ATTRIBUTE_TYPE:
     case ZCL_TRANS_ID_ATTRIBUTE_TYPE:
@@ -397,21 +118,9 @@ Status get_attr_val_from_raw_data_buffer(uint8_t *value, EmberAfAttributeType da
     case ZCL_ELAPSED_S_ATTRIBUTE_TYPE:
     case ZCL_DATA_VER_ATTRIBUTE_TYPE:
     case ZCL_DEVTYPE_ID_ATTRIBUTE_TYPE:
-    case ZCL_INT24U_ATTRIBUTE_TYPE: {
-        using Traits = chip::app::NumericAttributeTraits<uint32_t>;
-        Traits::StorageType attribute_value;
-        memcpy((uint8_t *)&attribute_value, value, sizeof(Traits::StorageType));
-        if (is_nullable) {
-            if (Traits::IsNullValue(attribute_value)) {
-                val = esp_matter_nullable_uint32(nullable<uint32_t>());
-            } else {
-                val = esp_matter_nullable_uint32(attribute_value);
-            }
-        } else {
-            val = esp_matter_uint32(attribute_value);
-        }
+    case ZCL_INT24U_ATTRIBUTE_TYPE:
+        val_type = ESP_MATTER_VAL_TYPE_UINT32;
         break;
-    }
 
     case ZCL_INT64S_ATTRIBUTE_TYPE:
     case ZCL_ENERGY_MWH_ATTRIBUTE_TYPE:
@@ -419,21 +128,9 @@ Status get_attr_val_from_raw_data_buffer(uint8_t *value, EmberAfAttributeType da
     case ZCL_POWER_MW_ATTRIBUTE_TYPE:
     case ZCL_INT56S_ATTRIBUTE_TYPE:
     case ZCL_INT48S_ATTRIBUTE_TYPE:
-    case ZCL_INT40S_ATTRIBUTE_TYPE: {
-        using Traits = chip::app::NumericAttributeTraits<int64_t>;
-        Traits::StorageType attribute_value;
-        memcpy((uint8_t *)&attribute_value, value, sizeof(Traits::StorageType));
-        if (is_nullable) {
-            if (Traits::IsNullValue(attribute_value)) {
-                val = esp_matter_nullable_int64(nullable<int64_t>());
-            } else {
-                val = esp_matter_nullable_int64(attribute_value);
-            }
-        } else {
-            val = esp_matter_int64(attribute_value);
-        }
+    case ZCL_INT40S_ATTRIBUTE_TYPE:
+        val_type = ESP_MATTER_VAL_TYPE_INT64;
         break;
-    }
 
     case ZCL_INT64U_ATTRIBUTE_TYPE:
     case ZCL_FABRIC_ID_ATTRIBUTE_TYPE:
@@ -445,128 +142,50 @@ Status get_attr_val_from_raw_data_buffer(uint8_t *value, EmberAfAttributeType da
     case ZCL_EVENT_NO_ATTRIBUTE_TYPE:
     case ZCL_INT56U_ATTRIBUTE_TYPE:
     case ZCL_INT48U_ATTRIBUTE_TYPE:
-    case ZCL_INT40U_ATTRIBUTE_TYPE: {
-        using Traits = chip::app::NumericAttributeTraits<uint64_t>;
-        Traits::StorageType attribute_value;
-        memcpy((uint8_t *)&attribute_value, value, sizeof(Traits::StorageType));
-        if (is_nullable) {
-            if (Traits::IsNullValue(attribute_value)) {
-                val = esp_matter_nullable_uint64(nullable<uint64_t>());
-            } else {
-                val = esp_matter_nullable_uint64(attribute_value);
-            }
-        } else {
-            val = esp_matter_uint64(attribute_value);
-        }
+    case ZCL_INT40U_ATTRIBUTE_TYPE:
+        val_type = ESP_MATTER_VAL_TYPE_UINT64;
         break;
-    }
 
     case ZCL_ENUM8_ATTRIBUTE_TYPE:
     case ZCL_STATUS_ATTRIBUTE_TYPE:
-    case ZCL_PRIORITY_ATTRIBUTE_TYPE: {
-        using Traits = chip::app::NumericAttributeTraits<uint8_t>;
-        Traits::StorageType attribute_value;
-        memcpy((uint8_t *)&attribute_value, value, sizeof(Traits::StorageType));
-        if (is_nullable) {
-            if (Traits::IsNullValue(attribute_value)) {
-                val = esp_matter_nullable_enum8(nullable<uint8_t>());
-            } else {
-                val = esp_matter_nullable_enum8(attribute_value);
-            }
-        } else {
-            val = esp_matter_enum8(attribute_value);
-        }
+    case ZCL_PRIORITY_ATTRIBUTE_TYPE:
+        val_type = ESP_MATTER_VAL_TYPE_ENUM8;
         break;
-    }
 
-    case ZCL_ENUM16_ATTRIBUTE_TYPE: {
-        using Traits = chip::app::NumericAttributeTraits<uint16_t>;
-        Traits::StorageType attribute_value;
-        memcpy((uint16_t *)&attribute_value, value, sizeof(Traits::StorageType));
-        if (is_nullable) {
-            if (Traits::IsNullValue(attribute_value)) {
-                val = esp_matter_nullable_enum16(nullable<uint16_t>());
-            } else {
-                val = esp_matter_nullable_enum16(attribute_value);
-            }
-        } else {
-            val = esp_matter_enum16(attribute_value);
-        }
+    case ZCL_ENUM16_ATTRIBUTE_TYPE:
+        val_type = ESP_MATTER_VAL_TYPE_ENUM16;
         break;
-    }
 
-    case ZCL_BITMAP8_ATTRIBUTE_TYPE: {
-        using Traits = chip::app::NumericAttributeTraits<uint8_t>;
-        Traits::StorageType attribute_value;
-        memcpy((uint8_t *)&attribute_value, value, sizeof(Traits::StorageType));
-        if (is_nullable) {
-            if (Traits::IsNullValue(attribute_value)) {
-                val = esp_matter_nullable_bitmap8(nullable<uint8_t>());
-            } else {
-                val = esp_matter_nullable_bitmap8(attribute_value);
-            }
-        } else {
-            val = esp_matter_bitmap8(attribute_value);
-        }
+    case ZCL_BITMAP8_ATTRIBUTE_TYPE:
+        val_type = ESP_MATTER_VAL_TYPE_BITMAP8;
         break;
-    }
 
-    case ZCL_BITMAP16_ATTRIBUTE_TYPE: {
-        using Traits = chip::app::NumericAttributeTraits<uint16_t>;
-        Traits::StorageType attribute_value;
-        memcpy((uint8_t *)&attribute_value, value, sizeof(Traits::StorageType));
-        if (is_nullable) {
-            if (Traits::IsNullValue(attribute_value)) {
-                val = esp_matter_nullable_bitmap16(nullable<uint16_t>());
-            } else {
-                val = esp_matter_nullable_bitmap16(attribute_value);
-            }
-        } else {
-            val = esp_matter_bitmap16(attribute_value);
-        }
+    case ZCL_BITMAP16_ATTRIBUTE_TYPE:
+        val_type = ESP_MATTER_VAL_TYPE_BITMAP16;
         break;
-    }
 
-    case ZCL_BITMAP32_ATTRIBUTE_TYPE: {
-        using Traits = chip::app::NumericAttributeTraits<uint32_t>;
-        Traits::StorageType attribute_value;
-        memcpy((uint8_t *)&attribute_value, value, sizeof(Traits::StorageType));
-        if (is_nullable) {
-            if (Traits::IsNullValue(attribute_value)) {
-                val = esp_matter_nullable_bitmap32(nullable<uint32_t>());
-            } else {
-                val = esp_matter_nullable_bitmap32(attribute_value);
-            }
-        } else {
-            val = esp_matter_bitmap32(attribute_value);
-        }
+    case ZCL_BITMAP32_ATTRIBUTE_TYPE:
+        val_type = ESP_MATTER_VAL_TYPE_BITMAP32;
         break;
-    }
 
-    case ZCL_SINGLE_ATTRIBUTE_TYPE: {
-        using Traits = chip::app::NumericAttributeTraits<float>;
-        Traits::StorageType attribute_value;
-        memcpy((float *)&attribute_value, value, sizeof(Traits::StorageType));
-        if (is_nullable) {
-            if (Traits::IsNullValue(attribute_value)) {
-                val = esp_matter_nullable_float(nullable<float>());
-            } else {
-                val = esp_matter_nullable_float(attribute_value);
-            }
-        } else {
-            val = esp_matter_float(attribute_value);
-        }
+    case ZCL_SINGLE_ATTRIBUTE_TYPE:
+        val_type = ESP_MATTER_VAL_TYPE_FLOAT;
         break;
-    }
 
     default:
-        val = esp_matter_invalid(NULL);
-        break;
+        return ESP_MATTER_VAL_TYPE_INVALID;
     }
+    return is_nullable ? (esp_matter_val_type_t)(val_type + ESP_MATTER_VAL_NULLABLE_BASE) : val_type;
+}
+
+Status get_attr_val_from_raw_data_buffer(uint8_t *value, EmberAfAttributeType dataType, esp_matter_attr_val_t &val,
+                                         bool is_nullable)
+{
+    val.type = get_val_type_from_ember_attr_type(dataType, is_nullable);
     if (val.type == ESP_MATTER_VAL_TYPE_INVALID) {
         return Status::InvalidDataType;
     }
-    return Status::Success;
+    return esp_matter::attribute::codec::from_raw(val, value, is_nullable);
 }
 
 EmberAfAttributeType get_ember_attr_type_from_val_type(esp_matter_val_type_t val_type)
@@ -853,7 +472,7 @@ chip::Protocols::InteractionModel::Status emberAfReadAttribute(chip::EndpointId
     if (esp_matter::attribute::get_val_internal(attribute, &val) != ESP_OK) {
         return chip::Protocols::InteractionModel::Status::Failure;
     }
-    return get_raw_data_buffer_from_attr_val(val, dataPtr, readLength);
+    return esp_matter::attribute::codec::to_raw(val, dataPtr, readLength);
 }
 
 Status emberAfWriteAttribute(chip::EndpointId endpointId, chip::ClusterId clusterId, chip::AttributeId attributeId,
@@ -27,8 +27,10 @@ application.
 #include <esp_matter_command.h>
 #include <esp_matter_endpoint.h>
 #include <esp_matter_event.h>
+#include <esp_matter_event_template.h>
 #include <esp_matter_feature.h>
 #include <esp_matter_data_model.h>
+#include <esp_matter_measurement.h>
 #endif // CONFIG_ESP_MATTER_ENABLE_DATA_MODEL
 #include <app/server/Dnssd.h>
 #include <esp_matter_identify.h>
@@ -54,6 +54,7 @@
 #include <esp_matter_ota.h>
 #include <esp_matter_mem.h>
 #include <esp_matter_providers.h>
+#include <esp_matter_startup_profiler.h>
 
 using chip::DeviceLayer::ChipDeviceEvent;
 using chip::DeviceLayer::ConfigurationMgr;
@@ -177,6 +178,7 @@ static void deinit_ble_if_commissioned(intptr_t unused)
 
 static void esp_matter_chip_init_task(intptr_t context)
 {
+    startup_profiler::ScopedPhase init_task_phase("chip_init_task");
     TaskHandle_t task_to_notify = reinterpret_cast<TaskHandle_t>(context);
     static chip::CommonCaseDeviceServerInitParams defaultInitParams;
 
@@ -221,14 +223,20 @@ static void esp_matter_chip_init_task(intptr_t context)
     if (ret != CHIP_NO_ERROR) {
         ESP_LOGE(TAG, "Failed to add fabric delegate, err:%" CHIP_ERROR_FORMAT, ret.Format());
     }
-    ret = chip::Server::GetInstance().Init(initParams);
+    {
+        startup_profiler::ScopedPhase phase("server_init");
+        ret = chip::Server::GetInstance().Init(initParams);
+    }
     if (ret != CHIP_NO_ERROR) {
         ESP_LOGE(TAG, "Failed to init server instance, err:%" CHIP_ERROR_FORMAT, ret.Format());
     }
 
 #ifdef CONFIG_ESP_MATTER_ENABLE_DATA_MODEL
-    if (endpoint::enable_all() != ESP_OK) {
-        ESP_LOGE(TAG, "Enable all endpoints failure");
+    {
+        startup_profiler::ScopedPhase phase("endpoint_enable_all");
+        if (endpoint::enable_all() != ESP_OK) {
+            ESP_LOGE(TAG, "Enable all endpoints failure");
+        }
     }
 #endif // CONFIG_ESP_MATTER_ENABLE_DATA_MODEL
 #if CHIP_CONFIG_ENABLE_ICD_SERVER
@@ -264,6 +272,7 @@ static void device_callback_internal(const ChipDeviceEvent * event, intptr_t arg
         break;
 #ifdef CONFIG_ESP_MATTER_ENABLE_MATTER_SERVER
     case chip::DeviceLayer::DeviceEventType::kDnssdInitialized:
+        startup_profiler::add_milestone("dnssd_initialized");
         esp_matter_ota_requestor_start();
         /* Initialize binding manager */
         client::binding_manager_init();
@@ -316,8 +325,12 @@ static esp_err_t init_thread_stack_and_start_thread_task()
 
 static esp_err_t chip_init(event_callback_t callback, intptr_t callback_arg)
 {
-    VerifyOrReturnError(chip::Platform::MemoryInit() == CHIP_NO_ERROR, ESP_ERR_NO_MEM, ESP_LOGE(TAG, "Failed to initialize CHIP memory pool"));
-    VerifyOrReturnError(PlatformMgr().InitChipStack() == CHIP_NO_ERROR, ESP_FAIL, ESP_LOGE(TAG, "Failed to initialize CHIP stack"));
+    startup_profiler::ScopedPhase phase("chip_init");
+    {
+        startup_profiler::ScopedPhase stack_phase("chip_stack_init");
+        VerifyOrReturnError(chip::Platform::MemoryInit() == CHIP_NO_ERROR, ESP_ERR_NO_MEM, ESP_LOGE(TAG, "Failed to initialize CHIP memory pool"));
+        VerifyOrReturnError(PlatformMgr().InitChipStack() == CHIP_NO_ERROR, ESP_FAIL, ESP_LOGE(TAG, "Failed to initialize CHIP stack"));
+    }
 
     setup_providers();
     // ConnectivityMgr().SetWiFiAPMode(ConnectivityManager::kWiFiAPMode_Enabled);
@@ -340,7 +353,10 @@ static esp_err_t chip_init(event_callback_t callback, intptr_t callback_arg)
             return ESP_FAIL;
         }
     }
-    init_thread_stack_and_start_thread_task();
+    {
+        startup_profiler::ScopedPhase thread_phase("thread_stack_init");
+        init_thread_stack_and_start_thread_task();
+    }
 #if CONFIG_ESP_MATTER_ENABLE_MATTER_SERVER
     if (PlatformMgr().ScheduleWork(esp_matter_chip_init_task, reinterpret_cast<intptr_t>(xTaskGetCurrentTaskHandle())) != CHIP_NO_ERROR) {
         (void)PlatformMgr().StopEventLoopTask();
@@ -370,13 +386,17 @@ esp_err_t set_server_init_params(chip::CommonCaseDeviceServerInitParams *server_
 esp_err_t start(event_callback_t callback, intptr_t callback_arg)
 {
     VerifyOrReturnError(!esp_matter_started, ESP_ERR_INVALID_STATE, ESP_LOGE(TAG, "esp_matter has started"));
+    startup_profiler::ScopedPhase phase("esp_matter_start");
     esp_err_t err = esp_event_loop_create_default();
 
     // In case create event loop returns ESP_ERR_INVALID_STATE it is not necessary to fail startup
     // as of it means that default event loop is already initialized and no additional actions should be done.
     VerifyOrReturnError((err == ESP_OK || err == ESP_ERR_INVALID_STATE), err, ESP_LOGE(TAG, "Error create default event loop"));
 #if CHIP_DEVICE_CONFIG_ENABLE_WIFI
-    VerifyOrReturnError(chip::DeviceLayer::Internal::ESP32Utils::InitWiFiStack() == CHIP_NO_ERROR, ESP_FAIL, ESP_LOGE(TAG, "Error initializing Wi-Fi stack"));
+    {
+        startup_profiler::ScopedPhase wifi_phase("wifi_stack_init");
+        VerifyOrReturnError(chip::DeviceLayer::Internal::ESP32Utils::InitWiFiStack() == CHIP_NO_ERROR, ESP_FAIL, ESP_LOGE(TAG, "Error initializing Wi-Fi stack"));
+    }
 #endif // CHIP_DEVICE_CONFIG_ENABLE_WIFI
 #ifdef CONFIG_ESP_MATTER_ENABLE_DATA_MODEL
     esp_matter_ota_requestor_init();
@@ -398,7 +418,10 @@ esp_err_t start(event_callback_t callback, intptr_t callback_arg)
 #endif // CHIP_DEVICE_CONFIG_ENABLE_THREAD
     esp_matter_started = true;
 #if defined(CONFIG_ESP_MATTER_ENABLE_MATTER_SERVER) && defined(CONFIG_ESP_MATTER_ENABLE_DATA_MODEL)
-    err = node::read_min_unused_endpoint_id();
+    {
+        startup_profiler::ScopedPhase nvs_phase("read_min_unused_endpoint_id");
+        err = node::read_min_unused_endpoint_id();
+    }
     // If the min_unused_endpoint_id is not found, we will write the current min_unused_endpoint_id in nvs.
     if (err == ESP_ERR_NVS_NOT_FOUND) {
         err = node::store_min_unused_endpoint_id();
@@ -0,0 +1,301 @@
+// Copyright 2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <esp_cpu.h>
+#include <esp_matter_attr_val_codec.h>
+#include <esp_matter_mem.h>
+#include <inttypes.h>
+#include <limits>
+#include <stdio.h>
+#include <string.h>
+#include <type_traits>
+#include <unity.h>
+
+using chip::Protocols::InteractionModel::Status;
+namespace codec = esp_matter::attribute::codec;
+
+static bool is_nullable(esp_matter_val_type_t type)
+{
+    return type & ESP_MATTER_VAL_NULLABLE_BASE;
+}
+
+static bool is_string(esp_matter_val_type_t type)
+{
+    return type == ESP_MATTER_VAL_TYPE_CHAR_STRING || type == ESP_MATTER_VAL_TYPE_OCTET_STRING ||
+           type == ESP_MATTER_VAL_TYPE_LONG_CHAR_STRING || type == ESP_MATTER_VAL_TYPE_LONG_OCTET_STRING;
+}
+
+static void assert_same_value(const esp_matter_attr_val_t &expected, const esp_matter_attr_val_t &actual)
+{
+    TEST_ASSERT_EQUAL(expected.type, actual.type);
+    TEST_ASSERT_EQUAL(codec::is_null(expected), codec::is_null(actual));
+    /* NaN, the null float, is not equal to itself */
+    if (!codec::is_null(expected)) {
+        TEST_ASSERT_TRUE(codec::equal(expected, actual));
+    }
+}
+
+/* TLV encode, decode, raw buffer conversion and bounds of one value */
+static void check_round_trips(const esp_matter_attr_val_t &val)
+{
+    uint8_t buf[300];
+    chip::TLV::TLVWriter writer;
+    writer.Init(buf, sizeof(buf));
+    TEST_ASSERT_TRUE(codec::encode(val, writer, chip::TLV::AnonymousTag()) == CHIP_NO_ERROR);
+    TEST_ASSERT_TRUE(writer.Finalize() == CHIP_NO_ERROR);
+
+    chip::TLV::TLVReader reader;
+    reader.Init(buf, writer.GetLengthWritten());
+    TEST_ASSERT_TRUE(reader.Next() == CHIP_NO_ERROR);
+    esp_matter_attr_val_t decoded = {};
+    decoded.type = val.type;
+    TEST_ASSERT_TRUE(codec::decode(decoded, reader) == CHIP_NO_ERROR);
+    assert_same_value(val, decoded);
+    if (is_string(val.type)) {
+        esp_matter_mem_free(decoded.val.a.b);
+    }
+
+    uint8_t raw[300];
+    TEST_ASSERT_EQUAL(Status::Success, codec::to_raw(val, raw, sizeof(raw)));
+    esp_matter_attr_val_t from_raw = {};
+    from_raw.type = val.type;
+    TEST_ASSERT_EQUAL(Status::Success, codec::from_raw(from_raw, raw, is_nullable(val.type) || codec::is_null(val)));
+    assert_same_value(val, from_raw);
+
+    uint8_t base_type = val.type & ~ESP_MATTER_VAL_NULLABLE_BASE;
+    if (base_type == ESP_MATTER_VAL_TYPE_BOOLEAN || is_string(val.type)) {
+        TEST_ASSERT_EQUAL(-2, codec::compare_with_bounds(val, val.val, val.val));
+    } else {
+        TEST_ASSERT_EQUAL(0, codec::compare_with_bounds(val, val.val, val.val));
+    }
+}
+
+template <typename T>
+static void check_integer_type(esp_matter_attr_val_t (*make)(T), esp_matter_attr_val_t (*make_nullable)(nullable<T>),
+                               T esp_matter_val_t::*member)
+{
+    constexpr T min = std::numeric_limits<T>::min();
+    constexpr T max = std::numeric_limits<T>::max();
+    const T values[] = {min, static_cast<T>(min + 1), 0, 1, static_cast<T>(max - 1), max};
+    for (T value : values) {
+        check_round_trips(make(value));
+        /* The min of signed and the max of unsigned types is the null value of the nullable type */
+        esp_matter_attr_val_t nullable_val = make_nullable(nullable<T>(value));
+        check_round_trips(nullable_val);
+        TEST_ASSERT_EQUAL(value == (std::is_signed<T>::value ? min : max), codec::is_null(nullable_val));
+    }
+    check_round_trips(make_nullable(nullable<T>()));
+
+    /* Bounds */
+    esp_matter_attr_val_t val = make(static_cast<T>(min + 1));
+    esp_matter_val_t low = {}, high = {};
+    low.*member = min;
+    high.*member = static_cast<T>(min + 1);
+    TEST_ASSERT_EQUAL(0, codec::compare_with_bounds(val, low, high));
+    low.*member = static_cast<T>(min + 2);
+    high.*member = max;
+    TEST_ASSERT_EQUAL(-1, codec::compare_with_bounds(val, low, high));
+    val = make(max);
+    high.*member = static_cast<T>(max - 1);
+    TEST_ASSERT_EQUAL(1, codec::compare_with_bounds(val, low, high));
+    /* A null value is always in bounds */
+    TEST_ASSERT_EQUAL(0, codec::compare_with_bounds(make_nullable(nullable<T>()), low, high));
+}
+
+TEST_CASE("attribute value codec round-trips every integer type", "[attr_val_codec]")
+{
+    check_integer_type<int8_t>(esp_matter_int8, esp_matter_nullable_int8, &esp_matter_val_t::i8);
+    check_integer_type<uint8_t>(esp_matter_uint8, esp_matter_nullable_uint8, &esp_matter_val_t::u8);
+    check_integer_type<uint8_t>(esp_matter_enum8, esp_matter_nullable_enum8, &esp_matter_val_t::u8);
+    check_integer_type<uint8_t>(esp_matter_bitmap8, esp_matter_nullable_bitmap8, &esp_matter_val_t::u8);
+    check_integer_type<int16_t>(esp_matter_int16, esp_matter_nullable_int16, &esp_matter_val_t::i16);
+    check_integer_type<uint16_t>(esp_matter_uint16, esp_matter_nullable_uint16, &esp_matter_val_t::u16);
+    check_integer_type<uint16_t>(esp_matter_enum16, esp_matter_nullable_enum16, &esp_matter_val_t::u16);
+    check_integer_type<uint16_t>(esp_matter_bitmap16, esp_matter_nullable_bitmap16, &esp_matter_val_t::u16);
+    check_integer_type<int32_t>(esp_matter_int32, esp_matter_nullable_int32, &esp_matter_val_t::i32);
+    check_integer_type<uint32_t>(esp_matter_uint32, esp_matter_nullable_uint32, &esp_matter_val_t::u32);
+    check_integer_type<uint32_t>(esp_matter_bitmap32, esp_matter_nullable_bitmap32, &esp_matter_val_t::u32);
+    check_integer_type<int64_t>(esp_matter_int64, esp_matter_nullable_int64, &esp_matter_val_t::i64);
+    check_integer_type<uint64_t>(esp_matter_uint64, esp_matter_nullable_uint64, &esp_matter_val_t::u64);
+}
+
+TEST_CASE("attribute value codec round-trips every 8-bit value", "[attr_val_codec]")
+{
+    for (int value = 0; value <= UINT8_MAX; value++) {
+        check_round_trips(esp_matter_uint8(value));
+        check_round_trips(esp_matter_nullable_uint8(nullable<uint8_t>(value)));
+        check_round_trips(esp_matter_int8(static_cast<int8_t>(value)));
+        check_round_trips(esp_matter_nullable_int8(nullable<int8_t>(static_cast<int8_t>(value))));
+    }
+}
+
+TEST_CASE("attribute value codec round-trips booleans and floats", "[attr_val_codec]")
+{
+    check_round_trips(esp_matter_bool(false));
+    check_round_trips(esp_matter_bool(true));
+    check_round_trips(esp_matter_nullable_bool(nullable<bool>(true)));
+    check_round_trips(esp_matter_nullable_bool(nullable<bool>()));
+    TEST_ASSERT_TRUE(codec::is_null(esp_matter_nullable_bool(nullable<bool>())));
+
+    const float values[] = {0.0f, -1.5f, 3.25e10f, std::numeric_limits<float>::lowest(),
+                            std::numeric_limits<float>::max()};
+    for (float value : values) {
+        check_round_trips(esp_matter_float(value));
+        check_round_trips(esp_matter_nullable_float(nullable<float>(value)));
+    }
+    check_round_trips(esp_matter_nullable_float(nullable<float>()));
+    TEST_ASSERT_TRUE(codec::is_null(esp_matter_nullable_float(nullable<float>())));
+}
+
+TEST_CASE("attribute value codec round-trips strings", "[attr_val_codec]")
+{
+    char text[] = "esp-matter";
+    uint8_t bytes[] = {0x00, 0x01, 0xFE, 0xFF};
+    static uint8_t long_bytes[1000];
+    for (size_t i = 0; i < sizeof(long_bytes); i++) {
+        long_bytes[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    check_round_trips(esp_matter_char_str(text, strlen(text)));
+    check_round_trips(esp_matter_char_str(text, 0));
+    check_round_trips(esp_matter_octet_str(bytes, sizeof(bytes)));
+    check_round_trips(esp_matter_long_char_str(text, strlen(text)));
+    check_round_trips(esp_matter_long_octet_str(bytes, sizeof(bytes)));
+
+    /* The null string is the null buffer with the maximum length */
+    esp_matter_attr_val_t null_str = esp_matter_char_str(nullptr, UINT8_MAX);
+    TEST_ASSERT_TRUE(codec::is_null(null_str));
+    check_round_trips(null_str);
+    esp_matter_attr_val_t null_long_str = esp_matter_long_octet_str(nullptr, UINT16_MAX);
+    TEST_ASSERT_TRUE(codec::is_null(null_long_str));
+    check_round_trips(null_long_str);
+
+    /* A long string does not fit the raw buffer of a short one, the TLV encoding carries it */
+    uint8_t raw[300];
+    esp_matter_attr_val_t long_str = esp_matter_long_octet_str(long_bytes, sizeof(long_bytes));
+    TEST_ASSERT_EQUAL(Status::ResourceExhausted, codec::to_raw(long_str, raw, sizeof(raw)));
+}
+
+TEST_CASE("attribute value codec has all or none of the operations of a type", "[attr_val_codec]")
+{
+    for (uint16_t type = 0; type < 2 * codec::k_base_val_type_count; type++) {
+        esp_matter_val_type_t val_type = static_cast<esp_matter_val_type_t>(
+            type < codec::k_base_val_type_count ? type
+                                                : ESP_MATTER_VAL_NULLABLE_BASE + type - codec::k_base_val_type_count);
+        uint8_t base_type = val_type & ~ESP_MATTER_VAL_NULLABLE_BASE;
+        const codec::val_ops_t &ops = codec::get_ops(val_type);
+        TEST_ASSERT_TRUE(&ops == &codec::k_val_ops[type]);
+        if (base_type == ESP_MATTER_VAL_TYPE_INVALID || base_type == ESP_MATTER_VAL_TYPE_ARRAY ||
+                (is_nullable(val_type) && is_string(static_cast<esp_matter_val_type_t>(base_type)))) {
+            TEST_ASSERT_NULL(ops.encode);
+            TEST_ASSERT_NULL(ops.to_raw);
+            continue;
+        }
+        if (base_type == ESP_MATTER_VAL_TYPE_INTEGER) {
+            TEST_ASSERT_NOT_NULL(ops.is_null);
+            TEST_ASSERT_NULL(ops.encode);
+            continue;
+        }
+        TEST_ASSERT_NOT_NULL(ops.is_null);
+        TEST_ASSERT_NOT_NULL(ops.equal);
+        TEST_ASSERT_NOT_NULL(ops.encode);
+        TEST_ASSERT_NOT_NULL(ops.decode);
+        TEST_ASSERT_NOT_NULL(ops.to_raw);
+        TEST_ASSERT_NOT_NULL(ops.from_raw);
+    }
+    /* Unknown types get the operations of the invalid type */
+    TEST_ASSERT_TRUE(&codec::get_ops(static_cast<esp_matter_val_type_t>(0x7F)) ==
+                     &codec::k_val_ops[ESP_MATTER_VAL_TYPE_INVALID]);
+}
+
+TEST_CASE("attribute value codec cycles per operation", "[attr_val_codec][benchmark]")
+{
+    constexpr uint32_t k_iterations = 1000;
+    char text[] = "kitchen light";
+    const struct {
+        const char *name;
+        esp_matter_attr_val_t val;
+    } cases[] = {
+        {"uint8", esp_matter_uint8(42)},
+        {"nullable int16", esp_matter_nullable_int16(nullable<int16_t>(-1234))},
+        {"uint32", esp_matter_uint32(123456)},
+        {"int64", esp_matter_int64(-1234567890123)},
+        {"float", esp_matter_float(21.5f)},
+        {"char string", esp_matter_char_str(text, strlen(text))},
+    };
+
+    printf("%-16s %8s %8s %8s %8s %8s %8s\n", "cycles", "encode", "decode", "equal", "bounds", "to_raw", "from_raw");
+    for (const auto &test_case : cases) {
+        const esp_matter_attr_val_t &val = test_case.val;
+        uint8_t buf[64];
+        chip::TLV::TLVWriter writer;
+        chip::TLV::TLVReader reader;
+        esp_matter_attr_val_t out = {};
+        out.type = val.type;
+
+        uint32_t start = esp_cpu_get_cycle_count();
+        for (uint32_t i = 0; i < k_iterations; i++) {
+            writer.Init(buf, sizeof(buf));
+            (void)codec::encode(val, writer, chip::TLV::AnonymousTag());
+        }
+        uint32_t encode_cycles = (esp_cpu_get_cycle_count() - start) / k_iterations;
+        uint32_t encoded_len = writer.GetLengthWritten();
+
+        start = esp_cpu_get_cycle_count();
+        for (uint32_t i = 0; i < k_iterations; i++) {
+            reader.Init(buf, encoded_len);
+            (void)reader.Next();
+            (void)codec::decode(out, reader);
+            if (is_string(val.type)) {
+                esp_matter_mem_free(out.val.a.b);
+            }
+        }
+        uint32_t decode_cycles = (esp_cpu_get_cycle_count() - start) / k_iterations;
+
+        volatile bool same = false;
+        start = esp_cpu_get_cycle_count();
+        for (uint32_t i = 0; i < k_iterations; i++) {
+            same = codec::equal(val, val);
+        }
+        uint32_t equal_cycles = (esp_cpu_get_cycle_count() - start) / k_iterations;
+        TEST_ASSERT_TRUE(same);
+
+        uint32_t bounds_cycles = 0;
+        if (!is_string(val.type)) {
+            volatile int in_bounds = -1;
+            start = esp_cpu_get_cycle_count();
+            for (uint32_t i = 0; i < k_iterations; i++) {
+                in_bounds = codec::compare_with_bounds(val, val.val, val.val);
+            }
+            bounds_cycles = (esp_cpu_get_cycle_count() - start) / k_iterations;
+            TEST_ASSERT_EQUAL(0, in_bounds);
+        }
+
+        start = esp_cpu_get_cycle_count();
+        for (uint32_t i = 0; i < k_iterations; i++) {
+            (void)codec::to_raw(val, buf, sizeof(buf));
+        }
+        uint32_t to_raw_cycles = (esp_cpu_get_cycle_count() - start) / k_iterations;
+
+        start = esp_cpu_get_cycle_count();
+        for (uint32_t i = 0; i < k_iterations; i++) {
+            (void)codec::from_raw(out, buf, false);
+        }
+        uint32_t from_raw_cycles = (esp_cpu_get_cycle_count() - start) / k_iterations;
+        assert_same_value(val, out);
+
+        printf("%-16s %8" PRIu32 " %8" PRIu32 " %8" PRIu32 " %8" PRIu32 " %8" PRIu32 " %8" PRIu32 "\n", test_case.name,
+               encode_cycles, decode_cycles, equal_cycles, bounds_cycles, to_raw_cycles, from_raw_cycles);
+    }
+}
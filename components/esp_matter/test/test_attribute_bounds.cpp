@@ -0,0 +1,127 @@
+// Copyright 2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <esp_heap_caps.h>
+#include <esp_matter_endpoint.h>
+#include <esp_matter_mem.h>
+#include <stdio.h>
+#include <unity.h>
+
+using namespace esp_matter;
+
+static constexpr uint8_t k_max_endpoints = 8;
+static constexpr uint16_t k_max_bounded_attributes = 256;
+
+typedef struct {
+    uint16_t clusters;
+    uint16_t attributes;
+} bounds_count_t;
+
+/* The device types of the all device types app whose clusters have an add_bounds callback. The endpoints are new for
+   each run, since destroying the endpoints needs the Matter stack. */
+static uint8_t create_endpoints(endpoint_t *endpoints[k_max_endpoints])
+{
+    node_t *node = node::get() ? node::get() : node::create_raw();
+    TEST_ASSERT_NOT_NULL(node);
+    uint8_t count = 0;
+
+    endpoint::extended_color_light::config_t extended_color_light_config;
+    endpoints[count++] = endpoint::extended_color_light::create(node, &extended_color_light_config, ENDPOINT_FLAG_NONE,
+                                                                nullptr);
+    endpoint::color_temperature_light::config_t color_temperature_light_config;
+    endpoints[count++] = endpoint::color_temperature_light::create(node, &color_temperature_light_config,
+                                                                   ENDPOINT_FLAG_NONE, nullptr);
+    endpoint::dimmable_light::config_t dimmable_light_config;
+    endpoints[count++] = endpoint::dimmable_light::create(node, &dimmable_light_config, ENDPOINT_FLAG_NONE, nullptr);
+    endpoint::fan::config_t fan_config;
+    endpoints[count++] = endpoint::fan::create(node, &fan_config, ENDPOINT_FLAG_NONE, nullptr);
+    endpoint::thermostat::config_t thermostat_config;
+    endpoints[count++] = endpoint::thermostat::create(node, &thermostat_config, ENDPOINT_FLAG_NONE, nullptr);
+
+    for (uint8_t i = 0; i < count; i++) {
+        TEST_ASSERT_NOT_NULL(endpoints[i]);
+    }
+    return count;
+}
+
+/* What the endpoint enable does for each cluster */
+static void add_bounds(endpoint_t *endpoints[], uint8_t endpoint_count)
+{
+    for (uint8_t i = 0; i < endpoint_count; i++) {
+        for (cluster_t *cluster = cluster::get_first(endpoints[i]); cluster; cluster = cluster::get_next(cluster)) {
+            cluster::add_bounds_callback_t callback = cluster::get_add_bounds_callback(cluster);
+            if (callback) {
+                callback(cluster);
+            }
+        }
+    }
+}
+
+static bounds_count_t count_bounds(endpoint_t *endpoints[], uint8_t endpoint_count)
+{
+    bounds_count_t count = {};
+    for (uint8_t i = 0; i < endpoint_count; i++) {
+        for (cluster_t *cluster = cluster::get_first(endpoints[i]); cluster; cluster = cluster::get_next(cluster)) {
+            uint16_t attributes = 0;
+            for (attribute_t *attribute = attribute::get_first(cluster); attribute;
+                    attribute = attribute::get_next(attribute)) {
+                if (attribute::get_flags(attribute) & ATTRIBUTE_FLAG_MIN_MAX) {
+                    esp_matter_attr_bounds_t bounds;
+                    TEST_ASSERT_EQUAL(ESP_OK, attribute::get_bounds(attribute, &bounds));
+                    TEST_ASSERT_EQUAL(attribute::get_val_type(attribute), bounds.min.type);
+                    attributes++;
+                }
+            }
+            count.clusters += attributes > 0 ? 1 : 0;
+            count.attributes += attributes;
+        }
+    }
+    return count;
+}
+
+TEST_CASE("attribute bounds take one allocation per cluster", "[attribute_bounds][benchmark]")
+{
+    endpoint_t *endpoints[k_max_endpoints];
+    uint8_t endpoint_count = create_endpoints(endpoints);
+
+    size_t free_before = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    add_bounds(endpoints, endpoint_count);
+    size_t table_used = free_before - heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    bounds_count_t count = count_bounds(endpoints, endpoint_count);
+    TEST_ASSERT_GREATER_THAN(0, count.attributes);
+
+    /* The endpoint enable runs the callbacks again, which updates the existing entries */
+    free_before = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    add_bounds(endpoints, endpoint_count);
+    TEST_ASSERT_EQUAL(free_before, heap_caps_get_free_size(MALLOC_CAP_8BIT));
+
+    /* The separate esp_matter_attr_bounds_t of each bounded attribute, as add_bounds() allocated them before */
+    static void *per_attribute[k_max_bounded_attributes];
+    TEST_ASSERT_LESS_OR_EQUAL(k_max_bounded_attributes, count.attributes);
+    free_before = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    for (uint16_t i = 0; i < count.attributes; i++) {
+        per_attribute[i] = esp_matter_mem_calloc(1, sizeof(esp_matter_attr_bounds_t));
+        TEST_ASSERT_NOT_NULL(per_attribute[i]);
+    }
+    size_t per_attribute_used = free_before - heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    for (uint16_t i = 0; i < count.attributes; i++) {
+        esp_matter_mem_free(per_attribute[i]);
+    }
+
+    printf("Bounds of %u attributes in %u clusters of %u endpoints: %u allocations and %zu bytes of heap per "
+           "attribute, %u allocations and %zu bytes of heap per cluster\n", count.attributes, count.clusters,
+           endpoint_count, count.attributes, per_attribute_used, count.clusters, table_used);
+    TEST_ASSERT_LESS_THAN(count.attributes, count.clusters);
+    TEST_ASSERT_LESS_THAN(per_attribute_used, table_used);
+}
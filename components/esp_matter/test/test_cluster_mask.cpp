@@ -0,0 +1,161 @@
+// Copyright 2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <esp_cpu.h>
+#include <esp_matter_data_model.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <unity.h>
+
+#include <app-common/zap-generated/ids/Attributes.h>
+#include <app-common/zap-generated/ids/Clusters.h>
+
+using namespace esp_matter;
+using namespace chip::app::Clusters;
+
+/* The optional attributes which the ElectricalPowerMeasurement delegate init looks up */
+static const uint32_t s_optional_attribute_ids[] = {
+    ElectricalPowerMeasurement::Attributes::Ranges::Id,
+    ElectricalPowerMeasurement::Attributes::Voltage::Id,
+    ElectricalPowerMeasurement::Attributes::ActiveCurrent::Id,
+    ElectricalPowerMeasurement::Attributes::ReactiveCurrent::Id,
+    ElectricalPowerMeasurement::Attributes::ApparentCurrent::Id,
+    ElectricalPowerMeasurement::Attributes::ReactivePower::Id,
+    ElectricalPowerMeasurement::Attributes::ApparentPower::Id,
+    ElectricalPowerMeasurement::Attributes::RMSVoltage::Id,
+    ElectricalPowerMeasurement::Attributes::RMSCurrent::Id,
+    ElectricalPowerMeasurement::Attributes::RMSPower::Id,
+    ElectricalPowerMeasurement::Attributes::Frequency::Id,
+    ElectricalPowerMeasurement::Attributes::PowerFactor::Id,
+    ElectricalPowerMeasurement::Attributes::NeutralCurrent::Id,
+};
+static constexpr uint8_t k_optional_attribute_count = sizeof(s_optional_attribute_ids) / sizeof(uint32_t);
+/* Voltage, ActiveCurrent and Frequency exist on the cluster */
+static constexpr uint32_t k_enabled_mask = (1 << 1) | (1 << 2) | (1 << 10);
+
+static constexpr uint8_t k_endpoint_count = 8;
+static constexpr uint8_t k_clusters_per_endpoint = 4;
+static constexpr uint8_t k_attributes_per_cluster = 12;
+
+static uint16_t s_endpoint_ids[k_endpoint_count];
+
+/* Endpoints with a few clusters of a dozen attributes, the ElectricalPowerMeasurement cluster last. The node is kept
+   for the following runs, since destroying the endpoints needs the Matter stack. */
+static void create_endpoints()
+{
+    static bool created = false;
+    if (created) {
+        return;
+    }
+    node_t *node = node::create_raw();
+    TEST_ASSERT_NOT_NULL(node);
+    for (uint8_t i = 0; i < k_endpoint_count; i++) {
+        endpoint_t *endpoint = endpoint::create(node, ENDPOINT_FLAG_NONE, nullptr);
+        TEST_ASSERT_NOT_NULL(endpoint);
+        s_endpoint_ids[i] = endpoint::get_id(endpoint);
+        for (uint8_t c = 0; c < k_clusters_per_endpoint - 1; c++) {
+            cluster_t *cluster = cluster::create(endpoint, 0xFFF10000 + c, CLUSTER_FLAG_SERVER);
+            TEST_ASSERT_NOT_NULL(cluster);
+            for (uint8_t a = 0; a < k_attributes_per_cluster; a++) {
+                TEST_ASSERT_NOT_NULL(attribute::create(cluster, a, ATTRIBUTE_FLAG_NONE, esp_matter_int64(0)));
+            }
+        }
+        cluster_t *cluster = cluster::create(endpoint, ElectricalPowerMeasurement::Id, CLUSTER_FLAG_SERVER);
+        TEST_ASSERT_NOT_NULL(cluster);
+        for (uint8_t a = 0; a < k_attributes_per_cluster - 3; a++) {
+            TEST_ASSERT_NOT_NULL(attribute::create(cluster, 0xFFF30000 + a, ATTRIBUTE_FLAG_NONE, esp_matter_int64(0)));
+        }
+        for (uint8_t n = 0; n < k_optional_attribute_count; n++) {
+            if (k_enabled_mask & (1 << n)) {
+                TEST_ASSERT_NOT_NULL(attribute::create(cluster, s_optional_attribute_ids[n], ATTRIBUTE_FLAG_NONE,
+                                                       esp_matter_int64(0)));
+            }
+        }
+    }
+    created = true;
+}
+
+static uint32_t get_mask_per_attribute(uint16_t endpoint_id)
+{
+    uint32_t mask = 0;
+    for (uint8_t n = 0; n < k_optional_attribute_count; n++) {
+        if (endpoint::is_attribute_enabled(endpoint_id, ElectricalPowerMeasurement::Id, s_optional_attribute_ids[n])) {
+            mask |= 1 << n;
+        }
+    }
+    return mask;
+}
+
+static uint32_t get_mask_of_cluster(uint16_t endpoint_id)
+{
+    cluster_t *cluster = cluster::get(endpoint_id, ElectricalPowerMeasurement::Id);
+    return cluster::get_attribute_mask(cluster, s_optional_attribute_ids, k_optional_attribute_count);
+}
+
+TEST_CASE("cluster attribute mask is dropped when an attribute is created or destroyed", "[cluster_mask]")
+{
+    create_endpoints();
+    cluster_t *cluster = cluster::get(s_endpoint_ids[0], ElectricalPowerMeasurement::Id);
+    TEST_ASSERT_NOT_NULL(cluster);
+    TEST_ASSERT_EQUAL_HEX32(k_enabled_mask, get_mask_of_cluster(s_endpoint_ids[0]));
+
+    attribute_t *attribute = attribute::create(cluster, ElectricalPowerMeasurement::Attributes::Ranges::Id,
+                                               ATTRIBUTE_FLAG_NONE, esp_matter_int64(0));
+    TEST_ASSERT_NOT_NULL(attribute);
+    TEST_ASSERT_EQUAL_HEX32(k_enabled_mask | 1, get_mask_of_cluster(s_endpoint_ids[0]));
+
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::destroy(cluster, attribute));
+    TEST_ASSERT_EQUAL_HEX32(k_enabled_mask, get_mask_of_cluster(s_endpoint_ids[0]));
+
+    /* A shorter count of the same table is not served from the cache */
+    TEST_ASSERT_EQUAL_HEX32(k_enabled_mask & 0x7, cluster::get_attribute_mask(cluster, s_optional_attribute_ids, 3));
+}
+
+TEST_CASE("cached cluster attribute mask is cheaper than one lookup per attribute", "[cluster_mask][benchmark]")
+{
+    create_endpoints();
+
+    /* The delegate init of each endpoint, as it was: one endpoint, cluster and attribute lookup per attribute */
+    uint32_t start = esp_cpu_get_cycle_count();
+    for (uint8_t i = 0; i < k_endpoint_count; i++) {
+        TEST_ASSERT_EQUAL_HEX32(k_enabled_mask, get_mask_per_attribute(s_endpoint_ids[i]));
+    }
+    uint32_t per_attribute_cycles = (esp_cpu_get_cycle_count() - start) / k_endpoint_count;
+
+    /* The first mask of a cluster walks its attribute list once */
+    for (uint8_t i = 0; i < k_endpoint_count; i++) {
+        cluster_t *cluster = cluster::get(s_endpoint_ids[i], ElectricalPowerMeasurement::Id);
+        attribute_t *attribute = attribute::create(cluster, ElectricalPowerMeasurement::Attributes::Ranges::Id,
+                                                   ATTRIBUTE_FLAG_NONE, esp_matter_int64(0));
+        TEST_ASSERT_EQUAL(ESP_OK, attribute::destroy(cluster, attribute));
+    }
+    start = esp_cpu_get_cycle_count();
+    for (uint8_t i = 0; i < k_endpoint_count; i++) {
+        TEST_ASSERT_EQUAL_HEX32(k_enabled_mask, get_mask_of_cluster(s_endpoint_ids[i]));
+    }
+    uint32_t first_mask_cycles = (esp_cpu_get_cycle_count() - start) / k_endpoint_count;
+
+    /* The following inits of the same cluster read the cached mask */
+    start = esp_cpu_get_cycle_count();
+    for (uint8_t i = 0; i < k_endpoint_count; i++) {
+        TEST_ASSERT_EQUAL_HEX32(k_enabled_mask, get_mask_of_cluster(s_endpoint_ids[i]));
+    }
+    uint32_t cached_mask_cycles = (esp_cpu_get_cycle_count() - start) / k_endpoint_count;
+
+    printf("ElectricalPowerMeasurement optional attributes of %u endpoints: %" PRIu32 " cycles per endpoint with one "
+           "lookup per attribute, %" PRIu32 " with the first mask, %" PRIu32 " with the cached mask\n",
+           k_endpoint_count, per_attribute_cycles, first_mask_cycles, cached_mask_cycles);
+    TEST_ASSERT_LESS_THAN_UINT32(per_attribute_cycles, first_mask_cycles);
+    TEST_ASSERT_LESS_THAN_UINT32(first_mask_cycles, cached_mask_cycles);
+}
@@ -0,0 +1,162 @@
+// Copyright 2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <esp_cpu.h>
+#include <esp_matter_event_template.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <unity.h>
+
+#include <app-common/zap-generated/cluster-objects.h>
+#include <app/MessageDef/EventDataIB.h>
+#include <lib/core/TLV.h>
+
+using namespace chip::app::Clusters;
+namespace payload_template = esp_matter::event::payload_template;
+
+static const esp_matter_val_type_t s_switch_field_types[] = {ESP_MATTER_VAL_TYPE_UINT8, ESP_MATTER_VAL_TYPE_UINT8};
+
+/* Write the patched payload the way the event logger does and position the reader on the event data structure */
+static void write_payload(payload_template::payload_template_t *event_template, const int64_t *values,
+                          uint8_t value_count, uint8_t *buf, size_t buf_size, chip::TLV::TLVReader &reader)
+{
+    uint8_t payload[64];
+    size_t payload_size = 0;
+    TEST_ASSERT_EQUAL(ESP_OK, payload_template::get_payload(event_template, values, value_count, payload,
+                                                            sizeof(payload), &payload_size));
+
+    chip::TLV::TLVWriter writer;
+    writer.Init(buf, buf_size);
+    TEST_ASSERT_TRUE(writer.PutPreEncodedContainer(chip::TLV::AnonymousTag(), chip::TLV::kTLVType_Structure, payload,
+                                                   static_cast<uint32_t>(payload_size)) == CHIP_NO_ERROR);
+    TEST_ASSERT_TRUE(writer.Finalize() == CHIP_NO_ERROR);
+
+    reader.Init(buf, writer.GetLengthWritten());
+    TEST_ASSERT_TRUE(reader.Next(chip::TLV::kTLVType_Structure, chip::TLV::AnonymousTag()) == CHIP_NO_ERROR);
+}
+
+TEST_CASE("switch InitialPress payload round-trips through the TLV reader", "[event_template]")
+{
+    payload_template::payload_template_t *event_template = payload_template::create(
+        Switch::Id, Switch::Events::InitialPress::Id, chip::app::PriorityLevel::Info, s_switch_field_types, 1);
+    TEST_ASSERT_NOT_NULL(event_template);
+
+    for (int64_t position : {0, 1, 2, 255}) {
+        uint8_t buf[64];
+        chip::TLV::TLVReader reader;
+        int64_t values[] = {position};
+        write_payload(event_template, values, 1, buf, sizeof(buf), reader);
+
+        Switch::Events::InitialPress::DecodableType event;
+        TEST_ASSERT_TRUE(event.Decode(reader) == CHIP_NO_ERROR);
+        TEST_ASSERT_EQUAL(position, event.newPosition);
+    }
+    payload_template::destroy(event_template);
+}
+
+TEST_CASE("switch MultiPressComplete payload round-trips through the TLV reader", "[event_template]")
+{
+    payload_template::payload_template_t *event_template = payload_template::create(
+        Switch::Id, Switch::Events::MultiPressComplete::Id, chip::app::PriorityLevel::Info, s_switch_field_types, 2);
+    TEST_ASSERT_NOT_NULL(event_template);
+
+    uint8_t buf[64];
+    chip::TLV::TLVReader reader;
+    int64_t values[] = {1, 3};
+    write_payload(event_template, values, 2, buf, sizeof(buf), reader);
+
+    Switch::Events::MultiPressComplete::DecodableType event;
+    TEST_ASSERT_TRUE(event.Decode(reader) == CHIP_NO_ERROR);
+    TEST_ASSERT_EQUAL(1, event.previousPosition);
+    TEST_ASSERT_EQUAL(3, event.totalNumberOfPressesCounted);
+
+    /* Each field keeps its context tag */
+    write_payload(event_template, values, 2, buf, sizeof(buf), reader);
+    chip::TLV::TLVType outer_type;
+    uint8_t value = 0;
+    TEST_ASSERT_TRUE(reader.EnterContainer(outer_type) == CHIP_NO_ERROR);
+    TEST_ASSERT_TRUE(reader.Next(chip::TLV::ContextTag(0)) == CHIP_NO_ERROR);
+    TEST_ASSERT_TRUE(reader.Get(value) == CHIP_NO_ERROR);
+    TEST_ASSERT_EQUAL(1, value);
+    TEST_ASSERT_TRUE(reader.Next(chip::TLV::ContextTag(1)) == CHIP_NO_ERROR);
+    TEST_ASSERT_TRUE(reader.Get(value) == CHIP_NO_ERROR);
+    TEST_ASSERT_EQUAL(3, value);
+    TEST_ASSERT_TRUE(reader.Next() == CHIP_END_OF_TLV);
+    TEST_ASSERT_TRUE(reader.ExitContainer(outer_type) == CHIP_NO_ERROR);
+    payload_template::destroy(event_template);
+}
+
+TEST_CASE("event template rejects values which do not fit the field type", "[event_template]")
+{
+    static const esp_matter_val_type_t field_types[] = {ESP_MATTER_VAL_TYPE_UINT8, ESP_MATTER_VAL_TYPE_INT16,
+                                                        ESP_MATTER_VAL_TYPE_BOOLEAN};
+    payload_template::payload_template_t *event_template = payload_template::create(
+        Switch::Id, Switch::Events::MultiPressComplete::Id, chip::app::PriorityLevel::Info, field_types, 3);
+    TEST_ASSERT_NOT_NULL(event_template);
+
+    uint8_t payload[64];
+    size_t payload_size = 0;
+    const int64_t valid[] = {255, -32768, 1};
+    const int64_t invalid[][3] = {{256, 0, 0}, {-1, 0, 0}, {0, 32768, 0}, {0, -32769, 0}, {0, 0, 2}};
+    TEST_ASSERT_EQUAL(ESP_OK, payload_template::get_payload(event_template, valid, 3, payload, sizeof(payload),
+                                                            &payload_size));
+    for (const int64_t *values : invalid) {
+        TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, payload_template::get_payload(event_template, values, 3, payload,
+                                                                             sizeof(payload), &payload_size));
+        TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, payload_template::emit(event_template, 1, values, 3));
+    }
+    payload_template::destroy(event_template);
+}
+
+TEST_CASE("event template patching is cheaper than encoding the event", "[event_template][benchmark]")
+{
+    constexpr uint32_t k_iterations = 1000;
+    payload_template::payload_template_t *event_template = payload_template::create(
+        Switch::Id, Switch::Events::MultiPressComplete::Id, chip::app::PriorityLevel::Info, s_switch_field_types, 2);
+    TEST_ASSERT_NOT_NULL(event_template);
+
+    /* Both paths produce the event data element which the event logger writes */
+    uint8_t buf[64];
+    chip::TLV::TLVWriter writer;
+    chip::TLV::Tag data_tag = chip::TLV::ContextTag(chip::to_underlying(chip::app::EventDataIB::Tag::kData));
+    uint32_t start = esp_cpu_get_cycle_count();
+    for (uint32_t i = 0; i < k_iterations; i++) {
+        Switch::Events::MultiPressComplete::Type event;
+        event.previousPosition = static_cast<uint8_t>(i);
+        event.totalNumberOfPressesCounted = 2;
+        writer.Init(buf, sizeof(buf));
+        TEST_ASSERT_TRUE(chip::app::DataModel::Encode(writer, data_tag, event) == CHIP_NO_ERROR);
+    }
+    uint32_t encode_cycles = (esp_cpu_get_cycle_count() - start) / k_iterations;
+
+    uint8_t payload[64];
+    size_t payload_size = 0;
+    start = esp_cpu_get_cycle_count();
+    for (uint32_t i = 0; i < k_iterations; i++) {
+        int64_t values[] = {static_cast<uint8_t>(i), 2};
+        TEST_ASSERT_EQUAL(ESP_OK, payload_template::get_payload(event_template, values, 2, payload, sizeof(payload),
+                                                                &payload_size));
+        writer.Init(buf, sizeof(buf));
+        TEST_ASSERT_TRUE(writer.PutPreEncodedContainer(data_tag, chip::TLV::kTLVType_Structure, payload,
+                                                       static_cast<uint32_t>(payload_size)) == CHIP_NO_ERROR);
+    }
+    uint32_t template_cycles = (esp_cpu_get_cycle_count() - start) / k_iterations;
+
+    printf("MultiPressComplete payload: %" PRIu32 " cycles encoded, %" PRIu32 " cycles from the template, "
+           "%" PRIu32 " payloads per second from the template at %d MHz\n", encode_cycles, template_cycles,
+           template_cycles ? CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ * 1000000U / template_cycles : 0,
+           CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ);
+    TEST_ASSERT_LESS_THAN_UINT32(encode_cycles, template_cycles);
+    payload_template::destroy(event_template);
+}
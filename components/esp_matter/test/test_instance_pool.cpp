@@ -0,0 +1,121 @@
+// Copyright 2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <esp_heap_caps.h>
+#include <stdio.h>
+#include <unity.h>
+
+#include <app/clusters/microwave-oven-control-server/microwave-oven-control-server.h>
+#include <app/clusters/mode-base-server/mode-base-server.h>
+#include <app/clusters/operational-state-server/operational-state-server.h>
+#include <lib/support/Pool.h>
+
+using namespace chip::app::Clusters;
+
+/* Blocks of the size of the cluster server instances which the delegate init keeps per endpoint. The instances
+   themselves register with the Matter stack, which the unit test app does not run. */
+template <size_t Size>
+struct instance_block {
+    alignas(void *) uint8_t data[Size];
+};
+using mode_block = instance_block<sizeof(ModeBase::Instance)>;
+using operational_state_block = instance_block<sizeof(OperationalState::Instance)>;
+using microwave_oven_control_block = instance_block<sizeof(MicrowaveOvenControl::Instance)>;
+
+static constexpr uint8_t k_endpoint_count = 4;
+static constexpr uint8_t k_cycle_count = 32;
+/* Allocations made while the endpoints are added (attributes, strings), which outlive the instances */
+static constexpr size_t k_long_lived_size = 48;
+
+static chip::ObjectPool<mode_block, k_endpoint_count, chip::ObjectPoolMem::kInline> s_mode_pool;
+static chip::ObjectPool<operational_state_block, k_endpoint_count, chip::ObjectPoolMem::kInline> s_operational_state_pool;
+static chip::ObjectPool<microwave_oven_control_block, k_endpoint_count, chip::ObjectPoolMem::kInline>
+    s_microwave_oven_control_pool;
+
+typedef struct {
+    size_t peak_used;
+    size_t largest_free_block;
+} heap_usage_t;
+
+/* Add and remove k_endpoint_count microwave oven endpoints k_cycle_count times, with a long lived allocation
+   after each endpoint, and track the heap */
+template <typename Create, typename Release>
+static heap_usage_t churn_endpoints(Create create, Release release)
+{
+    void *long_lived[k_cycle_count * k_endpoint_count];
+    void *instances[k_endpoint_count][3];
+    size_t free_before = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    size_t min_free = free_before;
+
+    for (uint8_t cycle = 0; cycle < k_cycle_count; cycle++) {
+        for (uint8_t i = 0; i < k_endpoint_count; i++) {
+            create(instances[i]);
+            TEST_ASSERT_NOT_NULL(instances[i][0]);
+            TEST_ASSERT_NOT_NULL(instances[i][1]);
+            TEST_ASSERT_NOT_NULL(instances[i][2]);
+            long_lived[cycle * k_endpoint_count + i] = heap_caps_malloc(k_long_lived_size, MALLOC_CAP_8BIT);
+            TEST_ASSERT_NOT_NULL(long_lived[cycle * k_endpoint_count + i]);
+        }
+        size_t free_size = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+        min_free = free_size < min_free ? free_size : min_free;
+        for (uint8_t i = 0; i < k_endpoint_count; i++) {
+            release(instances[i]);
+        }
+    }
+
+    heap_usage_t usage = {free_before - min_free, heap_caps_get_largest_free_block(MALLOC_CAP_8BIT)};
+    for (uint16_t i = 0; i < k_cycle_count * k_endpoint_count; i++) {
+        heap_caps_free(long_lived[i]);
+    }
+    return usage;
+}
+
+TEST_CASE("pooled cluster server instances keep off the heap", "[instance_pool][benchmark]")
+{
+    heap_usage_t heap = churn_endpoints(
+        [](void *instances[3]) {
+            instances[0] = new mode_block;
+            instances[1] = new operational_state_block;
+            instances[2] = new microwave_oven_control_block;
+        },
+        [](void *instances[3]) {
+            delete static_cast<microwave_oven_control_block *>(instances[2]);
+            delete static_cast<operational_state_block *>(instances[1]);
+            delete static_cast<mode_block *>(instances[0]);
+        });
+
+    heap_usage_t pool = churn_endpoints(
+        [](void *instances[3]) {
+            instances[0] = s_mode_pool.CreateObject();
+            instances[1] = s_operational_state_pool.CreateObject();
+            instances[2] = s_microwave_oven_control_pool.CreateObject();
+        },
+        [](void *instances[3]) {
+            s_microwave_oven_control_pool.ReleaseObject(static_cast<microwave_oven_control_block *>(instances[2]));
+            s_operational_state_pool.ReleaseObject(static_cast<operational_state_block *>(instances[1]));
+            s_mode_pool.ReleaseObject(static_cast<mode_block *>(instances[0]));
+        });
+    TEST_ASSERT_EQUAL(0, s_mode_pool.Allocated());
+    TEST_ASSERT_EQUAL(0, s_operational_state_pool.Allocated());
+    TEST_ASSERT_EQUAL(0, s_microwave_oven_control_pool.Allocated());
+
+    size_t pool_static_size = sizeof(s_mode_pool) + sizeof(s_operational_state_pool) +
+        sizeof(s_microwave_oven_control_pool);
+    printf("%d microwave oven endpoints added and removed %d times: heap instances peak at %zu bytes of heap with the "
+           "largest free block at %zu bytes, pooled instances peak at %zu bytes of heap (%zu static) with the largest "
+           "free block at %zu bytes\n", k_endpoint_count, k_cycle_count, heap.peak_used, heap.largest_free_block,
+           pool.peak_used, pool_static_size, pool.largest_free_block);
+    /* The pooled instances only leave the long lived allocations on the heap */
+    TEST_ASSERT_LESS_THAN(heap.peak_used, pool.peak_used);
+}
@@ -0,0 +1,118 @@
+// Copyright 2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <esp_matter_measurement.h>
+#include <unity.h>
+
+namespace measurement = esp_matter::measurement;
+
+static constexpr int64_t k_us_per_ms = 1000;
+
+static measurement::config_t make_config(uint32_t deadband, uint32_t min_interval_ms, uint32_t max_interval_ms,
+                                         uint8_t average_count)
+{
+    measurement::config_t config = {};
+    config.type = ESP_MATTER_VAL_TYPE_INT16;
+    config.deadband = deadband;
+    config.min_interval_ms = min_interval_ms;
+    config.max_interval_ms = max_interval_ms;
+    config.average_count = average_count;
+    return config;
+}
+
+TEST_CASE("measurement filter publishes the first value and the changes beyond the deadband", "[measurement]")
+{
+    measurement::config_t config = make_config(50, 0, 0, 0);
+    measurement::filter::state_t state = {};
+    int64_t value = 0;
+
+    TEST_ASSERT_TRUE(measurement::filter::apply(&config, &state, 2000, 0, &value));
+    TEST_ASSERT_EQUAL(2000, value);
+    TEST_ASSERT_FALSE(measurement::filter::apply(&config, &state, 2049, 1 * k_us_per_ms, &value));
+    TEST_ASSERT_FALSE(measurement::filter::apply(&config, &state, 1951, 2 * k_us_per_ms, &value));
+    TEST_ASSERT_TRUE(measurement::filter::apply(&config, &state, 1950, 3 * k_us_per_ms, &value));
+    TEST_ASSERT_EQUAL(1950, value);
+    /* The deadband is measured from the last published value, not from the last sample */
+    TEST_ASSERT_FALSE(measurement::filter::apply(&config, &state, 1990, 4 * k_us_per_ms, &value));
+    TEST_ASSERT_TRUE(measurement::filter::apply(&config, &state, 2000, 5 * k_us_per_ms, &value));
+
+    /* A deadband of 0 publishes every change, but not a repeated value */
+    config.deadband = 0;
+    TEST_ASSERT_TRUE(measurement::filter::apply(&config, &state, 2001, 6 * k_us_per_ms, &value));
+    TEST_ASSERT_FALSE(measurement::filter::apply(&config, &state, 2001, 7 * k_us_per_ms, &value));
+}
+
+TEST_CASE("measurement filter drops the changes within the minimum interval", "[measurement]")
+{
+    measurement::config_t config = make_config(10, 1000, 0, 0);
+    measurement::filter::state_t state = {};
+    int64_t value = 0;
+
+    TEST_ASSERT_TRUE(measurement::filter::apply(&config, &state, 100, 0, &value));
+    TEST_ASSERT_FALSE(measurement::filter::apply(&config, &state, 200, 999 * k_us_per_ms, &value));
+    /* The first sample after the interval is compared again */
+    TEST_ASSERT_FALSE(measurement::filter::apply(&config, &state, 105, 1000 * k_us_per_ms, &value));
+    TEST_ASSERT_TRUE(measurement::filter::apply(&config, &state, 300, 1001 * k_us_per_ms, &value));
+    TEST_ASSERT_EQUAL(300, value);
+    /* The interval starts again from that publish */
+    TEST_ASSERT_FALSE(measurement::filter::apply(&config, &state, 400, 1500 * k_us_per_ms, &value));
+    TEST_ASSERT_TRUE(measurement::filter::apply(&config, &state, 400, 2001 * k_us_per_ms, &value));
+}
+
+TEST_CASE("measurement filter publishes the small changes after the maximum interval", "[measurement]")
+{
+    measurement::config_t config = make_config(50, 100, 5000, 0);
+    measurement::filter::state_t state = {};
+    int64_t value = 0;
+
+    TEST_ASSERT_TRUE(measurement::filter::apply(&config, &state, 1000, 0, &value));
+    TEST_ASSERT_FALSE(measurement::filter::apply(&config, &state, 1010, 4999 * k_us_per_ms, &value));
+    TEST_ASSERT_TRUE(measurement::filter::apply(&config, &state, 1010, 5000 * k_us_per_ms, &value));
+    TEST_ASSERT_EQUAL(1010, value);
+    /* An unchanged value is never published again */
+    TEST_ASSERT_FALSE(measurement::filter::apply(&config, &state, 1010, 20000 * k_us_per_ms, &value));
+
+    /* Without a maximum interval a small change is never published */
+    config.max_interval_ms = 0;
+    TEST_ASSERT_FALSE(measurement::filter::apply(&config, &state, 1020, 100000 * k_us_per_ms, &value));
+}
+
+TEST_CASE("measurement filter averages the samples before filtering", "[measurement]")
+{
+    measurement::config_t config = make_config(10, 0, 0, 4);
+    measurement::filter::state_t state = {};
+    int64_t value = 0;
+
+    TEST_ASSERT_FALSE(measurement::filter::apply(&config, &state, 100, 0, &value));
+    TEST_ASSERT_FALSE(measurement::filter::apply(&config, &state, 110, 1 * k_us_per_ms, &value));
+    TEST_ASSERT_FALSE(measurement::filter::apply(&config, &state, 120, 2 * k_us_per_ms, &value));
+    TEST_ASSERT_TRUE(measurement::filter::apply(&config, &state, 130, 3 * k_us_per_ms, &value));
+    TEST_ASSERT_EQUAL(115, value);
+    TEST_ASSERT_EQUAL(0, state.sample_count);
+
+    /* A single outlier moves the average by less than the deadband */
+    TEST_ASSERT_FALSE(measurement::filter::apply(&config, &state, 150, 4 * k_us_per_ms, &value));
+    TEST_ASSERT_FALSE(measurement::filter::apply(&config, &state, 115, 5 * k_us_per_ms, &value));
+    TEST_ASSERT_FALSE(measurement::filter::apply(&config, &state, 115, 6 * k_us_per_ms, &value));
+    TEST_ASSERT_FALSE(measurement::filter::apply(&config, &state, 115, 7 * k_us_per_ms, &value));
+    TEST_ASSERT_EQUAL(115, state.published_value);
+
+    /* Negative samples are averaged as well */
+    state = {};
+    for (int64_t sample : {-10, -20, -30}) {
+        TEST_ASSERT_FALSE(measurement::filter::apply(&config, &state, sample, 0, &value));
+    }
+    TEST_ASSERT_TRUE(measurement::filter::apply(&config, &state, -40, 0, &value));
+    TEST_ASSERT_EQUAL(-25, value);
+}
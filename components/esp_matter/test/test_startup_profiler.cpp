@@ -0,0 +1,86 @@
+// Copyright 2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <esp_matter_startup_profiler.h>
+#include <esp_rom_sys.h>
+#include <string.h>
+#include <unity.h>
+
+namespace startup_profiler = esp_matter::startup_profiler;
+
+TEST_CASE("startup profiler keeps the top-level phases when the ring wraps", "[startup_profiler]")
+{
+#if CONFIG_ESP_MATTER_STARTUP_PROFILER
+    startup_profiler::clear();
+    startup_profiler::add_record("esp_matter_start", startup_profiler::k_invalid_endpoint_id,
+                                 startup_profiler::k_invalid_cluster_id, 1000, 251000);
+    for (uint16_t i = 0; i < CONFIG_ESP_MATTER_STARTUP_PROFILER_RECORD_COUNT + 3; i++) {
+        startup_profiler::add_record("cluster_init", i, 0x0006, 2000 + i, 2010 + i);
+    }
+    startup_profiler::add_milestone("dnssd_initialized");
+
+    TEST_ASSERT_EQUAL(2 + CONFIG_ESP_MATTER_STARTUP_PROFILER_RECORD_COUNT, startup_profiler::get_record_count());
+    startup_profiler::record_t record;
+    TEST_ASSERT_EQUAL(ESP_OK, startup_profiler::find_record("esp_matter_start", &record));
+    TEST_ASSERT_EQUAL(250000, record.end_us - record.start_us);
+    TEST_ASSERT_EQUAL(ESP_OK, startup_profiler::find_record("dnssd_initialized", &record));
+    TEST_ASSERT_TRUE(record.start_us == record.end_us);
+
+    /* The first ring records were overwritten, the oldest one left is the 4th */
+    TEST_ASSERT_EQUAL(ESP_OK, startup_profiler::get_record(2, &record));
+    TEST_ASSERT_EQUAL(3, record.endpoint_id);
+    TEST_ASSERT_EQUAL(ESP_OK, startup_profiler::get_record(startup_profiler::get_record_count() - 1, &record));
+    TEST_ASSERT_EQUAL(CONFIG_ESP_MATTER_STARTUP_PROFILER_RECORD_COUNT + 2, record.endpoint_id);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, startup_profiler::get_record(startup_profiler::get_record_count(), &record));
+    TEST_ASSERT_EQUAL(ESP_ERR_NOT_FOUND, startup_profiler::find_record("server_init", &record));
+    startup_profiler::clear();
+#else
+    TEST_IGNORE_MESSAGE("Enable CONFIG_ESP_MATTER_STARTUP_PROFILER");
+#endif
+}
+
+TEST_CASE("startup profiler JSON can be checked against a budget", "[startup_profiler]")
+{
+#if CONFIG_ESP_MATTER_STARTUP_PROFILER
+    startup_profiler::clear();
+    {
+        startup_profiler::ScopedPhase phase("endpoint_enable", 1);
+        esp_rom_delay_us(2000);
+    }
+    startup_profiler::add_record("cluster_init", 1, 0x0008, 10, 30);
+
+    startup_profiler::record_t record;
+    TEST_ASSERT_EQUAL(ESP_OK, startup_profiler::find_record("endpoint_enable", &record));
+    TEST_ASSERT_EQUAL(1, record.endpoint_id);
+    TEST_ASSERT_EQUAL_HEX32(startup_profiler::k_invalid_cluster_id, record.cluster_id);
+    TEST_ASSERT_GREATER_OR_EQUAL(2000, record.end_us - record.start_us);
+
+    size_t len = startup_profiler::to_json(nullptr, 0);
+    char json[256];
+    TEST_ASSERT_LESS_THAN(sizeof(json), len);
+    TEST_ASSERT_EQUAL(len, startup_profiler::to_json(json, sizeof(json)));
+    TEST_ASSERT_EQUAL('[', json[0]);
+    TEST_ASSERT_EQUAL(']', json[len - 1]);
+    TEST_ASSERT_NOT_NULL(strstr(json, "{\"name\":\"cluster_init\",\"endpoint\":1,\"cluster\":8,\"start_us\":10,"
+                                      "\"duration_us\":20}"));
+
+    /* A short buffer is truncated and NUL terminated, the return value is still the full length */
+    char short_json[16];
+    TEST_ASSERT_EQUAL(len, startup_profiler::to_json(short_json, sizeof(short_json)));
+    TEST_ASSERT_EQUAL(sizeof(short_json) - 1, strlen(short_json));
+    startup_profiler::clear();
+#else
+    TEST_IGNORE_MESSAGE("Enable CONFIG_ESP_MATTER_STARTUP_PROFILER");
+#endif
+}
@@ -0,0 +1,96 @@
+// Copyright 2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <esp_cpu.h>
+#include <esp_matter_trace.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unity.h>
+
+#if CONFIG_ESP_MATTER_TRACE
+typedef struct {
+    char data[2048];
+    size_t len;
+} export_buffer_t;
+
+static void write_to_buffer(const char *data, size_t len, void *context)
+{
+    export_buffer_t *buffer = (export_buffer_t *)context;
+    if (buffer->len + len < sizeof(buffer->data)) {
+        memcpy(buffer->data + buffer->len, data, len);
+        buffer->len += len;
+        buffer->data[buffer->len] = '\0';
+    }
+}
+
+static uint32_t count_occurrences(const char *haystack, const char *needle)
+{
+    uint32_t count = 0;
+    for (const char *found = strstr(haystack, needle); found; found = strstr(found + 1, needle)) {
+        count++;
+    }
+    return count;
+}
+#endif // CONFIG_ESP_MATTER_TRACE
+
+TEST_CASE("trace export pairs the begin and end events", "[trace]")
+{
+#if CONFIG_ESP_MATTER_TRACE
+    esp_matter::trace::clear();
+    {
+        ESP_MATTER_TRACE_SCOPE(COMMAND_INVOKE, 1, 0x0006, 0x02);
+        ESP_MATTER_TRACE_BEGIN(ATTRIBUTE_SET_VAL, 1, 0x0006, 0x0000);
+        ESP_MATTER_TRACE_END(ATTRIBUTE_SET_VAL, 1, 0x0006, 0x0000);
+    }
+
+    static export_buffer_t buffer;
+    buffer.len = 0;
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter::trace::export_chrome_json(write_to_buffer, &buffer));
+    TEST_ASSERT_EQUAL(0, strncmp(buffer.data, "{\"traceEvents\":[{", strlen("{\"traceEvents\":[{")));
+    TEST_ASSERT_NOT_NULL(strstr(buffer.data, "],\"displayTimeUnit\":\"ms\"}"));
+    TEST_ASSERT_EQUAL(2, count_occurrences(buffer.data, "\"ph\":\"B\""));
+    TEST_ASSERT_EQUAL(2, count_occurrences(buffer.data, "\"ph\":\"E\""));
+    TEST_ASSERT_EQUAL(4, count_occurrences(buffer.data, "\"endpoint\":1,\"cluster\":6"));
+
+    esp_matter::trace::clear();
+    buffer.len = 0;
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter::trace::export_chrome_json(write_to_buffer, &buffer));
+    TEST_ASSERT_EQUAL_STRING("{\"traceEvents\":[],\"displayTimeUnit\":\"ms\"}", buffer.data);
+#else
+    TEST_ASSERT_EQUAL(ESP_ERR_NOT_SUPPORTED, esp_matter::trace::export_chrome_json([](const char *, size_t, void *) {},
+                                                                                   nullptr));
+#endif
+}
+
+TEST_CASE("trace point cycles per event", "[trace][benchmark]")
+{
+#if CONFIG_ESP_MATTER_TRACE
+    /* Begin/end pairs which fit in the ring of the core */
+    constexpr uint32_t k_pairs = CONFIG_ESP_MATTER_TRACE_EVENTS_PER_CORE / 2;
+    esp_matter::trace::clear();
+    uint32_t start = esp_cpu_get_cycle_count();
+    for (uint32_t i = 0; i < k_pairs; i++) {
+        ESP_MATTER_TRACE_BEGIN(ATTRIBUTE_READ, 1, 0x0006, i);
+        ESP_MATTER_TRACE_END(ATTRIBUTE_READ, 1, 0x0006, i);
+    }
+    uint32_t cycles_per_event = (esp_cpu_get_cycle_count() - start) / (2 * k_pairs);
+    esp_matter::trace::clear();
+
+    printf("%" PRIu32 " trace events: %" PRIu32 " cycles per event\n", 2 * k_pairs, cycles_per_event);
+    TEST_ASSERT_LESS_THAN_UINT32(500, cycles_per_event);
+#else
+    TEST_IGNORE_MESSAGE("Enable CONFIG_ESP_MATTER_TRACE, the trace points compile to nothing without it");
+#endif
+}
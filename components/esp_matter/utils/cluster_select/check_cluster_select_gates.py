@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+# Copyright 2025 Espressif Systems (Shanghai) PTE LTD
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Script to check the ESP_MATTER_CLUSTER_SELECTED gates of the esp_matter data model sources against
+esp_matter_cluster_select.h, please run this script after changing the gates or regenerating the header.
+
+A gate is checked for:
+- a macro for its namespace in esp_matter_cluster_select.h
+- a matching #endif comment
+- the namespace it opens first, which must be its own
+- the esp_matter code of other clusters it uses, which must be gated as well or always be selected with it
+"""
+
+import argparse
+import glob
+import os
+import re
+import sys
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_HEADER = os.path.join(SCRIPT_DIR, 'esp_matter_cluster_select.h')
+DEFAULT_SOURCES = os.path.join(SCRIPT_DIR, '..', '..', 'data_model', '*.cpp')
+
+GATE_RE = re.compile(r'^\s*#\s*if\s+ESP_MATTER_CLUSTER_SELECTED\((\w+)\)\s*$')
+ENDIF_COMMENT_RE = re.compile(r'^\s*#\s*endif\s*//\s*ESP_MATTER_CLUSTER_SELECTED\((\w+)\)')
+IF_RE = re.compile(r'^\s*#\s*if(n?def)?\b')
+ENDIF_RE = re.compile(r'^\s*#\s*endif\b')
+NAMESPACE_RE = re.compile(r'\bnamespace\s+(\w+)\s*\{')
+# A namespace used unqualified or from esp_matter::cluster, feature::on_off:: is a feature of the enclosing cluster
+REFERENCE_RE = re.compile(r'(?:(?<![:\w])|(?<=\bcluster::))(\w+)::')
+DEFINE_RE = re.compile(r'#define\s+ESP_MATTER_CLUSTER_SELECTED_(\w+)\s+\(([^)]*)\)')
+
+
+def load_selections(header):
+    """Map each namespace of the header to the set of options which select it"""
+    with open(header, 'r', encoding='utf-8') as file:
+        content = file.read().replace('\\\n', ' ')
+    return {namespace: set(re.findall(r'CONFIG_SUPPORT_\w+', options))
+            for namespace, options in DEFINE_RE.findall(content)}
+
+
+def is_implied(namespace, gates, selections):
+    """Whether the namespace is selected whenever all the enclosing gates are"""
+    options = selections[namespace]
+    return any(gate == namespace or (len(selections.get(gate, ())) == 1 and selections[gate] <= options)
+               for gate in gates)
+
+
+def strip_comments(line, in_block_comment):
+    code = ''
+    while line:
+        if in_block_comment:
+            end = line.find('*/')
+            if end < 0:
+                return code, True
+            line = line[end + 2:]
+            in_block_comment = False
+        else:
+            start = line.find('/*')
+            line_comment = line.find('//')
+            if line_comment >= 0 and (start < 0 or line_comment < start):
+                return code + line[:line_comment], False
+            if start < 0:
+                return code + line, False
+            code += line[:start]
+            line = line[start + 2:]
+            in_block_comment = True
+    return code, in_block_comment
+
+
+def check_source(source, selections):
+    errors = []
+    # Stack of the open #if blocks, the namespace for the ESP_MATTER_CLUSTER_SELECTED gates and None for the others
+    stack = []
+    # Gate whose first namespace is not opened yet
+    opening_gate = None
+    in_block_comment = False
+    name = os.path.basename(source)
+    with open(source, 'r', encoding='utf-8') as file:
+        lines = file.readlines()
+
+    for number, line in enumerate(lines, 1):
+        location = '{}:{}'.format(name, number)
+        gate = GATE_RE.match(line)
+        if gate:
+            namespace = gate.group(1)
+            if namespace not in selections:
+                errors.append('{}: no ESP_MATTER_CLUSTER_SELECTED_{} in the header'.format(location, namespace))
+            stack.append(namespace)
+            opening_gate = namespace
+            continue
+        if IF_RE.match(line):
+            stack.append(None)
+            continue
+        if ENDIF_RE.match(line):
+            if not stack:
+                errors.append('{}: #endif without #if'.format(location))
+                continue
+            closed = stack.pop()
+            comment = ENDIF_COMMENT_RE.match(line)
+            if comment and comment.group(1) != closed:
+                errors.append('{}: #endif of {} closes {}'.format(location, comment.group(1), closed))
+            continue
+
+        code, in_block_comment = strip_comments(line, in_block_comment)
+        gates = [gate for gate in stack if gate]
+        if not gates:
+            continue
+        namespaces = NAMESPACE_RE.findall(code)
+        if opening_gate and namespaces:
+            if namespaces[0] in selections and namespaces[0] != opening_gate:
+                errors.append('{}: namespace {} inside the gate of {}'.format(location, namespaces[0], opening_gate))
+            opening_gate = None
+        for namespace in REFERENCE_RE.findall(code):
+            if namespace in selections and not is_implied(namespace, gates, selections):
+                errors.append('{}: {}:: used inside the gate of {} only'.format(location, namespace, gates[-1]))
+
+    if stack:
+        errors.append('{}: {} unterminated #if'.format(name, len(stack)))
+    return errors
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--header', default=DEFAULT_HEADER, help='Path to esp_matter_cluster_select.h')
+    parser.add_argument('sources', nargs='*', help='Sources to check, defaults to the esp_matter data model sources')
+    args = parser.parse_args()
+
+    selections = load_selections(args.header)
+    sources = args.sources or sorted(glob.glob(DEFAULT_SOURCES))
+    errors = []
+    gated_sources = 0
+    for source in sources:
+        with open(source, 'r', encoding='utf-8') as file:
+            if 'ESP_MATTER_CLUSTER_SELECTED(' not in file.read():
+                continue
+        gated_sources += 1
+        errors.extend(check_source(source, selections))
+
+    for error in errors:
+        print(error)
+    print('Checked the cluster select gates of {} sources against {} namespaces, {} errors'.format(
+        gated_sources, len(selections), len(errors)))
+    return 1 if errors else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
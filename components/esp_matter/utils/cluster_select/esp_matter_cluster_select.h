@@ -0,0 +1,166 @@
+// This file is generated by generate_cluster_select_files.py
+// Please don't edit this file
+
+#pragma once
+
+#include "sdkconfig.h"
+
+// The esp_matter create, attribute, command, feature and event code of a cluster is built only if
+// ESP_MATTER_CLUSTER_SELECTED(<esp_matter namespace of the cluster>) is true, e.g.
+// #if ESP_MATTER_CLUSTER_SELECTED(on_off)
+#define ESP_MATTER_CLUSTER_SELECTED(name) (ESP_MATTER_CLUSTER_SELECTED_##name)
+
+#define ESP_MATTER_CLUSTER_SELECTED_access_control (CONFIG_SUPPORT_ACCESS_CONTROL_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_account_login (CONFIG_SUPPORT_ACCOUNT_LOGIN_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_actions (CONFIG_SUPPORT_ACTIONS_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_activated_carbon_filter_monitoring (CONFIG_SUPPORT_ACTIVATED_CARBON_FILTER_MONITORING_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_administrator_commissioning (CONFIG_SUPPORT_ADMINISTRATOR_COMMISSIONING_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_air_quality (CONFIG_SUPPORT_AIR_QUALITY_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_application_basic (CONFIG_SUPPORT_APPLICATION_BASIC_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_application_launcher (CONFIG_SUPPORT_APPLICATION_LAUNCHER_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_audio_output (CONFIG_SUPPORT_AUDIO_OUTPUT_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_basic_information (CONFIG_SUPPORT_BASIC_INFORMATION_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_binding (CONFIG_SUPPORT_BINDING_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_boolean_state (CONFIG_SUPPORT_BOOLEAN_STATE_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_boolean_state_configuration (CONFIG_SUPPORT_BOOLEAN_STATE_CONFIGURATION_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_bridged_device_basic_information (CONFIG_SUPPORT_BRIDGED_DEVICE_BASIC_INFORMATION_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_camera_av_settings_user_level_management (CONFIG_SUPPORT_CAMERA_AV_SETTINGS_USER_LEVEL_MANAGEMENT_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_camera_av_stream_management (CONFIG_SUPPORT_CAMERA_AV_STREAM_MANAGEMENT_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_carbon_dioxide_concentration_measurement (CONFIG_SUPPORT_CARBON_DIOXIDE_CONCENTRATION_MEASUREMENT_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_carbon_monoxide_concentration_measurement (CONFIG_SUPPORT_CARBON_MONOXIDE_CONCENTRATION_MEASUREMENT_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_channel (CONFIG_SUPPORT_CHANNEL_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_chime (CONFIG_SUPPORT_CHIME_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_closure_control (CONFIG_SUPPORT_CLOSURE_CONTROL_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_closure_dimension (CONFIG_SUPPORT_CLOSURE_DIMENSION_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_color_control (CONFIG_SUPPORT_COLOR_CONTROL_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_commissioner_control (CONFIG_SUPPORT_COMMISSIONER_CONTROL_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_commodity_metering (CONFIG_SUPPORT_COMMODITY_METERING_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_commodity_price (CONFIG_SUPPORT_COMMODITY_PRICE_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_commodity_tariff (CONFIG_SUPPORT_COMMODITY_TARIFF_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_content_launcher (CONFIG_SUPPORT_CONTENT_LAUNCHER_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_content_control (CONFIG_SUPPORT_CONTENT_CONTROL_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_content_app_observer (CONFIG_SUPPORT_CONTENT_APP_OBSERVER_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_descriptor (CONFIG_SUPPORT_DESCRIPTOR_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_device_energy_management (CONFIG_SUPPORT_DEVICE_ENERGY_MANAGEMENT_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_device_energy_management_mode (CONFIG_SUPPORT_DEVICE_ENERGY_MANAGEMENT_MODE_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_diagnostic_logs (CONFIG_SUPPORT_DIAGNOSTIC_LOGS_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_dish_washer_alarm (CONFIG_SUPPORT_DISHWASHER_ALARM_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_dish_washer_mode (CONFIG_SUPPORT_DISHWASHER_MODE_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_electrical_grid_conditions (CONFIG_SUPPORT_ELECTRICAL_GRID_CONDITIONS_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_groupcast (CONFIG_SUPPORT_GROUPCAST_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_meter_identification (CONFIG_SUPPORT_METER_IDENTIFICATION_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_microwave_oven_mode (CONFIG_SUPPORT_MICROWAVE_OVEN_MODE_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_door_lock (CONFIG_SUPPORT_DOOR_LOCK_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_ecosystem_information (CONFIG_SUPPORT_ECOSYSTEM_INFORMATION_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_electrical_energy_measurement (CONFIG_SUPPORT_ELECTRICAL_ENERGY_MEASUREMENT_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_electrical_power_measurement (CONFIG_SUPPORT_ELECTRICAL_POWER_MEASUREMENT_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_energy_evse (CONFIG_SUPPORT_ENERGY_EVSE_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_energy_evse_mode (CONFIG_SUPPORT_ENERGY_EVSE_MODE_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_ethernet_network_diagnostics (CONFIG_SUPPORT_ETHERNET_NETWORK_DIAGNOSTICS_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_energy_preference (CONFIG_SUPPORT_ENERGY_PREFERENCE_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_fan_control (CONFIG_SUPPORT_FAN_CONTROL_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_fault_injection (CONFIG_SUPPORT_FAULT_INJECTION_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_fixed_label (CONFIG_SUPPORT_FIXED_LABEL_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_formaldehyde_concentration_measurement (CONFIG_SUPPORT_FORMALDEHYDE_CONCENTRATION_MEASUREMENT_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_general_commissioning (CONFIG_SUPPORT_GENERAL_COMMISSIONING_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_general_diagnostics (CONFIG_SUPPORT_GENERAL_DIAGNOSTICS_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_groups (CONFIG_SUPPORT_GROUPS_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_hepa_filter_monitoring (CONFIG_SUPPORT_HEPA_FILTER_MONITORING_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_group_key_management (CONFIG_SUPPORT_GROUP_KEY_MANAGEMENT_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_icd_management (CONFIG_SUPPORT_ICD_MANAGEMENT_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_identify (CONFIG_SUPPORT_IDENTIFY_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_joint_fabric_datastore (CONFIG_SUPPORT_JOINT_FABRIC_DATASTORE_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_joint_fabric_administrator (CONFIG_SUPPORT_JOINT_FABRIC_ADMINISTRATOR_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_keypad_input (CONFIG_SUPPORT_KEYPAD_INPUT_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_laundry_washer_mode (CONFIG_SUPPORT_LAUNDRY_WASHER_MODE_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_level_control (CONFIG_SUPPORT_LEVEL_CONTROL_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_localization_configuration (CONFIG_SUPPORT_LOCALIZATION_CONFIGURATION_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_low_power (CONFIG_SUPPORT_LOW_POWER_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_media_input (CONFIG_SUPPORT_MEDIA_INPUT_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_media_playback (CONFIG_SUPPORT_MEDIA_PLAYBACK_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_microwave_oven_control (CONFIG_SUPPORT_MICROWAVE_OVEN_CONTROL_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_messages (CONFIG_SUPPORT_MESSAGES_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_mode_select (CONFIG_SUPPORT_MODE_SELECT_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_network_commissioning (CONFIG_SUPPORT_NETWORK_COMMISSIONING_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_nitrogen_dioxide_concentration_measurement (CONFIG_SUPPORT_NITROGEN_DIOXIDE_CONCENTRATION_MEASUREMENT_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_push_av_stream_transport (CONFIG_SUPPORT_PUSH_AV_STREAM_TRANSPORT_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_sample_mei (CONFIG_SUPPORT_SAMPLE_MEI_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_occupancy_sensing (CONFIG_SUPPORT_OCCUPANCY_SENSING_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_on_off (CONFIG_SUPPORT_ON_OFF_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_power_topology (CONFIG_SUPPORT_POWER_TOPOLOGY_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_operational_credentials (CONFIG_SUPPORT_OPERATIONAL_CREDENTIALS_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_operational_state (CONFIG_SUPPORT_OPERATIONAL_STATE_CLUSTER || CONFIG_SUPPORT_OPERATIONAL_STATE_RVC_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_operational_state_oven (CONFIG_SUPPORT_OPERATIONAL_STATE_OVEN_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_rvc_operational_state (CONFIG_SUPPORT_OPERATIONAL_STATE_RVC_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_ota_software_update_provider (CONFIG_SUPPORT_OTA_SOFTWARE_UPDATE_PROVIDER_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_ota_software_update_requestor (CONFIG_SUPPORT_OTA_SOFTWARE_UPDATE_REQUESTOR_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_oven_mode (CONFIG_SUPPORT_OVEN_MODE_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_ozone_concentration_measurement (CONFIG_SUPPORT_OZONE_CONCENTRATION_MEASUREMENT_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_pm10_concentration_measurement (CONFIG_SUPPORT_PM10_CONCENTRATION_MEASUREMENT_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_pm1_concentration_measurement (CONFIG_SUPPORT_PM1_CONCENTRATION_MEASUREMENT_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_pm25_concentration_measurement (CONFIG_SUPPORT_PM2_5_CONCENTRATION_MEASUREMENT_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_power_source (CONFIG_SUPPORT_POWER_SOURCE_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_power_source_configuration (CONFIG_SUPPORT_POWER_SOURCE_CONFIGURATION_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_pump_configuration_and_control (CONFIG_SUPPORT_PUMP_CONFIGURATION_AND_CONTROL_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_radon_concentration_measurement (CONFIG_SUPPORT_RADON_CONCENTRATION_MEASUREMENT_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_refrigerator_alarm (CONFIG_SUPPORT_REFRIGERATOR_ALARM_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_refrigerator_and_tcc_mode (CONFIG_SUPPORT_REFRIGERATOR_AND_TEMPERATURE_CONTROLLED_CABINET_MODE_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_rvc_clean_mode (CONFIG_SUPPORT_RVC_CLEAN_MODE_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_rvc_run_mode (CONFIG_SUPPORT_RVC_RUN_MODE_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_scenes_management (CONFIG_SUPPORT_SCENES_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_service_area (CONFIG_SUPPORT_SERVICE_AREA_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_smoke_co_alarm (CONFIG_SUPPORT_SMOKE_CO_ALARM_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_software_diagnostics (CONFIG_SUPPORT_SOFTWARE_DIAGNOSTICS_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_soil_measurement (CONFIG_SUPPORT_SOIL_MEASUREMENT_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_switch_cluster (CONFIG_SUPPORT_SWITCH_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_target_navigator (CONFIG_SUPPORT_TARGET_NAVIGATOR_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_temperature_control (CONFIG_SUPPORT_TEMPERATURE_CONTROL_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_thermostat (CONFIG_SUPPORT_THERMOSTAT_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_thermostat_user_interface_configuration (CONFIG_SUPPORT_THERMOSTAT_USER_INTERFACE_CONFIGURATION_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_thread_border_router_management (CONFIG_SUPPORT_THREAD_BORDER_ROUTER_MANAGEMENT_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_thread_network_diagnostics (CONFIG_SUPPORT_THREAD_NETWORK_DIAGNOSTICS_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_thread_network_directory (CONFIG_SUPPORT_THREAD_NETWORK_DIRECTORY_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_time_format_localization (CONFIG_SUPPORT_TIME_FORMAT_LOCALIZATION_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_time_synchronization (CONFIG_SUPPORT_TIME_SYNCHRONIZATION_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_timer (CONFIG_SUPPORT_TIMER_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_tls_certificate_management (CONFIG_SUPPORT_TLS_CERTIFICATE_MANAGEMENT_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_tls_client_management (CONFIG_SUPPORT_TLS_CLIENT_MANAGEMENT_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_total_volatile_organic_compounds_concentration_measurement (CONFIG_SUPPORT_TVOC_CONCENTRATION_MEASUREMENT_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_unit_localization (CONFIG_SUPPORT_UNIT_LOCALIZATION_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_unit_testing (CONFIG_SUPPORT_UNIT_TESTING_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_user_label (CONFIG_SUPPORT_USER_LABEL_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_valve_configuration_and_control (CONFIG_SUPPORT_VALVE_CONFIGURATION_AND_CONTROL_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_wake_on_lan (CONFIG_SUPPORT_WAKE_ON_LAN_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_laundry_washer_controls (CONFIG_SUPPORT_LAUNDRY_WASHER_CONTROLS_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_laundry_dryer_controls (CONFIG_SUPPORT_LAUNDRY_DRYER_CONTROLS_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_webrtc_transport_provider (CONFIG_SUPPORT_WEB_RTC_TRANSPORT_PROVIDER_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_webrtc_transport_requestor (CONFIG_SUPPORT_WEB_RTC_TRANSPORT_REQUESTOR_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_wifi_network_diagnostics (CONFIG_SUPPORT_WIFI_NETWORK_DIAGNOSTICS_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_wifi_network_management (CONFIG_SUPPORT_WIFI_NETWORK_MANAGEMENT_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_window_covering (CONFIG_SUPPORT_WINDOW_COVERING_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_water_heater_management (CONFIG_SUPPORT_WATER_HEATER_MANAGEMENT_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_water_heater_mode (CONFIG_SUPPORT_WATER_HEATER_MODE_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_zone_management (CONFIG_SUPPORT_ZONE_MANAGEMENT_CLUSTER)
+
+#define ESP_MATTER_CLUSTER_SELECTED_concentration_measurement (CONFIG_SUPPORT_CARBON_DIOXIDE_CONCENTRATION_MEASUREMENT_CLUSTER || \
+    CONFIG_SUPPORT_CARBON_MONOXIDE_CONCENTRATION_MEASUREMENT_CLUSTER || \
+    CONFIG_SUPPORT_FORMALDEHYDE_CONCENTRATION_MEASUREMENT_CLUSTER || \
+    CONFIG_SUPPORT_NITROGEN_DIOXIDE_CONCENTRATION_MEASUREMENT_CLUSTER || \
+    CONFIG_SUPPORT_OZONE_CONCENTRATION_MEASUREMENT_CLUSTER || \
+    CONFIG_SUPPORT_PM10_CONCENTRATION_MEASUREMENT_CLUSTER || \
+    CONFIG_SUPPORT_PM1_CONCENTRATION_MEASUREMENT_CLUSTER || \
+    CONFIG_SUPPORT_PM2_5_CONCENTRATION_MEASUREMENT_CLUSTER || \
+    CONFIG_SUPPORT_RADON_CONCENTRATION_MEASUREMENT_CLUSTER || \
+    CONFIG_SUPPORT_TVOC_CONCENTRATION_MEASUREMENT_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_mode_base (CONFIG_SUPPORT_DEVICE_ENERGY_MANAGEMENT_MODE_CLUSTER || \
+    CONFIG_SUPPORT_DISHWASHER_MODE_CLUSTER || \
+    CONFIG_SUPPORT_MICROWAVE_OVEN_MODE_CLUSTER || \
+    CONFIG_SUPPORT_ENERGY_EVSE_MODE_CLUSTER || \
+    CONFIG_SUPPORT_LAUNDRY_WASHER_MODE_CLUSTER || \
+    CONFIG_SUPPORT_OVEN_MODE_CLUSTER || \
+    CONFIG_SUPPORT_REFRIGERATOR_AND_TEMPERATURE_CONTROLLED_CABINET_MODE_CLUSTER || \
+    CONFIG_SUPPORT_RVC_CLEAN_MODE_CLUSTER || \
+    CONFIG_SUPPORT_RVC_RUN_MODE_CLUSTER || \
+    CONFIG_SUPPORT_WATER_HEATER_MODE_CLUSTER)
+#define ESP_MATTER_CLUSTER_SELECTED_resource_monitoring (CONFIG_SUPPORT_ACTIVATED_CARBON_FILTER_MONITORING_CLUSTER || \
+    CONFIG_SUPPORT_HEPA_FILTER_MONITORING_CLUSTER)
@@ -32,10 +32,10 @@ if not os.getenv('ESP_MATTER_PATH'):
 BASE_PATH = os.getenv('ESP_MATTER_PATH')
 
 
-def write_file_header(file):
+def write_file_header(file, comment='#'):
     file.writelines(
-        ['# This file is generated by {}\n'.format(os.path.basename(__file__)),
-         '# Please don\'t edit this file\n'
+        ['{} This file is generated by {}\n'.format(comment, os.path.basename(__file__)),
+         '{} Please don\'t edit this file\n'.format(comment),
          '\n'])
 
 
@@ -54,6 +54,38 @@ OPENTHREAD_CLUSTERS = {
 }
 
 
+# esp_matter namespaces of the clusters whose namespace is not the lower case cluster name
+ESP_MATTER_NAMESPACES = {
+    'DISHWASHER_ALARM_CLUSTER': 'dish_washer_alarm',
+    'DISHWASHER_MODE_CLUSTER': 'dish_washer_mode',
+    'OPERATIONAL_STATE_RVC_CLUSTER': 'rvc_operational_state',
+    'PM2_5_CONCENTRATION_MEASUREMENT_CLUSTER': 'pm25_concentration_measurement',
+    'REFRIGERATOR_AND_TEMPERATURE_CONTROLLED_CABINET_MODE_CLUSTER': 'refrigerator_and_tcc_mode',
+    'SCENES_CLUSTER': 'scenes_management',
+    'SWITCH_CLUSTER': 'switch_cluster',
+    'TVOC_CONCENTRATION_MEASUREMENT_CLUSTER': 'total_volatile_organic_compounds_concentration_measurement',
+    'WEB_RTC_TRANSPORT_PROVIDER_CLUSTER': 'webrtc_transport_provider',
+    'WEB_RTC_TRANSPORT_REQUESTOR_CLUSTER': 'webrtc_transport_requestor',
+}
+
+# esp_matter namespaces shared by several clusters, built if any of these clusters is supported
+ESP_MATTER_SHARED_NAMESPACES = {
+    'concentration_measurement': lambda cluster: cluster.endswith('_CONCENTRATION_MEASUREMENT_CLUSTER'),
+    'mode_base': lambda cluster: cluster.endswith('_MODE_CLUSTER'),
+    'resource_monitoring': lambda cluster: cluster.endswith('_FILTER_MONITORING_CLUSTER'),
+}
+
+# esp_matter namespaces also used by the code of other clusters, built if any of these clusters is supported
+ESP_MATTER_REUSED_NAMESPACES = {
+    # rvc_operational_state creates the attributes and the events of operational_state
+    'OPERATIONAL_STATE_CLUSTER': ['OPERATIONAL_STATE_RVC_CLUSTER'],
+}
+
+
+def get_esp_matter_namespace(cluster):
+    return ESP_MATTER_NAMESPACES.get(cluster, cluster[:-len('_CLUSTER')].lower())
+
+
 def generate_cluster_select_kconfig(cluster_list, output_dir):
     with open(os.path.join(output_dir, 'Kconfig.in'), 'w') as kconfig_file:
         write_file_header(kconfig_file)
@@ -83,6 +115,30 @@ def generate_cluster_select_cmake(cluster_list, output_dir):
         cmake_file.write('endfunction()')
 
 
+def generate_cluster_select_header(cluster_list, output_dir):
+    with open(os.path.join(output_dir, 'esp_matter_cluster_select.h'), 'w') as header_file:
+        write_file_header(header_file, '//')
+        header_file.writelines([
+            '#pragma once\n',
+            '\n',
+            '#include "sdkconfig.h"\n',
+            '\n',
+            '// The esp_matter create, attribute, command, feature and event code of a cluster is built only if\n',
+            '// ESP_MATTER_CLUSTER_SELECTED(<esp_matter namespace of the cluster>) is true, e.g.\n',
+            '// #if ESP_MATTER_CLUSTER_SELECTED(on_off)\n',
+            '#define ESP_MATTER_CLUSTER_SELECTED(name) (ESP_MATTER_CLUSTER_SELECTED_##name)\n',
+            '\n'])
+        for cluster in cluster_list.keys():
+            users = [cluster] + [user for user in ESP_MATTER_REUSED_NAMESPACES.get(cluster, []) if user in cluster_list]
+            header_file.write('#define ESP_MATTER_CLUSTER_SELECTED_{} ({})\n'.format(
+                get_esp_matter_namespace(cluster), ' || '.join('CONFIG_SUPPORT_{}'.format(user) for user in users)))
+        header_file.write('\n')
+        for namespace, is_member in ESP_MATTER_SHARED_NAMESPACES.items():
+            members = ['CONFIG_SUPPORT_{}'.format(cluster) for cluster in cluster_list.keys() if is_member(cluster)]
+            header_file.write('#define ESP_MATTER_CLUSTER_SELECTED_{} ({})\n'.format(
+                namespace, ' || \\\n    '.join(members)))
+
+
 def main():
     parser = argparse.ArgumentParser()
     parser.add_argument('--cluster-implementation-data',
@@ -100,6 +156,7 @@ def main():
     cluster_list = load_json(args.cluster_implementation_data)
     generate_cluster_select_kconfig(cluster_list, args.output_dir)
     generate_cluster_select_cmake(cluster_list, args.output_dir)
+    generate_cluster_select_header(cluster_list, args.output_dir)
 
 
 if __name__ == "__main__":
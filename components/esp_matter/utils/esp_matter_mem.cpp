@@ -15,6 +15,7 @@
 #include "esp_attr.h"
 #include "esp_heap_caps.h"
 #include "esp_matter_mem.h"
+#include "freertos/FreeRTOS.h"
 
 IRAM_ATTR void *esp_matter_mem_calloc(size_t n, size_t size)
 {
@@ -46,3 +47,103 @@ IRAM_ATTR void esp_matter_mem_free(void *ptr)
 {
     free(ptr);
 }
+
+#if CONFIG_ESP_MATTER_MEM_STATS
+static esp_matter_mem_stats_t s_total_stats;
+// Allocations are made from the Matter task, the application tasks and the bridge tasks
+static portMUX_TYPE s_stats_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static void stats_add(esp_matter_mem_stats_t *stats, esp_matter_mem_category_t category, size_t size)
+{
+    stats->live[category] += size;
+    if (stats->live[category] > stats->peak[category]) {
+        stats->peak[category] = stats->live[category];
+    }
+}
+
+static void stats_sub(esp_matter_mem_stats_t *stats, esp_matter_mem_category_t category, size_t size)
+{
+    stats->live[category] = stats->live[category] > size ? stats->live[category] - size : 0;
+}
+#endif // CONFIG_ESP_MATTER_MEM_STATS
+
+void esp_matter_mem_stats_add(esp_matter_mem_stats_t *stats, esp_matter_mem_category_t category, size_t size)
+{
+#if CONFIG_ESP_MATTER_MEM_STATS
+    if (category >= ESP_MATTER_MEM_CATEGORY_MAX || size == 0) {
+        return;
+    }
+    taskENTER_CRITICAL(&s_stats_lock);
+    stats_add(&s_total_stats, category, size);
+    if (stats) {
+        stats_add(stats, category, size);
+    }
+    taskEXIT_CRITICAL(&s_stats_lock);
+#endif
+}
+
+void esp_matter_mem_stats_sub(esp_matter_mem_stats_t *stats, esp_matter_mem_category_t category, size_t size)
+{
+#if CONFIG_ESP_MATTER_MEM_STATS
+    if (category >= ESP_MATTER_MEM_CATEGORY_MAX || size == 0) {
+        return;
+    }
+    taskENTER_CRITICAL(&s_stats_lock);
+    stats_sub(&s_total_stats, category, size);
+    if (stats) {
+        stats_sub(stats, category, size);
+    }
+    taskEXIT_CRITICAL(&s_stats_lock);
+#endif
+}
+
+void *esp_matter_mem_calloc_tagged(esp_matter_mem_stats_t *stats, esp_matter_mem_category_t category, size_t n,
+                                   size_t size)
+{
+    void *ptr = esp_matter_mem_calloc(n, size);
+    if (ptr) {
+        esp_matter_mem_stats_add(stats, category, n * size);
+    }
+    return ptr;
+}
+
+void esp_matter_mem_free_tagged(esp_matter_mem_stats_t *stats, esp_matter_mem_category_t category, void *ptr,
+                                size_t size)
+{
+    if (ptr) {
+        esp_matter_mem_stats_sub(stats, category, size);
+    }
+    esp_matter_mem_free(ptr);
+}
+
+const esp_matter_mem_stats_t *esp_matter_mem_get_total_stats()
+{
+#if CONFIG_ESP_MATTER_MEM_STATS
+    return &s_total_stats;
+#else
+    return NULL;
+#endif
+}
+
+const char *esp_matter_mem_category_name(esp_matter_mem_category_t category)
+{
+    switch (category) {
+    case ESP_MATTER_MEM_CATEGORY_ENDPOINT:
+        return "endpoint";
+    case ESP_MATTER_MEM_CATEGORY_CLUSTER:
+        return "cluster";
+    case ESP_MATTER_MEM_CATEGORY_ATTRIBUTE:
+        return "attribute";
+    case ESP_MATTER_MEM_CATEGORY_ATTRIBUTE_VALUE:
+        return "attr_value";
+    case ESP_MATTER_MEM_CATEGORY_BOUNDS:
+        return "bounds";
+    case ESP_MATTER_MEM_CATEGORY_COMMAND:
+        return "command";
+    case ESP_MATTER_MEM_CATEGORY_EVENT:
+        return "event";
+    default:
+        break;
+    }
+    return "unknown";
+}
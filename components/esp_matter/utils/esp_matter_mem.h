@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <stddef.h>
+
 /** ESP Matter Memory Allocations
  * @param[in] n number of elements to be allocated
  * @param[in] size size of elements to be allocated
@@ -30,3 +32,62 @@ void esp_matter_mem_free(void *ptr);
  * @param[in] size size to reallocate
  */
 void *esp_matter_mem_realloc(void *ptr, size_t size);
+
+/** Categories of the memory accounted with CONFIG_ESP_MATTER_MEM_STATS */
+typedef enum esp_matter_mem_category {
+    ESP_MATTER_MEM_CATEGORY_ENDPOINT = 0,
+    ESP_MATTER_MEM_CATEGORY_CLUSTER,
+    ESP_MATTER_MEM_CATEGORY_ATTRIBUTE,
+    ESP_MATTER_MEM_CATEGORY_ATTRIBUTE_VALUE,
+    ESP_MATTER_MEM_CATEGORY_BOUNDS,
+    ESP_MATTER_MEM_CATEGORY_COMMAND,
+    ESP_MATTER_MEM_CATEGORY_EVENT,
+    ESP_MATTER_MEM_CATEGORY_MAX,
+} esp_matter_mem_category_t;
+
+/** Live and peak bytes per category */
+typedef struct esp_matter_mem_stats {
+    size_t live[ESP_MATTER_MEM_CATEGORY_MAX];
+    size_t peak[ESP_MATTER_MEM_CATEGORY_MAX];
+} esp_matter_mem_stats_t;
+
+/** ESP Matter tagged memory allocation
+ *
+ * Same as esp_matter_mem_calloc(), the allocated bytes are also accounted to the category in `stats` and in the
+ * total stats when CONFIG_ESP_MATTER_MEM_STATS is enabled.
+ *
+ * @param[in] stats stats of the owner of the allocation, can be NULL to only account in the total stats
+ * @param[in] category category of the allocation
+ * @param[in] n number of elements to be allocated
+ * @param[in] size size of elements to be allocated
+ */
+void *esp_matter_mem_calloc_tagged(esp_matter_mem_stats_t *stats, esp_matter_mem_category_t category, size_t n,
+                                   size_t size);
+
+/** ESP Matter tagged free memory
+ *
+ * @param[in] stats stats which the allocation was accounted to
+ * @param[in] category category which the allocation was accounted to
+ * @param[in] ptr pointer to the memory to be freed
+ * @param[in] size size which was allocated, i.e. n * size passed to esp_matter_mem_calloc_tagged()
+ */
+void esp_matter_mem_free_tagged(esp_matter_mem_stats_t *stats, esp_matter_mem_category_t category, void *ptr,
+                                size_t size);
+
+/** Account an allocation which was done with esp_matter_mem_calloc() somewhere else and handed over to the owner of
+ *  `stats`. Does nothing if CONFIG_ESP_MATTER_MEM_STATS is not enabled.
+ */
+void esp_matter_mem_stats_add(esp_matter_mem_stats_t *stats, esp_matter_mem_category_t category, size_t size);
+
+/** Remove an allocation from the accounting. Does nothing if CONFIG_ESP_MATTER_MEM_STATS is not enabled. */
+void esp_matter_mem_stats_sub(esp_matter_mem_stats_t *stats, esp_matter_mem_category_t category, size_t size);
+
+/** Get the total stats of all the tagged allocations
+ *
+ * @return stats on success.
+ * @return NULL if CONFIG_ESP_MATTER_MEM_STATS is not enabled.
+ */
+const esp_matter_mem_stats_t *esp_matter_mem_get_total_stats();
+
+/** Get the name of the category, for logging */
+const char *esp_matter_mem_category_name(esp_matter_mem_category_t category);
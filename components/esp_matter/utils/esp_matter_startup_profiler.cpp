@@ -0,0 +1,196 @@
+// Copyright 2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <esp_matter_startup_profiler.h>
+
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+namespace esp_matter {
+namespace startup_profiler {
+
+#if CONFIG_ESP_MATTER_STARTUP_PROFILER
+/* The top-level phases, i.e. the records without an endpoint or a cluster, are kept in fixed slots so that the
+ * per-endpoint and per-cluster records do not evict them from the ring. */
+static constexpr size_t k_phase_record_count = 16;
+static record_t s_phase_records[k_phase_record_count];
+static size_t s_phase_count = 0;
+static record_t s_records[CONFIG_ESP_MATTER_STARTUP_PROFILER_RECORD_COUNT];
+/* Index where the next record is written and number of valid records */
+static size_t s_head = 0;
+static size_t s_count = 0;
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+
+void add_record(const char *name, uint16_t endpoint_id, uint32_t cluster_id, int64_t start_us, int64_t end_us)
+{
+    portENTER_CRITICAL(&s_lock);
+    record_t *record = nullptr;
+    if (endpoint_id == k_invalid_endpoint_id && cluster_id == k_invalid_cluster_id &&
+        s_phase_count < k_phase_record_count) {
+        record = &s_phase_records[s_phase_count++];
+    } else {
+        record = &s_records[s_head];
+        s_head = (s_head + 1) % CONFIG_ESP_MATTER_STARTUP_PROFILER_RECORD_COUNT;
+        if (s_count < CONFIG_ESP_MATTER_STARTUP_PROFILER_RECORD_COUNT) {
+            s_count++;
+        }
+    }
+    record->name = name;
+    record->endpoint_id = endpoint_id;
+    record->cluster_id = cluster_id;
+    record->start_us = start_us;
+    record->end_us = end_us;
+    portEXIT_CRITICAL(&s_lock);
+}
+
+void add_milestone(const char *name)
+{
+    int64_t now_us = esp_timer_get_time();
+    add_record(name, k_invalid_endpoint_id, k_invalid_cluster_id, now_us, now_us);
+}
+
+size_t get_record_count()
+{
+    return s_phase_count + s_count;
+}
+
+esp_err_t get_record(size_t index, record_t *out_record)
+{
+    if (!out_record) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_err_t err = ESP_ERR_INVALID_ARG;
+    portENTER_CRITICAL(&s_lock);
+    if (index < s_phase_count) {
+        *out_record = s_phase_records[index];
+        err = ESP_OK;
+    } else if (index - s_phase_count < s_count) {
+        size_t oldest = (s_head + CONFIG_ESP_MATTER_STARTUP_PROFILER_RECORD_COUNT - s_count) %
+                        CONFIG_ESP_MATTER_STARTUP_PROFILER_RECORD_COUNT;
+        *out_record = s_records[(oldest + index - s_phase_count) % CONFIG_ESP_MATTER_STARTUP_PROFILER_RECORD_COUNT];
+        err = ESP_OK;
+    }
+    portEXIT_CRITICAL(&s_lock);
+    return err;
+}
+
+void clear()
+{
+    portENTER_CRITICAL(&s_lock);
+    s_phase_count = 0;
+    s_head = 0;
+    s_count = 0;
+    portEXIT_CRITICAL(&s_lock);
+}
+
+ScopedPhase::ScopedPhase(const char *name, uint16_t endpoint_id, uint32_t cluster_id)
+    : m_name(name), m_endpoint_id(endpoint_id), m_cluster_id(cluster_id), m_start_us(esp_timer_get_time())
+{
+}
+
+ScopedPhase::~ScopedPhase()
+{
+    add_record(m_name, m_endpoint_id, m_cluster_id, m_start_us, esp_timer_get_time());
+}
+#else
+void add_record(const char *name, uint16_t endpoint_id, uint32_t cluster_id, int64_t start_us, int64_t end_us)
+{
+}
+
+size_t get_record_count()
+{
+    return 0;
+}
+
+esp_err_t get_record(size_t index, record_t *out_record)
+{
+    return ESP_ERR_INVALID_ARG;
+}
+
+void clear()
+{
+}
+
+void add_milestone(const char *name)
+{
+}
+#endif // CONFIG_ESP_MATTER_STARTUP_PROFILER
+
+esp_err_t find_record(const char *name, record_t *out_record)
+{
+    if (!name || !out_record) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    for (size_t i = 0; get_record(i, out_record) == ESP_OK; i++) {
+        if (strcmp(out_record->name, name) == 0) {
+            return ESP_OK;
+        }
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+void dump()
+{
+    record_t record;
+    printf("%-28s %-8s %-10s %12s %12s\n", "Phase", "Endpoint", "Cluster", "Start(us)", "Duration(us)");
+    for (size_t i = 0; get_record(i, &record) == ESP_OK; i++) {
+        char endpoint_str[8] = "-";
+        char cluster_str[12] = "-";
+        if (record.endpoint_id != k_invalid_endpoint_id) {
+            snprintf(endpoint_str, sizeof(endpoint_str), "0x%04" PRIX16, record.endpoint_id);
+        }
+        if (record.cluster_id != k_invalid_cluster_id) {
+            snprintf(cluster_str, sizeof(cluster_str), "0x%08" PRIX32, record.cluster_id);
+        }
+        printf("%-28s %-8s %-10s %12" PRId64 " %12" PRId64 "\n", record.name, endpoint_str, cluster_str,
+               record.start_us, record.end_us - record.start_us);
+    }
+}
+
+size_t to_json(char *buf, size_t buf_len)
+{
+    size_t len = 0;
+    record_t record;
+    /* Keep counting the length once the buffer is full, like snprintf() */
+    auto append = [&](int written) {
+        if (written > 0) {
+            len += written;
+        }
+    };
+    auto remaining = [&]() -> size_t {
+        return (buf && len < buf_len) ? buf_len - len : 0;
+    };
+    auto position = [&]() -> char * {
+        return (buf && len < buf_len) ? buf + len : nullptr;
+    };
+
+    append(snprintf(position(), remaining(), "["));
+    for (size_t i = 0; get_record(i, &record) == ESP_OK; i++) {
+        append(snprintf(position(), remaining(),
+                        "%s{\"name\":\"%s\",\"endpoint\":%d,\"cluster\":%" PRId64 ",\"start_us\":%" PRId64
+                        ",\"duration_us\":%" PRId64 "}",
+                        i == 0 ? "" : ",", record.name,
+                        record.endpoint_id == k_invalid_endpoint_id ? -1 : record.endpoint_id,
+                        record.cluster_id == k_invalid_cluster_id ? (int64_t)-1 : (int64_t)record.cluster_id,
+                        record.start_us, record.end_us - record.start_us));
+    }
+    append(snprintf(position(), remaining(), "]"));
+    return len;
+}
+
+} // namespace startup_profiler
+} // namespace esp_matter
@@ -0,0 +1,118 @@
+// Copyright 2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <esp_err.h>
+#include <sdkconfig.h>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace esp_matter {
+namespace startup_profiler {
+
+/** Endpoint or cluster ID of a record which is not specific to an endpoint or a cluster */
+constexpr uint16_t k_invalid_endpoint_id = 0xFFFF;
+constexpr uint32_t k_invalid_cluster_id = 0xFFFFFFFF;
+
+/** One startup phase
+ *
+ * The times are in microseconds since boot, `start_us` and `end_us` are the same for a milestone.
+ */
+typedef struct record {
+    const char *name;
+    uint16_t endpoint_id;
+    uint32_t cluster_id;
+    int64_t start_us;
+    int64_t end_us;
+} record_t;
+
+/** Add a record
+ *
+ * The first top-level records, i.e. with both k_invalid_endpoint_id and k_invalid_cluster_id, are kept in fixed
+ * slots which are never overwritten. The other records are kept in a ring of
+ * CONFIG_ESP_MATTER_STARTUP_PROFILER_RECORD_COUNT entries, the oldest record is overwritten when the ring is full.
+ * Does nothing if CONFIG_ESP_MATTER_STARTUP_PROFILER is not enabled.
+ *
+ * @param[in] name Name of the phase, must be a string literal as only the pointer is stored.
+ * @param[in] endpoint_id Endpoint ID or k_invalid_endpoint_id.
+ * @param[in] cluster_id Cluster ID or k_invalid_cluster_id.
+ * @param[in] start_us Start time of the phase.
+ * @param[in] end_us End time of the phase.
+ */
+void add_record(const char *name, uint16_t endpoint_id, uint32_t cluster_id, int64_t start_us, int64_t end_us);
+
+/** Add a milestone, i.e. a record with the current time as start and end time */
+void add_milestone(const char *name);
+
+/** Get the number of records */
+size_t get_record_count();
+
+/** Get a record
+ *
+ * @param[in] index Index of the record. The top-level records in the fixed slots come first, followed by the records
+ *                  in the ring from the oldest.
+ * @param[out] out_record Record.
+ *
+ * @return ESP_OK on success.
+ * @return ESP_ERR_INVALID_ARG if the index is out of range or out_record is NULL.
+ */
+esp_err_t get_record(size_t index, record_t *out_record);
+
+/** Get the first record with the given name
+ *
+ * This can be used to check the duration of a phase against a budget, for example "esp_matter_start".
+ *
+ * @return ESP_OK on success.
+ * @return ESP_ERR_NOT_FOUND if there is no record with the name.
+ */
+esp_err_t find_record(const char *name, record_t *out_record);
+
+/** Remove all the records */
+void clear();
+
+/** Print the records in a human readable table */
+void dump();
+
+/** Write the records as a JSON array of objects {"name", "endpoint", "cluster", "start_us", "duration_us"}
+ *
+ * @param[out] buf Output buffer, can be NULL to get the required size.
+ * @param[in] buf_len Length of the output buffer.
+ *
+ * @return The length of the JSON string without the NUL terminator, like snprintf(). The output is truncated when
+ *         the return value is not less than buf_len.
+ */
+size_t to_json(char *buf, size_t buf_len);
+
+/** Record the lifetime of the object as a phase */
+class ScopedPhase {
+public:
+#if CONFIG_ESP_MATTER_STARTUP_PROFILER
+    ScopedPhase(const char *name, uint16_t endpoint_id = k_invalid_endpoint_id,
+                uint32_t cluster_id = k_invalid_cluster_id);
+    ~ScopedPhase();
+
+private:
+    const char *m_name;
+    uint16_t m_endpoint_id;
+    uint32_t m_cluster_id;
+    int64_t m_start_us;
+#else
+    ScopedPhase(const char *name, uint16_t endpoint_id = k_invalid_endpoint_id,
+                uint32_t cluster_id = k_invalid_cluster_id) {}
+#endif // CONFIG_ESP_MATTER_STARTUP_PROFILER
+};
+
+} // namespace startup_profiler
+} // namespace esp_matter
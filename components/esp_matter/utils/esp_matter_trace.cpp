@@ -0,0 +1,141 @@
+// Copyright 2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <esp_matter_trace.h>
+
+#include <esp_attr.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <inttypes.h>
+#include <stdio.h>
+
+#include <atomic>
+
+namespace esp_matter {
+namespace trace {
+
+#if CONFIG_ESP_MATTER_TRACE
+typedef struct event {
+    int64_t timestamp_us;
+    uint32_t cluster_id;
+    uint32_t id;
+    uint32_t task;
+    uint16_t endpoint_id;
+    event_type_t type;
+    event_phase_t phase;
+} event_t;
+
+static constexpr uint32_t k_ring_size = CONFIG_ESP_MATTER_TRACE_EVENTS_PER_CORE;
+/* The slot stays continuous when the head wraps around UINT32_MAX only if the size divides 2^32 */
+static_assert((k_ring_size & (k_ring_size - 1)) == 0, "CONFIG_ESP_MATTER_TRACE_EVENTS_PER_CORE must be a power of two");
+
+/* One ring per core, an event goes to the ring of the core which records it. The head is only ever incremented and
+ * the slot of an event is head % k_ring_size. Writers claim their slot with an atomic increment, so no lock is needed
+ * and two writers never share a slot. */
+static event_t s_rings[portNUM_PROCESSORS][k_ring_size];
+static std::atomic<uint32_t> s_heads[portNUM_PROCESSORS];
+
+static const char *const k_event_names[EVENT_TYPE_MAX] = {
+    "attribute_read", "attribute_write", "attribute_set_val", "command_invoke",
+    "nvs_load",       "nvs_store",       "report_change",
+};
+
+IRAM_ATTR void record(event_type_t type, event_phase_t phase, uint16_t endpoint_id, uint32_t cluster_id, uint32_t id)
+{
+    int64_t timestamp_us = esp_timer_get_time();
+    uint32_t core = xPortGetCoreID();
+    uint32_t index = s_heads[core].fetch_add(1, std::memory_order_relaxed) % k_ring_size;
+    event_t &event = s_rings[core][index];
+    event.timestamp_us = timestamp_us;
+    event.cluster_id = cluster_id;
+    event.id = id;
+    event.task = (uint32_t)(uintptr_t)xTaskGetCurrentTaskHandle();
+    event.endpoint_id = endpoint_id;
+    event.type = type;
+    event.phase = phase;
+}
+
+esp_err_t export_chrome_json(write_callback_t callback, void *context)
+{
+    if (!callback) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    char buf[200];
+    bool first = true;
+    int len = snprintf(buf, sizeof(buf), "{\"traceEvents\":[");
+    callback(buf, len, context);
+    /* Merge the rings by timestamp so that the events of the different cores are interleaved in order */
+    uint32_t next[portNUM_PROCESSORS];
+    uint32_t heads[portNUM_PROCESSORS];
+    for (uint32_t core = 0; core < portNUM_PROCESSORS; core++) {
+        heads[core] = s_heads[core].load(std::memory_order_acquire);
+        uint32_t count = heads[core] < k_ring_size ? heads[core] : k_ring_size;
+        next[core] = heads[core] - count;
+    }
+    while (true) {
+        uint32_t core = portNUM_PROCESSORS;
+        for (uint32_t i = 0; i < portNUM_PROCESSORS; i++) {
+            if (next[i] != heads[i] && (core == portNUM_PROCESSORS ||
+                                        s_rings[i][next[i] % k_ring_size].timestamp_us <
+                                        s_rings[core][next[core] % k_ring_size].timestamp_us)) {
+                core = i;
+            }
+        }
+        if (core == portNUM_PROCESSORS) {
+            break;
+        }
+        const event_t &event = s_rings[core][next[core]++ % k_ring_size];
+        if (event.type >= EVENT_TYPE_MAX || (event.phase != PHASE_BEGIN && event.phase != PHASE_END)) {
+            continue;
+        }
+        len = snprintf(buf, sizeof(buf),
+                       "%s{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%" PRId64 ",\"pid\":0,\"tid\":%" PRIu32
+                       ",\"args\":{\"core\":%" PRIu32 ",\"endpoint\":%" PRIu16 ",\"cluster\":%" PRIu32
+                       ",\"id\":%" PRIu32 "}}",
+                       first ? "" : ",", k_event_names[event.type], (char)event.phase, event.timestamp_us,
+                       event.task, core, event.endpoint_id, event.cluster_id, event.id);
+        if (len > 0) {
+            callback(buf, len < (int)sizeof(buf) ? len : sizeof(buf) - 1, context);
+            first = false;
+        }
+    }
+    len = snprintf(buf, sizeof(buf), "],\"displayTimeUnit\":\"ms\"}");
+    callback(buf, len, context);
+    return ESP_OK;
+}
+
+void clear()
+{
+    for (uint32_t core = 0; core < portNUM_PROCESSORS; core++) {
+        s_heads[core].store(0, std::memory_order_release);
+    }
+}
+#else
+void record(event_type_t type, event_phase_t phase, uint16_t endpoint_id, uint32_t cluster_id, uint32_t id)
+{
+}
+
+esp_err_t export_chrome_json(write_callback_t callback, void *context)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+void clear()
+{
+}
+#endif // CONFIG_ESP_MATTER_TRACE
+
+} // namespace trace
+} // namespace esp_matter
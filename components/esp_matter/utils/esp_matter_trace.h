@@ -0,0 +1,105 @@
+// Copyright 2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <esp_err.h>
+#include <sdkconfig.h>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace esp_matter {
+namespace trace {
+
+/** Trace point types */
+typedef enum event_type : uint8_t {
+    ATTRIBUTE_READ = 0,
+    ATTRIBUTE_WRITE,
+    ATTRIBUTE_SET_VAL,
+    COMMAND_INVOKE,
+    NVS_LOAD,
+    NVS_STORE,
+    REPORT_CHANGE,
+    EVENT_TYPE_MAX,
+} event_type_t;
+
+/** Phase of a trace event, the values are the Chrome trace event phases */
+typedef enum event_phase : uint8_t {
+    PHASE_BEGIN = 'B',
+    PHASE_END = 'E',
+} event_phase_t;
+
+/** Add a trace event to the ring of the current core
+ *
+ * Use the ESP_MATTER_TRACE_* macros instead, they compile to nothing when CONFIG_ESP_MATTER_TRACE is not enabled.
+ */
+void record(event_type_t type, event_phase_t phase, uint16_t endpoint_id, uint32_t cluster_id, uint32_t id);
+
+/** Callback used to export the trace, called with consecutive chunks of the output */
+typedef void (*write_callback_t)(const char *data, size_t len, void *context);
+
+/** Export the trace events in the Chrome trace event format
+ *
+ * The output is a JSON object with a "traceEvents" array which can be opened with Perfetto or chrome://tracing. The
+ * rings of the cores are merged, so the events are in timestamp order.
+ * Each FreeRTOS task is a thread of the trace, so that begin and end events pair up even if the task moved to the
+ * other core. Events which are being written while exporting may be inconsistent, stop the activity for an exact
+ * trace.
+ *
+ * @param[in] callback Callback to write the output.
+ * @param[in] context Context passed to the callback.
+ *
+ * @return ESP_OK on success.
+ * @return ESP_ERR_NOT_SUPPORTED if CONFIG_ESP_MATTER_TRACE is not enabled.
+ */
+esp_err_t export_chrome_json(write_callback_t callback, void *context);
+
+/** Remove all the trace events */
+void clear();
+
+#if CONFIG_ESP_MATTER_TRACE
+/** Record a begin event on construction and the matching end event on destruction */
+class Scope {
+public:
+    Scope(event_type_t type, uint16_t endpoint_id, uint32_t cluster_id, uint32_t id)
+        : m_type(type), m_endpoint_id(endpoint_id), m_cluster_id(cluster_id), m_id(id)
+    {
+        record(m_type, PHASE_BEGIN, m_endpoint_id, m_cluster_id, m_id);
+    }
+    ~Scope() { record(m_type, PHASE_END, m_endpoint_id, m_cluster_id, m_id); }
+
+private:
+    event_type_t m_type;
+    uint16_t m_endpoint_id;
+    uint32_t m_cluster_id;
+    uint32_t m_id;
+};
+#endif // CONFIG_ESP_MATTER_TRACE
+
+} // namespace trace
+} // namespace esp_matter
+
+#if CONFIG_ESP_MATTER_TRACE
+#define ESP_MATTER_TRACE_BEGIN(type, endpoint_id, cluster_id, id)                                                     \
+    esp_matter::trace::record(esp_matter::trace::type, esp_matter::trace::PHASE_BEGIN, endpoint_id, cluster_id, id)
+#define ESP_MATTER_TRACE_END(type, endpoint_id, cluster_id, id)                                                       \
+    esp_matter::trace::record(esp_matter::trace::type, esp_matter::trace::PHASE_END, endpoint_id, cluster_id, id)
+/* Trace the rest of the enclosing block, can be used once per block */
+#define ESP_MATTER_TRACE_SCOPE(type, endpoint_id, cluster_id, id)                                                     \
+    esp_matter::trace::Scope esp_matter_trace_scope(esp_matter::trace::type, endpoint_id, cluster_id, id)
+#else
+#define ESP_MATTER_TRACE_BEGIN(type, endpoint_id, cluster_id, id) do {} while (0)
+#define ESP_MATTER_TRACE_END(type, endpoint_id, cluster_id, id) do {} while (0)
+#define ESP_MATTER_TRACE_SCOPE(type, endpoint_id, cluster_id, id) do {} while (0)
+#endif // CONFIG_ESP_MATTER_TRACE
@@ -15,13 +15,20 @@
 #include "esp_matter_endpoint.h"
 #include <esp_log.h>
 #include <esp_matter.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include <inttypes.h>
 #include <nvs.h>
 #include <nvs_flash.h>
 #include <string.h>
 
 #include <esp_matter_bridge.h>
 #include <esp_matter_mem.h>
+#include <esp_matter_startup_profiler.h>
 #include <nvs_key_allocator.h>
+#include <platform/CHIPDeviceLayer.h>
 #if MAX_BRIDGED_DEVICE_COUNT > 0
 
 static const char *TAG = "esp_matter_bridge";
@@ -33,6 +40,250 @@ namespace esp_matter_bridge {
 
 static uint16_t bridged_endpoint_id_array[MAX_BRIDGED_DEVICE_COUNT];
 
+/** Bridge Storage Batch **/
+typedef struct storage_batch {
+    uint16_t depth;
+    bool handle_open;
+    bool endpoint_ids_dirty;
+    nvs_handle_t handle;
+    int64_t start_time;
+    int64_t last_flush_time;
+    uint32_t op_count;
+    uint32_t erase_count;
+    /* Keys erased in the batch, they are removed only after the bridged endpoint id array is stored */
+    char (*pending_erase_keys)[NVS_KEY_NAME_MAX_SIZE];
+    uint16_t pending_erase_count;
+    uint16_t pending_erase_capacity;
+    /* Flushes a batch which has no storage operation for CONFIG_ESP_MATTER_BRIDGE_STORAGE_BATCH_TIMEOUT_MS */
+    esp_timer_handle_t flush_timer;
+} storage_batch_t;
+
+static storage_batch_t storage_batch;
+
+/* The batch is used from the application tasks which create or remove the bridged devices, and flushed from the
+ * Matter thread when it is idle, so every access to it is done with this recursive mutex held */
+static SemaphoreHandle_t get_storage_batch_mutex()
+{
+    static StaticSemaphore_t mutex_buffer;
+    static SemaphoreHandle_t mutex = xSemaphoreCreateRecursiveMutexStatic(&mutex_buffer);
+    return mutex;
+}
+
+class StorageBatchLock {
+public:
+    StorageBatchLock() { xSemaphoreTakeRecursive(get_storage_batch_mutex(), portMAX_DELAY); }
+    ~StorageBatchLock() { xSemaphoreGiveRecursive(get_storage_batch_mutex()); }
+};
+
+static esp_err_t open_storage_handle(nvs_handle_t *handle)
+{
+    esp_err_t err = nvs_open_from_partition(CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME, ESP_MATTER_BRIDGE_NAMESPACE,
+                                            NVS_READWRITE, handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Error opening partition %s namespace %s. Err: %d", CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME,
+                 ESP_MATTER_BRIDGE_NAMESPACE, err);
+    }
+    return err;
+}
+
+static void restart_storage_batch_flush_timer()
+{
+    if (storage_batch.flush_timer) {
+        esp_timer_stop(storage_batch.flush_timer);
+        esp_timer_start_once(storage_batch.flush_timer,
+                             (uint64_t)CONFIG_ESP_MATTER_BRIDGE_STORAGE_BATCH_TIMEOUT_MS * 1000);
+    }
+}
+
+static esp_err_t flush_storage_batch()
+{
+    esp_err_t err = ESP_OK;
+    // The bridged endpoint id array is the commit record of the batch: the persistent info of the new endpoints is
+    // already stored and the persistent info of the removed endpoints is erased only after the array is stored.
+    if (storage_batch.endpoint_ids_dirty) {
+        err = nvs_set_blob(storage_batch.handle, nvs_key_allocator::endpoint_ids_array().KeyName(),
+                           bridged_endpoint_id_array, sizeof(bridged_endpoint_id_array));
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "Failed on nvs_set_blob when storing bridged_endpoint_ids");
+        } else {
+            storage_batch.endpoint_ids_dirty = false;
+        }
+    }
+    // Keep the pending erases until the array is stored, the next flush retries both
+    if (!storage_batch.endpoint_ids_dirty) {
+        for (uint16_t idx = 0; idx < storage_batch.pending_erase_count; ++idx) {
+            esp_err_t erase_err = nvs_erase_key(storage_batch.handle, storage_batch.pending_erase_keys[idx]);
+            if (erase_err != ESP_OK && erase_err != ESP_ERR_NVS_NOT_FOUND) {
+                ESP_LOGE(TAG, "Failed to erase %s", storage_batch.pending_erase_keys[idx]);
+            }
+        }
+        storage_batch.pending_erase_count = 0;
+    }
+    // Commit what is written even if the array could not be stored, the old array does not refer to it
+    if (storage_batch.handle_open) {
+        esp_err_t commit_err = nvs_commit(storage_batch.handle);
+        if (commit_err != ESP_OK) {
+            ESP_LOGE(TAG, "Failed on nvs_commit when flushing the bridge storage batch");
+            err = err != ESP_OK ? err : commit_err;
+        }
+    }
+    storage_batch.last_flush_time = esp_timer_get_time();
+    restart_storage_batch_flush_timer();
+    return err;
+}
+
+static void storage_batch_flush_work(intptr_t arg)
+{
+    StorageBatchLock lock;
+    if (storage_batch.depth > 0 &&
+            esp_timer_get_time() - storage_batch.last_flush_time >=
+            (int64_t)CONFIG_ESP_MATTER_BRIDGE_STORAGE_BATCH_TIMEOUT_MS * 1000) {
+        flush_storage_batch();
+    }
+}
+
+static void storage_batch_flush_timer_cb(void *arg)
+{
+    // Flush from the Matter thread rather than the esp_timer task, so that the timer task is not blocked on NVS
+    if (chip::DeviceLayer::PlatformMgr().ScheduleWork(storage_batch_flush_work) != CHIP_NO_ERROR) {
+        ESP_LOGE(TAG, "Failed to schedule the flush of the bridge storage batch");
+    }
+}
+
+esp_err_t begin_storage_batch()
+{
+    StorageBatchLock lock;
+    if (storage_batch.depth++ > 0) {
+        return ESP_OK;
+    }
+    esp_err_t err = open_storage_handle(&storage_batch.handle);
+    if (err != ESP_OK) {
+        storage_batch.depth = 0;
+        return err;
+    }
+    storage_batch.handle_open = true;
+    storage_batch.start_time = esp_timer_get_time();
+    storage_batch.last_flush_time = storage_batch.start_time;
+    storage_batch.op_count = 0;
+    storage_batch.erase_count = 0;
+    if (!storage_batch.flush_timer) {
+        esp_timer_create_args_t timer_args = {
+            .callback = storage_batch_flush_timer_cb,
+            .arg = NULL,
+            .dispatch_method = ESP_TIMER_TASK,
+            .name = "bridge_batch",
+            .skip_unhandled_events = true,
+        };
+        if (esp_timer_create(&timer_args, &storage_batch.flush_timer) != ESP_OK) {
+            // The batch is still flushed on its storage operations
+            ESP_LOGW(TAG, "Failed to create the bridge storage batch flush timer");
+            storage_batch.flush_timer = NULL;
+        }
+    }
+    restart_storage_batch_flush_timer();
+    return ESP_OK;
+}
+
+esp_err_t end_storage_batch()
+{
+    StorageBatchLock lock;
+    if (storage_batch.depth == 0) {
+        ESP_LOGE(TAG, "No bridge storage batch in progress");
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (--storage_batch.depth > 0) {
+        return ESP_OK;
+    }
+    esp_err_t err = flush_storage_batch();
+    if (storage_batch.flush_timer) {
+        esp_timer_stop(storage_batch.flush_timer);
+    }
+    if (storage_batch.endpoint_ids_dirty) {
+        // The stored array still describes the endpoints before the batch, so do not erase their info
+        ESP_LOGE(TAG, "Bridge storage batch not committed, %u deferred erases are dropped",
+                 storage_batch.pending_erase_count);
+        storage_batch.endpoint_ids_dirty = false;
+        storage_batch.pending_erase_count = 0;
+    }
+    nvs_close(storage_batch.handle);
+    storage_batch.handle_open = false;
+    esp_matter_mem_free(storage_batch.pending_erase_keys);
+    storage_batch.pending_erase_keys = NULL;
+    storage_batch.pending_erase_capacity = 0;
+    ESP_LOGI(TAG, "Bridge storage batch committed %" PRIu32 " operations (%" PRIu32 " deferred erases) in %" PRId64
+             " ms", storage_batch.op_count, storage_batch.erase_count,
+             (esp_timer_get_time() - storage_batch.start_time) / 1000);
+    return err;
+}
+
+bool is_storage_batch_in_progress()
+{
+    StorageBatchLock lock;
+    return storage_batch.depth > 0;
+}
+
+esp_err_t open_storage(nvs_handle_t *handle)
+{
+    if (!handle) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    StorageBatchLock lock;
+    if (storage_batch.depth == 0) {
+        return open_storage_handle(handle);
+    }
+    // Bound the time the changes of a long running batch stay uncommitted
+    if (esp_timer_get_time() - storage_batch.last_flush_time >=
+            (int64_t)CONFIG_ESP_MATTER_BRIDGE_STORAGE_BATCH_TIMEOUT_MS * 1000) {
+        flush_storage_batch();
+    }
+    storage_batch.op_count++;
+    *handle = storage_batch.handle;
+    // Held until close_storage(), so that the batch handle is not flushed or closed while it is written
+    xSemaphoreTakeRecursive(get_storage_batch_mutex(), portMAX_DELAY);
+    return ESP_OK;
+}
+
+esp_err_t close_storage(nvs_handle_t handle)
+{
+    StorageBatchLock lock;
+    if (storage_batch.depth > 0 && handle == storage_batch.handle) {
+        xSemaphoreGiveRecursive(get_storage_batch_mutex());
+        return ESP_OK;
+    }
+    esp_err_t err = nvs_commit(handle);
+    nvs_close(handle);
+    return err;
+}
+
+esp_err_t erase_storage_key(nvs_handle_t handle, const char *key)
+{
+    if (!key || strlen(key) >= NVS_KEY_NAME_MAX_SIZE) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    StorageBatchLock lock;
+    if (storage_batch.depth == 0 || handle != storage_batch.handle) {
+        return nvs_erase_key(handle, key);
+    }
+    if (storage_batch.pending_erase_count == storage_batch.pending_erase_capacity) {
+        uint16_t capacity = storage_batch.pending_erase_capacity ? 2 * storage_batch.pending_erase_capacity : 8;
+        char (*keys)[NVS_KEY_NAME_MAX_SIZE] =
+            (char (*)[NVS_KEY_NAME_MAX_SIZE])esp_matter_mem_calloc(capacity, NVS_KEY_NAME_MAX_SIZE);
+        if (!keys) {
+            // Fall back to erasing the key right away
+            return nvs_erase_key(handle, key);
+        }
+        if (storage_batch.pending_erase_keys) {
+            memcpy(keys, storage_batch.pending_erase_keys, storage_batch.pending_erase_count * NVS_KEY_NAME_MAX_SIZE);
+            esp_matter_mem_free(storage_batch.pending_erase_keys);
+        }
+        storage_batch.pending_erase_keys = keys;
+        storage_batch.pending_erase_capacity = capacity;
+    }
+    memcpy(storage_batch.pending_erase_keys[storage_batch.pending_erase_count++], key, strlen(key) + 1);
+    storage_batch.erase_count++;
+    return ESP_OK;
+}
+
 /** Persistent Bridged Device Info **/
 static esp_err_t store_device_persistent_info(device_persistent_info_t *persistent_info)
 {
@@ -43,11 +294,8 @@ static esp_err_t store_device_persistent_info(device_persistent_info_t *persiste
     }
 
     nvs_handle_t handle;
-    err = nvs_open_from_partition(CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME, ESP_MATTER_BRIDGE_NAMESPACE, NVS_READWRITE,
-                                  &handle);
+    err = open_storage(&handle);
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Error opening partition %s namespace %s. Err: %d", CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME,
-                 ESP_MATTER_BRIDGE_NAMESPACE, err);
         return err;
     }
     uint16_t endpoint_id = persistent_info->device_endpoint_id;
@@ -56,12 +304,11 @@ static esp_err_t store_device_persistent_info(device_persistent_info_t *persiste
     if (err != ESP_OK) {
         ESP_LOGE(TAG, "Failed on nvs_set_blob when storing device_persistent_info");
     }
-    err = nvs_commit(handle);
-    if (err != ESP_OK) {
+    esp_err_t commit_err = close_storage(handle);
+    if (commit_err != ESP_OK) {
         ESP_LOGE(TAG, "Failed on nvs_commit when storing device_persistent_info");
     }
-    nvs_close(handle);
-    return err;
+    return err != ESP_OK ? err : commit_err;
 }
 
 static esp_err_t nvs_get_device_persistent_info(const char *nvs_namespace, const char *nvs_key,
@@ -120,12 +367,15 @@ static esp_err_t read_device_persistent_info(device_persistent_info_t *persisten
 static esp_err_t store_bridged_endpoint_ids()
 {
     esp_err_t err = ESP_OK;
+    StorageBatchLock lock;
+    if (storage_batch.depth > 0) {
+        // Stored once when the batch is flushed
+        storage_batch.endpoint_ids_dirty = true;
+        return ESP_OK;
+    }
     nvs_handle_t handle;
-    err = nvs_open_from_partition(CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME, ESP_MATTER_BRIDGE_NAMESPACE, NVS_READWRITE,
-                                  &handle);
+    err = open_storage_handle(&handle);
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Error opening partition %s namespace %s. Err: %d", CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME,
-                 ESP_MATTER_BRIDGE_NAMESPACE, err);
         return err;
     }
     err = nvs_set_blob(handle, nvs_key_allocator::endpoint_ids_array().KeyName(), bridged_endpoint_id_array,
@@ -212,16 +462,12 @@ esp_err_t erase_bridged_device_info(uint16_t endpoint_id)
     }
     // Clear the persistent information of the removed endpoint
     nvs_handle_t handle;
-    err = nvs_open_from_partition(CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME, ESP_MATTER_BRIDGE_NAMESPACE, NVS_READWRITE,
-                                  &handle);
+    err = open_storage(&handle);
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Error opening partition %s namespace %s. Err: %d", CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME,
-                 ESP_MATTER_BRIDGE_NAMESPACE, err);
         return err;
     }
-    err = nvs_erase_key(handle, nvs_key_allocator::endpoint_pesistent_info(endpoint_id).KeyName());
-    nvs_commit(handle);
-    nvs_close(handle);
+    err = erase_storage_key(handle, nvs_key_allocator::endpoint_pesistent_info(endpoint_id).KeyName());
+    close_storage(handle);
     return err;
 }
 
@@ -262,6 +508,160 @@ esp_err_t set_device_type(device_t *bridged_device, uint32_t device_type_id, voi
     return plugin_init_callback_endpoint(bridged_device->endpoint);
 }
 
+#if CONFIG_ESP_MATTER_BRIDGE_LAZY_RESUME
+/** Lazy Resume **/
+static device_t *lazy_resume_queue[MAX_BRIDGED_DEVICE_COUNT];
+static size_t lazy_resume_count = 0;
+static portMUX_TYPE lazy_resume_lock = portMUX_INITIALIZER_UNLOCKED;
+/* Whether the lazy resume task is running, accessed under lazy_resume_lock */
+static bool lazy_resume_task_running = false;
+
+/* Remove the device from the queue if it is pending, returns whether it was. Only one caller completes a device. */
+static bool lazy_resume_take(device_t *dev)
+{
+    taskENTER_CRITICAL(&lazy_resume_lock);
+    bool pending = dev->resume_pending;
+    if (pending) {
+        dev->resume_pending = false;
+        for (size_t idx = 0; idx < lazy_resume_count; ++idx) {
+            if (lazy_resume_queue[idx] == dev) {
+                memmove(&lazy_resume_queue[idx], &lazy_resume_queue[idx + 1],
+                        (lazy_resume_count - idx - 1) * sizeof(lazy_resume_queue[0]));
+                lazy_resume_count--;
+                break;
+            }
+        }
+    }
+    taskEXIT_CRITICAL(&lazy_resume_lock);
+    return pending;
+}
+
+/* Get the first queued device, marks the task as finished if there is none so that a new device restarts it */
+static device_t *lazy_resume_peek_or_finish()
+{
+    taskENTER_CRITICAL(&lazy_resume_lock);
+    device_t *dev = lazy_resume_count > 0 ? lazy_resume_queue[0] : NULL;
+    if (!dev) {
+        lazy_resume_task_running = false;
+    }
+    taskEXIT_CRITICAL(&lazy_resume_lock);
+    return dev;
+}
+
+/* The Matter task holds the stack lock while it runs the callbacks, taking the lock again from there deadlocks when
+ * CHIP_STACK_LOCK_TRACKING_ENABLED is not set */
+static bool is_matter_task()
+{
+    static TaskHandle_t matter_task = NULL;
+    if (!matter_task) {
+        matter_task = xTaskGetHandle(CHIP_DEVICE_CONFIG_CHIP_TASK_NAME);
+    }
+    return matter_task && matter_task == xTaskGetCurrentTaskHandle();
+}
+
+/* Must be called with the Matter stack lock held */
+static esp_err_t complete_resume_locked(device_t *bridged_device)
+{
+    if (!lazy_resume_take(bridged_device)) {
+        return ESP_OK;
+    }
+
+    // The clusters added by the device type callback are appended after the ones of the skeleton
+    cluster_t *last_cluster = cluster::get_first(bridged_device->endpoint);
+    while (last_cluster && cluster::get_next(last_cluster)) {
+        last_cluster = cluster::get_next(last_cluster);
+    }
+    esp_err_t err = set_device_type(bridged_device, bridged_device->persistent_info.device_type_id,
+                                    bridged_device->priv_data);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to add the device type for the resumed endpoint 0x%04" PRIx16,
+                 bridged_device->persistent_info.device_endpoint_id);
+        return err;
+    }
+    // A skeleton which has already been enabled only needs its new clusters initialized
+    if (endpoint::is_enabled(bridged_device->endpoint)) {
+        endpoint::init_clusters(bridged_device->endpoint, last_cluster ? cluster::get_next(last_cluster)
+                                                                       : cluster::get_first(bridged_device->endpoint));
+    }
+    return ESP_OK;
+}
+
+static void lazy_resume_task_handler(void *arg)
+{
+    while (!esp_matter::is_started()) {
+        vTaskDelay(pdMS_TO_TICKS(100));
+    }
+    // Let the node serve its first requests with the endpoint skeletons before completing them
+    vTaskDelay(pdMS_TO_TICKS(CONFIG_ESP_MATTER_BRIDGE_LAZY_RESUME_DELAY_MS));
+    int64_t start_time = esp_timer_get_time();
+    size_t completed_count = 0;
+    while (true) {
+        {
+            esp_matter::lock::ScopedChipStackLock lock(portMAX_DELAY);
+            device_t *dev = lazy_resume_peek_or_finish();
+            if (!dev) {
+                break;
+            }
+            if (complete_resume_locked(dev) == ESP_OK) {
+                completed_count++;
+            }
+        }
+        // Yield between the devices so that the Matter and the network tasks are not starved
+        vTaskDelay(1);
+    }
+    startup_profiler::add_milestone("bridge_lazy_resume_done");
+    ESP_LOGI(TAG, "Completed the lazy resume of %u bridged devices in %" PRId64 " ms", (unsigned)completed_count,
+             (esp_timer_get_time() - start_time) / 1000);
+    vTaskDelete(NULL);
+}
+
+static esp_err_t lazy_resume_add(device_t *dev)
+{
+    taskENTER_CRITICAL(&lazy_resume_lock);
+    bool queued = lazy_resume_count < MAX_BRIDGED_DEVICE_COUNT;
+    bool start_task = false;
+    if (queued) {
+        lazy_resume_queue[lazy_resume_count++] = dev;
+        dev->resume_pending = true;
+        start_task = !lazy_resume_task_running;
+        lazy_resume_task_running = true;
+    }
+    taskEXIT_CRITICAL(&lazy_resume_lock);
+    if (!queued) {
+        return ESP_ERR_NO_MEM;
+    }
+    if (start_task &&
+            xTaskCreate(lazy_resume_task_handler, "bridge_resume", CONFIG_ESP_MATTER_BRIDGE_LAZY_RESUME_TASK_STACK, NULL,
+                        tskIDLE_PRIORITY + 1, NULL) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create the lazy resume task");
+        taskENTER_CRITICAL(&lazy_resume_lock);
+        lazy_resume_task_running = false;
+        taskEXIT_CRITICAL(&lazy_resume_lock);
+        lazy_resume_take(dev);
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+#endif // CONFIG_ESP_MATTER_BRIDGE_LAZY_RESUME
+
+esp_err_t complete_resume(device_t *bridged_device)
+{
+    if (!bridged_device) {
+        ESP_LOGE(TAG, "bridged_device cannot be NULL");
+        return ESP_ERR_INVALID_ARG;
+    }
+#if CONFIG_ESP_MATTER_BRIDGE_LAZY_RESUME
+    // Called from the bridge tasks of the examples as well as from the Matter callbacks
+    if (is_matter_task()) {
+        return complete_resume_locked(bridged_device);
+    }
+    esp_matter::lock::ScopedChipStackLock lock(portMAX_DELAY);
+    return complete_resume_locked(bridged_device);
+#else
+    return ESP_OK;
+#endif // CONFIG_ESP_MATTER_BRIDGE_LAZY_RESUME
+}
+
 static bool parent_endpoint_is_valid(node_t *node, uint16_t parent_endpoint_id)
 {
     if (!node) {
@@ -302,6 +702,7 @@ device_t *create_device(node_t *node, uint16_t parent_endpoint_id, uint32_t devi
     }
 
     dev->node = node;
+    dev->priv_data = priv_data;
     dev->persistent_info.parent_endpoint_id = parent_endpoint_id;
     bridged_node::config_t bridged_node_config;
     dev->endpoint =
@@ -369,6 +770,7 @@ device_t *resume_device(node_t *node, uint16_t device_endpoint_id, void *priv_da
     }
 
     dev->node = node;
+    dev->priv_data = priv_data;
     dev->persistent_info = persistent_info;
     bridged_node::config_t bridged_node_config;
     dev->endpoint = bridged_node::resume(node, &bridged_node_config, ENDPOINT_FLAG_DESTROYABLE | ENDPOINT_FLAG_BRIDGE,
@@ -379,17 +781,28 @@ device_t *resume_device(node_t *node, uint16_t device_endpoint_id, void *priv_da
         erase_bridged_device_info(device_endpoint_id);
         return NULL;
     }
+#if !CONFIG_ESP_MATTER_BRIDGE_LAZY_RESUME
     if (set_device_type(dev, persistent_info.device_type_id, priv_data) != ESP_OK) {
         ESP_LOGE(TAG, "Failed to add the device type for the bridged device");
         remove_device(dev);
         return NULL;
     }
+#endif
     endpoint_t *parent_endpoint = endpoint::get(node, persistent_info.parent_endpoint_id);
     if (set_parent_endpoint(dev->endpoint, parent_endpoint) != ESP_OK) {
         ESP_LOGE(TAG, "Failed to set parent endpoint for the bridged device");
         remove_device(dev);
         return NULL;
     }
+#if CONFIG_ESP_MATTER_BRIDGE_LAZY_RESUME
+    // Only the skeleton of the endpoint is resumed here, the device type is added by complete_resume()
+    if (lazy_resume_add(dev) != ESP_OK &&
+            set_device_type(dev, persistent_info.device_type_id, priv_data) != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to add the device type for the bridged device");
+        remove_device(dev);
+        return NULL;
+    }
+#endif
     return dev;
 }
 
@@ -398,6 +811,9 @@ esp_err_t remove_device(device_t *bridged_device)
     if (!bridged_device) {
         return ESP_ERR_INVALID_ARG;
     }
+#if CONFIG_ESP_MATTER_BRIDGE_LAZY_RESUME
+    lazy_resume_take(bridged_device);
+#endif
     erase_bridged_device_info(bridged_device->persistent_info.device_endpoint_id);
     esp_err_t error = endpoint::destroy(bridged_device->node, bridged_device->endpoint);
     if (error != ESP_OK) {
@@ -407,6 +823,57 @@ esp_err_t remove_device(device_t *bridged_device)
     return error;
 }
 
+esp_err_t create_devices(node_t *node, uint16_t parent_endpoint_id, size_t count, const uint32_t *device_type_ids,
+                         void *const *priv_data, device_t **devices)
+{
+    if (!device_type_ids || !devices) {
+        ESP_LOGE(TAG, "device_type_ids and devices cannot be NULL");
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_err_t err = begin_storage_batch();
+    if (err != ESP_OK) {
+        return err;
+    }
+    endpoint::begin_batch();
+    size_t created_count = 0;
+    for (size_t idx = 0; idx < count; ++idx) {
+        devices[idx] = create_device(node, parent_endpoint_id, device_type_ids[idx], priv_data ? priv_data[idx] : NULL);
+        if (devices[idx]) {
+            created_count++;
+        }
+    }
+    endpoint::end_batch();
+    err = end_storage_batch();
+    if (created_count != count) {
+        ESP_LOGE(TAG, "Failed to create %u of %u bridged devices", (unsigned)(count - created_count), (unsigned)count);
+        return ESP_FAIL;
+    }
+    return err;
+}
+
+esp_err_t remove_devices(device_t **devices, size_t count)
+{
+    if (!devices) {
+        ESP_LOGE(TAG, "devices cannot be NULL");
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_err_t err = begin_storage_batch();
+    if (err != ESP_OK) {
+        return err;
+    }
+    endpoint::begin_batch();
+    esp_err_t remove_err = ESP_OK;
+    for (size_t idx = 0; idx < count; ++idx) {
+        if (devices[idx] && remove_device(devices[idx]) != ESP_OK) {
+            remove_err = ESP_FAIL;
+        }
+        devices[idx] = NULL;
+    }
+    endpoint::end_batch();
+    err = end_storage_batch();
+    return remove_err != ESP_OK ? remove_err : err;
+}
+
 esp_err_t initialize(node_t *node, bridge_device_type_callback_t device_type_cb)
 {
     if (!node) {
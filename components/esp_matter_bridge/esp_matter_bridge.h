@@ -17,6 +17,7 @@
 
 #include <esp_err.h>
 #include <esp_matter_data_model.h>
+#include <nvs.h>
 
 #define MAX_BRIDGED_DEVICE_COUNT \
     CONFIG_ESP_MATTER_MAX_DYNAMIC_ENDPOINT_COUNT - 1 - CONFIG_ESP_MATTER_AGGREGATOR_ENDPOINT_COUNT
@@ -34,6 +35,9 @@ typedef struct device {
     esp_matter::node_t *node;
     esp_matter::endpoint_t *endpoint;
     device_persistent_info_t persistent_info;
+    void *priv_data;
+    /* The device type of the resumed device has not been added yet, see CONFIG_ESP_MATTER_BRIDGE_LAZY_RESUME */
+    bool resume_pending;
 } device_t;
 
 typedef esp_err_t (*bridge_device_type_callback_t)(esp_matter::endpoint_t *ep, uint32_t device_type_id, void *priv_data);
@@ -49,9 +53,96 @@ device_t *resume_device(esp_matter::node_t *node, uint16_t device_endpoint_id, v
 
 esp_err_t set_device_type(device_t *bridged_device, uint32_t device_type_id, void *priv_data);
 
+/** Complete the resume of a bridged device
+ *
+ * With CONFIG_ESP_MATTER_BRIDGE_LAZY_RESUME, `resume_device()` only brings up the descriptor and the bridged device
+ * basic information clusters of the endpoint, the device type is added later by a low priority task once the Matter
+ * stack is started. Call this to add it right away, e.g. when the device is first accessed. It takes the Matter stack
+ * lock unless it is called from the Matter task, so it can be called from any task which does not already hold the
+ * lock. It does nothing for a device which is already complete.
+ *
+ * @param[in] bridged_device Bridged device handle.
+ *
+ * @return ESP_OK on success.
+ * @return error in case of failure.
+ */
+esp_err_t complete_resume(device_t *bridged_device);
+
 esp_err_t remove_device(device_t *bridged_device);
 
+/** Create bridged devices in one pass
+ *
+ * The devices are created in one bridge storage batch and one endpoint batch, so the bridged endpoint id array is
+ * stored once and the PartsList change is reported once for all the devices, once they are enabled in the same
+ * endpoint batch or later.
+ *
+ * @param[in] node Node handle.
+ * @param[in] parent_endpoint_id Endpoint id of the aggregator the devices are bridged to.
+ * @param[in] count Number of devices to create.
+ * @param[in] device_type_ids Array of `count` device type ids.
+ * @param[in] priv_data Array of `count` private data pointers, can be NULL.
+ * @param[out] devices Array of `count` device handles, the devices which could not be created are set to NULL.
+ *
+ * @return ESP_OK if all the devices are created.
+ * @return error in case of failure.
+ */
+esp_err_t create_devices(esp_matter::node_t *node, uint16_t parent_endpoint_id, size_t count,
+                         const uint32_t *device_type_ids, void *const *priv_data, device_t **devices);
+
+/** Remove bridged devices in one pass
+ *
+ * @param[in,out] devices Array of `count` device handles, NULL entries are skipped. All entries are set to NULL.
+ * @param[in] count Number of devices to remove.
+ *
+ * @return ESP_OK if all the devices are removed.
+ * @return error in case of failure.
+ */
+esp_err_t remove_devices(device_t **devices, size_t count);
+
 esp_err_t initialize(esp_matter::node_t *node, bridge_device_type_callback_t device_type_cb);
 
+/** Begin a bridge storage batch
+ *
+ * Until the matching `end_storage_batch()`, the bridge storage namespace is kept open, the bridged endpoint id array
+ * is stored once per flush and the erased keys are removed only after the array is stored. The array is the commit
+ * record of the batch, so after a power loss the bridge resumes the endpoints as they were either before or after the
+ * batch. A batch which stays open for longer than CONFIG_ESP_MATTER_BRIDGE_STORAGE_BATCH_TIMEOUT_MS is flushed on the
+ * next storage operation, or from the Matter thread if there is none. Batches can be nested, only the outermost one
+ * is committed.
+ *
+ * @note The batch is shared by all the tasks and guarded by a mutex. A batch begun by one task is committed by the
+ * outermost `end_storage_batch()`, whichever task calls it.
+ *
+ * @return ESP_OK on success.
+ * @return error in case of failure.
+ */
+esp_err_t begin_storage_batch();
+
+/** End a bridge storage batch and commit it if it is the outermost one
+ *
+ * @return ESP_OK on success.
+ * @return ESP_ERR_INVALID_STATE if there is no batch in progress.
+ * @return error in case of failure.
+ */
+esp_err_t end_storage_batch();
+
+/** Check whether a bridge storage batch is in progress */
+bool is_storage_batch_in_progress();
+
+/** Open the bridge storage namespace for writing
+ *
+ * Returns the handle of the batch when a batch is in progress. The handle must be released with `close_storage()`,
+ * the batch stays locked for the calling task until then.
+ */
+esp_err_t open_storage(nvs_handle_t *handle);
+
+/** Release a handle got from `open_storage()`, the changes are committed unless they belong to a batch */
+esp_err_t close_storage(nvs_handle_t handle);
+
+/** Erase a key of the bridge storage namespace, the erase is deferred to the commit of the batch if one is in
+ * progress
+ */
+esp_err_t erase_storage_key(nvs_handle_t handle, const char *key);
+
 esp_err_t factory_reset();
 } // namespace esp_matter_bridge
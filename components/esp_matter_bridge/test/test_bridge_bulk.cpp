@@ -0,0 +1,101 @@
+// Copyright 2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <esp_heap_caps.h>
+#include <esp_matter.h>
+#include <esp_matter_bridge.h>
+#include <esp_timer.h>
+#include <inttypes.h>
+#include <nvs_flash.h>
+#include <stdio.h>
+#include <unity.h>
+
+#if defined(MAX_BRIDGED_DEVICE_COUNT) && MAX_BRIDGED_DEVICE_COUNT > 0
+
+using namespace esp_matter;
+
+/* The request measures 200 devices, the test app must allow that many dynamic endpoints to run the full count */
+static constexpr size_t k_device_count = MAX_BRIDGED_DEVICE_COUNT < 200 ? MAX_BRIDGED_DEVICE_COUNT : 200;
+
+static esp_err_t add_on_off_light(endpoint_t *ep, uint32_t device_type_id, void *priv_data)
+{
+    endpoint::on_off_light::config_t on_off_light_config;
+    return endpoint::on_off_light::add(ep, &on_off_light_config);
+}
+
+static uint16_t setup_bridge(node_t **node)
+{
+    TEST_ASSERT_EQUAL(ESP_OK, nvs_flash_init());
+    *node = node::get() ? node::get() : node::create_raw();
+    TEST_ASSERT_NOT_NULL(*node);
+    endpoint::aggregator::config_t aggregator_config;
+    endpoint_t *aggregator = endpoint::aggregator::create(*node, &aggregator_config, ENDPOINT_FLAG_NONE, NULL);
+    TEST_ASSERT_NOT_NULL(aggregator);
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::initialize(*node, add_on_off_light));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::factory_reset());
+    return endpoint::get_id(aggregator);
+}
+
+TEST_CASE("bridge creates and removes 200 devices in bulk", "[esp_matter_bridge][benchmark]")
+{
+    node_t *node = NULL;
+    uint16_t aggregator_id = setup_bridge(&node);
+    static esp_matter_bridge::device_t *devices[k_device_count];
+    static uint32_t device_type_ids[k_device_count];
+    for (size_t idx = 0; idx < k_device_count; ++idx) {
+        device_type_ids[idx] = ESP_MATTER_ON_OFF_LIGHT_DEVICE_TYPE_ID;
+    }
+
+    // One at a time, every creation and removal stores the bridged endpoint id array
+    size_t free_heap = heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+    int64_t start = esp_timer_get_time();
+    for (size_t idx = 0; idx < k_device_count; ++idx) {
+        devices[idx] = esp_matter_bridge::create_device(node, aggregator_id, device_type_ids[idx], NULL);
+        TEST_ASSERT_NOT_NULL(devices[idx]);
+    }
+    int64_t single_create_us = esp_timer_get_time() - start;
+    size_t device_heap = free_heap - heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+    start = esp_timer_get_time();
+    for (size_t idx = 0; idx < k_device_count; ++idx) {
+        TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::remove_device(devices[idx]));
+    }
+    int64_t single_remove_us = esp_timer_get_time() - start;
+
+    // In bulk, the array is stored once per pass
+    start = esp_timer_get_time();
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::create_devices(node, aggregator_id, k_device_count, device_type_ids,
+                                                                NULL, devices));
+    int64_t bulk_create_us = esp_timer_get_time() - start;
+
+    static uint16_t endpoint_ids[MAX_BRIDGED_DEVICE_COUNT];
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::get_bridged_endpoint_ids(endpoint_ids));
+    size_t stored_count = 0;
+    for (size_t idx = 0; idx < MAX_BRIDGED_DEVICE_COUNT; ++idx) {
+        stored_count += endpoint_ids[idx] != chip::kInvalidEndpointId ? 1 : 0;
+    }
+    TEST_ASSERT_EQUAL(k_device_count, stored_count);
+
+    start = esp_timer_get_time();
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::remove_devices(devices, k_device_count));
+    int64_t bulk_remove_us = esp_timer_get_time() - start;
+
+    printf("%u bridged devices, %u bytes of heap: create %" PRId64 " ms one at a time, %" PRId64 " ms in bulk; "
+           "remove %" PRId64 " ms one at a time, %" PRId64 " ms in bulk\n", (unsigned)k_device_count,
+           (unsigned)device_heap, single_create_us / 1000, bulk_create_us / 1000, single_remove_us / 1000,
+           bulk_remove_us / 1000);
+    TEST_ASSERT_LESS_THAN(single_create_us, bulk_create_us);
+    TEST_ASSERT_LESS_THAN(single_remove_us, bulk_remove_us);
+}
+
+#endif // MAX_BRIDGED_DEVICE_COUNT > 0
@@ -15,9 +15,17 @@
 #include <esp_heap_caps.h>
 #include <esp_log.h>
 #include <esp_matter_console.h>
+#include <esp_matter_startup_profiler.h>
+#include <esp_matter_trace.h>
 #include <esp_timer.h>
+#include <inttypes.h>
+#include <stdlib.h>
 #include <string.h>
 
+#if CONFIG_ESP_MATTER_ENABLE_DATA_MODEL
+#include <data_model/esp_matter_data_model.h>
+#endif
+
 namespace esp_matter {
 namespace console {
 
@@ -37,12 +45,98 @@ static esp_err_t mem_dump_console_handler(int argc, char *argv[])
     return ESP_OK;
 }
 
+#if CONFIG_ESP_MATTER_ENABLE_DATA_MODEL
+static void print_mem_stats(const esp_matter_mem_stats_t &stats)
+{
+    size_t live = 0;
+    size_t peak = 0;
+    for (int i = 0; i < ESP_MATTER_MEM_CATEGORY_MAX; i++) {
+        live += stats.live[i];
+        peak += stats.peak[i];
+    }
+    printf("live: %u peak: %u", (unsigned int)live, (unsigned int)peak);
+    for (int i = 0; i < ESP_MATTER_MEM_CATEGORY_MAX; i++) {
+        if (stats.peak[i] > 0) {
+            printf(" %s: %u/%u", esp_matter_mem_category_name((esp_matter_mem_category_t)i),
+                   (unsigned int)stats.live[i], (unsigned int)stats.peak[i]);
+        }
+    }
+    printf("\n");
+}
+
+static void mem_report_callback(uint16_t endpoint_id, uint32_t cluster_id, const esp_matter_mem_stats_t &stats,
+                                void *context)
+{
+    if (cluster_id == chip::kInvalidClusterId) {
+        printf("Endpoint 0x%04" PRIX16 "\t\t", endpoint_id);
+    } else {
+        printf("  Cluster 0x%08" PRIX32 "\t", cluster_id);
+    }
+    print_mem_stats(stats);
+}
+
+static esp_err_t mem_report_console_handler(int argc, char *argv[])
+{
+    esp_err_t err = node::memory_report(mem_report_callback, NULL);
+    if (err != ESP_OK) {
+        return err;
+    }
+    const esp_matter_mem_stats_t *total_stats = esp_matter_mem_get_total_stats();
+    if (total_stats) {
+        printf("Total\t\t\t");
+        print_mem_stats(*total_stats);
+    }
+    return ESP_OK;
+}
+#endif // CONFIG_ESP_MATTER_ENABLE_DATA_MODEL
+
 static esp_err_t up_time_console_handler(int argc, char *argv[])
 {
     printf("%s: Uptime of the device: %lld milliseconds\n", TAG, esp_timer_get_time() / 1000);
     return ESP_OK;
 }
 
+static esp_err_t startup_profile_console_handler(int argc, char *argv[])
+{
+#if CONFIG_ESP_MATTER_STARTUP_PROFILER
+    if (argc >= 1 && strncmp(argv[0], "json", sizeof("json")) == 0) {
+        size_t len = startup_profiler::to_json(NULL, 0);
+        char *json = (char *)calloc(1, len + 1);
+        if (!json) {
+            return ESP_ERR_NO_MEM;
+        }
+        startup_profiler::to_json(json, len + 1);
+        printf("%s\n", json);
+        free(json);
+    } else {
+        startup_profiler::dump();
+    }
+    return ESP_OK;
+#else
+    ESP_LOGE(TAG, "Enable CONFIG_ESP_MATTER_STARTUP_PROFILER for the startup profile");
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+static void trace_write_callback(const char *data, size_t len, void *context)
+{
+    fwrite(data, 1, len, stdout);
+}
+
+static esp_err_t trace_console_handler(int argc, char *argv[])
+{
+    if (argc >= 1 && strncmp(argv[0], "clear", sizeof("clear")) == 0) {
+        trace::clear();
+        return ESP_OK;
+    }
+    esp_err_t err = trace::export_chrome_json(trace_write_callback, NULL);
+    if (err == ESP_ERR_NOT_SUPPORTED) {
+        ESP_LOGE(TAG, "Enable CONFIG_ESP_MATTER_TRACE for the trace");
+    }
+    printf("\n");
+    return err;
+}
+
 static esp_err_t diagnostics_dispatch(int argc, char **argv)
 {
     if (argc <= 0) {
@@ -66,6 +160,24 @@ esp_err_t diagnostics_register_commands()
             .description = "help for memory analysis",
             .handler = mem_dump_console_handler,
         },
+#if CONFIG_ESP_MATTER_ENABLE_DATA_MODEL
+        {
+            .name = "mem-report",
+            .description = "print the live/peak data model memory by endpoint, cluster and category (bytes)",
+            .handler = mem_report_console_handler,
+        },
+#endif
+        {
+            .name = "startup-profile",
+            .description = "print the startup phase timings. Usage: matter esp diagnostics startup-profile [json]",
+            .handler = startup_profile_console_handler,
+        },
+        {
+            .name = "trace",
+            .description = "export the data model trace in the Chrome trace format. Usage: matter esp diagnostics "
+                           "trace [clear]",
+            .handler = trace_console_handler,
+        },
         {
             .name = "up-time",
             .description = "print the uptime of the device",
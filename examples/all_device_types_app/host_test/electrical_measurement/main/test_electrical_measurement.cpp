@@ -0,0 +1,149 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+
+#include <electrical_measurement_accumulator.h>
+#include <chrono>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unity.h>
+
+using Quantity = ElectricalMeasurementAccumulator::Quantity;
+using Period = ElectricalMeasurementAccumulator::Period;
+
+static constexpr int64_t k_us_per_hour = 3600LL * 1000 * 1000;
+
+static const ElectricalMeasurementAccumulator::Window &window(const Period &period, Quantity quantity)
+{
+    return period.windows[static_cast<uint8_t>(quantity)];
+}
+
+static void test_window_min_max_mean(void)
+{
+    ElectricalMeasurementAccumulator accumulator;
+    accumulator.Reset(1, 0);
+    accumulator.Add(230000, 1000, 230000, 0, 0);
+    accumulator.Add(220000, 3000, 660000, 1000, 1);
+    accumulator.Add(240000, 2000, 480000, 2000, 2);
+
+    Period period;
+    accumulator.Close(3, period);
+    TEST_ASSERT_TRUE(period.publishAttributes);
+    TEST_ASSERT_EQUAL(0, period.startSystimeMs);
+    TEST_ASSERT_EQUAL(3, period.endSystimeMs);
+
+    const ElectricalMeasurementAccumulator::Window &voltage = window(period, Quantity::kVoltage);
+    TEST_ASSERT_EQUAL(3, voltage.count);
+    TEST_ASSERT_EQUAL(220000, voltage.min);
+    TEST_ASSERT_EQUAL(1, voltage.minSystimeMs);
+    TEST_ASSERT_EQUAL(240000, voltage.max);
+    TEST_ASSERT_EQUAL(2, voltage.maxSystimeMs);
+    TEST_ASSERT_EQUAL(230000, voltage.sum / voltage.count);
+    TEST_ASSERT_EQUAL(3000, window(period, Quantity::kActiveCurrent).max);
+
+    /* The next window starts empty */
+    accumulator.Close(4, period);
+    TEST_ASSERT_FALSE(period.publishAttributes);
+    TEST_ASSERT_EQUAL(3, period.startSystimeMs);
+}
+
+static void test_energy_does_not_drift(void)
+{
+    /* 1 W imported for one hour at 1 kHz, then 2 W exported for half an hour at 7 Hz */
+    ElectricalMeasurementAccumulator accumulator;
+    accumulator.Reset(1, 0);
+    int64_t now_us = 0;
+    for (; now_us <= k_us_per_hour; now_us += 1000) {
+        accumulator.Add(230000, 4, 1000, now_us, now_us / 1000);
+    }
+    accumulator.Add(230000, -9, -2000, now_us, now_us / 1000);
+    int64_t end_us = now_us + k_us_per_hour / 2;
+    for (now_us += 142857; now_us <= end_us; now_us += 142857) {
+        accumulator.Add(230000, -9, -2000, now_us, now_us / 1000);
+    }
+    accumulator.Add(230000, 0, 0, end_us, end_us / 1000);
+
+    Period period;
+    accumulator.Close(end_us / 1000, period);
+    TEST_ASSERT_TRUE(period.publishEnergy);
+    /* The 1 ms spent at 1 W past the hour is below one mWh */
+    TEST_ASSERT_EQUAL(1000, period.importedMwh);
+    TEST_ASSERT_EQUAL(1000, period.exportedMwh);
+}
+
+static void test_no_energy_report_without_samples(void)
+{
+    ElectricalMeasurementAccumulator accumulator;
+    accumulator.Reset(3, 0);
+    Period period;
+
+    /* No sample: the energy interval elapses without a report */
+    for (uint64_t now_ms = 10000; now_ms <= 30000; now_ms += 10000) {
+        accumulator.Close(now_ms, period);
+        TEST_ASSERT_FALSE(period.publishAttributes);
+        TEST_ASSERT_FALSE(period.publishEnergy);
+    }
+
+    /* One sample in the second window of the interval is reported at its end */
+    accumulator.Close(40000, period);
+    accumulator.Add(230000, 1000, 230000, 45000000, 45000);
+    accumulator.Close(50000, period);
+    TEST_ASSERT_TRUE(period.publishAttributes);
+    TEST_ASSERT_FALSE(period.publishEnergy);
+    accumulator.Close(60000, period);
+    TEST_ASSERT_TRUE(period.publishEnergy);
+}
+
+static void benchmark_cpu_per_sample_and_reports_per_hour(void)
+{
+    /* One hour of a 10 Hz meter with the default intervals: 10 s attributes, 60 s energy */
+    static constexpr uint32_t k_sample_period_us = 100000;
+    static constexpr uint32_t k_attribute_interval_ms = 10000;
+    static constexpr uint32_t k_windows_per_energy_report = 6;
+
+    ElectricalMeasurementAccumulator accumulator;
+    accumulator.Reset(k_windows_per_energy_report, 0);
+    Period period;
+    uint32_t samples = 0;
+    uint32_t attribute_reports = 0;
+    uint32_t energy_reports = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int64_t now_us = k_sample_period_us; now_us <= k_us_per_hour; now_us += k_sample_period_us) {
+        uint64_t now_ms = now_us / 1000;
+        int64_t power_mw = 1000000 + (now_us / k_sample_period_us) % 1000;
+        accumulator.Add(230000, power_mw * 1000 / 230000, power_mw, now_us, now_ms);
+        samples++;
+        if (now_ms % k_attribute_interval_ms == 0) {
+            accumulator.Close(now_ms, period);
+            attribute_reports += period.publishAttributes;
+            energy_reports += period.publishEnergy;
+        }
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+    printf("electrical_measurement: %" PRIu32 " samples, %.1f ns per sample, %" PRIu32 " attribute reports and %" PRIu32
+           " energy reports per hour\n", samples, static_cast<double>(elapsed.count()) / samples, attribute_reports,
+           energy_reports);
+    /* Without batching, each sample would have been 3 attribute reports and an energy report */
+    TEST_ASSERT_EQUAL(36000, samples);
+    TEST_ASSERT_EQUAL(360, attribute_reports);
+    TEST_ASSERT_EQUAL(60, energy_reports);
+    /* About 1 kW for one hour */
+    TEST_ASSERT_TRUE(llabs(period.importedMwh - 1000500) < 1000);
+}
+
+extern "C" void app_main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_window_min_max_mean);
+    RUN_TEST(test_energy_does_not_drift);
+    RUN_TEST(test_no_energy_report_without_samples);
+    RUN_TEST(benchmark_cpu_per_sample_and_reports_per_hour);
+    exit(UNITY_END());
+}
@@ -7,7 +7,10 @@
 */
 
 #include "electrical_measurement.h"
+#include "electrical_measurement_aggregator.h"
+#include <atomic>
 #include <esp_log.h>
+#include <esp_timer.h>
 #include <app-common/zap-generated/ids/Attributes.h>
 #include <app-common/zap-generated/ids/Clusters.h>
 #include <app-common/zap-generated/ids/Events.h>
@@ -36,6 +39,40 @@ static const char *TAG = "electrical_measurement";
 static std::unique_ptr<ElectricalPowerMeasurementDelegate> gEPMDelegate;
 // Global pointer to our ElectricalPowerMeasurementInstance
 static std::unique_ptr<ElectricalPowerMeasurement::Instance> gEPMInstance;
+// Aggregator of the meter samples, started once both clusters are initialized
+static ElectricalMeasurementAggregator gAggregator;
+static std::atomic<bool> gAggregatorStarted{false};
+
+#if CONFIG_ELECTRICAL_MEASUREMENT_SIMULATED_METER
+static esp_timer_handle_t gSimulatedMeterTimer;
+
+// A 230 V load whose power ramps from 100 W to 2 kW and back over one minute
+static void simulated_meter_sample(void *arg)
+{
+    static constexpr int64_t kVoltageMv = 230000;
+    static constexpr int64_t kMinPowerMw = 100000;
+    static constexpr int64_t kMaxPowerMw = 2000000;
+    static constexpr int64_t kRampUs = 30 * 1000 * 1000;
+
+    int64_t phase = esp_timer_get_time() % (2 * kRampUs);
+    int64_t ramp = phase < kRampUs ? phase : 2 * kRampUs - phase;
+    int64_t power_mw = kMinPowerMw + (kMaxPowerMw - kMinPowerMw) * ramp / kRampUs;
+    electrical_measurement_submit_sample(kVoltageMv, power_mw * 1000 / kVoltageMv, power_mw);
+}
+
+static esp_err_t simulated_meter_start()
+{
+    const esp_timer_create_args_t args = {
+        .callback = simulated_meter_sample,
+        .name = "simulated_meter",
+    };
+    esp_err_t err = esp_timer_create(&args, &gSimulatedMeterTimer);
+    if (err != ESP_OK) {
+        return err;
+    }
+    return esp_timer_start_periodic(gSimulatedMeterTimer, CONFIG_ELECTRICAL_MEASUREMENT_SIMULATED_METER_PERIOD_MS * 1000);
+}
+#endif // CONFIG_ELECTRICAL_MEASUREMENT_SIMULATED_METER
 
 CHIP_ERROR PowerTopology::PowerTopologyDelegate::GetAvailableEndpointAtIndex(size_t index, EndpointId  &endpointId)
 {
@@ -193,6 +230,7 @@ esp_err_t electrical_measurement_example(uint16_t endpoint_id)
                            ElectricalPowerMeasurement::Feature::kDirectCurrent,
                            ElectricalPowerMeasurement::Feature::kAlternatingCurrent),
                        BitMask<ElectricalPowerMeasurement::OptionalAttributes, uint32_t>(
+                           ElectricalPowerMeasurement::OptionalAttributes::kOptionalAttributeRanges,
                            ElectricalPowerMeasurement::OptionalAttributes::kOptionalAttributeVoltage,
                            ElectricalPowerMeasurement::OptionalAttributes::kOptionalAttributeActiveCurrent
                        ));
@@ -211,10 +249,38 @@ esp_err_t electrical_measurement_example(uint16_t endpoint_id)
         return ESP_FAIL;
     }
 
+    ElectricalMeasurementAggregator::Config aggregatorConfig;
+    aggregatorConfig.attributeIntervalMs = CONFIG_ELECTRICAL_MEASUREMENT_ATTRIBUTE_INTERVAL_MS;
+    aggregatorConfig.energyIntervalMs = CONFIG_ELECTRICAL_MEASUREMENT_ENERGY_INTERVAL_MS;
+    err = gAggregator.Start(EndpointId(endpoint_id), *gEPMDelegate, aggregatorConfig);
+    if (err != CHIP_NO_ERROR) {
+        ESP_LOGE(TAG, "Failed to start the measurement aggregator: %" CHIP_ERROR_FORMAT, err.Format());
+        return ESP_FAIL;
+    }
+    gAggregatorStarted = true;
+
+#if CONFIG_ELECTRICAL_MEASUREMENT_SIMULATED_METER
+    esp_err_t meter_err = simulated_meter_start();
+    if (meter_err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to start the simulated meter: %s", esp_err_to_name(meter_err));
+        return meter_err;
+    }
+#endif
+
     ESP_LOGI(TAG, "Electrical Energy and Power Measurement clusters initialized successfully");
     return ESP_OK;
 }
 
+esp_err_t electrical_measurement_submit_sample(int64_t voltage_mv, int64_t active_current_ma, int64_t active_power_mw)
+{
+    if (!gAggregatorStarted) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    gAggregator.Submit(voltage_mv, active_current_ma, active_power_mw);
+    return ESP_OK;
+}
+
 //
 // Implementation of ElectricalPowerMeasurementDelegate methods
 //
@@ -366,18 +432,23 @@ CHIP_ERROR ElectricalPowerMeasurementDelegate::EndAccuracyRead()
 
 CHIP_ERROR ElectricalPowerMeasurementDelegate::StartRangesRead()
 {
-    /* Since we don't an implementation here we don't need to do anything here */
+    /* The ranges are only updated from the Matter thread, which also runs the read */
     return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR ElectricalPowerMeasurementDelegate::GetRangeByIndex(uint8_t index, Structs::MeasurementRangeStruct::Type  &range)
 {
-    return CHIP_ERROR_PROVIDER_LIST_EXHAUSTED;
+    if (index >= mRangeCount) {
+        return CHIP_ERROR_PROVIDER_LIST_EXHAUSTED;
+    }
+
+    range = mRanges[index];
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR ElectricalPowerMeasurementDelegate::EndRangesRead()
 {
-    /* Since we don't an implementation here we don't need to do anything here */
+    /* The ranges are only updated from the Matter thread, which also runs the read */
     return CHIP_NO_ERROR;
 }
 
@@ -612,6 +683,22 @@ CHIP_ERROR ElectricalPowerMeasurementDelegate::SetNeutralCurrent(DataModel::Null
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR ElectricalPowerMeasurementDelegate::SetRanges(const Structs::MeasurementRangeStruct::Type * ranges, uint8_t count)
+{
+    if (count > kMaxNumberOfRanges) {
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        mRanges[i] = ranges[i];
+    }
+    mRangeCount = count;
+    // The ranges carry their time window, so they change with every update
+    MatterReportingAttributeChangeCallback(mEndpointId, ElectricalPowerMeasurement::Id, Ranges::Id);
+
+    return CHIP_NO_ERROR;
+}
+
 // Implementation of ElectricalPowerMeasurementInstance methods
 CHIP_ERROR ElectricalPowerMeasurementInstance::Init()
 {
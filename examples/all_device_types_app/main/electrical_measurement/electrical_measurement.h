@@ -41,6 +41,19 @@ esp_err_t electrical_measurement_example(uint16_t endpoint_id);
  * @return ESP_OK on success, error code otherwise
  */
 esp_err_t send_energy_measurement_events(uint16_t endpoint_id);
+
+/**
+ * @brief Submit a sample of the meter to the measurement aggregator
+ *
+ * Can be called from any task at the sampling rate of the meter. The samples are aggregated and published
+ * to the Electrical Power and Energy Measurement clusters at the configured intervals.
+ *
+ * @param voltage_mv Voltage in mV
+ * @param active_current_ma Active current in mA
+ * @param active_power_mw Active power in mW, positive when importing
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE if the clusters are not initialized
+ */
+esp_err_t electrical_measurement_submit_sample(int64_t voltage_mv, int64_t active_current_ma, int64_t active_power_mw);
 #ifdef __cplusplus
 }
 #endif
@@ -83,6 +96,7 @@ public:
 
     static constexpr uint8_t kMaxNumberOfMeasurementTypes     = 14; // From spec
     static constexpr uint8_t kDefaultNumberOfMeasurementTypes = 1;
+    static constexpr uint8_t kMaxNumberOfRanges               = 3;
 
     // Attribute Accessors
     PowerModeEnum GetPowerMode() override
@@ -181,6 +195,7 @@ public:
     CHIP_ERROR SetFrequency(DataModel::Nullable<int64_t>);
     CHIP_ERROR SetPowerFactor(DataModel::Nullable<int64_t>);
     CHIP_ERROR SetNeutralCurrent(DataModel::Nullable<int64_t>);
+    CHIP_ERROR SetRanges(const Structs::MeasurementRangeStruct::Type * ranges, uint8_t count);
 
 private:
     // Attribute storage
@@ -198,6 +213,8 @@ private:
     DataModel::Nullable<int64_t> mFrequency;
     DataModel::Nullable<int64_t> mPowerFactor;
     DataModel::Nullable<int64_t> mNeutralCurrent;
+    Structs::MeasurementRangeStruct::Type mRanges[kMaxNumberOfRanges];
+    uint8_t mRangeCount = 0;
 };
 
 class ElectricalPowerMeasurementInstance : public Instance {
@@ -0,0 +1,85 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+
+#include "electrical_measurement_accumulator.h"
+
+#include <string.h>
+
+static void window_add(ElectricalMeasurementAccumulator::Window &window, int64_t value, uint64_t nowMs)
+{
+    if (window.count == 0 || value < window.min) {
+        window.min = value;
+        window.minSystimeMs = nowMs;
+    }
+    if (window.count == 0 || value > window.max) {
+        window.max = value;
+        window.maxSystimeMs = nowMs;
+    }
+    window.sum += value;
+    window.count++;
+}
+
+// Carry the whole mWh of an accumulator in mW x us
+static void carry_energy(int64_t &remainder, int64_t &mwh, int64_t unit)
+{
+    if (remainder >= unit) {
+        mwh += remainder / unit;
+        remainder %= unit;
+    }
+}
+
+void ElectricalMeasurementAccumulator::Reset(uint32_t windowsPerEnergyReport, uint64_t nowSystimeMs)
+{
+    *this = ElectricalMeasurementAccumulator();
+    mWindowsPerEnergyReport = windowsPerEnergyReport > 0 ? windowsPerEnergyReport : 1;
+    mWindowStartSystimeMs = nowSystimeMs;
+}
+
+void ElectricalMeasurementAccumulator::Add(int64_t voltageMv, int64_t activeCurrentMa, int64_t activePowerMw,
+                                           int64_t nowUs, uint64_t nowSystimeMs)
+{
+    mSamplesSinceEnergyReport++;
+    window_add(mWindows[static_cast<uint8_t>(Quantity::kVoltage)], voltageMv, nowSystimeMs);
+    window_add(mWindows[static_cast<uint8_t>(Quantity::kActiveCurrent)], activeCurrentMa, nowSystimeMs);
+    window_add(mWindows[static_cast<uint8_t>(Quantity::kActivePower)], activePowerMw, nowSystimeMs);
+
+    // The previous power holds until this sample
+    if (mHasLastSample) {
+        int64_t energy = mLastPowerMw * (nowUs - mLastSampleUs);
+        if (energy >= 0) {
+            mImportedRemainder += energy;
+            carry_energy(mImportedRemainder, mImportedMwh, kMilliwattMicrosecondsPerMilliwattHour);
+        } else {
+            mExportedRemainder -= energy;
+            carry_energy(mExportedRemainder, mExportedMwh, kMilliwattMicrosecondsPerMilliwattHour);
+        }
+    }
+    mHasLastSample = true;
+    mLastPowerMw = activePowerMw;
+    mLastSampleUs = nowUs;
+}
+
+void ElectricalMeasurementAccumulator::Close(uint64_t nowSystimeMs, Period &period)
+{
+    memcpy(period.windows, mWindows, sizeof(period.windows));
+    memset(mWindows, 0, sizeof(mWindows));
+    period.startSystimeMs = mWindowStartSystimeMs;
+    period.endSystimeMs = nowSystimeMs;
+    mWindowStartSystimeMs = nowSystimeMs;
+    period.publishAttributes = period.windows[0].count > 0;
+    period.importedMwh = mImportedMwh;
+    period.exportedMwh = mExportedMwh;
+
+    // Without a sample in the energy interval there is nothing to report, the next report covers it
+    period.publishEnergy = false;
+    if (++mWindowsSinceEnergyReport >= mWindowsPerEnergyReport) {
+        mWindowsSinceEnergyReport = 0;
+        period.publishEnergy = mSamplesSinceEnergyReport > 0;
+        mSamplesSinceEnergyReport = 0;
+    }
+}
@@ -0,0 +1,80 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Accumulation of the electrical samples of a meter, independent of chip and of the OS
+ *
+ * Keeps the window (min, max, sum) of the voltage, current and power, integrates the energy in fixed point
+ * and decides which publishes are due when a window is closed. The time is passed by the caller, the
+ * caller also serializes the calls.
+ *
+ * The energy is integrated in fixed point: power (mW) x time (us) is accumulated per direction and carried
+ * into whole mWh, so the cumulative energy does not drift whatever the sampling rate.
+ */
+class ElectricalMeasurementAccumulator {
+public:
+    enum class Quantity : uint8_t {
+        kVoltage,
+        kActiveCurrent,
+        kActivePower,
+        kCount,
+    };
+
+    static constexpr uint8_t kQuantityCount = static_cast<uint8_t>(Quantity::kCount);
+
+    struct Window {
+        int64_t min;
+        int64_t max;
+        int64_t sum;
+        uint32_t count;
+        uint64_t minSystimeMs;
+        uint64_t maxSystimeMs;
+    };
+
+    /** One closed window, and the publishes it is due for */
+    struct Period {
+        Window windows[kQuantityCount];
+        uint64_t startSystimeMs;
+        uint64_t endSystimeMs;
+        // The window has samples, the attributes are updated
+        bool publishAttributes;
+        // The energy interval elapsed with samples in it, the energy is reported
+        bool publishEnergy;
+        int64_t importedMwh;
+        int64_t exportedMwh;
+    };
+
+    /** Reset the accumulator, the energy report is due every windowsPerEnergyReport windows */
+    void Reset(uint32_t windowsPerEnergyReport, uint64_t nowSystimeMs);
+
+    /** Add one sample, in mV, mA and mW. Positive power is imported. */
+    void Add(int64_t voltageMv, int64_t activeCurrentMa, int64_t activePowerMw, int64_t nowUs, uint64_t nowSystimeMs);
+
+    /** Close the current window, the samples added from now on go to the next one */
+    void Close(uint64_t nowSystimeMs, Period &period);
+
+private:
+    static constexpr int64_t kMilliwattMicrosecondsPerMilliwattHour = 3600LL * 1000 * 1000;
+
+    Window mWindows[kQuantityCount] = {};
+    uint64_t mWindowStartSystimeMs = 0;
+    uint32_t mWindowsPerEnergyReport = 1;
+    uint32_t mWindowsSinceEnergyReport = 0;
+    uint32_t mSamplesSinceEnergyReport = 0;
+    bool mHasLastSample = false;
+    int64_t mLastPowerMw = 0;
+    int64_t mLastSampleUs = 0;
+    int64_t mImportedRemainder = 0; // mW x us, below one mWh
+    int64_t mExportedRemainder = 0;
+    int64_t mImportedMwh = 0;
+    int64_t mExportedMwh = 0;
+};
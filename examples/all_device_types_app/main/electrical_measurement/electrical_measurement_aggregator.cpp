@@ -0,0 +1,164 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+
+#include "electrical_measurement_aggregator.h"
+#include "electrical_measurement.h"
+
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <inttypes.h>
+#include <data_model_provider/clusters/electrical_energy_measurement/integration.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <system/SystemClock.h>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::DataModel;
+using namespace chip::app::Clusters;
+
+static const char *TAG = "electrical_aggregator";
+
+static constexpr uint8_t kQuantityCount = ElectricalMeasurementAccumulator::kQuantityCount;
+
+static const ElectricalPowerMeasurement::MeasurementTypeEnum kQuantityMeasurementTypes[kQuantityCount] = {
+    ElectricalPowerMeasurement::MeasurementTypeEnum::kVoltage,
+    ElectricalPowerMeasurement::MeasurementTypeEnum::kActiveCurrent,
+    ElectricalPowerMeasurement::MeasurementTypeEnum::kActivePower,
+};
+
+static uint64_t systime_ms()
+{
+    return static_cast<uint64_t>(System::SystemClock().GetMonotonicTimestamp().count());
+}
+
+CHIP_ERROR ElectricalMeasurementAggregator::Start(EndpointId endpointId,
+                                                  ElectricalPowerMeasurement::ElectricalPowerMeasurementDelegate &delegate,
+                                                  const Config &config)
+{
+    VerifyOrReturnError(config.attributeIntervalMs > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mEndpointId = endpointId;
+    mDelegate = &delegate;
+    mConfig = config;
+    uint32_t publishesPerEnergyReport = config.energyIntervalMs > config.attributeIntervalMs
+                                        ? (config.energyIntervalMs + config.attributeIntervalMs / 2) / config.attributeIntervalMs
+                                        : 1;
+
+    uint64_t nowMs = systime_ms();
+    taskENTER_CRITICAL(&mLock);
+    mAccumulator.Reset(publishesPerEnergyReport, nowMs);
+    mStats = {};
+    taskEXIT_CRITICAL(&mLock);
+    mReportedImportedMwh = 0;
+    mReportedExportedMwh = 0;
+    mEnergyPeriodStartSystimeMs = nowMs;
+
+    return DeviceLayer::SystemLayer().StartTimer(System::Clock::Milliseconds32(mConfig.attributeIntervalMs), OnPublishTimer,
+                                                 this);
+}
+
+void ElectricalMeasurementAggregator::Submit(int64_t voltageMv, int64_t activeCurrentMa, int64_t activePowerMw)
+{
+    int64_t nowUs = esp_timer_get_time();
+    uint64_t nowMs = systime_ms();
+
+    taskENTER_CRITICAL(&mLock);
+    mStats.sampleCount++;
+    mAccumulator.Add(voltageMv, activeCurrentMa, activePowerMw, nowUs, nowMs);
+    taskEXIT_CRITICAL(&mLock);
+}
+
+ElectricalMeasurementAggregator::Stats ElectricalMeasurementAggregator::GetStats()
+{
+    taskENTER_CRITICAL(&mLock);
+    Stats stats = mStats;
+    taskEXIT_CRITICAL(&mLock);
+    return stats;
+}
+
+void ElectricalMeasurementAggregator::OnPublishTimer(System::Layer *layer, void *context)
+{
+    auto *aggregator = static_cast<ElectricalMeasurementAggregator *>(context);
+    aggregator->Publish();
+    layer->StartTimer(System::Clock::Milliseconds32(aggregator->mConfig.attributeIntervalMs), OnPublishTimer, aggregator);
+}
+
+void ElectricalMeasurementAggregator::Publish()
+{
+    ElectricalMeasurementAccumulator::Period period;
+
+    // Close the window, the samples submitted from now on go to the next one
+    taskENTER_CRITICAL(&mLock);
+    mAccumulator.Close(systime_ms(), period);
+    mStats.attributePublishCount++;
+    taskEXIT_CRITICAL(&mLock);
+
+    // No sample in the window, the attributes keep their values
+    if (period.publishAttributes) {
+        const Window *windows = period.windows;
+        auto mean = [windows](Quantity quantity) {
+            const Window &window = windows[static_cast<uint8_t>(quantity)];
+            return MakeNullable(static_cast<int64_t>(window.sum / static_cast<int64_t>(window.count)));
+        };
+        mDelegate->SetVoltage(mean(Quantity::kVoltage));
+        mDelegate->SetActiveCurrent(mean(Quantity::kActiveCurrent));
+        mDelegate->SetActivePower(mean(Quantity::kActivePower));
+
+        ElectricalPowerMeasurement::Structs::MeasurementRangeStruct::Type ranges[kQuantityCount];
+        for (uint8_t i = 0; i < kQuantityCount; i++) {
+            ranges[i].measurementType = kQuantityMeasurementTypes[i];
+            ranges[i].min = windows[i].min;
+            ranges[i].max = windows[i].max;
+            ranges[i].startSystime = MakeOptional(period.startSystimeMs);
+            ranges[i].endSystime = MakeOptional(period.endSystimeMs);
+            ranges[i].minSystime = MakeOptional(windows[i].minSystimeMs);
+            ranges[i].maxSystime = MakeOptional(windows[i].maxSystimeMs);
+        }
+        mDelegate->SetRanges(ranges, kQuantityCount);
+    }
+
+    // No sample in the energy interval, no zero energy event
+    if (period.publishEnergy) {
+        PublishEnergy(period.importedMwh, period.exportedMwh, period.endSystimeMs);
+    }
+}
+
+void ElectricalMeasurementAggregator::PublishEnergy(int64_t importedMwh, int64_t exportedMwh, uint64_t nowSystimeMs)
+{
+    using ElectricalEnergyMeasurement::Structs::EnergyMeasurementStruct::Type;
+
+    auto energy = [](int64_t mwh, uint64_t startMs, uint64_t endMs) {
+        Type measurement;
+        measurement.energy = mwh;
+        measurement.startSystime = MakeOptional(startMs);
+        measurement.endSystime = MakeOptional(endMs);
+        return MakeOptional(measurement);
+    };
+
+    // The periodic energy of both directions goes in one event, and so does the cumulative energy
+    bool success = ElectricalEnergyMeasurement::NotifyPeriodicEnergyMeasured(
+                       mEndpointId, energy(importedMwh - mReportedImportedMwh, mEnergyPeriodStartSystimeMs, nowSystimeMs),
+                       energy(exportedMwh - mReportedExportedMwh, mEnergyPeriodStartSystimeMs, nowSystimeMs));
+    success &= ElectricalEnergyMeasurement::NotifyCumulativeEnergyMeasured(mEndpointId, energy(importedMwh, 0, nowSystimeMs),
+                                                                           energy(exportedMwh, 0, nowSystimeMs));
+    if (!success) {
+        ESP_LOGE(TAG, "Failed to report the energy of endpoint %u", mEndpointId);
+        return;
+    }
+
+    mReportedImportedMwh = importedMwh;
+    mReportedExportedMwh = exportedMwh;
+    mEnergyPeriodStartSystimeMs = nowSystimeMs;
+
+    taskENTER_CRITICAL(&mLock);
+    mStats.energyPublishCount++;
+    Stats stats = mStats;
+    taskEXIT_CRITICAL(&mLock);
+    ESP_LOGD(TAG, "samples: %" PRIu32 ", attribute publishes: %" PRIu32 ", energy reports: %" PRIu32,
+             stats.sampleCount, stats.attributePublishCount, stats.energyPublishCount);
+}
@@ -0,0 +1,85 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+
+#pragma once
+
+#include "electrical_measurement_accumulator.h"
+
+#include <freertos/FreeRTOS.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <system/SystemLayer.h>
+
+namespace chip {
+namespace app {
+namespace Clusters {
+namespace ElectricalPowerMeasurement {
+class ElectricalPowerMeasurementDelegate;
+} // namespace ElectricalPowerMeasurement
+} // namespace Clusters
+} // namespace app
+} // namespace chip
+
+/**
+ * Aggregation of the electrical samples of a meter
+ *
+ * The meter submits its samples at its own rate, from any task. A sample only updates the window of the
+ * voltage, current and power (min, max, sum) and integrates the energy, nothing reaches the data model.
+ * Every attribute interval, one batched update on the Matter thread publishes the window means to the
+ * ElectricalPowerMeasurement attributes and its min/max to the Ranges attribute. Every energy interval,
+ * the same update reports the periodic and cumulative energy of the ElectricalEnergyMeasurement cluster,
+ * unless no sample was submitted in the interval.
+ *
+ * The windows and the energy are kept by an ElectricalMeasurementAccumulator, under a spinlock.
+ */
+class ElectricalMeasurementAggregator {
+public:
+    struct Config {
+        uint32_t attributeIntervalMs = 10000;
+        // rounded to a multiple of attributeIntervalMs
+        uint32_t energyIntervalMs = 60000;
+    };
+
+    using Quantity = ElectricalMeasurementAccumulator::Quantity;
+    using Window = ElectricalMeasurementAccumulator::Window;
+
+    struct Stats {
+        uint32_t sampleCount;
+        uint32_t attributePublishCount;
+        uint32_t energyPublishCount;
+    };
+
+    /** Start publishing, called from the Matter thread once both clusters are initialized */
+    CHIP_ERROR Start(chip::EndpointId endpointId,
+                     chip::app::Clusters::ElectricalPowerMeasurement::ElectricalPowerMeasurementDelegate &delegate,
+                     const Config &config);
+
+    /** Submit one sample of the meter, in mV, mA and mW. Positive power is imported. */
+    void Submit(int64_t voltageMv, int64_t activeCurrentMa, int64_t activePowerMw);
+
+    Stats GetStats();
+
+private:
+    static void OnPublishTimer(chip::System::Layer *layer, void *context);
+    void Publish();
+    void PublishEnergy(int64_t importedMwh, int64_t exportedMwh, uint64_t nowSystimeMs);
+
+    chip::EndpointId mEndpointId = chip::kInvalidEndpointId;
+    chip::app::Clusters::ElectricalPowerMeasurement::ElectricalPowerMeasurementDelegate *mDelegate = nullptr;
+    Config mConfig;
+
+    portMUX_TYPE mLock = portMUX_INITIALIZER_UNLOCKED;
+    // Guarded by mLock
+    ElectricalMeasurementAccumulator mAccumulator;
+    Stats mStats = {};
+
+    // Matter thread only
+    int64_t mReportedImportedMwh = 0;
+    int64_t mReportedExportedMwh = 0;
+    uint64_t mEnergyPeriodStartSystimeMs = 0;
+};
@@ -136,6 +136,9 @@ extern "C" void app_main()
 
     aggregator_endpoint_id = endpoint::get_id(aggregator);
 
+    err = blemesh_bridge_init();
+    ABORT_APP_ON_FAILURE(err == ESP_OK, ESP_LOGE(TAG, "Failed to initialize the bridge, err:%d", err));
+
     /* Matter start */
     err = esp_matter::start(app_event_cb);
     ABORT_APP_ON_FAILURE(err == ESP_OK, ESP_LOGE(TAG, "Failed to start Matter, err:%d", err));
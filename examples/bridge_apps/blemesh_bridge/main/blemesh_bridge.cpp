@@ -14,6 +14,7 @@
 #include <esp_matter_core.h>
 #include <esp_matter_bridge.h>
 
+#include <app_bridge_outbound.h>
 #include <app_bridged_device.h>
 #include <blemesh_bridge.h>
 #include <app_blemesh.h>
@@ -25,6 +26,8 @@ using namespace esp_matter;
 using namespace esp_matter::cluster;
 extern uint16_t aggregator_endpoint_id;
 
+static app_bridge_outbound_handle_t s_outbound = NULL;
+
 /** Mesh Spec 4.2.1: "The Composition Data state contains information about a node,
  * the elements it includes, and the supported models. Composition Data Page 0 is mandatory."
  * Composition Data Page 0 can be used to determine device type.
@@ -54,6 +57,10 @@ esp_err_t blemesh_bridge_match_bridged_onoff_light(uint8_t *composition_data, ui
             ESP_LOGI(TAG, "Bridged node for 0x%04x bridged device on endpoint %d has been created", blemesh_addr,
                      app_bridge_get_matter_endpointid_by_blemesh_addr(blemesh_addr));
         } else {
+            // Devices which join together are stored in one batch, a failure only costs the batching
+            if (app_bridge_join_storage_batch() != ESP_OK) {
+                ESP_LOGW(TAG, "Failed to join the storage batch, the device is stored on its own");
+            }
             app_bridged_device_t *bridged_device =
                 app_bridge_create_bridged_device(node, aggregator_endpoint_id, ESP_MATTER_ON_OFF_LIGHT_DEVICE_TYPE_ID,
                                                  ESP_MATTER_BRIDGED_DEVICE_TYPE_BLEMESH,
@@ -68,6 +75,36 @@ esp_err_t blemesh_bridge_match_bridged_onoff_light(uint8_t *composition_data, ui
     return ESP_OK;
 }
 
+/* Send an attribute change to the mesh node, called from the outbound scheduler task */
+static esp_err_t blemesh_bridge_send(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id,
+                                     const esp_matter_attr_val_t *val, void *ctx)
+{
+    /* The device may have been removed while the change was pending */
+    uint16_t blemesh_addr = app_bridge_get_blemesh_addr_by_matter_endpointid(endpoint_id);
+    ESP_RETURN_ON_FALSE(blemesh_addr != 0xFFFF, ESP_ERR_NOT_FOUND, TAG, "Bridged mesh node of ep 0x%x removed",
+                        endpoint_id);
+
+    if (cluster_id == OnOff::Id && attribute_id == OnOff::Attributes::OnOff::Id) {
+        return app_ble_mesh_onoff_set(blemesh_addr, val->val.b);
+    }
+    return ESP_OK;
+}
+
+esp_err_t blemesh_bridge_init()
+{
+    app_bridge_outbound_config_t config = {
+        .name = "blemesh_outbound",
+        .coalesce_ms = CONFIG_BLEMESH_BRIDGE_OUTBOUND_COALESCE_MS,
+        .min_interval_ms = CONFIG_BLEMESH_BRIDGE_OUTBOUND_MIN_INTERVAL_MS,
+        .max_pending = MAX_BRIDGED_DEVICE_COUNT,
+        .task_stack_size = 3072,
+        .task_priority = 5,
+        .send_cb = blemesh_bridge_send,
+        .ctx = NULL,
+    };
+    return app_bridge_outbound_create(&config, &s_outbound);
+}
+
 esp_err_t blemesh_bridge_attribute_update(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id,
                                           esp_matter_attr_val_t *val, app_bridged_device_t *bridged_device)
 {
@@ -76,7 +113,8 @@ esp_err_t blemesh_bridge_attribute_update(uint16_t endpoint_id, uint32_t cluster
             if (attribute_id == OnOff::Attributes::OnOff::Id) {
                 ESP_LOGD(TAG, "Update Bridged Device, ep: 0x%x, cluster: 0x%lx, att: 0x%lx", endpoint_id, cluster_id,
                          attribute_id);
-                app_ble_mesh_onoff_set(bridged_device->dev_addr.blemesh_addr, val->val.b);
+                /* Sent by the outbound scheduler, so that a group command does not flood the mesh network */
+                return app_bridge_outbound_post(s_outbound, endpoint_id, cluster_id, attribute_id, val);
             }
         }
     } else {
@@ -20,6 +20,13 @@ extern "C" {
 #include <esp_matter_attribute_utils.h>
 #include <app_bridged_device.h>
 
+/**
+ * @brief Create the outbound scheduler forwarding the Matter attribute changes to the mesh nodes
+ *
+ * @return esp_err_t
+ */
+esp_err_t blemesh_bridge_init();
+
 /**
  * @brief
  *
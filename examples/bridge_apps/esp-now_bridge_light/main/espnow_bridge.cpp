@@ -35,6 +35,10 @@ esp_err_t espnow_bridge_match_bridged_switch(uint8_t espnow_macaddr[6], uint16_t
         ESP_LOGI(TAG, "Bridged node for " MACSTR " ESP-NOW device on endpoint %d has been created", MAC2STR(espnow_macaddr),
                  app_bridge_get_matter_endpointid_by_espnow_macaddr(espnow_macaddr));
     } else {
+        // Devices which join together are stored in one batch, a failure only costs the batching
+        if (app_bridge_join_storage_batch() != ESP_OK) {
+            ESP_LOGW(TAG, "Failed to join the storage batch, the device is stored on its own");
+        }
         app_bridged_device_t *bridged_device =
             app_bridge_create_bridged_device(node, aggregator_endpoint_id, matter_device_type_id,
                                              ESP_MATTER_BRIDGED_DEVICE_TYPE_ESPNOW,
@@ -4,12 +4,15 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <atomic>
+#include <mutex>
 #include <string>
 #include <cstring>
 #include <memory>
 #include <functional>
 #include <esp_http_client.h>
 #include <esp_log.h>
+#include <esp_timer.h>
 #include <cJSON.h>
 #include "esp_crt_bundle.h"
 #include "rainmaker_api.h"
@@ -28,6 +31,14 @@ static const char* rainmaker_node_mapping_payload_remove = "{\"node_id\":\"%s\",
 
 #define RAINMAKER_URL_LEN 256
 
+/* HTTP traffic counters, the client is used by the bridge task and the Matter attribute callbacks */
+static std::atomic<uint32_t> s_request_count(0);
+static std::atomic<uint32_t> s_tx_bytes(0);
+static std::atomic<uint32_t> s_rx_bytes(0);
+
+/* Timeout of each HTTP request, 0 keeps the default timeout of esp_http_client */
+static std::atomic<uint32_t> s_timeout_ms(0);
+
 /* RAII wrapper for HTTP client */
 class HttpClientWrapper {
 public:
@@ -125,11 +136,17 @@ esp_err_t RainmakerApi::MakeHttpRequest(esp_http_client_handle_t client, const c
         return ESP_ERR_INVALID_ARG;
     }
 
+    uint32_t timeout_ms = s_timeout_ms;
+    if (timeout_ms) {
+        esp_http_client_set_timeout_ms(client, timeout_ms);
+    }
+
     esp_err_t err = esp_http_client_open(client, post_data ? strlen(post_data) : 0);
     if (err != ESP_OK) {
         ESP_LOGE(TAG, "Failed to open HTTP connection: %s", esp_err_to_name(err));
         return err;
     }
+    s_request_count++;
 
     if (post_data) {
         ESP_LOGI(TAG, "Sending data: %s", post_data);
@@ -138,6 +155,7 @@ esp_err_t RainmakerApi::MakeHttpRequest(esp_http_client_handle_t client, const c
             ESP_LOGE(TAG, "Write failed");
             return ESP_FAIL;
         }
+        s_tx_bytes += wlen;
     }
 
     int content_length = esp_http_client_fetch_headers(client);
@@ -174,6 +192,7 @@ esp_err_t RainmakerApi::ReadHttpResponse(esp_http_client_handle_t client, char**
     }
 
     (*response_data)[read_len] = '\0';
+    s_rx_bytes += read_len;
     return ESP_OK;
 }
 
@@ -267,14 +286,31 @@ RainmakerApi::RainmakerApi() : access_token_(""), refresh_token_(""), base_url_(
 
 RainmakerApi::~RainmakerApi()
 {
+    if (params_client_) {
+        esp_http_client_cleanup(params_client_);
+        params_client_ = nullptr;
+    }
     access_token_.clear();
     refresh_token_.clear();
     base_url_.clear();
     user_id_.clear();
 }
 
+std::string RainmakerApi::GetAccessToken()
+{
+    std::lock_guard<std::mutex> lock(token_mutex_);
+    return access_token_;
+}
+
 esp_err_t RainmakerApi::Login(void)
 {
+    /* Requests running in parallel may all see an expired token, only one of them logs in at a time and the others
+     * use the token it got */
+    int64_t request_time = esp_timer_get_time();
+    std::lock_guard<std::mutex> login_lock(login_mutex_);
+    if (login_time_ > request_time && !GetAccessToken().empty()) {
+        return ESP_OK;
+    }
     if (refresh_token_.empty()) {
         ESP_LOGE(TAG, "Refresh token not available");
         return ESP_ERR_INVALID_STATE;
@@ -329,12 +365,19 @@ esp_err_t RainmakerApi::Login(void)
     MallocWrapper response_wrapper(response_data);
     ESP_LOGD(TAG, "Response data: %s", response_data);
 
-    return ParseLoginResponse(response_data, access_token_);
+    std::string access_token;
+    err = ParseLoginResponse(response_data, access_token);
+    if (err == ESP_OK) {
+        std::lock_guard<std::mutex> lock(token_mutex_);
+        access_token_ = access_token;
+        login_time_ = esp_timer_get_time();
+    }
+    return err;
 }
 
 esp_err_t RainmakerApi::GetUserInfo(void)
 {
-    if (access_token_.empty()) {
+    if (GetAccessToken().empty()) {
         ESP_LOGE(TAG, "Access token not available, need login first");
         if (Login() == ESP_OK) {
             return GetUserInfo();
@@ -358,7 +401,7 @@ esp_err_t RainmakerApi::GetUserInfo(void)
         return ESP_FAIL;
     }
 
-    SetCommonHeaders(client.get(), access_token_);
+    SetCommonHeaders(client.get(), GetAccessToken());
 
     esp_err_t err = MakeHttpRequest(client.get());
     if (err != ESP_OK) {
@@ -391,7 +434,7 @@ esp_err_t RainmakerApi::GetUserInfo(void)
 
 esp_err_t RainmakerApi::GetNodesRecursive(const char* start_id)
 {
-    if (access_token_.empty()) {
+    if (GetAccessToken().empty()) {
         ESP_LOGE(TAG, "Access token not available, need login first");
         if (Login() == ESP_OK) {
             return GetNodesRecursive(start_id);
@@ -423,7 +466,7 @@ esp_err_t RainmakerApi::GetNodesRecursive(const char* start_id)
         return ESP_FAIL;
     }
 
-    SetCommonHeaders(client.get(), access_token_);
+    SetCommonHeaders(client.get(), GetAccessToken());
 
     esp_err_t err = MakeHttpRequest(client.get());
     if (err != ESP_OK) {
@@ -467,7 +510,7 @@ esp_err_t RainmakerApi::RefreshNodes(void)
 
 char* RainmakerApi::GetNodeList(void)
 {
-    if (access_token_.empty()) {
+    if (GetAccessToken().empty()) {
         ESP_LOGE(TAG, "Access token not available, need login first");
         if (Login() == ESP_OK) {
             return GetNodeList();
@@ -494,7 +537,7 @@ char* RainmakerApi::GetNodeList(void)
         return nullptr;
     }
 
-    SetCommonHeaders(client.get(), access_token_);
+    SetCommonHeaders(client.get(), GetAccessToken());
 
     esp_err_t err = MakeHttpRequest(client.get());
     if (err != ESP_OK) {
@@ -518,9 +561,70 @@ char* RainmakerApi::GetNodeList(void)
     return response_data;
 }
 
+char* RainmakerApi::GetNodesDetails(const char* start_id)
+{
+    if (GetAccessToken().empty()) {
+        ESP_LOGE(TAG, "Access token not available, need login first");
+        if (Login() == ESP_OK) {
+            return GetNodesDetails(start_id);
+        }
+        return nullptr;
+    }
+
+    char url[RAINMAKER_URL_LEN];
+    const char* base_params = "?node_details=true&status=true&config=false&params=true&show_tags=false&is_matter=false";
+
+    if (start_id) {
+        snprintf(url, sizeof(url), "%s%s%s&start_id=%s",
+                 base_url_.c_str(), rainmaker_nodes_url, base_params, start_id);
+    } else {
+        snprintf(url, sizeof(url), "%s%s%s",
+                 base_url_.c_str(), rainmaker_nodes_url, base_params);
+    }
+
+    esp_http_client_config_t config = {
+        .url = url,
+        .method = HTTP_METHOD_GET,
+        .buffer_size_tx = 2048,
+        .crt_bundle_attach = esp_crt_bundle_attach,
+    };
+
+    HttpClientWrapper client(config);
+    if (!client.is_valid()) {
+        ESP_LOGE(TAG, "Failed to initialize HTTP client");
+        return nullptr;
+    }
+
+    SetCommonHeaders(client.get(), GetAccessToken());
+
+    esp_err_t err = MakeHttpRequest(client.get());
+    if (err != ESP_OK) {
+        return nullptr;
+    }
+
+    char* response_data = nullptr;
+    char* retry_result = nullptr;
+    err = HandleHttpResponse(client.get(), &response_data, [this, start_id, &retry_result]() -> esp_err_t {
+        if (Login() == ESP_OK) {
+            retry_result = GetNodesDetails(start_id);
+        }
+        return retry_result ? ESP_OK : ESP_ERR_INVALID_STATE;
+    });
+
+    if (retry_result) {
+        return retry_result;
+    }
+    if (err != ESP_OK && response_data) {
+        free(response_data);
+        return nullptr;
+    }
+
+    return response_data;
+}
+
 char* RainmakerApi::GetNodeConfig(const char* node_id)
 {
-    if (access_token_.empty()) {
+    if (GetAccessToken().empty()) {
         ESP_LOGE(TAG, "Access token not available, need login first");
         if (Login() == ESP_OK) {
             return GetNodeConfig(node_id);
@@ -544,7 +648,7 @@ char* RainmakerApi::GetNodeConfig(const char* node_id)
         return nullptr;
     }
 
-    SetCommonHeaders(client.get(), access_token_);
+    SetCommonHeaders(client.get(), GetAccessToken());
 
     esp_err_t err = MakeHttpRequest(client.get());
     if (err != ESP_OK) {
@@ -572,9 +676,30 @@ char* RainmakerApi::GetNodeConfig(const char* node_id)
     return response_data;
 }
 
+esp_http_client_handle_t RainmakerApi::GetParamsClient(const char* url)
+{
+    if (!params_client_) {
+        esp_http_client_config_t config = {
+            .url = url,
+            .method = HTTP_METHOD_PUT,
+            .buffer_size_tx = 2048,
+            .crt_bundle_attach = esp_crt_bundle_attach,
+            .keep_alive_enable = true,
+        };
+        params_client_ = esp_http_client_init(&config);
+        if (!params_client_) {
+            return nullptr;
+        }
+    } else {
+        esp_http_client_set_url(params_client_, url);
+        esp_http_client_set_method(params_client_, HTTP_METHOD_PUT);
+    }
+    return params_client_;
+}
+
 esp_err_t RainmakerApi::SetNodeParams(const char* payload)
 {
-    if (access_token_.empty()) {
+    if (GetAccessToken().empty()) {
         ESP_LOGE(TAG, "Access token not available, need login first");
         if (Login() == ESP_OK) {
             return SetNodeParams(payload);
@@ -585,25 +710,27 @@ esp_err_t RainmakerApi::SetNodeParams(const char* payload)
     char url[RAINMAKER_URL_LEN];
     snprintf(url, sizeof(url), "%s%s", base_url_.c_str(), rainmaker_nodes_params_url);
 
-    esp_http_client_config_t config = {
-        .url = url,
-        .method = HTTP_METHOD_PUT,
-        .buffer_size_tx = 2048,
-        .crt_bundle_attach = esp_crt_bundle_attach,
-    };
-
-    HttpClientWrapper client(config);
-    if (!client.is_valid()) {
+    std::lock_guard<std::recursive_mutex> lock(params_client_mutex_);
+    esp_http_client_handle_t client = GetParamsClient(url);
+    if (!client) {
         ESP_LOGE(TAG, "Failed to initialize HTTP client");
         return ESP_FAIL;
     }
 
-    SetCommonHeaders(client.get(), access_token_, true);
-    esp_http_client_set_post_field(client.get(), payload, strlen(payload));
+    /* The access token may have been refreshed since the previous request */
+    SetCommonHeaders(client, GetAccessToken(), true);
+    esp_http_client_set_post_field(client, payload, strlen(payload));
 
-    esp_err_t err = MakeHttpRequest(client.get(), payload);
+    esp_err_t err = MakeHttpRequest(client, payload);
     if (err != ESP_OK) {
-        return err;
+        /* The server may have closed the idle connection, reconnect once */
+        ESP_LOGW(TAG, "Params request failed on the kept alive connection, reconnecting");
+        esp_http_client_close(client);
+        err = MakeHttpRequest(client, payload);
+        if (err != ESP_OK) {
+            esp_http_client_close(client);
+            return err;
+        }
     }
 
     char* response_data = nullptr;
@@ -614,7 +741,7 @@ esp_err_t RainmakerApi::SetNodeParams(const char* payload)
         return ESP_ERR_INVALID_STATE;
     };
 
-    err = HandleHttpResponse(client.get(), &response_data, retry_func);
+    err = HandleHttpResponse(client, &response_data, retry_func);
     if (response_data) {
         free(response_data);
     }
@@ -623,7 +750,7 @@ esp_err_t RainmakerApi::SetNodeParams(const char* payload)
 
 char* RainmakerApi::GetNodeParams(const char* node_id)
 {
-    if (access_token_.empty()) {
+    if (GetAccessToken().empty()) {
         ESP_LOGE(TAG, "Access token not available, need login first");
         if (Login() == ESP_OK) {
             return GetNodeParams(node_id);
@@ -647,7 +774,7 @@ char* RainmakerApi::GetNodeParams(const char* node_id)
         return nullptr;
     }
 
-    SetCommonHeaders(client.get(), access_token_);
+    SetCommonHeaders(client.get(), GetAccessToken());
 
     esp_err_t err = MakeHttpRequest(client.get());
     if (err != ESP_OK) {
@@ -683,7 +810,10 @@ esp_err_t RainmakerApi::SetRefreshToken(const char* refresh_token)
     }
 
     refresh_token_ = refresh_token;
-    access_token_.clear();
+    {
+        std::lock_guard<std::mutex> lock(token_mutex_);
+        access_token_.clear();
+    }
     user_id_.clear();
     return ESP_OK;
 }
@@ -701,14 +831,17 @@ esp_err_t RainmakerApi::SetBaseUrl(const char* base_url)
 esp_err_t RainmakerApi::DeleteRefreshToken(void)
 {
     refresh_token_.clear();
-    access_token_.clear();
+    {
+        std::lock_guard<std::mutex> lock(token_mutex_);
+        access_token_.clear();
+    }
     user_id_.clear();
     return ESP_OK;
 }
 
 char* RainmakerApi::GetGroup(void)
 {
-    if (access_token_.empty()) {
+    if (GetAccessToken().empty()) {
         ESP_LOGE(TAG, "Access token not available, need login first");
         if (Login() == ESP_OK) {
             return GetGroup();
@@ -732,7 +865,7 @@ char* RainmakerApi::GetGroup(void)
         return nullptr;
     }
 
-    SetCommonHeaders(client.get(), access_token_);
+    SetCommonHeaders(client.get(), GetAccessToken());
 
     esp_err_t err = MakeHttpRequest(client.get());
     if (err != ESP_OK) {
@@ -762,7 +895,7 @@ char* RainmakerApi::GetGroup(void)
 
 esp_err_t RainmakerApi::CreateGroup(const char* group_name)
 {
-    if (access_token_.empty()) {
+    if (GetAccessToken().empty()) {
         ESP_LOGE(TAG, "Access token not available, need login first");
         if (Login() == ESP_OK) {
             return CreateGroup(group_name);
@@ -801,7 +934,7 @@ esp_err_t RainmakerApi::CreateGroup(const char* group_name)
     }
 
     /* Set headers */
-    SetCommonHeaders(client.get(), access_token_, true);
+    SetCommonHeaders(client.get(), GetAccessToken(), true);
     esp_http_client_set_post_field(client.get(), static_cast<char*>(post_data.get()),
                                    strlen(static_cast<char*>(post_data.get())));
 
@@ -827,7 +960,7 @@ esp_err_t RainmakerApi::CreateGroup(const char* group_name)
 
 esp_err_t RainmakerApi::DeleteGroup(const char* group_id)
 {
-    if (access_token_.empty()) {
+    if (GetAccessToken().empty()) {
         ESP_LOGE(TAG, "Access token not available, need login first");
         if (Login() == ESP_OK) {
             return DeleteGroup(group_id);
@@ -852,7 +985,7 @@ esp_err_t RainmakerApi::DeleteGroup(const char* group_id)
     }
 
     /* Set headers */
-    SetCommonHeaders(client.get(), access_token_, true);
+    SetCommonHeaders(client.get(), GetAccessToken(), true);
 
     esp_err_t err = MakeHttpRequest(client.get());
     if (err != ESP_OK) {
@@ -877,7 +1010,7 @@ esp_err_t RainmakerApi::DeleteGroup(const char* group_id)
 esp_err_t RainmakerApi::OperateNodeToGroup(const char* node_id, const char* group_id,
                                            esp_rainmaker_api_group_operation_type_t operation_type)
 {
-    if (access_token_.empty()) {
+    if (GetAccessToken().empty()) {
         ESP_LOGE(TAG, "Access token not available, need login first");
         if (Login() == ESP_OK) {
             return OperateNodeToGroup(node_id, group_id, operation_type);
@@ -927,7 +1060,7 @@ esp_err_t RainmakerApi::OperateNodeToGroup(const char* node_id, const char* grou
     }
 
     /* Set headers */
-    SetCommonHeaders(client.get(), access_token_, true);
+    SetCommonHeaders(client.get(), GetAccessToken(), true);
     esp_http_client_set_post_field(client.get(), static_cast<char*>(post_data.get()),
                                    strlen(static_cast<char*>(post_data.get())));
 
@@ -981,7 +1114,7 @@ static esp_err_t ParseNodeMappingResponse(char *response_data, char *request_id)
 esp_err_t RainmakerApi::SetNodeMapping(const char* user_id, const char* secret_key, const char* node_id,
                                        esp_rainmaker_api_node_mapping_operation_type_t operation_type, char *request_id)
 {
-    if (access_token_.empty()) {
+    if (GetAccessToken().empty()) {
         ESP_LOGE(TAG, "Access token not available, need login first");
         if (Login() == ESP_OK) {
             return SetNodeMapping(user_id, secret_key, node_id, operation_type, request_id);
@@ -1016,7 +1149,7 @@ esp_err_t RainmakerApi::SetNodeMapping(const char* user_id, const char* secret_k
         return ESP_FAIL;
     }
 
-    SetCommonHeaders(client.get(), access_token_, true);
+    SetCommonHeaders(client.get(), GetAccessToken(), true);
     esp_http_client_set_post_field(client.get(), payload, strlen(payload));
 
     esp_err_t err = MakeHttpRequest(client.get(), payload);
@@ -1071,7 +1204,7 @@ static esp_rainmaker_api_node_mapping_status_type_t ParseNodeMappingStatusRespon
 
 esp_rainmaker_api_node_mapping_status_type_t RainmakerApi::GetNodeMappingStatus(const char *request_id)
 {
-    if (access_token_.empty()) {
+    if (GetAccessToken().empty()) {
         ESP_LOGE(TAG, "Access token not available, need login first");
         if (Login() == ESP_OK) {
             return GetNodeMappingStatus(request_id);
@@ -1095,7 +1228,7 @@ esp_rainmaker_api_node_mapping_status_type_t RainmakerApi::GetNodeMappingStatus(
         return ESP_RAINMAKER_API_NODE_MAPPING_STATUS_INTERNAL_ERROR;
     }
 
-    SetCommonHeaders(client.get(), access_token_);
+    SetCommonHeaders(client.get(), GetAccessToken());
 
     esp_err_t err = MakeHttpRequest(client.get());
     if (err != ESP_OK) {
@@ -1128,7 +1261,7 @@ const std::string &RainmakerApi::GetUserId() const
 
 esp_err_t RainmakerApi::GetNodeConnectionStatus(const char *node_id, bool *connection_status)
 {
-    if (access_token_.empty()) {
+    if (GetAccessToken().empty()) {
         ESP_LOGE(TAG, "Access token not available, need login first");
         if (Login() == ESP_OK) {
             return GetNodeConnectionStatus(node_id, connection_status);
@@ -1153,7 +1286,7 @@ esp_err_t RainmakerApi::GetNodeConnectionStatus(const char *node_id, bool *conne
         return ESP_ERR_INVALID_STATE;
     }
 
-    SetCommonHeaders(client.get(), access_token_);
+    SetCommonHeaders(client.get(), GetAccessToken());
 
     esp_err_t err = MakeHttpRequest(client.get());
     if (err != ESP_OK) {
@@ -1244,6 +1377,28 @@ char* esp_rainmaker_api_get_nodes_list(void)
     return RainmakerApi::GetInstance().GetNodeList();
 }
 
+char* esp_rainmaker_api_get_nodes_details(const char* start_id)
+{
+    return RainmakerApi::GetInstance().GetNodesDetails(start_id);
+}
+
+esp_err_t esp_rainmaker_api_set_timeout(uint32_t timeout_ms)
+{
+    s_timeout_ms = timeout_ms;
+    return ESP_OK;
+}
+
+esp_err_t esp_rainmaker_api_get_stats(esp_rainmaker_api_stats_t *stats)
+{
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    stats->request_count = s_request_count;
+    stats->tx_bytes = s_tx_bytes;
+    stats->rx_bytes = s_rx_bytes;
+    return ESP_OK;
+}
+
 char* esp_rainmaker_api_get_node_config(const char* node_id)
 {
     return RainmakerApi::GetInstance().GetNodeConfig(node_id);
@@ -15,6 +15,7 @@
 #include <string>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <cstring>
 #include <cstdlib>
 #include <cJSON.h>
@@ -49,6 +50,15 @@ typedef enum {
     ESP_RAINMAKER_API_NODE_MAPPING_STATUS_INTERNAL_ERROR,   /* Node mapping status internal error */
 } esp_rainmaker_api_node_mapping_status_type_t;
 
+/**
+ * @brief HTTP traffic counters of the Rainmaker API client
+ */
+typedef struct {
+    uint32_t request_count;     /* Number of HTTP requests sent */
+    uint32_t tx_bytes;          /* Bytes of request bodies sent */
+    uint32_t rx_bytes;          /* Bytes of response bodies received */
+} esp_rainmaker_api_stats_t;
+
 /* Login to Rainmaker cloud using refresh token
  * This function attempts to login to the Rainmaker cloud using the stored refresh token.
  * If successful, it will store the access token for subsequent API calls.
@@ -76,6 +86,29 @@ esp_err_t esp_rainmaker_api_refresh_nodes(void);
  */
 char* esp_rainmaker_api_get_nodes_list(void);
 
+/* Get one page of node details
+ * This function retrieves the id, the parameters and the connection status of the nodes associated with the
+ * Rainmaker account in a single request. The "next_id" field of the response is the start_id of the next page,
+ * it is absent on the last page.
+ * The caller is responsible for freeing the returned string.
+ * @param start_id Node ID to start the page from, NULL for the first page
+ * Returns JSON string with node details (caller must free), nullptr on error
+ */
+char* esp_rainmaker_api_get_nodes_details(const char* start_id);
+
+/* Get the HTTP traffic counters
+ * @param stats Pointer to store the counters
+ * Returns ESP_OK on success, error code otherwise
+ */
+esp_err_t esp_rainmaker_api_get_stats(esp_rainmaker_api_stats_t *stats);
+
+/* Set the timeout of the HTTP requests
+ * The requests may be made from several tasks, the timeout bounds how long a slow node blocks one of them.
+ * @param timeout_ms Timeout in milliseconds, 0 to use the esp_http_client default
+ * Returns ESP_OK on success, error code otherwise
+ */
+esp_err_t esp_rainmaker_api_set_timeout(uint32_t timeout_ms);
+
 /* Get node config
  * This function retrieves the config of a node (device) in the Rainmaker cloud.
  * The caller is responsible for freeing the returned string.
@@ -230,6 +263,13 @@ public:
      */
     char* GetNodeList(void);
 
+    /**
+     * @brief Get one page of node details, including parameters and connection status
+     * @param start_id Node ID to start the page from, nullptr for the first page
+     * @return JSON string with node details (caller must free), nullptr on error
+     */
+    char* GetNodesDetails(const char* start_id);
+
     /**
      * @brief Get node config
      * @param node_id Node ID
@@ -344,11 +384,32 @@ private:
      */
     ~RainmakerApi();
 
-    std::string access_token_;   /* Current access token */
+    std::string access_token_;   /* Current access token, guarded by token_mutex_ */
     std::string refresh_token_;  /* Stored refresh token */
     std::string base_url_;       /* Base URL for Rainmaker API */
     std::string user_id_;        /* User ID */
 
+    std::mutex token_mutex_;     /* Guards access_token_, the API is used from several tasks */
+    std::mutex login_mutex_;     /* Serializes the token refresh */
+    int64_t login_time_ = 0;     /* esp_timer time of the last successful login, guarded by login_mutex_ */
+
+    /**
+     * @brief Get a copy of the current access token
+     * @return Access token, empty if not logged in
+     */
+    std::string GetAccessToken();
+
+    /* Kept alive across the set node params requests so that each update does not pay for a new TLS handshake */
+    esp_http_client_handle_t params_client_ = nullptr;
+    std::recursive_mutex params_client_mutex_;
+
+    /**
+     * @brief Get the persistent HTTP client for the node params requests, creating it on first use
+     * @param url URL of the node params request
+     * @return HTTP client handle, nullptr on failure
+     */
+    esp_http_client_handle_t GetParamsClient(const char* url);
+
     /**
      * @brief Recursively get nodes with pagination
      * @param start_id Starting node ID for pagination
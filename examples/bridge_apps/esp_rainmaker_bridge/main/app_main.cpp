@@ -153,6 +153,7 @@ extern "C" void app_main()
     esp_matter::console::diagnostics_register_commands();
     esp_matter::console::wifi_register_commands();
     esp_matter::console::factoryreset_register_commands();
+    rainmaker_bridge_register_commands();
     esp_matter::console::init();
 #endif
 }
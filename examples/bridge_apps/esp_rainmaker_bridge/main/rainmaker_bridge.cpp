@@ -10,9 +10,15 @@
 #include <esp_err.h>
 #include <esp_log.h>
 #include <esp_event.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
 #include <esp_matter.h>
 #include <esp_matter_bridge.h>
+#include <esp_matter_console.h>
 #include <esp_rmaker_standard_types.h>
+#include <inttypes.h>
 #include "esp_rmaker_standard_params.h"
 #include <json_parser.h>
 #include <json_generator.h>
@@ -44,6 +50,67 @@ using namespace esp_matter::cluster;
 
 extern uint16_t aggregator_endpoint_id;
 
+#define RMAKER_PARAM_UNKNOWN INT32_MIN
+
+/* Last known params of a rainmaker node, the sync loop only pushes the values which changed since the last cycle.
+ * The params written from the Matter side update it as well, so that they are not seen as a change of the node. */
+typedef struct {
+    uint16_t endpoint_id;
+    uint32_t last_seen_cycle;
+    int32_t power;
+    int32_t brightness;
+    int32_t hue;
+    int32_t saturation;
+    int32_t cct;
+} rainmaker_node_state_t;
+
+/* Written by the sync task and by the Matter callbacks */
+static rainmaker_node_state_t node_states[MAX_BRIDGED_DEVICE_COUNT];
+static portMUX_TYPE node_states_lock = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t sync_cycle = 0;
+
+static struct {
+    uint32_t attribute_update_count;
+} sync_stats;
+
+typedef enum {
+    RMAKER_PARAM_POWER = 0,
+    RMAKER_PARAM_BRIGHTNESS,
+    RMAKER_PARAM_HUE,
+    RMAKER_PARAM_SATURATION,
+    RMAKER_PARAM_CCT,
+    RMAKER_PARAM_MAX,
+} rmaker_param_t;
+
+static const char *rmaker_param_names[RMAKER_PARAM_MAX] = {"Power", "Brightness", "Hue", "Saturation", "CCT"};
+
+/* Param changes of the Matter side waiting to be sent to a rainmaker node */
+typedef struct {
+    uint16_t endpoint_id;
+    uint8_t param_mask;
+    int values[RMAKER_PARAM_MAX];
+    char node_id[33];
+    char node_name[33];
+} rainmaker_pending_params_t;
+
+static rainmaker_pending_params_t pending_params[MAX_BRIDGED_DEVICE_COUNT];
+static portMUX_TYPE pending_params_lock = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t params_task = NULL;
+
+/* Node config request of a newly seen rainmaker node, run by the HTTP worker pool */
+typedef struct {
+    char node_id[33];
+    char node_name[32];
+    uint32_t device_type_id;
+    esp_err_t err;
+} rainmaker_config_job_t;
+
+/* Bounded set of tasks making the per node HTTP requests, so that one slow node does not delay the others */
+static struct {
+    QueueHandle_t jobs;
+    SemaphoreHandle_t done;
+} http_pool;
+
 static esp_err_t attribute_update(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id, int value)
 {
     esp_err_t err = ESP_OK;
@@ -93,66 +160,11 @@ static esp_err_t attribute_update(uint16_t endpoint_id, uint32_t cluster_id, uin
     }
 
     attribute::report(endpoint_id, cluster_id, attribute_id, &val);
+    sync_stats.attribute_update_count++;
 
     return err;
 }
 
-static esp_err_t get_attribute_value_from_rainmaker_device(uint16_t endpoint_id, const char *node_id, const char *node_name)
-{
-    int attribute_value;
-    jparse_ctx_t jctx;
-    bool power;
-
-    char* receive_buffer = esp_rainmaker_api_get_node_params(node_id);
-
-    if (receive_buffer == NULL) {
-        return ESP_FAIL;
-    }
-
-    if (json_parse_start(&jctx, receive_buffer, strlen(receive_buffer)) != 0) {
-        free(receive_buffer);
-        return ESP_FAIL;
-    }
-
-    if (node_name[0] != 0) {
-        if (json_obj_get_object(&jctx, node_name) == 0) {
-            if (json_obj_get_int(&jctx, "Brightness", &attribute_value) == 0) {
-                if (attribute_value > 0) {
-                    attribute_update(endpoint_id, LevelControl::Id, LevelControl::Attributes::CurrentLevel::Id, attribute_value);
-                }
-            }
-
-            if (json_obj_get_int(&jctx, "Hue", &attribute_value) == 0) {
-                attribute_update(endpoint_id, ColorControl::Id, ColorControl::Attributes::CurrentHue::Id, attribute_value);
-            }
-
-            if (json_obj_get_bool(&jctx, "Power", &power) == 0) {
-                attribute_value = power;
-                attribute_update(endpoint_id, OnOff::Id, OnOff::Attributes::OnOff::Id, attribute_value);
-            }
-
-            if (json_obj_get_int(&jctx, "Saturation", &attribute_value) == 0) {
-                attribute_update(endpoint_id, ColorControl::Id, ColorControl::Attributes::CurrentSaturation::Id, attribute_value);
-            }
-
-            if (json_obj_get_int(&jctx, "CCT", &attribute_value) == 0) {
-                attribute_update(endpoint_id, ColorControl::Id, ColorControl::Attributes::ColorTemperatureMireds::Id, attribute_value);
-            }
-        } else {
-            ESP_LOGE(TAG, "No light param found in json ");
-        }
-        json_obj_leave_object(&jctx);
-    } else {
-        /* Todo: add other device types later */
-    }
-
-    json_parse_end(&jctx);
-
-    free(receive_buffer);
-
-    return ESP_OK;
-}
-
 static uint32_t matter_get_device_type_from_rainmaker_device(const char *input_buf, size_t buf_length, const char *node_name)
 {
     jparse_ctx_t jctx;
@@ -221,99 +233,310 @@ static uint32_t matter_get_device_type_from_rainmaker_device(const char *input_b
     return matter_device_type_id;
 }
 
-static esp_err_t rainmaker_bridge_match_device(const char *node_id, const char *node_name, uint32_t device_type_id)
+static rainmaker_node_state_t *get_node_state(uint16_t endpoint_id)
+{
+    rainmaker_node_state_t *state = NULL;
+    rainmaker_node_state_t *free_state = NULL;
+    taskENTER_CRITICAL(&node_states_lock);
+    for (size_t i = 0; i < MAX_BRIDGED_DEVICE_COUNT; i++) {
+        if (node_states[i].endpoint_id == endpoint_id) {
+            state = &node_states[i];
+            break;
+        }
+        if (!free_state && node_states[i].endpoint_id == chip::kInvalidEndpointId) {
+            free_state = &node_states[i];
+        }
+    }
+    if (!state && free_state) {
+        state = free_state;
+        state->endpoint_id = endpoint_id;
+        state->power = RMAKER_PARAM_UNKNOWN;
+        state->brightness = RMAKER_PARAM_UNKNOWN;
+        state->hue = RMAKER_PARAM_UNKNOWN;
+        state->saturation = RMAKER_PARAM_UNKNOWN;
+        state->cct = RMAKER_PARAM_UNKNOWN;
+    }
+    taskEXIT_CRITICAL(&node_states_lock);
+    return state;
+}
+
+static void release_node_state(uint16_t endpoint_id)
 {
-    node_t *node = node::get();
+    taskENTER_CRITICAL(&node_states_lock);
+    for (size_t i = 0; i < MAX_BRIDGED_DEVICE_COUNT; i++) {
+        if (node_states[i].endpoint_id == endpoint_id) {
+            node_states[i].endpoint_id = chip::kInvalidEndpointId;
+        }
+    }
+    taskEXIT_CRITICAL(&node_states_lock);
+}
 
-    if (app_bridge_get_matter_endpointid_by_rainmaker_node_id(node_id) == chip::kInvalidEndpointId) {
-        app_bridged_device_t *bridged_device = app_bridge_create_bridged_device(node, aggregator_endpoint_id, device_type_id,
-                                                                                ESP_MATTER_BRIDGED_DEVICE_TYPE_RAINMAKER,
-                                                                                app_bridge_rainmaker_address(node_id, node_name), NULL);
-        ESP_RETURN_ON_FALSE(bridged_device, ESP_FAIL, TAG, "Failed to create bridged device (rainmaker device)");
-    } else {
-        ESP_LOGI(TAG, "Bridged node for %s rainmaker device has been created", node_id);
+static int32_t *get_cached_param(rainmaker_node_state_t *state, uint8_t param)
+{
+    switch (param) {
+    case RMAKER_PARAM_POWER:
+        return &state->power;
+    case RMAKER_PARAM_BRIGHTNESS:
+        return &state->brightness;
+    case RMAKER_PARAM_HUE:
+        return &state->hue;
+    case RMAKER_PARAM_SATURATION:
+        return &state->saturation;
+    case RMAKER_PARAM_CCT:
+        return &state->cct;
+    default:
+        break;
     }
+    return NULL;
+}
 
-    return ESP_OK;
+/* Record a param sent to the node from the Matter side as its last known value */
+static void set_cached_param(uint16_t endpoint_id, uint8_t param, int value)
+{
+    taskENTER_CRITICAL(&node_states_lock);
+    for (size_t i = 0; i < MAX_BRIDGED_DEVICE_COUNT; i++) {
+        if (node_states[i].endpoint_id == endpoint_id) {
+            int32_t *cached = get_cached_param(&node_states[i], param);
+            if (cached) {
+                *cached = value;
+            }
+            break;
+        }
+    }
+    taskEXIT_CRITICAL(&node_states_lock);
 }
 
-static esp_err_t rainmaker_bridge_get_param_from_device(const char* node_id, uint16_t endpoint_id)
+static bool is_light_endpoint(uint16_t endpoint_id)
 {
-    node_t *node = node::get();
-    endpoint_t *dev_endpoint = endpoint::get(node, endpoint_id);
+    endpoint_t *dev_endpoint = endpoint::get(node::get(), endpoint_id);
     uint8_t device_type_count = endpoint::get_device_type_count(dev_endpoint);
     uint32_t dev_type_id;
     uint8_t dev_type_ver;
 
     for (uint8_t i = 0; i < device_type_count; ++i) {
-        if ((ESP_OK == endpoint::get_device_type_at_index(dev_endpoint, i, dev_type_id, dev_type_ver))) {
-            ESP_LOGI(TAG, "Endpoint Id: %d--Node Id: %s Device Type: %ld\n", endpoint_id, node_id, dev_type_id);
-            if (dev_type_id != endpoint::bridged_node::get_device_type_id()) {
-                break;
-            }
+        if (ESP_OK != endpoint::get_device_type_at_index(dev_endpoint, i, dev_type_id, dev_type_ver)) {
+            continue;
+        }
+        switch (dev_type_id) {
+        case ESP_MATTER_EXTENDED_COLOR_LIGHT_DEVICE_TYPE_ID:
+        case ESP_MATTER_COLOR_TEMPERATURE_LIGHT_DEVICE_TYPE_ID:
+        case ESP_MATTER_DIMMABLE_LIGHT_DEVICE_TYPE_ID:
+        case ESP_MATTER_ON_OFF_LIGHT_DEVICE_TYPE_ID:
+            return true;
+        /* Todo: add other device types */
+        default:
+            break;
         }
     }
+    return false;
+}
 
-    switch (dev_type_id) {
-    case ESP_MATTER_EXTENDED_COLOR_LIGHT_DEVICE_TYPE_ID:
-    case ESP_MATTER_COLOR_TEMPERATURE_LIGHT_DEVICE_TYPE_ID:
-    case ESP_MATTER_DIMMABLE_LIGHT_DEVICE_TYPE_ID:
-    case ESP_MATTER_ON_OFF_LIGHT_DEVICE_TYPE_ID: {
-        get_attribute_value_from_rainmaker_device(endpoint_id, node_id, app_bridge_get_rainmaker_node_name_by_matter_endpointid(endpoint_id));
-    }
-    break;
-    /* Todo: add other device types */
-    default:
-        break;
+/* Update the attribute only if the rainmaker param changed since the last cycle */
+static void sync_param(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id, int32_t *cached,
+                       int value)
+{
+    taskENTER_CRITICAL(&node_states_lock);
+    bool changed = *cached != value;
+    *cached = value;
+    taskEXIT_CRITICAL(&node_states_lock);
+    if (changed) {
+        attribute_update(endpoint_id, cluster_id, attribute_id, value);
     }
-    return ESP_OK;
 }
 
-static esp_err_t rainmaker_bridge_update_online_state(const char* node_id, uint16_t endpoint_id)
+/* The params of the node in the node details object the parser is in */
+static void sync_light_params(jparse_ctx_t *jctx, uint16_t endpoint_id, const char *node_name,
+                              rainmaker_node_state_t *state)
 {
-    esp_err_t err = ESP_OK;
-    bool connection_status = false;
-    attribute_t *attribute = attribute::get(endpoint_id, BridgedDeviceBasicInformation::Id, BridgedDeviceBasicInformation::Attributes::Reachable::Id);
-    esp_matter_attr_val_t val = esp_matter_invalid(NULL);
-    attribute::get_val(attribute, &val);
+    int attribute_value;
+    bool power;
 
-    err = esp_rainmaker_api_get_node_connection_status(node_id, &connection_status);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to get node %s connection status", node_id);
+    if (json_obj_get_object(jctx, "params") != 0) {
+        return;
+    }
+    if (json_obj_get_object(jctx, node_name) == 0) {
+        if (json_obj_get_int(jctx, "Brightness", &attribute_value) == 0 && attribute_value > 0) {
+            sync_param(endpoint_id, LevelControl::Id, LevelControl::Attributes::CurrentLevel::Id, &state->brightness,
+                       attribute_value);
+        }
+        if (json_obj_get_int(jctx, "Hue", &attribute_value) == 0) {
+            sync_param(endpoint_id, ColorControl::Id, ColorControl::Attributes::CurrentHue::Id, &state->hue,
+                       attribute_value);
+        }
+        if (json_obj_get_bool(jctx, "Power", &power) == 0) {
+            sync_param(endpoint_id, OnOff::Id, OnOff::Attributes::OnOff::Id, &state->power, power);
+        }
+        if (json_obj_get_int(jctx, "Saturation", &attribute_value) == 0) {
+            sync_param(endpoint_id, ColorControl::Id, ColorControl::Attributes::CurrentSaturation::Id,
+                       &state->saturation, attribute_value);
+        }
+        if (json_obj_get_int(jctx, "CCT", &attribute_value) == 0) {
+            sync_param(endpoint_id, ColorControl::Id, ColorControl::Attributes::ColorTemperatureMireds::Id,
+                       &state->cct, attribute_value);
+        }
+        json_obj_leave_object(jctx);
     } else {
-        ESP_LOGI(TAG, "node %s connection status: %d", node_id, connection_status);
-        if (val.val.b != connection_status) {
-            val.val.b = connection_status;
-            attribute::update(endpoint_id, BridgedDeviceBasicInformation::Id, BridgedDeviceBasicInformation::Attributes::Reachable::Id, &val);
+        ESP_LOGE(TAG, "No light param found in json ");
+    }
+    json_obj_leave_object(jctx);
+}
+
+/* The connection status of the node in the node details object the parser is in */
+static void sync_online_state(jparse_ctx_t *jctx, uint16_t endpoint_id)
+{
+    bool connected;
+
+    if (json_obj_get_object(jctx, "status") != 0) {
+        return;
+    }
+    if (json_obj_get_object(jctx, "connectivity") == 0) {
+        if (json_obj_get_bool(jctx, "connected", &connected) == 0) {
+            // Reachable is also changed by the bridge itself, so compare against the attribute and not a cache
+            attribute_t *attribute = attribute::get(endpoint_id, BridgedDeviceBasicInformation::Id,
+                                                    BridgedDeviceBasicInformation::Attributes::Reachable::Id);
+            esp_matter_attr_val_t val = esp_matter_invalid(NULL);
+            if (attribute && attribute::get_val(attribute, &val) == ESP_OK && val.val.b != connected) {
+                val = esp_matter_bool(connected);
+                attribute::update(endpoint_id, BridgedDeviceBasicInformation::Id,
+                                  BridgedDeviceBasicInformation::Attributes::Reachable::Id, &val);
+                sync_stats.attribute_update_count++;
+            }
         }
+        json_obj_leave_object(jctx);
     }
-    return err;
+    json_obj_leave_object(jctx);
 }
 
-static esp_err_t rainmaker_bridge_add_new_device(const char *node_id)
+/* Get the node config with back-off between the retries, a failed node is retried in the next sync cycle */
+static void rainmaker_fetch_node_config(rainmaker_config_job_t *job)
 {
-    uint32_t matter_device_type = 0;
-    char node_name[32] = {0};
+    uint32_t backoff_ms = CONFIG_RAINMAKER_HTTP_BACKOFF_MS;
+    char *receive_buffer = NULL;
 
-    if (node_id != NULL) {
-        char* receive_buffer = esp_rainmaker_api_get_node_config(node_id);
-        if (receive_buffer == NULL) {
-            ESP_LOGE(TAG, "Get Node %s config failed\n", node_id);
-            return ESP_FAIL;
+    for (int attempt = 0; attempt <= CONFIG_RAINMAKER_HTTP_RETRY_COUNT; attempt++) {
+        if (attempt > 0) {
+            vTaskDelay(pdMS_TO_TICKS(backoff_ms));
+            backoff_ms *= 2;
         }
-        matter_device_type = matter_get_device_type_from_rainmaker_device(receive_buffer, strlen(receive_buffer), node_name);
-        if ((matter_device_type != INVALID_MATTER_DEVICE_TYPE) && (node_name[0] != 0)) {
-            rainmaker_bridge_match_device(node_id, node_name, matter_device_type);
-        } else {
-            ESP_LOGW(TAG, "Node %s device type 0x%lx is invalid\n", node_id, matter_device_type);
-            free(receive_buffer);
-            return ESP_ERR_NOT_FOUND;
+        receive_buffer = esp_rainmaker_api_get_node_config(job->node_id);
+        if (receive_buffer) {
+            break;
+        }
+    }
+    if (receive_buffer == NULL) {
+        ESP_LOGE(TAG, "Get Node %s config failed", job->node_id);
+        job->err = ESP_FAIL;
+        return;
+    }
+
+    job->device_type_id = matter_get_device_type_from_rainmaker_device(receive_buffer, strlen(receive_buffer),
+                                                                       job->node_name);
+    free(receive_buffer);
+    if ((job->device_type_id == INVALID_MATTER_DEVICE_TYPE) || (job->node_name[0] == 0)) {
+        ESP_LOGW(TAG, "Node %s device type 0x%" PRIx32 " is invalid", job->node_id, job->device_type_id);
+        job->err = ESP_ERR_NOT_FOUND;
+        return;
+    }
+    job->err = ESP_OK;
+}
+
+static void rainmaker_http_worker_task(void *pvParameters)
+{
+    rainmaker_config_job_t *job = NULL;
+    while (true) {
+        if (xQueueReceive(http_pool.jobs, &job, portMAX_DELAY) == pdTRUE) {
+            rainmaker_fetch_node_config(job);
+            xSemaphoreGive(http_pool.done);
+        }
+    }
+}
+
+static esp_err_t rainmaker_http_pool_init()
+{
+    http_pool.jobs = xQueueCreate(CONFIG_RAINMAKER_HTTP_WORKER_COUNT, sizeof(rainmaker_config_job_t *));
+    http_pool.done = xSemaphoreCreateCounting(MAX_BRIDGED_DEVICE_COUNT, 0);
+    ESP_RETURN_ON_FALSE(http_pool.jobs && http_pool.done, ESP_ERR_NO_MEM, TAG, "Failed to create the HTTP pool");
+    for (int i = 0; i < CONFIG_RAINMAKER_HTTP_WORKER_COUNT; i++) {
+        char name[16];
+        snprintf(name, sizeof(name), "rmaker_http%d", i);
+        if (xTaskCreate(rainmaker_http_worker_task, name, CONFIG_RAINMAKER_TASK_STACK_SIZE, NULL, 5, NULL) != pdPASS) {
+            ESP_LOGE(TAG, "Failed to create the HTTP worker %d", i);
+            return ESP_ERR_NO_MEM;
         }
-        free(receive_buffer);
     }
     return ESP_OK;
 }
 
+/* Get the configs of the new nodes in the worker pool and create their bridged devices in one batch */
+static void rainmaker_bridge_add_new_devices(rainmaker_config_job_t *jobs, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        rainmaker_config_job_t *job = &jobs[i];
+        xQueueSend(http_pool.jobs, &job, portMAX_DELAY);
+    }
+    for (size_t i = 0; i < count; i++) {
+        xSemaphoreTake(http_pool.done, portMAX_DELAY);
+    }
+
+    app_bridged_device_config_t *configs =
+        (app_bridged_device_config_t *)calloc(count, sizeof(app_bridged_device_config_t));
+    app_bridged_device_t **devices = (app_bridged_device_t **)calloc(count, sizeof(app_bridged_device_t *));
+    if (!configs || !devices) {
+        ESP_LOGE(TAG, "Failed to allocate the bridged device configs");
+        free(configs);
+        free(devices);
+        return;
+    }
+    size_t config_count = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (jobs[i].err != ESP_OK) {
+            continue;
+        }
+        configs[config_count].matter_device_type_id = jobs[i].device_type_id;
+        configs[config_count].bridged_device_type = ESP_MATTER_BRIDGED_DEVICE_TYPE_RAINMAKER;
+        configs[config_count].bridged_device_address = app_bridge_rainmaker_address(jobs[i].node_id, jobs[i].node_name);
+        config_count++;
+    }
+    if (config_count > 0) {
+        app_bridge_create_bridged_devices(node::get(), aggregator_endpoint_id, configs, config_count, devices);
+    }
+    free(configs);
+    free(devices);
+}
+
+/* Collect the nodes of the page which are not bridged yet */
+static esp_err_t rainmaker_collect_new_nodes(char *out_buf, size_t out_buf_len, rainmaker_config_job_t **jobs,
+                                             size_t *count)
+{
+    jparse_ctx_t jctx;
+    int total_count = 0;
+
+    *jobs = NULL;
+    *count = 0;
+    if (json_parse_start(&jctx, out_buf, out_buf_len) != 0) {
+        return ESP_FAIL;
+    }
+    if (json_obj_get_array(&jctx, "node_details", &total_count) == 0 && total_count > 0) {
+        *jobs = (rainmaker_config_job_t *)calloc(total_count, sizeof(rainmaker_config_job_t));
+        for (int i = 0; *jobs && i < total_count; i++) {
+            if (json_arr_get_object(&jctx, i) != 0) {
+                continue;
+            }
+            rainmaker_config_job_t *job = &(*jobs)[*count];
+            /* No more devices than the bridge can hold are fetched */
+            if (*count < MAX_BRIDGED_DEVICE_COUNT &&
+                    json_obj_get_string(&jctx, "id", job->node_id, sizeof(job->node_id)) == 0 &&
+                    app_bridge_get_matter_endpointid_by_rainmaker_node_id(job->node_id) == chip::kInvalidEndpointId) {
+                (*count)++;
+            }
+            json_arr_leave_object(&jctx);
+        }
+        json_obj_leave_array(&jctx);
+    }
+    json_parse_end(&jctx);
+    return (total_count > 0 && !*jobs) ? ESP_ERR_NO_MEM : ESP_OK;
+}
+
 static esp_err_t rainmaker_bridge_delete_device(uint16_t endpoint_id)
 {
     const char* node_id = app_bridge_get_rainmaker_node_id_by_matter_endpointid(endpoint_id);
@@ -334,6 +557,7 @@ static esp_err_t rainmaker_bridge_delete_device(uint16_t endpoint_id)
     return ESP_OK;
 }
 
+/* Remove the bridged rainmaker devices which were not in the node list of a complete sync cycle */
 static void matter_check_and_remove_not_exist_device()
 {
     uint16_t matter_endpoint_id_array[MAX_BRIDGED_DEVICE_COUNT];
@@ -343,73 +567,154 @@ static void matter_check_and_remove_not_exist_device()
         if (matter_endpoint_id_array[i] != chip::kInvalidEndpointId) {
             const char *node_id = app_bridge_get_rainmaker_node_id_by_matter_endpointid(matter_endpoint_id_array[i]);
             if (node_id != NULL) {
-                char *buffer = esp_rainmaker_api_get_node_params(node_id);
-                if (buffer == NULL) {
+                rainmaker_node_state_t *state = get_node_state(matter_endpoint_id_array[i]);
+                if (state && state->last_seen_cycle != sync_cycle) {
                     ESP_LOGI(TAG, "Remove not exist Rainmaker device Node: %s Endpoint: %d\n", node_id, matter_endpoint_id_array[i]);
                     rainmaker_bridge_delete_device(matter_endpoint_id_array[i]);
-                } else {
-                    free(buffer);
+                    release_node_state(matter_endpoint_id_array[i]);
                 }
             }
         }
     }
 }
 
-static esp_err_t rainmaker_sync_nodes(char *out_buf, size_t out_buf_len)
+/* Sync one page of node details, next_id is set to the start id of the next page or to an empty string */
+static esp_err_t rainmaker_sync_nodes(char *out_buf, size_t out_buf_len, char *next_id, size_t next_id_len)
 {
     jparse_ctx_t jctx;
     int total_count;
     char node[32];
-    static uint8_t check_count = 0;
+
+    next_id[0] = 0;
+    rainmaker_config_job_t *jobs = NULL;
+    size_t new_node_count = 0;
+    ESP_RETURN_ON_ERROR(rainmaker_collect_new_nodes(out_buf, out_buf_len, &jobs, &new_node_count), TAG,
+                        "Failed to parse the node details");
+    if (new_node_count > 0) {
+        rainmaker_bridge_add_new_devices(jobs, new_node_count);
+    }
+    free(jobs);
+
     if (json_parse_start(&jctx, out_buf, out_buf_len) != 0) {
         return ESP_FAIL;
     }
 
-    if (json_obj_get_array(&jctx, "nodes", &total_count) == 0) {
+    if (json_obj_get_array(&jctx, "node_details", &total_count) == 0) {
         for (int i = 0; i < total_count; i++) {
-            if (json_arr_get_string(&jctx, i, node, sizeof(node)) == 0) {
+            if (json_arr_get_object(&jctx, i) != 0) {
+                continue;
+            }
+            if (json_obj_get_string(&jctx, "id", node, sizeof(node)) == 0) {
                 uint16_t endpoint_id = app_bridge_get_matter_endpointid_by_rainmaker_node_id(node);
-                if (endpoint_id == chip::kInvalidEndpointId) {
-                    if (rainmaker_bridge_add_new_device(node) == ESP_OK) {
-                        endpoint_id = app_bridge_get_matter_endpointid_by_rainmaker_node_id(node);
+                rainmaker_node_state_t *state =
+                    endpoint_id != chip::kInvalidEndpointId ? get_node_state(endpoint_id) : NULL;
+                if (state) {
+                    state->last_seen_cycle = sync_cycle;
+                    if (is_light_endpoint(endpoint_id)) {
+                        sync_light_params(&jctx, endpoint_id,
+                                          app_bridge_get_rainmaker_node_name_by_matter_endpointid(endpoint_id), state);
                     }
-                }
-
-                ESP_LOGI(TAG, "Exist node: %s--endpoint id: %d\n", node, endpoint_id);
-                if (endpoint_id != chip::kInvalidEndpointId) {
-                    rainmaker_bridge_get_param_from_device(node, endpoint_id);
-                    rainmaker_bridge_update_online_state(node, endpoint_id);
+                    sync_online_state(&jctx, endpoint_id);
                 }
             }
+            json_arr_leave_object(&jctx);
         }
         json_obj_leave_array(&jctx);
     } else {
         ESP_LOGE(TAG, "No node found in json ");
     }
 
+    json_obj_get_string(&jctx, "next_id", next_id, next_id_len);
     json_parse_end(&jctx);
+    return ESP_OK;
+}
+
+/* Sync all the rainmaker nodes with one node details request per page */
+static esp_err_t rainmaker_sync_cycle()
+{
+    char next_id[64] = {0};
+    esp_rainmaker_api_stats_t start_stats = {};
+    esp_rainmaker_api_stats_t end_stats = {};
+    esp_rainmaker_api_get_stats(&start_stats);
+    uint32_t start_update_count = sync_stats.attribute_update_count;
+    int64_t start_time = esp_timer_get_time();
+
+    sync_cycle++;
+    do {
+        char* nodes_buffer = esp_rainmaker_api_get_nodes_details(next_id[0] ? next_id : NULL);
+        if (nodes_buffer == NULL) {
+            return ESP_FAIL;
+        }
+        esp_err_t err = rainmaker_sync_nodes(nodes_buffer, strlen(nodes_buffer), next_id, sizeof(next_id));
+        free(nodes_buffer);
+        if (err != ESP_OK) {
+            return err;
+        }
+    } while (next_id[0]);
+
+    /* All the pages are synced, the nodes which were not seen have been removed from the account */
+    matter_check_and_remove_not_exist_device();
 
-    check_count++;
-    if (check_count >= 5) {
-        matter_check_and_remove_not_exist_device();
-        check_count = 0;
+    size_t node_count = 0;
+    taskENTER_CRITICAL(&node_states_lock);
+    for (size_t i = 0; i < MAX_BRIDGED_DEVICE_COUNT; i++) {
+        if (node_states[i].endpoint_id != chip::kInvalidEndpointId) {
+            node_count++;
+        }
     }
+    taskEXIT_CRITICAL(&node_states_lock);
+    esp_rainmaker_api_get_stats(&end_stats);
+    ESP_LOGI(TAG, "Sync cycle %" PRIu32 ": %u nodes in %" PRId64 " ms, %" PRIu32 " requests, %" PRIu32
+             " bytes sent, %" PRIu32 " bytes received, %" PRIu32 " attribute updates", sync_cycle,
+             (unsigned)node_count, (esp_timer_get_time() - start_time) / 1000,
+             end_stats.request_count - start_stats.request_count, end_stats.tx_bytes - start_stats.tx_bytes,
+             end_stats.rx_bytes - start_stats.rx_bytes, sync_stats.attribute_update_count - start_update_count);
     return ESP_OK;
 }
 
+static void queue_param(uint16_t endpoint_id, const char *node_id, const char *node_name, uint8_t param,
+                        int value)
+{
+    rainmaker_pending_params_t *pending = NULL;
+    taskENTER_CRITICAL(&pending_params_lock);
+    for (size_t i = 0; i < MAX_BRIDGED_DEVICE_COUNT; i++) {
+        if (pending_params[i].param_mask && pending_params[i].endpoint_id == endpoint_id) {
+            pending = &pending_params[i];
+            break;
+        }
+        if (!pending && pending_params[i].param_mask == 0) {
+            pending = &pending_params[i];
+        }
+    }
+    if (pending) {
+        if (pending->param_mask == 0) {
+            pending->endpoint_id = endpoint_id;
+            strlcpy(pending->node_id, node_id, sizeof(pending->node_id));
+            strlcpy(pending->node_name, node_name, sizeof(pending->node_name));
+        }
+        /* A later change of the same param within the window overrides the earlier one */
+        pending->param_mask |= BIT(param);
+        pending->values[param] = value;
+    }
+    taskEXIT_CRITICAL(&pending_params_lock);
+    set_cached_param(endpoint_id, param, value);
+
+    if (pending && params_task) {
+        xTaskNotifyGive(params_task);
+    }
+}
+
 esp_err_t rainmaker_bridge_attribute_update(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id, esp_matter_attr_val_t *val)
 {
-    char param_buffer[128] = {0};
     const char* node_id = app_bridge_get_rainmaker_node_id_by_matter_endpointid(endpoint_id);
     const char* node_name = app_bridge_get_rainmaker_node_name_by_matter_endpointid(endpoint_id);
     if (node_id == NULL) {
         return ESP_OK;
     }
 
-    esp_err_t err = ESP_OK;
     if (cluster_id == OnOff::Id) {
         if (attribute_id == OnOff::Attributes::OnOff::Id) {
-            snprintf(param_buffer, sizeof(param_buffer), "[{\"node_id\":\"%s\",\"payload\":{\"%s\":{\"Power\":%s}}}]", node_id, node_name, val->val.b ? "true" : "false");
+            queue_param(endpoint_id, node_id, node_name, RMAKER_PARAM_POWER, val->val.b);
         }
     } else if (cluster_id == LevelControl::Id) {
         if (attribute_id == LevelControl::Attributes::CurrentLevel::Id) {
@@ -419,40 +724,173 @@ esp_err_t rainmaker_bridge_attribute_update(uint16_t endpoint_id, uint32_t clust
             if (val_onoff.val.b == false) {
                 return ESP_OK;
             }
-            snprintf(param_buffer, sizeof(param_buffer), "[{\"node_id\":\"%s\",\"payload\":{\"%s\":{\"Brightness\":%d}}}]", node_id, node_name,
-                     REMAP_TO_RANGE(val->val.u8, MATTER_LEVEL_MAX_VALUE, RMAKER_LEVEL_MAX_VALUE));
+            queue_param(endpoint_id, node_id, node_name, RMAKER_PARAM_BRIGHTNESS,
+                        REMAP_TO_RANGE(val->val.u8, MATTER_LEVEL_MAX_VALUE, RMAKER_LEVEL_MAX_VALUE));
         }
     } else if (cluster_id == ColorControl::Id) {
         if (attribute_id == ColorControl::Attributes::CurrentHue::Id) {
-            snprintf(param_buffer, sizeof(param_buffer), "[{\"node_id\":\"%s\",\"payload\":{\"%s\":{\"Hue\":%d}}}]", node_id, node_name,
-                     REMAP_TO_RANGE(val->val.u8, MATTER_HUE_MAX_VALUE, RMAKER_HUE_MAX_VALUE));
+            queue_param(endpoint_id, node_id, node_name, RMAKER_PARAM_HUE,
+                        REMAP_TO_RANGE(val->val.u8, MATTER_HUE_MAX_VALUE, RMAKER_HUE_MAX_VALUE));
         } else if (attribute_id == ColorControl::Attributes::CurrentSaturation::Id) {
-            snprintf(param_buffer, sizeof(param_buffer), "[{\"node_id\":\"%s\",\"payload\":{\"%s\":{\"Saturation\":%d}}}]", node_id, node_name,
-                     REMAP_TO_RANGE(val->val.u8, MATTER_SATURATION_MAX_VALUE, RMAKER_SATURATION_MAX_VALUE));
+            queue_param(endpoint_id, node_id, node_name, RMAKER_PARAM_SATURATION,
+                        REMAP_TO_RANGE(val->val.u8, MATTER_SATURATION_MAX_VALUE, RMAKER_SATURATION_MAX_VALUE));
         } else if (attribute_id == ColorControl::Attributes::ColorTemperatureMireds::Id) {
-            snprintf(param_buffer, sizeof(param_buffer), "[{\"node_id\":\"%s\",\"payload\":{\"%s\":{\"CCT\":%d}}}]", node_id, node_name,
-                     REMAP_TO_RANGE_INVERSE(val->val.u16, STANDARD_TEMPERATURE_FACTOR));
+            queue_param(endpoint_id, node_id, node_name, RMAKER_PARAM_CCT,
+                        REMAP_TO_RANGE_INVERSE(val->val.u16, STANDARD_TEMPERATURE_FACTOR));
+        }
+    }
+    return ESP_OK;
+}
+
+/* Build one params document for all the pending nodes: [{"node_id":"..","payload":{"<name>":{..}}},..] */
+static char *build_params_document(const rainmaker_pending_params_t *pending, size_t count, size_t *param_count)
+{
+    /* Large enough for the ids, the name and all the params of one node */
+    const size_t node_doc_len = 256;
+    size_t buf_len = count * node_doc_len + 3;
+    char *buf = (char *)malloc(buf_len);
+    if (!buf) {
+        return NULL;
+    }
+    size_t len = snprintf(buf, buf_len, "[");
+    *param_count = 0;
+    for (size_t i = 0; i < count; i++) {
+        len += snprintf(buf + len, buf_len - len, "%s{\"node_id\":\"%s\",\"payload\":{\"%s\":{", i ? "," : "",
+                        pending[i].node_id, pending[i].node_name);
+        bool first = true;
+        for (uint8_t param = 0; param < RMAKER_PARAM_MAX; param++) {
+            if (!(pending[i].param_mask & BIT(param))) {
+                continue;
+            }
+            if (param == RMAKER_PARAM_POWER) {
+                len += snprintf(buf + len, buf_len - len, "%s\"%s\":%s", first ? "" : ",", rmaker_param_names[param],
+                                pending[i].values[param] ? "true" : "false");
+            } else {
+                len += snprintf(buf + len, buf_len - len, "%s\"%s\":%d", first ? "" : ",", rmaker_param_names[param],
+                                pending[i].values[param]);
+            }
+            first = false;
+            (*param_count)++;
         }
+        len += snprintf(buf + len, buf_len - len, "}}}");
     }
+    snprintf(buf + len, buf_len - len, "]");
+    return buf;
+}
 
-    if (param_buffer[0] == 0) {
-        return ESP_OK;
+/* Put back the changes of a failed request, a change made since then is newer and is kept */
+static void requeue_params(const rainmaker_pending_params_t *pending, size_t count)
+{
+    size_t dropped = 0;
+    taskENTER_CRITICAL(&pending_params_lock);
+    for (size_t i = 0; i < count; i++) {
+        rainmaker_pending_params_t *slot = NULL;
+        for (size_t j = 0; j < MAX_BRIDGED_DEVICE_COUNT; j++) {
+            if (pending_params[j].param_mask && pending_params[j].endpoint_id == pending[i].endpoint_id) {
+                slot = &pending_params[j];
+                break;
+            }
+            if (!slot && pending_params[j].param_mask == 0) {
+                slot = &pending_params[j];
+            }
+        }
+        if (!slot) {
+            dropped++;
+            continue;
+        }
+        if (slot->param_mask == 0) {
+            *slot = pending[i];
+            continue;
+        }
+        for (uint8_t param = 0; param < RMAKER_PARAM_MAX; param++) {
+            if ((pending[i].param_mask & BIT(param)) && !(slot->param_mask & BIT(param))) {
+                slot->param_mask |= BIT(param);
+                slot->values[param] = pending[i].values[param];
+            }
+        }
+    }
+    taskEXIT_CRITICAL(&pending_params_lock);
+    if (dropped) {
+        ESP_LOGE(TAG, "Dropped the param changes of %u nodes", (unsigned)dropped);
     }
+}
 
-    esp_rainmaker_api_set_node_params(param_buffer);
-    return err;
+/* Send the param changes of the Matter side to rainmaker, merging the changes of a short window in one request */
+static void rainmaker_params_task(void *pvParameters)
+{
+    rainmaker_pending_params_t *pending =
+        (rainmaker_pending_params_t *)calloc(MAX_BRIDGED_DEVICE_COUNT, sizeof(rainmaker_pending_params_t));
+    if (!pending) {
+        ESP_LOGE(TAG, "Failed to allocate the pending params");
+        params_task = NULL;
+        vTaskDelete(NULL);
+        return;
+    }
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        int64_t first_change_time = esp_timer_get_time();
+        /* Let the other changes of a scene recall or a color change join the same request */
+        vTaskDelay(pdMS_TO_TICKS(CONFIG_RAINMAKER_PARAMS_SET_COALESCE_MS));
+        ulTaskNotifyTake(pdTRUE, 0);
+
+        size_t count = 0;
+        taskENTER_CRITICAL(&pending_params_lock);
+        for (size_t i = 0; i < MAX_BRIDGED_DEVICE_COUNT; i++) {
+            if (pending_params[i].param_mask) {
+                pending[count++] = pending_params[i];
+                pending_params[i].param_mask = 0;
+            }
+        }
+        taskEXIT_CRITICAL(&pending_params_lock);
+        if (count == 0) {
+            continue;
+        }
+
+        size_t param_count = 0;
+        esp_err_t err = ESP_ERR_NO_MEM;
+        char *payload = build_params_document(pending, count, &param_count);
+        if (payload) {
+            err = esp_rainmaker_api_set_node_params(payload);
+            free(payload);
+        }
+        if (err != ESP_OK) {
+            /* The cache already holds the new values, so the changes must reach rainmaker or the next sync cycle
+             * would not see them as changed */
+            ESP_LOGE(TAG, "Failed to send %u param changes of %u nodes, err:%d, retrying in %d ms",
+                     (unsigned)param_count, (unsigned)count, err, CONFIG_RAINMAKER_PARAMS_SET_RETRY_MS);
+            requeue_params(pending, count);
+            vTaskDelay(pdMS_TO_TICKS(CONFIG_RAINMAKER_PARAMS_SET_RETRY_MS));
+            xTaskNotifyGive(params_task);
+            continue;
+        }
+        ESP_LOGI(TAG, "Sent %u param changes of %u nodes in one request, %" PRId64 " ms after the first change",
+                 (unsigned)param_count, (unsigned)count, (esp_timer_get_time() - first_change_time) / 1000);
+    }
 }
 
 static void rainmaker_bridge_task(void *pvParameters)
 {
+    taskENTER_CRITICAL(&node_states_lock);
+    for (size_t i = 0; i < MAX_BRIDGED_DEVICE_COUNT; i++) {
+        node_states[i].endpoint_id = chip::kInvalidEndpointId;
+    }
+    taskEXIT_CRITICAL(&node_states_lock);
+    if (rainmaker_http_pool_init() != ESP_OK) {
+        vTaskDelete(NULL);
+        return;
+    }
+    esp_rainmaker_api_set_timeout(CONFIG_RAINMAKER_HTTP_TIMEOUT_MS);
+
+    /* Back off while the cloud cannot be reached, up to 8 sync periods */
+    uint32_t period_ms = CONFIG_RAINMAKER_PARAMS_GET_PERIOD_MS;
     while (true) {
-        vTaskDelay(pdMS_TO_TICKS(CONFIG_RAINMAKER_PARAMS_GET_PERIOD_MS));
-        char* nodes_buffer = esp_rainmaker_api_get_nodes_list();
-        if (nodes_buffer == NULL) {
-            continue;
+        vTaskDelay(pdMS_TO_TICKS(period_ms));
+        if (rainmaker_sync_cycle() == ESP_OK) {
+            period_ms = CONFIG_RAINMAKER_PARAMS_GET_PERIOD_MS;
+        } else if (period_ms < 8 * CONFIG_RAINMAKER_PARAMS_GET_PERIOD_MS) {
+            period_ms *= 2;
+            ESP_LOGW(TAG, "Sync cycle failed, retrying in %" PRIu32 " ms", period_ms);
         }
-        rainmaker_sync_nodes(nodes_buffer, strlen(nodes_buffer));
-        free(nodes_buffer);
     }
 }
 
@@ -476,6 +914,39 @@ static esp_err_t write_cb(const esp_rmaker_device_t *device, const esp_rmaker_pa
     return ESP_OK;
 }
 
+#if CONFIG_ENABLE_CHIP_SHELL
+static esp_err_t rainmaker_console_handler(int argc, char **argv)
+{
+    if (argc == 1 && strncmp(argv[0], "help", sizeof("help")) == 0) {
+        printf("Rainmaker commands:\n"
+               "\thelp: Print help\n"
+               "\tcloud: <base_url> <refresh_token>\n"
+               "\t\tExample: matter esp rainmaker cloud http://192.168.1.2:8080 token.\n");
+    } else if (argc == 3 && strncmp(argv[0], "cloud", sizeof("cloud")) == 0) {
+        ESP_RETURN_ON_ERROR(esp_rainmaker_api_set_base_url(argv[1]), TAG, "Failed to set base_url");
+        ESP_RETURN_ON_ERROR(esp_rainmaker_api_set_refresh_token(argv[2]), TAG, "Failed to set user_token");
+        ESP_LOGI(TAG, "Set base url: %s", argv[1]);
+    } else {
+        ESP_LOGE(TAG, "Incorrect arguments. Check help for more details.");
+        return ESP_ERR_INVALID_ARG;
+    }
+    return ESP_OK;
+}
+
+void rainmaker_bridge_register_commands()
+{
+    /* Point the bridge to another rainmaker API server, e.g. a local mock server to measure the sync cycles */
+    static const esp_matter::console::command_t rainmaker_command = {
+        .name = "rainmaker",
+        .description = "Set the rainmaker API server of the bridge. "
+        "Usage: matter esp rainmaker <rainmaker_command>. "
+        "Rainmaker commands: help, cloud",
+        .handler = rainmaker_console_handler,
+    };
+    esp_matter::console::add_commands(&rainmaker_command, 1);
+}
+#endif // CONFIG_ENABLE_CHIP_SHELL
+
 #ifdef CONFIG_AUTO_UPDATE_RCP
 static esp_err_t init_spiffs()
 {
@@ -540,4 +1011,6 @@ void rainmaker_init()
 
     /* create task to get node and params from rainmaker side */
     xTaskCreate(rainmaker_bridge_task, "rainmaker_main", CONFIG_RAINMAKER_TASK_STACK_SIZE, xTaskGetCurrentTaskHandle(), 5, NULL);
+    /* create task to send the Matter side param changes to rainmaker */
+    xTaskCreate(rainmaker_params_task, "rainmaker_params", CONFIG_RAINMAKER_TASK_STACK_SIZE, NULL, 5, &params_task);
 }
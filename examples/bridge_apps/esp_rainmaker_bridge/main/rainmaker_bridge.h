@@ -26,4 +26,9 @@ esp_err_t rainmaker_bridge_attribute_update(uint16_t endpoint_id, uint32_t clust
                                             uint32_t attribute_id, esp_matter_attr_val_t *val);
 
 /* Init Rainmaker */
-void rainmaker_init();
\ No newline at end of file
+void rainmaker_init();
+
+#if CONFIG_ENABLE_CHIP_SHELL
+/* Add the "matter esp rainmaker" console commands */
+void rainmaker_bridge_register_commands();
+#endif
\ No newline at end of file
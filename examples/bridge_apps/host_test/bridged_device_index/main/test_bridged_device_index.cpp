@@ -0,0 +1,212 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+
+#include <app_bridged_device_index.h>
+#include <chrono>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unity.h>
+
+/* The part of app_bridged_device_t which a Zigbee report touches */
+typedef struct bridged_device {
+    uint16_t zigbee_shortaddr;
+    uint16_t endpoint_id;
+    uint8_t current_level;
+    bool present;
+    struct bridged_device *next;
+} bridged_device_t;
+
+static constexpr size_t k_device_count = 500;
+static constexpr uint32_t k_report_count = 1000000;
+
+using device_index = app_bridge::device_index<bridged_device_t, k_device_count>;
+
+static bridged_device_t s_devices[k_device_count];
+
+static uint32_t hash_shortaddr(uint16_t shortaddr)
+{
+    return app_bridge::hash_bytes(&shortaddr, sizeof(shortaddr));
+}
+
+static uint32_t hash_device_shortaddr(const bridged_device_t *dev)
+{
+    return hash_shortaddr(dev->zigbee_shortaddr);
+}
+
+static uint32_t hash_device_endpoint_id(const bridged_device_t *dev)
+{
+    return dev->endpoint_id;
+}
+
+/* Every device in the same few home slots, so that removals have to shift long probe sequences */
+static uint32_t hash_colliding(const bridged_device_t *dev)
+{
+    return dev->zigbee_shortaddr % 4;
+}
+
+static bridged_device_t *find_by_shortaddr(const device_index &index, uint16_t shortaddr)
+{
+    return index.find(hash_shortaddr(shortaddr), [&](const bridged_device_t *dev) {
+        return dev->zigbee_shortaddr == shortaddr;
+    });
+}
+
+static bridged_device_t *find_by_endpoint_id(const device_index &index, uint16_t endpoint_id)
+{
+    return index.find(endpoint_id, [&](const bridged_device_t *dev) {
+        return dev->endpoint_id == endpoint_id;
+    });
+}
+
+/* The lookup which app_bridge did before the indexes */
+static bridged_device_t *find_in_list(bridged_device_t *list, uint16_t shortaddr)
+{
+    for (bridged_device_t *dev = list; dev; dev = dev->next) {
+        if (dev->zigbee_shortaddr == shortaddr) {
+            return dev;
+        }
+    }
+    return nullptr;
+}
+
+/* Short addresses are random 16-bit values in a Zigbee network, endpoint IDs are allocated in sequence */
+static void init_devices()
+{
+    srand(1);
+    for (size_t i = 0; i < k_device_count; i++) {
+        uint16_t shortaddr;
+        bool duplicate;
+        do {
+            shortaddr = rand() & 0xFFF7;
+            duplicate = false;
+            for (size_t j = 0; j < i; j++) {
+                duplicate |= s_devices[j].zigbee_shortaddr == shortaddr;
+            }
+        } while (duplicate);
+        s_devices[i] = {shortaddr, static_cast<uint16_t>(2 + i), 0, false, nullptr};
+    }
+}
+
+static void check_index(device_index &index, uint32_t (*hash_fn)(const bridged_device_t *dev))
+{
+    init_devices();
+    for (uint32_t step = 0; step < 20000; step++) {
+        bridged_device_t *dev = &s_devices[rand() % k_device_count];
+        if (dev->present) {
+            index.remove(dev);
+        } else {
+            index.insert(dev);
+        }
+        dev->present = !dev->present;
+
+        /* Every device is found if and only if it is in the index */
+        if (step % 100 == 0) {
+            for (size_t i = 0; i < k_device_count; i++) {
+                bridged_device_t *found = index.find(hash_fn(&s_devices[i]), [&](const bridged_device_t *candidate) {
+                    return candidate == &s_devices[i];
+                });
+                TEST_ASSERT_TRUE(found == (s_devices[i].present ? &s_devices[i] : nullptr));
+            }
+        }
+    }
+}
+
+static void test_insert_remove_find(void)
+{
+    static device_index index(hash_device_shortaddr);
+    check_index(index, hash_device_shortaddr);
+}
+
+static void test_remove_shifts_colliding_entries(void)
+{
+    static device_index index(hash_colliding);
+    check_index(index, hash_colliding);
+}
+
+static void test_lookup_by_address_and_endpoint_id(void)
+{
+    static device_index address_index(hash_device_shortaddr);
+    static device_index endpoint_index(hash_device_endpoint_id);
+    init_devices();
+    for (size_t i = 0; i < k_device_count; i++) {
+        address_index.insert(&s_devices[i]);
+        endpoint_index.insert(&s_devices[i]);
+    }
+    for (size_t i = 0; i < k_device_count; i++) {
+        TEST_ASSERT_TRUE(find_by_shortaddr(address_index, s_devices[i].zigbee_shortaddr) == &s_devices[i]);
+        TEST_ASSERT_TRUE(find_by_endpoint_id(endpoint_index, s_devices[i].endpoint_id) == &s_devices[i]);
+    }
+    /* Bit 3 is never set in the short addresses of the devices */
+    TEST_ASSERT_NULL(find_by_shortaddr(address_index, 0x0008));
+    TEST_ASSERT_NULL(find_by_endpoint_id(endpoint_index, 1));
+
+    address_index.remove(&s_devices[0]);
+    endpoint_index.remove(&s_devices[0]);
+    TEST_ASSERT_NULL(find_by_shortaddr(address_index, s_devices[0].zigbee_shortaddr));
+    TEST_ASSERT_NULL(find_by_endpoint_id(endpoint_index, s_devices[0].endpoint_id));
+    TEST_ASSERT_TRUE(find_by_shortaddr(address_index, s_devices[1].zigbee_shortaddr) == &s_devices[1]);
+}
+
+/* Inbound level reports from random children of a 500 device bridge: find the device by its short address and update
+   the attribute value, which is what the Zigbee bridge does before calling attribute::update() */
+template <typename Find>
+static double reports_per_second(Find find, const uint16_t *report_addrs, uint32_t *updates)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < k_report_count; i++) {
+        bridged_device_t *dev = find(report_addrs[i % k_device_count]);
+        if (dev) {
+            dev->current_level = static_cast<uint8_t>(i);
+            (*updates)++;
+        }
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    return k_report_count * 1e9 / elapsed.count();
+}
+
+static void benchmark_report_to_update_throughput(void)
+{
+    static device_index address_index(hash_device_shortaddr);
+    init_devices();
+    bridged_device_t *list = nullptr;
+    for (size_t i = 0; i < k_device_count; i++) {
+        s_devices[i].next = list;
+        list = &s_devices[i];
+        address_index.insert(&s_devices[i]);
+    }
+    static uint16_t report_addrs[k_device_count];
+    for (size_t i = 0; i < k_device_count; i++) {
+        report_addrs[i] = s_devices[rand() % k_device_count].zigbee_shortaddr;
+    }
+
+    uint32_t list_updates = 0;
+    uint32_t index_updates = 0;
+    double list_rate = reports_per_second([&](uint16_t shortaddr) { return find_in_list(list, shortaddr); },
+                                          report_addrs, &list_updates);
+    double index_rate = reports_per_second(
+        [&](uint16_t shortaddr) { return find_by_shortaddr(address_index, shortaddr); }, report_addrs,
+        &index_updates);
+
+    printf("bridged_device_index: %zu devices, %" PRIu32 " reports: %.0f reports/s with the device list, %.0f "
+           "reports/s with the address index (%.1fx)\n", k_device_count, k_report_count, list_rate, index_rate,
+           index_rate / list_rate);
+    TEST_ASSERT_EQUAL(k_report_count, list_updates);
+    TEST_ASSERT_EQUAL(k_report_count, index_updates);
+    TEST_ASSERT_TRUE(index_rate > list_rate);
+}
+
+extern "C" void app_main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_insert_remove_find);
+    RUN_TEST(test_remove_shifts_colliding_entries);
+    RUN_TEST(test_lookup_by_address_and_endpoint_id);
+    RUN_TEST(benchmark_report_to_update_throughput);
+    exit(UNITY_END());
+}
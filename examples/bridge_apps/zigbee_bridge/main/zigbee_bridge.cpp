@@ -6,6 +6,7 @@
    CONDITIONS OF ANY KIND, either express or implied.
 */
 
+#include <app_bridge_outbound.h>
 #include <app_bridged_device.h>
 #include <esp_check.h>
 #include <esp_err.h>
@@ -22,6 +23,8 @@ using namespace esp_matter::cluster;
 
 extern uint16_t aggregator_endpoint_id;
 
+static app_bridge_outbound_handle_t s_outbound = NULL;
+
 void zigbee_bridge_find_bridged_on_off_light_cb(esp_zb_zdp_status_t zdo_status, uint16_t addr, uint8_t endpoint, void *user_ctx)
 {
     ESP_LOGI(TAG, "on_off_light found: address:0x%" PRIx16 ", endpoint:%" PRId8 ", response_status:%d", addr, endpoint, zdo_status);
@@ -35,6 +38,10 @@ void zigbee_bridge_find_bridged_on_off_light_cb(esp_zb_zdp_status_t zdo_status,
             ESP_LOGI(TAG, "Bridged node for 0x%04" PRIx16 " zigbee device on endpoint %" PRId16 " has been created", addr,
                      app_bridge_get_matter_endpointid_by_zigbee_shortaddr(addr));
         } else {
+            // Devices which join together are stored in one batch, a failure only costs the batching
+            if (app_bridge_join_storage_batch() != ESP_OK) {
+                ESP_LOGW(TAG, "Failed to join the storage batch, the device is stored on its own");
+            }
             app_bridged_device_t *bridged_device =
                 app_bridge_create_bridged_device(node, aggregator_endpoint_id, ESP_MATTER_ON_OFF_LIGHT_DEVICE_TYPE_ID,
                                                  ESP_MATTER_BRIDGED_DEVICE_TYPE_ZIGBEE,
@@ -49,6 +56,45 @@ void zigbee_bridge_find_bridged_on_off_light_cb(esp_zb_zdp_status_t zdo_status,
     }
 }
 
+/* Send an attribute change to the zigbee device, called from the outbound scheduler task */
+static esp_err_t zigbee_bridge_send(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id,
+                                   const esp_matter_attr_val_t *val, void *ctx)
+{
+    /* The device may have been removed while the change was pending */
+    app_bridged_device_t *zigbee_device = app_bridge_get_zigbee_device_by_matter_endpointid(endpoint_id);
+    ESP_RETURN_ON_FALSE(zigbee_device, ESP_ERR_NOT_FOUND, TAG, "Bridged zigbee device of ep %" PRIu16 " removed",
+                        endpoint_id);
+
+    if (cluster_id == OnOff::Id && attribute_id == OnOff::Attributes::OnOff::Id) {
+        esp_zb_zcl_on_off_cmd_t cmd_req;
+        cmd_req.zcl_basic_cmd.dst_addr_u.addr_short = zigbee_device->dev_addr.zigbee_shortaddr;
+        cmd_req.zcl_basic_cmd.dst_endpoint = zigbee_device->dev_addr.zigbee_endpointid;
+        cmd_req.zcl_basic_cmd.src_endpoint = endpoint_id;
+        cmd_req.address_mode = ESP_ZB_APS_ADDR_MODE_16_ENDP_PRESENT;
+        cmd_req.on_off_cmd_id = val->val.b ? ESP_ZB_ZCL_CMD_ON_OFF_ON_ID : ESP_ZB_ZCL_CMD_ON_OFF_OFF_ID;
+        ESP_RETURN_ON_FALSE(esp_zb_lock_acquire(portMAX_DELAY), ESP_ERR_TIMEOUT, TAG,
+                            "Failed to acquire the zigbee lock for ep %" PRIu16, endpoint_id);
+        esp_zb_zcl_on_off_cmd_req(&cmd_req);
+        esp_zb_lock_release();
+    }
+    return ESP_OK;
+}
+
+esp_err_t zigbee_bridge_init()
+{
+    app_bridge_outbound_config_t config = {
+        .name = "zigbee_outbound",
+        .coalesce_ms = CONFIG_ZIGBEE_BRIDGE_OUTBOUND_COALESCE_MS,
+        .min_interval_ms = CONFIG_ZIGBEE_BRIDGE_OUTBOUND_MIN_INTERVAL_MS,
+        .max_pending = MAX_BRIDGED_DEVICE_COUNT,
+        .task_stack_size = 3072,
+        .task_priority = 5,
+        .send_cb = zigbee_bridge_send,
+        .ctx = NULL,
+    };
+    return app_bridge_outbound_create(&config, &s_outbound);
+}
+
 esp_err_t zigbee_bridge_attribute_update(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id,
                                          esp_matter_attr_val_t *val, app_bridged_device_t *zigbee_device)
 {
@@ -57,16 +103,8 @@ esp_err_t zigbee_bridge_attribute_update(uint16_t endpoint_id, uint32_t cluster_
             if (attribute_id == OnOff::Attributes::OnOff::Id) {
                 ESP_LOGD(TAG, "Update Bridged Device, ep: %" PRId16 ", cluster: %" PRId32 ", att: %" PRId32 "", endpoint_id, cluster_id,
                          attribute_id);
-                esp_zb_zcl_on_off_cmd_t cmd_req;
-                cmd_req.zcl_basic_cmd.dst_addr_u.addr_short = zigbee_device->dev_addr.zigbee_shortaddr;
-                cmd_req.zcl_basic_cmd.dst_endpoint = zigbee_device->dev_addr.zigbee_endpointid;
-                cmd_req.zcl_basic_cmd.src_endpoint = esp_matter::endpoint::get_id(zigbee_device->dev->endpoint);
-                cmd_req.address_mode = ESP_ZB_APS_ADDR_MODE_16_ENDP_PRESENT;
-                cmd_req.on_off_cmd_id = val->val.b ? ESP_ZB_ZCL_CMD_ON_OFF_ON_ID : ESP_ZB_ZCL_CMD_ON_OFF_OFF_ID;
-                if (esp_zb_lock_acquire(portMAX_DELAY)) {
-                    esp_zb_zcl_on_off_cmd_req(&cmd_req);
-                    esp_zb_lock_release();
-                }
+                /* Sent by the outbound scheduler, so that a group command does not flood the zigbee network */
+                return app_bridge_outbound_post(s_outbound, endpoint_id, cluster_id, attribute_id, val);
             }
         }
     } else {
@@ -16,5 +16,8 @@
 
 void zigbee_bridge_find_bridged_on_off_light_cb(esp_zb_zdp_status_t zdo_status, uint16_t addr, uint8_t endpoint, void *user_ctx);
 
+/** Create the outbound scheduler forwarding the Matter attribute changes to the zigbee devices */
+esp_err_t zigbee_bridge_init();
+
 esp_err_t zigbee_bridge_attribute_update(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id,
                                          esp_matter_attr_val_t *val, app_bridged_device_t *zigbee_device);
@@ -0,0 +1,159 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+
+#include <camera-stream-admission.h>
+#include <stdlib.h>
+#include <unity.h>
+
+using namespace Camera;
+
+/* Underlying values of StreamUsageEnum */
+static constexpr uint8_t k_recording = 1;
+static constexpr uint8_t k_live_view = 3;
+
+static constexpr uint32_t k_1080p_pixels = 1920 * 1080;
+static constexpr uint32_t k_720p_pixels = 1280 * 720;
+
+static StreamAdmissionRequest video_request(uint16_t stream_id, uint8_t usage, uint16_t min_fps, uint16_t max_fps,
+                                            uint32_t pixels, uint32_t min_bps, uint32_t max_bps)
+{
+    return { StreamKind::kVideo, stream_id, usage, true, min_fps, max_fps, pixels, min_bps, max_bps };
+}
+
+static void test_encoders_are_limited(void)
+{
+    StreamAdmissionScheduler scheduler;
+    scheduler.Init(2, k_1080p_pixels * 120, 100000000);
+
+    StreamAdmissionResult result = scheduler.Admit(video_request(1, k_live_view, 30, 60, k_720p_pixels, 1000000,
+                                                                 2000000));
+    TEST_ASSERT_EQUAL(AdmissionDecision::kAdmitted, result.decision);
+    TEST_ASSERT_EQUAL(60, result.budget.frameRate);
+    TEST_ASSERT_EQUAL(2000000, result.budget.bitRate);
+    TEST_ASSERT_EQUAL(AdmissionDecision::kAdmitted,
+                      scheduler.Admit(video_request(2, k_recording, 30, 60, k_720p_pixels, 1000000, 2000000)).decision);
+    TEST_ASSERT_EQUAL(AdmissionDecision::kRejected,
+                      scheduler.Admit(video_request(3, k_recording, 30, 60, k_720p_pixels, 1000000, 2000000)).decision);
+    TEST_ASSERT_NULL(scheduler.GetBudget(StreamKind::kVideo, 3));
+
+    /* Audio does not take an encoder */
+    StreamAdmissionRequest audio = { StreamKind::kAudio, 1, k_live_view, false, 0, 0, 0, 64000, 64000 };
+    TEST_ASSERT_EQUAL(AdmissionDecision::kAdmitted, scheduler.Admit(audio).decision);
+
+    /* A released encoder is available again */
+    scheduler.Release(StreamKind::kVideo, 1);
+    TEST_ASSERT_EQUAL(AdmissionDecision::kAdmitted,
+                      scheduler.Admit(video_request(3, k_recording, 30, 60, k_720p_pixels, 1000000, 2000000)).decision);
+}
+
+static void test_frame_rate_follows_pixel_rate_and_priority(void)
+{
+    StreamAdmissionScheduler scheduler;
+    scheduler.Init(4, k_1080p_pixels * 90, 100000000);
+    scheduler.SetStreamUsagePriorities({ k_live_view, k_recording });
+
+    StreamAdmissionResult recording = scheduler.Admit(video_request(1, k_recording, 15, 60, k_1080p_pixels, 1000000,
+                                                                    1000000));
+    TEST_ASSERT_EQUAL(AdmissionDecision::kAdmitted, recording.decision);
+    TEST_ASSERT_EQUAL(60, recording.budget.frameRate);
+
+    /* Both get their minimum, the higher priority live view gets the rest */
+    StreamAdmissionResult live_view = scheduler.Admit(video_request(2, k_live_view, 30, 60, k_1080p_pixels, 1000000,
+                                                                    1000000));
+    TEST_ASSERT_EQUAL(AdmissionDecision::kAdmitted, live_view.decision);
+    TEST_ASSERT_EQUAL(60, live_view.budget.frameRate);
+    TEST_ASSERT_EQUAL(1, live_view.changedBudgets.size());
+    TEST_ASSERT_EQUAL(1, live_view.changedBudgets[0].streamID);
+    TEST_ASSERT_EQUAL(30, live_view.changedBudgets[0].frameRate);
+
+    /* A stream whose minimum frame rate does not fit is rejected, the others keep their budget */
+    TEST_ASSERT_EQUAL(AdmissionDecision::kRejected,
+                      scheduler.Admit(video_request(3, k_live_view, 60, 60, k_1080p_pixels, 1000000, 1000000)).decision);
+    TEST_ASSERT_EQUAL(30, scheduler.GetBudget(StreamKind::kVideo, 1)->frameRate);
+    TEST_ASSERT_EQUAL(60, scheduler.GetBudget(StreamKind::kVideo, 2)->frameRate);
+
+    /* The downgraded frame rate is restored once the live view is released */
+    std::vector<StreamBudget> changed = scheduler.Release(StreamKind::kVideo, 2);
+    TEST_ASSERT_EQUAL(1, changed.size());
+    TEST_ASSERT_EQUAL(60, changed[0].frameRate);
+    TEST_ASSERT_EQUAL(60, scheduler.GetBudget(StreamKind::kVideo, 1)->frameRate);
+}
+
+static void test_bandwidth_follows_priority_and_uplink(void)
+{
+    StreamAdmissionScheduler scheduler;
+    scheduler.Init(4, k_1080p_pixels * 120, 5000000);
+    scheduler.SetStreamUsagePriorities({ k_live_view, k_recording });
+
+    TEST_ASSERT_EQUAL(AdmissionDecision::kAdmitted,
+                      scheduler.Admit(video_request(1, k_recording, 30, 30, k_720p_pixels, 1000000, 4000000)).decision);
+    StreamAdmissionResult live_view = scheduler.Admit(video_request(2, k_live_view, 30, 30, k_720p_pixels, 1000000,
+                                                                    4000000));
+    TEST_ASSERT_EQUAL(AdmissionDecision::kAdmitted, live_view.decision);
+    TEST_ASSERT_EQUAL(4000000, live_view.budget.bitRate);
+    TEST_ASSERT_EQUAL(1000000, scheduler.GetBudget(StreamKind::kVideo, 1)->bitRate);
+
+    /* A lower measured uplink downgrades the live view down to what is left after the minimums */
+    scheduler.UpdateMeasuredUplink(3000000);
+    TEST_ASSERT_EQUAL(3000000, scheduler.GetUplinkBudget());
+    TEST_ASSERT_EQUAL(2000000, scheduler.GetBudget(StreamKind::kVideo, 2)->bitRate);
+    TEST_ASSERT_EQUAL(1000000, scheduler.GetBudget(StreamKind::kVideo, 1)->bitRate);
+
+    /* A measurement above the configured maximum does not raise the budget */
+    scheduler.UpdateMeasuredUplink(10000000);
+    TEST_ASSERT_EQUAL(5000000, scheduler.GetUplinkBudget());
+
+    /* Swapping the priorities moves the extra bandwidth to the recording */
+    std::vector<StreamBudget> changed = scheduler.SetStreamUsagePriorities({ k_recording, k_live_view });
+    TEST_ASSERT_EQUAL(2, changed.size());
+    TEST_ASSERT_EQUAL(4000000, scheduler.GetBudget(StreamKind::kVideo, 1)->bitRate);
+    TEST_ASSERT_EQUAL(1000000, scheduler.GetBudget(StreamKind::kVideo, 2)->bitRate);
+
+    /* Audio gets its fixed bit rate or is rejected */
+    StreamAdmissionRequest audio = { StreamKind::kAudio, 1, k_live_view, false, 0, 0, 0, 4000000, 4000000 };
+    TEST_ASSERT_EQUAL(AdmissionDecision::kRejected, scheduler.Admit(audio).decision);
+    audio.minBitRate = audio.maxBitRate = 64000;
+    TEST_ASSERT_EQUAL(AdmissionDecision::kAdmitted, scheduler.Admit(audio).decision);
+    TEST_ASSERT_EQUAL(4000000 - 64000, scheduler.GetBudget(StreamKind::kVideo, 1)->bitRate);
+}
+
+static void test_snapshot_takes_pixel_rate_only(void)
+{
+    StreamAdmissionScheduler scheduler;
+    scheduler.Init(2, k_1080p_pixels * 60, 1000000);
+
+    StreamAdmissionRequest snapshot = { StreamKind::kSnapshot, 1, 0, true, 30, 30, k_1080p_pixels, 0, 0 };
+    StreamAdmissionResult result = scheduler.Admit(snapshot);
+    TEST_ASSERT_EQUAL(AdmissionDecision::kAdmitted, result.decision);
+    TEST_ASSERT_EQUAL(0, result.budget.bitRate);
+
+    /* The video stream gets the pixel rate left by the snapshot stream */
+    result = scheduler.Admit(video_request(1, k_live_view, 15, 60, k_1080p_pixels, 500000, 1000000));
+    TEST_ASSERT_EQUAL(AdmissionDecision::kDowngraded, result.decision);
+    TEST_ASSERT_EQUAL(30, result.budget.frameRate);
+    TEST_ASSERT_EQUAL(1000000, result.budget.bitRate);
+
+    /* Both encoders are taken */
+    snapshot.streamID = 2;
+    TEST_ASSERT_EQUAL(AdmissionDecision::kRejected, scheduler.Admit(snapshot).decision);
+
+    /* A reused stream keeps its budget */
+    result = scheduler.Admit(video_request(1, k_live_view, 15, 60, k_1080p_pixels, 500000, 1000000));
+    TEST_ASSERT_EQUAL(AdmissionDecision::kAdmitted, result.decision);
+    TEST_ASSERT_EQUAL(30, result.budget.frameRate);
+}
+
+extern "C" void app_main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_encoders_are_limited);
+    RUN_TEST(test_frame_rate_follows_pixel_rate_and_priority);
+    RUN_TEST(test_bandwidth_follows_priority_and_uplink);
+    RUN_TEST(test_snapshot_takes_pixel_rate_only);
+    exit(UNITY_END());
+}
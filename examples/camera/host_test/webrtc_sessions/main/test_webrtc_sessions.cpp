@@ -0,0 +1,238 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+
+#include <webrtc-session-table.h>
+#include <chrono>
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <unity.h>
+#include <vector>
+
+using namespace Camera;
+
+/* Heap accounting of all the C++ allocations, the size is kept in front of each block. The operators are not
+   inlined so that the compiler does not see the header as out of the bounds of the block */
+typedef struct {
+    size_t allocations;
+    size_t live;
+} heap_stats_t;
+
+static heap_stats_t s_heap;
+
+__attribute__((noinline)) void * operator new(size_t size)
+{
+    size_t * block = static_cast<size_t *>(malloc(size + sizeof(max_align_t)));
+    if (!block) {
+        throw std::bad_alloc();
+    }
+    *block = size;
+    s_heap.allocations++;
+    s_heap.live += size;
+    return reinterpret_cast<uint8_t *>(block) + sizeof(max_align_t);
+}
+
+__attribute__((noinline)) void operator delete(void * ptr) noexcept
+{
+    if (ptr) {
+        size_t * block = reinterpret_cast<size_t *>(static_cast<uint8_t *>(ptr) - sizeof(max_align_t));
+        s_heap.live -= *block;
+        free(block);
+    }
+}
+
+void operator delete(void * ptr, size_t) noexcept
+{
+    operator delete(ptr);
+}
+
+/* The ScopedNodeId of a peer */
+struct peer_id {
+    uint64_t node_id;
+    uint8_t fabric_index;
+
+    bool operator<(const peer_id &other) const
+    {
+        return fabric_index != other.fabric_index ? fabric_index < other.fabric_index : node_id < other.node_id;
+    }
+};
+
+/* The signaling state which a session keeps between the offer and the connection */
+struct simulated_transport {
+    uint16_t session_id;
+    peer_id peer;
+    std::string remote_sdp;
+    std::vector<std::string> remote_candidates;
+};
+
+using session_table = WebRTCSessionTable<simulated_transport, peer_id>;
+
+static constexpr size_t k_heap_budget = 16384;
+
+static std::unique_ptr<simulated_transport> make_transport(uint16_t session_id, peer_id peer)
+{
+    return std::unique_ptr<simulated_transport>(new simulated_transport{ session_id, peer, {}, {} });
+}
+
+static void test_session_cap_and_heap_budget(void)
+{
+    session_table sessions;
+    sessions.Init(3, k_heap_budget);
+
+    TEST_ASSERT_FALSE(sessions.CanAdmit(k_heap_budget - 1));
+    for (uint16_t id = 1; id <= 3; id++) {
+        TEST_ASSERT_TRUE(sessions.CanAdmit(k_heap_budget));
+        sessions.Insert(id, { id, 1 }, make_transport(id, { id, 1 }));
+    }
+    TEST_ASSERT_EQUAL(3, sessions.Size());
+    TEST_ASSERT_FALSE(sessions.CanAdmit(SIZE_MAX));
+
+    /* An ended session frees its slot */
+    sessions.Erase(2, { 2, 1 });
+    TEST_ASSERT_NULL(sessions.Get(2));
+    TEST_ASSERT_TRUE(sessions.CanAdmit(k_heap_budget));
+
+    /* A budget of 0 only checks the session cap */
+    session_table unbudgeted;
+    unbudgeted.Init(1, 0);
+    TEST_ASSERT_TRUE(unbudgeted.CanAdmit(0));
+}
+
+static void test_peer_keeps_its_latest_session(void)
+{
+    session_table sessions;
+    sessions.Init(4, 0);
+    peer_id peer = { 0x1122334455667788ull, 1 };
+    uint16_t session_id = 0;
+
+    TEST_ASSERT_FALSE(sessions.GetPeerSession(peer, session_id));
+    sessions.Insert(10, peer, make_transport(10, peer));
+    sessions.Insert(11, peer, make_transport(11, peer));
+    TEST_ASSERT_TRUE(sessions.GetPeerSession(peer, session_id));
+    TEST_ASSERT_EQUAL(11, session_id);
+
+    /* Ending the older session leaves the peer on the newer one */
+    sessions.Erase(10, peer);
+    TEST_ASSERT_TRUE(sessions.GetPeerSession(peer, session_id));
+    TEST_ASSERT_EQUAL(11, session_id);
+    TEST_ASSERT_TRUE(sessions.Get(11)->session_id == 11);
+
+    /* The same node ID on another fabric is another peer */
+    TEST_ASSERT_FALSE(sessions.GetPeerSession({ peer.node_id, 2 }, session_id));
+
+    sessions.Erase(11, peer);
+    TEST_ASSERT_FALSE(sessions.GetPeerSession(peer, session_id));
+    TEST_ASSERT_EQUAL(0, sessions.Size());
+}
+
+/* The lookup which a linear search over the sessions did */
+static simulated_transport * find_in_vector(const std::vector<simulated_transport *> &transports, uint16_t session_id)
+{
+    for (simulated_transport * transport : transports) {
+        if (transport->session_id == session_id) {
+            return transport;
+        }
+    }
+    return nullptr;
+}
+
+static const std::string k_candidate = "candidate:842163049 1 udp 1677729535 203.0.113.7 46154 typ srflx raddr "
+                                       "192.168.1.20 rport 46154 generation 0 ufrag sX1a network-cost 999";
+
+/* Sessions of many viewers: each one is admitted, gets its signaling messages routed to it and ends. The table bytes are the allocations of the table itself, its buckets and nodes, without the transports. */
+static void benchmark_sessions(uint16_t session_count)
+{
+    static constexpr uint32_t k_messages = 200000;
+    std::vector<simulated_transport *> transports;
+    transports.reserve(session_count);
+
+    size_t live_before = s_heap.live;
+    session_table sessions;
+    sessions.Init(session_count, k_heap_budget);
+    size_t transport_bytes = 0;
+    for (uint16_t i = 0; i < session_count; i++) {
+        TEST_ASSERT_TRUE(sessions.CanAdmit(k_heap_budget));
+        uint16_t session_id = static_cast<uint16_t>(1 + i * 7);
+        peer_id peer = { static_cast<uint64_t>(0x1000 + i), static_cast<uint8_t>(1 + i % 3) };
+        std::unique_ptr<simulated_transport> transport = make_transport(session_id, peer);
+        transport_bytes += sizeof(simulated_transport);
+        transports.push_back(sessions.Insert(session_id, peer, std::move(transport)));
+    }
+    size_t table_bytes = s_heap.live - live_before - transport_bytes;
+    TEST_ASSERT_FALSE(sessions.CanAdmit(SIZE_MAX));
+
+    /* ProvideICECandidates and ProvideAnswer are routed by session ID, OnDeviceConnected by peer */
+    srand(1);
+    std::vector<uint16_t> targets(k_messages);
+    for (uint32_t i = 0; i < k_messages; i++) {
+        targets[i] = transports[rand() % session_count]->session_id;
+    }
+    uint32_t routed = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < k_messages; i++) {
+        simulated_transport * transport = sessions.Get(targets[i]);
+        routed += transport && transport->session_id == targets[i];
+    }
+    auto table_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+    uint32_t found = 0;
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < k_messages; i++) {
+        found += find_in_vector(transports, targets[i]) != nullptr;
+    }
+    auto vector_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+    for (simulated_transport * transport : transports) {
+        uint16_t session_id = 0;
+        TEST_ASSERT_TRUE(sessions.GetPeerSession(transport->peer, session_id) && session_id == transport->session_id);
+    }
+
+    /* Offer and candidates of every session, the signaling state is what grows with the sessions */
+    live_before = s_heap.live;
+    for (simulated_transport * transport : transports) {
+        transport->remote_sdp.assign(2048, 'v');
+        transport->remote_candidates.assign(4, k_candidate);
+    }
+    size_t signaling_bytes = s_heap.live - live_before;
+
+    printf("webrtc_sessions: %u sessions: %zu bytes of table and %zu bytes of transport per session, %zu bytes of "
+           "signaling state per session; %.1f ns per message routed by session ID, %.1f ns with a linear "
+           "search\n", session_count, table_bytes / session_count, sizeof(simulated_transport),
+           signaling_bytes / session_count, static_cast<double>(table_ns.count()) / k_messages,
+           static_cast<double>(vector_ns.count()) / k_messages);
+    TEST_ASSERT_EQUAL(k_messages, routed);
+    TEST_ASSERT_EQUAL(k_messages, found);
+
+    /* Every session ends and the table releases all its memory */
+    size_t live_with_sessions = s_heap.live;
+    for (simulated_transport * transport : transports) {
+        sessions.Erase(transport->session_id, transport->peer);
+    }
+    TEST_ASSERT_EQUAL(0, sessions.Size());
+    TEST_ASSERT_TRUE(s_heap.live < live_with_sessions);
+    uint16_t session_id = 0;
+    TEST_ASSERT_FALSE(sessions.GetPeerSession({ 0x1000, 1 }, session_id));
+}
+
+static void benchmark_memory_and_latency_per_session(void)
+{
+    benchmark_sessions(3);
+    benchmark_sessions(16);
+    benchmark_sessions(256);
+    benchmark_sessions(4096);
+}
+
+extern "C" void app_main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_session_cap_and_heap_budget);
+    RUN_TEST(test_peer_keeps_its_latest_session);
+    RUN_TEST(benchmark_memory_and_latency_per_session);
+    exit(UNITY_END());
+}
@@ -0,0 +1,259 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+
+#include <webrtc-signaling-json.h>
+#include <chrono>
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unity.h>
+
+/* Heap accounting of all the C++ allocations, the size is kept in front of each block. The operators are not
+   inlined so that the compiler does not see the header as out of the bounds of the block */
+typedef struct {
+    size_t allocations;
+    size_t bytes;
+    size_t live;
+    size_t peak;
+} heap_stats_t;
+
+static heap_stats_t s_heap;
+
+__attribute__((noinline)) void * operator new(size_t size)
+{
+    size_t * block = static_cast<size_t *>(malloc(size + sizeof(max_align_t)));
+    if (!block) {
+        throw std::bad_alloc();
+    }
+    *block = size;
+    s_heap.allocations++;
+    s_heap.bytes += size;
+    s_heap.live += size;
+    s_heap.peak = s_heap.live > s_heap.peak ? s_heap.live : s_heap.peak;
+    return reinterpret_cast<uint8_t *>(block) + sizeof(max_align_t);
+}
+
+__attribute__((noinline)) void operator delete(void * ptr) noexcept
+{
+    if (ptr) {
+        size_t * block = reinterpret_cast<size_t *>(static_cast<uint8_t *>(ptr) - sizeof(max_align_t));
+        s_heap.live -= *block;
+        free(block);
+    }
+}
+
+void * operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete[](void * ptr) noexcept
+{
+    operator delete(ptr);
+}
+
+void operator delete(void * ptr, size_t) noexcept
+{
+    operator delete(ptr);
+}
+
+void operator delete[](void * ptr, size_t) noexcept
+{
+    operator delete(ptr);
+}
+
+static void reset_heap_stats()
+{
+    s_heap.allocations = 0;
+    s_heap.bytes = 0;
+    s_heap.peak = s_heap.live;
+}
+
+/* The signaling payload as KVSWebRTCPeerConnection built it before: escape into a growing temporary, then sprintf
+   into a fixed CONFIG_MAX_LARGE_BUFFER_SIZE_BYTES buffer for the SDP and 1 KB for a candidate */
+static constexpr size_t kOldSdpBufferSize = 5120;
+static constexpr size_t kOldCandidateBufferSize = 1024;
+
+static std::string old_json_escape(const std::string &input)
+{
+    std::string output;
+    for (char c : input) {
+        switch (c) {
+        case '\"':
+            output += "\\\"";
+            break;
+        case '\\':
+            output += "\\\\";
+            break;
+        case '\n':
+            output += "\\n";
+            break;
+        case '\r':
+            output += "\\r";
+            break;
+        default:
+            output += c;
+        }
+    }
+    return output;
+}
+
+static size_t old_offer_json(const std::string &sdp, char ** out)
+{
+    char * json = new char[kOldSdpBufferSize];
+    std::string escaped = old_json_escape(sdp);
+    size_t len = sprintf(json, "{\"type\": \"offer\", \"sdp\": \"%s\"}", escaped.c_str());
+    *out = json;
+    return len;
+}
+
+static size_t old_candidate_json(const std::string &candidate, char ** out)
+{
+    char * json = new char[kOldCandidateBufferSize];
+    std::string escaped = old_json_escape(candidate);
+    size_t len = sprintf(json, "{\"candidate\": \"%s\"}", escaped.c_str());
+    *out = json;
+    return len;
+}
+
+/* An offer of a video, an audio and a data channel section, about 2 KB */
+static std::string synthetic_offer()
+{
+    std::string sdp = "v=0\r\no=- 4611731400430051336 2 IN IP4 127.0.0.1\r\ns=-\r\nt=0 0\r\n"
+                      "a=group:BUNDLE 0 1 2\r\na=extmap-allow-mixed\r\na=msid-semantic: WMS stream\r\n";
+    sdp += "m=video 9 UDP/TLS/RTP/SAVPF 96 97 102 103\r\nc=IN IP4 0.0.0.0\r\na=rtcp:9 IN IP4 0.0.0.0\r\n"
+           "a=ice-ufrag:sX1a\r\na=ice-pwd:5dvJtWOQ8m1ZfmZ6yL3Rk7Nq\r\na=ice-options:trickle\r\n"
+           "a=fingerprint:sha-256 7B:8B:F0:65:5F:78:E2:51:3B:AC:6F:F3:3F:46:1B:35:DC:B8:5F:64:1A:24:C2:43:F0:A1:"
+           "58:D0:A1:2C:19:08\r\na=setup:actpass\r\na=mid:0\r\na=sendonly\r\na=rtcp-mux\r\na=rtcp-rsize\r\n";
+    for (int pt : { 96, 97, 102, 103 }) {
+        char line[160];
+        snprintf(line, sizeof(line),
+                 "a=rtpmap:%d H264/90000\r\na=rtcp-fb:%d goog-remb\r\na=rtcp-fb:%d transport-cc\r\n"
+                 "a=rtcp-fb:%d ccm fir\r\na=rtcp-fb:%d nack\r\na=rtcp-fb:%d nack pli\r\n",
+                 pt, pt, pt, pt, pt, pt);
+        sdp += line;
+        snprintf(line, sizeof(line),
+                 "a=fmtp:%d level-asymmetry-allowed=1;packetization-mode=1;profile-level-id=42e01f\r\n", pt);
+        sdp += line;
+    }
+    sdp += "a=ssrc:1001 cname:camera\r\na=ssrc:1001 msid:stream video\r\n";
+    sdp += "m=audio 9 UDP/TLS/RTP/SAVPF 111\r\nc=IN IP4 0.0.0.0\r\na=rtcp:9 IN IP4 0.0.0.0\r\na=mid:1\r\n"
+           "a=sendrecv\r\na=rtcp-mux\r\na=rtpmap:111 opus/48000/2\r\na=rtcp-fb:111 transport-cc\r\n"
+           "a=fmtp:111 minptime=10;useinbandfec=1\r\na=ssrc:1002 cname:camera\r\na=ssrc:1002 msid:stream audio\r\n";
+    sdp += "m=application 9 UDP/DTLS/SCTP webrtc-datachannel\r\nc=IN IP4 0.0.0.0\r\na=mid:2\r\n"
+           "a=sctp-port:5000\r\na=max-message-size:262144\r\n";
+    return sdp;
+}
+
+static const std::string kCandidate = "candidate:842163049 1 udp 1677729535 203.0.113.7 46154 typ srflx raddr "
+                                      "192.168.1.20 rport 46154 generation 0 ufrag sX1a network-cost 999";
+
+static void test_escape_matches_escaped_length(void)
+{
+    const std::string value = std::string("a\"b\\c\r\n\t\b\f") + '\x01' + "end";
+    std::string json = make_signaling_json("{\"candidate\": \"", value);
+    TEST_ASSERT_EQUAL_STRING("{\"candidate\": \"a\\\"b\\\\c\\r\\n\\t\\b\\f\\u0001end\"}", json.c_str());
+    TEST_ASSERT_EQUAL(json_escape(value).size(), json_escaped_length(value));
+    TEST_ASSERT_EQUAL(0, json_escaped_length(std::string()));
+}
+
+static void test_payloads_match_the_previous_format(void)
+{
+    std::string sdp = synthetic_offer();
+    char * old_json = nullptr;
+    size_t old_len = old_offer_json(sdp, &old_json);
+    std::string json = make_signaling_json("{\"type\": \"offer\", \"sdp\": \"", sdp);
+    TEST_ASSERT_EQUAL(old_len, json.size());
+    TEST_ASSERT_EQUAL_STRING(old_json, json.c_str());
+    delete[] old_json;
+
+    old_len = old_candidate_json(kCandidate, &old_json);
+    json = make_signaling_json("{\"candidate\": \"", kCandidate);
+    TEST_ASSERT_EQUAL_STRING(old_json, json.c_str());
+    delete[] old_json;
+
+    /* A candidate which would have overflowed the fixed 1 KB buffer */
+    std::string long_candidate(2000, 'x');
+    json = make_signaling_json("{\"candidate\": \"", long_candidate);
+    TEST_ASSERT_EQUAL(strlen("{\"candidate\": \"") + 2000 + 2, json.size());
+}
+
+typedef struct {
+    double allocations;
+    double bytes;
+    size_t peak;
+    double ns;
+} message_cost_t;
+
+template <typename Build>
+static message_cost_t measure(Build build, uint32_t messages)
+{
+    reset_heap_stats();
+    size_t live_before = s_heap.live;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < messages; i++) {
+        build();
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    TEST_ASSERT_EQUAL(live_before, s_heap.live);
+    return { static_cast<double>(s_heap.allocations) / messages, static_cast<double>(s_heap.bytes) / messages,
+             s_heap.peak - live_before, static_cast<double>(elapsed.count()) / messages };
+}
+
+static void print_cost(const char * name, size_t payload_len, const message_cost_t &before, const message_cost_t &after)
+{
+    printf("webrtc_signaling: %s of %zu bytes: %.1f allocations, %.0f bytes allocated, %zu bytes peak heap, %.0f ns "
+           "per message before; %.1f allocations, %.0f bytes allocated, %zu bytes peak heap, %.0f ns after\n",
+           name, payload_len, before.allocations, before.bytes, before.peak, before.ns, after.allocations, after.bytes,
+           after.peak, after.ns);
+}
+
+static void benchmark_heap_per_signaling_message(void)
+{
+    static constexpr uint32_t kMessages = 1000;
+    std::string sdp = synthetic_offer();
+    size_t sdp_json_len = make_signaling_json("{\"type\": \"offer\", \"sdp\": \"", sdp).size();
+
+    message_cost_t offer_before = measure([&]() {
+        char * json = nullptr;
+        old_offer_json(sdp, &json);
+        delete[] json;
+    }, kMessages);
+    message_cost_t offer_after = measure([&]() {
+        std::string json = make_signaling_json("{\"type\": \"offer\", \"sdp\": \"", sdp);
+    }, kMessages);
+    print_cost("offer", sdp_json_len, offer_before, offer_after);
+
+    message_cost_t candidate_before = measure([&]() {
+        char * json = nullptr;
+        old_candidate_json(kCandidate, &json);
+        delete[] json;
+    }, kMessages);
+    message_cost_t candidate_after = measure([&]() {
+        std::string json = make_signaling_json("{\"candidate\": \"", kCandidate);
+    }, kMessages);
+    print_cost("candidate", make_signaling_json("{\"candidate\": \"", kCandidate).size(), candidate_before,
+               candidate_after);
+
+    /* One allocation of the final size per message */
+    TEST_ASSERT_TRUE(offer_after.allocations == 1);
+    TEST_ASSERT_TRUE(candidate_after.allocations == 1);
+    TEST_ASSERT_TRUE(offer_after.bytes == sdp_json_len + 1);
+    TEST_ASSERT_TRUE(offer_after.peak < offer_before.peak);
+    TEST_ASSERT_TRUE(candidate_after.peak < candidate_before.peak);
+}
+
+extern "C" void app_main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_escape_matches_escaped_length);
+    RUN_TEST(test_payloads_match_the_previous_format);
+    RUN_TEST(benchmark_heap_per_signaling_message);
+    exit(UNITY_END());
+}
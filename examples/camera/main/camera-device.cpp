@@ -15,6 +15,7 @@
  *    limitations under the License.
  */
 #include "camera-device.h"
+#include <algorithm>
 #include <lib/support/logging/CHIPLogging.h>
 
 using namespace chip::app::Clusters;
@@ -95,31 +96,56 @@ bool CameraDevice::MatchClosestSnapshotParams(const VideoResolutionStruct  &requ
     return false;
 }
 
-CameraError CameraDevice::CaptureSnapshot(const chip::app::DataModel::Nullable<uint16_t> streamID,
-                                          const VideoResolutionStruct  &resolution, ImageSnapshot  &outImageSnapshot)
+const SnapshotStream * CameraDevice::FindSnapshotStream(const chip::app::DataModel::Nullable<uint16_t>  &streamID,
+                                                      const VideoResolutionStruct  &resolution)
 {
-    VideoResolutionStruct matchedRes;
-    ImageCodecEnum matchedCodec;
-
+    uint16_t streamId = kInvalidStreamID;
     if (streamID.IsNull()) {
-        if (!MatchClosestSnapshotParams(resolution, matchedRes, matchedCodec)) {
-            ChipLogError(Camera, "No matching snapshot stream found for requested resolution %ux%u", resolution.width,
-                         resolution.height);
-            return CameraError::ERROR_CAPTURE_SNAPSHOT_FAILED;
-        }
-    } else {
-        uint16_t streamId = streamID.Value();
-        auto it           = std::find_if(mSnapshotStreams.begin(), mSnapshotStreams.end(), [streamId](const SnapshotStream & s) {
-            return s.snapshotStreamParams.snapshotStreamID == streamId;
+        auto match = std::find_if(mSnapshotMatches.begin(), mSnapshotMatches.end(), [&resolution](const SnapshotMatch & m) {
+            return m.requested.width == resolution.width && m.requested.height == resolution.height;
         });
-        if (it == mSnapshotStreams.end()) {
-            ChipLogError(Camera, "Snapshot stream not found for stream ID %u", streamId);
-            return CameraError::ERROR_CAPTURE_SNAPSHOT_FAILED;
+        if (match != mSnapshotMatches.end()) {
+            streamId = match->snapshotStreamID;
+            std::rotate(mSnapshotMatches.begin(), match, match + 1);
+        } else {
+            VideoResolutionStruct matchedRes;
+            ImageCodecEnum matchedCodec;
+            if (!MatchClosestSnapshotParams(resolution, matchedRes, matchedCodec)) {
+                ChipLogError(Camera, "No matching snapshot stream found for requested resolution %ux%u", resolution.width,
+                             resolution.height);
+                return nullptr;
+            }
+            auto it = std::find_if(mSnapshotStreams.begin(), mSnapshotStreams.end(), [&](const SnapshotStream & s) {
+                return s.snapshotStreamParams.minResolution.width == matchedRes.width &&
+                       s.snapshotStreamParams.minResolution.height == matchedRes.height &&
+                       s.snapshotStreamParams.imageCodec == matchedCodec;
+            });
+            if (it == mSnapshotStreams.end()) {
+                return nullptr;
+            }
+            streamId = it->snapshotStreamParams.snapshotStreamID;
+            // Bounded, as controllers can request any resolution
+            if (mSnapshotMatches.size() >= kMaxSnapshotMatches) {
+                mSnapshotMatches.pop_back();
+            }
+            mSnapshotMatches.insert(mSnapshotMatches.begin(), { resolution, streamId });
         }
-        matchedRes   = it->snapshotStreamParams.minResolution;
-        matchedCodec = it->snapshotStreamParams.imageCodec;
+    } else {
+        streamId = streamID.Value();
+    }
+
+    auto it = std::find_if(mSnapshotStreams.begin(), mSnapshotStreams.end(), [streamId](const SnapshotStream & s) {
+        return s.snapshotStreamParams.snapshotStreamID == streamId;
+    });
+    if (it == mSnapshotStreams.end()) {
+        ChipLogError(Camera, "Snapshot stream not found for stream ID %u", streamId);
+        return nullptr;
     }
+    return &(*it);
+}
 
+CameraError CameraDevice::CaptureAndEncodeSnapshot(const SnapshotStream  &stream, ImageSnapshot  &outImageSnapshot)
+{
     // Create a dummy JPEG image
     static const uint8_t dummy_jpeg[] = {
         0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 0x4A, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x01, 0x00, 0x48, 0x00, 0x48, 0x00,
@@ -136,12 +162,62 @@ CameraError CameraDevice::CaptureSnapshot(const chip::app::DataModel::Nullable<u
     // Copy the dummy JPEG data to the output
     outImageSnapshot.data.assign(dummy_jpeg, dummy_jpeg + sizeof(dummy_jpeg));
 
-    outImageSnapshot.imageRes   = matchedRes;
-    outImageSnapshot.imageCodec = matchedCodec;
+    outImageSnapshot.imageRes   = stream.snapshotStreamParams.minResolution;
+    outImageSnapshot.imageCodec = stream.snapshotStreamParams.imageCodec;
 
     return CameraError::SUCCESS;
 }
 
+CameraError CameraDevice::CaptureSnapshot(const chip::app::DataModel::Nullable<uint16_t> streamID,
+                                          const VideoResolutionStruct  &resolution, ImageSnapshot  &outImageSnapshot)
+{
+    const SnapshotStream * stream = FindSnapshotStream(streamID, resolution);
+    if (stream == nullptr) {
+        return CameraError::ERROR_CAPTURE_SNAPSHOT_FAILED;
+    }
+    uint16_t streamId = stream->snapshotStreamParams.snapshotStreamID;
+
+    // The CaptureSnapshot commands are handled one at a time on the Matter thread, so the requests of the controllers
+    // polling at the same time are served by the first capture of the stream as long as it is recent enough.
+    chip::System::Clock::Timestamp now = chip::System::SystemClock().GetMonotonicTimestamp();
+    auto cached = std::find_if(mSnapshotCache.begin(), mSnapshotCache.end(),
+                               [streamId](const CachedSnapshot & c) { return c.snapshotStreamID == streamId; });
+    if (cached != mSnapshotCache.end() &&
+            now - cached->capturedAt < chip::System::Clock::Milliseconds32(kSnapshotCacheTtlMs)) {
+        outImageSnapshot = cached->snapshot;
+        mSnapshotCacheHitCount++;
+        ChipLogDetail(Camera, "Snapshot of stream %u served from cache, captures: %lu, cache hits: %lu", streamId,
+                      static_cast<unsigned long>(mSnapshotCaptureCount), static_cast<unsigned long>(mSnapshotCacheHitCount));
+        return CameraError::SUCCESS;
+    }
+
+    CameraError err = CaptureAndEncodeSnapshot(*stream, outImageSnapshot);
+    if (err != CameraError::SUCCESS) {
+        return err;
+    }
+    mSnapshotCaptureCount++;
+
+    if (cached == mSnapshotCache.end()) {
+        if (mSnapshotCache.size() >= kMaxCachedSnapshots) {
+            // Replace the oldest snapshot
+            cached = std::min_element(mSnapshotCache.begin(), mSnapshotCache.end(),
+                                      [](const CachedSnapshot & a, const CachedSnapshot & b) { return a.capturedAt < b.capturedAt; });
+        } else {
+            cached = mSnapshotCache.insert(mSnapshotCache.end(), CachedSnapshot());
+        }
+    }
+    cached->snapshotStreamID = streamId;
+    cached->capturedAt       = now;
+    cached->snapshot         = outImageSnapshot;
+
+    return CameraError::SUCCESS;
+}
+
+void CameraDevice::InvalidateSnapshotCache()
+{
+    mSnapshotCache.clear();
+}
+
 // Allocate snapshot stream
 CameraError CameraDevice::AllocateSnapshotStream(const CameraAVStreamManagementDelegate::SnapshotStreamAllocateArgs  &args,
                                                  uint16_t  &outStreamID)
@@ -272,6 +348,7 @@ std::vector<SnapshotCapabilitiesStruct>  &CameraDevice::GetSnapshotCapabilities(
 CameraError CameraDevice::SetNightVision(TriStateAutoEnum nightVision)
 {
     mNightVision = nightVision;
+    InvalidateSnapshotCache();
 
     return CameraError::SUCCESS;
 }
@@ -283,12 +360,20 @@ uint32_t CameraDevice::GetMaxNetworkBandwidth()
 
 uint16_t CameraDevice::GetCurrentFrameRate()
 {
-    return mCurrentVideoFrameRate;
+    // The encoder runs at the highest frame rate admitted for the allocated video streams
+    uint16_t frameRate = 0;
+    for (const VideoStream  &stream : mVideoStreams) {
+        if (stream.isAllocated) {
+            frameRate = std::max(frameRate, stream.targetFrameRate);
+        }
+    }
+    return frameRate ? frameRate : mCurrentVideoFrameRate;
 }
 
 CameraError CameraDevice::SetHDRMode(bool hdrMode)
 {
     mHDREnabled = hdrMode;
+    InvalidateSnapshotCache();
 
     return CameraError::SUCCESS;
 }
@@ -297,6 +382,7 @@ CameraError CameraDevice::SetHardPrivacyMode(bool hardPrivacyMode)
 {
     ChipLogProgress(Camera, "SetHardPrivacyMode: Setting hard privacy mode to %s", hardPrivacyMode ? "true" : "false");
     mHardPrivacyModeOn = hardPrivacyMode;
+    InvalidateSnapshotCache();
 
     return CameraError::SUCCESS;
 }
@@ -317,6 +403,7 @@ std::vector<StreamUsageEnum>  &CameraDevice::GetSupportedStreamUsages()
 CameraError CameraDevice::SetViewport(const chip::app::Clusters::Globals::Structs::ViewportStruct::Type  &viewPort)
 {
     mViewport = viewPort;
+    InvalidateSnapshotCache();
 
     return CameraError::SUCCESS;
 }
@@ -330,6 +417,21 @@ CameraError CameraDevice::SetViewport(VideoStream  &stream,
     return CameraError::SUCCESS;
 }
 
+CameraError CameraDevice::SetSnapshotStreamOverlays(SnapshotStream  &stream, const chip::Optional<bool>  &watermarkEnabled,
+                                                    const chip::Optional<bool>  &osdEnabled)
+{
+    if (watermarkEnabled.HasValue()) {
+        stream.snapshotStreamParams.watermarkEnabled = watermarkEnabled;
+    }
+    if (osdEnabled.HasValue()) {
+        stream.snapshotStreamParams.OSDEnabled = osdEnabled;
+    }
+    // The cached snapshots were encoded with the previous overlays
+    InvalidateSnapshotCache();
+
+    return CameraError::SUCCESS;
+}
+
 CameraError CameraDevice::SetSoftRecordingPrivacyModeEnabled(bool softRecordingPrivacyMode)
 {
     mSoftRecordingPrivacyModeEnabled = softRecordingPrivacyMode;
@@ -383,6 +485,7 @@ CameraError CameraDevice::SetMicrophoneVolume(uint8_t microphoneVol)
 CameraError CameraDevice::SetImageRotation(uint16_t imageRotation)
 {
     mImageRotation = imageRotation;
+    InvalidateSnapshotCache();
 
     return CameraError::SUCCESS;
 }
@@ -390,6 +493,7 @@ CameraError CameraDevice::SetImageRotation(uint16_t imageRotation)
 CameraError CameraDevice::SetImageFlipHorizontal(bool imageFlipHorizontal)
 {
     mImageFlipHorizontal = imageFlipHorizontal;
+    InvalidateSnapshotCache();
 
     return CameraError::SUCCESS;
 }
@@ -397,6 +501,7 @@ CameraError CameraDevice::SetImageFlipHorizontal(bool imageFlipHorizontal)
 CameraError CameraDevice::SetImageFlipVertical(bool imageFlipVertical)
 {
     mImageFlipVertical = imageFlipVertical;
+    InvalidateSnapshotCache();
 
     return CameraError::SUCCESS;
 }
@@ -606,6 +711,8 @@ bool CameraDevice::AddSnapshotStream(
     };
 
     mSnapshotStreams.push_back(snapshotStream);
+    // A new stream may be closer to the resolutions matched so far
+    mSnapshotMatches.clear();
     return true;
 }
 
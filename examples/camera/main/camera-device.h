@@ -21,6 +21,7 @@
 #include "camera-device-interface.h"
 #include "webrtc-provider-manager.h"
 #include <protocols/interaction_model/StatusCode.h>
+#include <system/SystemClock.h>
 
 // Camera Constraints set to typical values.
 // TODO: Look into ways to fetch from hardware, if required/possible.
@@ -41,6 +42,7 @@ static constexpr uint16_t k720pResolutionHeight      = 720;  // 720p resolution
 static constexpr uint16_t kMaxResolutionWidth        = 1920; // 1080p resolution
 static constexpr uint16_t kMaxResolutionHeight       = 1080; // 1080p resolution
 static constexpr uint16_t kSnapshotStreamFrameRate   = 30;
+static constexpr uint8_t kMaxSnapshotMatches         = 8; // Requested resolutions remembered, least recently used first out
 static constexpr uint16_t kMaxVideoFrameRate         = 120;
 static constexpr uint16_t k60fpsVideoFrameRate       = 60;
 static constexpr uint16_t kMinVideoFrameRate         = 30;
@@ -54,6 +56,8 @@ static constexpr uint16_t kMaxImageRotation          = 359; // Spec constraint
 static constexpr uint8_t kMaxZones                   = 10;  // Spec has min 1
 static constexpr uint8_t kMaxUserDefinedZones        = 10;  // Spec has min 5
 static constexpr uint8_t kSensitivityMax             = 10;  // Spec has 2 to 10
+static constexpr uint32_t kSnapshotCacheTtlMs        = 1000; // Age up to which a captured snapshot is served again
+static constexpr size_t kMaxCachedSnapshots          = 2;    // One per snapshot stream being polled
 
 // StreamIDs typically start from 0 and monotonically increase. Setting
 // Invalid value to a large and practically unused value.
@@ -175,6 +179,9 @@ public:
     CameraError SetViewport(VideoStream  &stream,
                             const chip::app::Clusters::Globals::Structs::ViewportStruct::Type  &viewport) override;
 
+    CameraError SetSnapshotStreamOverlays(SnapshotStream  &stream, const chip::Optional<bool>  &watermarkEnabled,
+                                          const chip::Optional<bool>  &osdEnabled) override;
+
     // Get/Set SoftRecordingPrivacyMode.
     CameraError SetSoftRecordingPrivacyModeEnabled(bool softRecordingPrivacyMode) override;
     bool GetSoftRecordingPrivacyModeEnabled() override
@@ -338,6 +345,34 @@ private:
     bool MatchClosestSnapshotParams(const VideoResolutionStruct  &requested, VideoResolutionStruct  &outResolution,
                                     chip::app::Clusters::CameraAvStreamManagement::ImageCodecEnum  &outCodec);
 
+    // Snapshot stream serving a CaptureSnapshot request, nullptr if none
+    const SnapshotStream * FindSnapshotStream(const chip::app::DataModel::Nullable<uint16_t>  &streamID,
+                                              const VideoResolutionStruct  &resolution);
+
+    CameraError CaptureAndEncodeSnapshot(const SnapshotStream  &stream, ImageSnapshot  &outImageSnapshot);
+
+    // Drop the cached snapshots, called when a setting changing the image is applied
+    void InvalidateSnapshotCache();
+
+    struct SnapshotMatch {
+        VideoResolutionStruct requested;
+        uint16_t snapshotStreamID;
+    };
+
+    struct CachedSnapshot {
+        uint16_t snapshotStreamID;
+        chip::System::Clock::Timestamp capturedAt;
+        ImageSnapshot snapshot;
+    };
+
+    // Closest snapshot stream of the last kMaxSnapshotMatches requested resolutions, most recently used first,
+    // cleared when the snapshot streams change
+    std::vector<SnapshotMatch> mSnapshotMatches;
+    // Recent snapshots by snapshot stream, the controllers polling the same stream share one capture
+    std::vector<CachedSnapshot> mSnapshotCache;
+    uint32_t mSnapshotCaptureCount  = 0;
+    uint32_t mSnapshotCacheHitCount = 0;
+
     // Various cluster server delegates
     chip::app::Clusters::WebRTCTransportProvider::WebRTCProviderManager mWebRTCProviderManager;
 
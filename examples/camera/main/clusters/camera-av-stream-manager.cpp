@@ -36,6 +36,19 @@ namespace {
 
 // Constants
 constexpr uint16_t kInvalidStreamID = 65500;
+constexpr uint32_t kBitsPerMegabit  = 1000000;
+
+const char * AdmissionDecisionToString(Camera::AdmissionDecision decision)
+{
+    switch (decision) {
+    case Camera::AdmissionDecision::kAdmitted:
+        return "admitted";
+    case Camera::AdmissionDecision::kDowngraded:
+        return "downgraded";
+    default:
+        return "rejected";
+    }
+}
 
 } // namespace
 
@@ -44,6 +57,55 @@ void CameraAVStreamManager::SetCameraDeviceHAL(CameraDeviceInterface * aCameraDe
     mCameraDeviceHAL = aCameraDeviceHAL;
 }
 
+void CameraAVStreamManager::InitStreamAdmission()
+{
+    if (mStreamAdmission.IsInitialized()) {
+        return;
+    }
+
+    auto  &hal = mCameraDeviceHAL->GetCameraHALInterface();
+    mStreamAdmission.Init(hal.GetMaxConcurrentEncoders(), hal.GetMaxEncodedPixelRate(),
+                          hal.GetMaxNetworkBandwidth() * kBitsPerMegabit);
+
+    std::vector<uint8_t> priorities;
+    for (StreamUsageEnum usage : hal.GetStreamUsagePriorities()) {
+        priorities.push_back(to_underlying(usage));
+    }
+    mStreamAdmission.SetStreamUsagePriorities(priorities);
+}
+
+void CameraAVStreamManager::ApplyStreamBudgets(const std::vector<Camera::StreamBudget>  &budgets)
+{
+    bool videoBudgetChanged = false;
+    for (const auto  &budget : budgets) {
+        if (budget.kind != Camera::StreamKind::kVideo) {
+            continue;
+        }
+        for (VideoStream  &stream : mCameraDeviceHAL->GetCameraHALInterface().GetAvailableVideoStreams()) {
+            if (stream.videoStreamParams.videoStreamID == budget.streamID) {
+                stream.targetFrameRate = budget.frameRate;
+                stream.targetBitRate   = budget.bitRate;
+                videoBudgetChanged     = true;
+                ChipLogProgress(Camera, "Video stream %u budget: %u fps, %lu bps", budget.streamID, budget.frameRate,
+                                static_cast<unsigned long>(budget.bitRate));
+                break;
+            }
+        }
+    }
+
+    // The HAL runs the encoder at the frame rate of the admitted streams
+    if (videoBudgetChanged) {
+        GetCameraAVStreamManagementCluster()->SetCurrentFrameRate(mCameraDeviceHAL->GetCameraHALInterface().GetCurrentFrameRate());
+    }
+}
+
+void CameraAVStreamManager::OnUplinkBandwidthMeasured(uint32_t bps)
+{
+    InitStreamAdmission();
+    ChipLogProgress(Camera, "Uplink bandwidth measured: %lu bps", static_cast<unsigned long>(bps));
+    ApplyStreamBudgets(mStreamAdmission.UpdateMeasuredUplink(bps));
+}
+
 CHIP_ERROR CameraAVStreamManager::ValidateStreamUsage(StreamUsageEnum streamUsage,
                                                       Optional<DataModel::Nullable<uint16_t>>  &videoStreamId,
                                                       Optional<DataModel::Nullable<uint16_t>>  &audioStreamId)
@@ -149,12 +211,14 @@ void CameraAVStreamManager::GetBandwidthForStreams(const Optional<DataModel::Nul
 
     outBandwidthbps = 0;
     if (videoStreamId.HasValue() && !videoStreamId.Value().IsNull()) {
-        uint16_t vStreamId           = videoStreamId.Value().Value();
-        auto  &allocatedVideoStreams = GetCameraAVStreamManagementCluster()->GetAllocatedVideoStreams();
-        for (const chip::app::Clusters::CameraAvStreamManagement::Structs::VideoStreamStruct::Type  &stream : allocatedVideoStreams) {
-            if (stream.videoStreamID == vStreamId) {
-                outBandwidthbps += stream.maxBitRate;
-                ChipLogProgress(Camera, "GetBandwidthForStreams: VideoStream %u maxBitRate: %lu bps", vStreamId, stream.maxBitRate);
+        uint16_t vStreamId = videoStreamId.Value().Value();
+        for (const VideoStream  &stream : mCameraDeviceHAL->GetCameraHALInterface().GetAvailableVideoStreams()) {
+            if (stream.isAllocated && stream.videoStreamParams.videoStreamID == vStreamId) {
+                // The admitted budget is what the stream sends, the maxBitRate only bounds it
+                uint32_t bitRate = stream.targetBitRate ? stream.targetBitRate : stream.videoStreamParams.maxBitRate;
+                outBandwidthbps += bitRate;
+                ChipLogProgress(Camera, "GetBandwidthForStreams: VideoStream %u bitRate: %lu bps", vStreamId,
+                                static_cast<unsigned long>(bitRate));
                 break;
             }
         }
@@ -278,15 +342,29 @@ Protocols::InteractionModel::Status CameraAVStreamManager::VideoStreamAllocate(c
     // Try to find an unused compatible available stream
     for (auto  &stream : mCameraDeviceHAL->GetCameraHALInterface().GetAvailableVideoStreams()) {
         if (!stream.isAllocated && stream.IsCompatible(allocateArgs)) {
-            uint32_t candidateEncodedPixelRate =
-                allocateArgs.maxFrameRate * allocateArgs.maxResolution.height * allocateArgs.maxResolution.width;
-            bool encoderRequired = true;
-            if (!GetCameraAVStreamManagementCluster()->IsResourceAvailableForStreamAllocation(candidateEncodedPixelRate,
-                                                                                              encoderRequired)) {
+            InitStreamAdmission();
+            Camera::StreamAdmissionRequest request = {
+                Camera::StreamKind::kVideo,
+                stream.videoStreamParams.videoStreamID,
+                to_underlying(allocateArgs.streamUsage),
+                true /* encoderRequired */,
+                allocateArgs.minFrameRate,
+                allocateArgs.maxFrameRate,
+                static_cast<uint32_t>(allocateArgs.maxResolution.width) * allocateArgs.maxResolution.height,
+                allocateArgs.minBitRate,
+                allocateArgs.maxBitRate,
+            };
+            Camera::StreamAdmissionResult admission = mStreamAdmission.Admit(request);
+            ChipLogProgress(Camera, "Video stream %u %s at %u fps, %lu bps", request.streamID,
+                            AdmissionDecisionToString(admission.decision), admission.budget.frameRate,
+                            static_cast<unsigned long>(admission.budget.bitRate));
+            if (admission.decision == Camera::AdmissionDecision::kRejected) {
                 return Status::ResourceExhausted;
             }
             stream.isAllocated = true;
             outStreamID        = stream.videoStreamParams.videoStreamID;
+            ApplyStreamBudgets({ admission.budget });
+            ApplyStreamBudgets(admission.changedBudgets);
 
             // Set the default viewport on the newly allocated stream
             mCameraDeviceHAL->GetCameraHALInterface().SetViewport(stream, mCameraDeviceHAL->GetCameraHALInterface().GetViewport());
@@ -359,7 +437,12 @@ Protocols::InteractionModel::Status CameraAVStreamManager::VideoStreamDeallocate
 {
     for (VideoStream  &stream : mCameraDeviceHAL->GetCameraHALInterface().GetAvailableVideoStreams()) {
         if (stream.videoStreamParams.videoStreamID == streamID && stream.isAllocated) {
-            stream.isAllocated = false;
+            stream.isAllocated     = false;
+            stream.targetFrameRate = 0;
+            stream.targetBitRate   = 0;
+            ApplyStreamBudgets(mStreamAdmission.Release(Camera::StreamKind::kVideo, streamID));
+            GetCameraAVStreamManagementCluster()->SetCurrentFrameRate(
+                mCameraDeviceHAL->GetCameraHALInterface().GetCurrentFrameRate());
             return Status::Success;
         }
     }
@@ -378,7 +461,28 @@ Protocols::InteractionModel::Status CameraAVStreamManager::AudioStreamAllocate(c
         if (stream.IsCompatible(allocateArgs)) {
             outStreamID = stream.audioStreamParams.audioStreamID;
             if (!stream.isAllocated) {
+                InitStreamAdmission();
+                // Audio is not downgraded, the stream gets its bit rate or is rejected
+                Camera::StreamAdmissionRequest request = {
+                    Camera::StreamKind::kAudio,
+                    outStreamID,
+                    to_underlying(allocateArgs.streamUsage),
+                    false /* encoderRequired */,
+                    0,
+                    0,
+                    0,
+                    allocateArgs.bitRate,
+                    allocateArgs.bitRate,
+                };
+                Camera::StreamAdmissionResult admission = mStreamAdmission.Admit(request);
+                if (admission.decision == Camera::AdmissionDecision::kRejected) {
+                    ChipLogError(Camera, "Audio stream %u rejected, %lu bps does not fit in the uplink budget", outStreamID,
+                                 static_cast<unsigned long>(allocateArgs.bitRate));
+                    outStreamID = kInvalidStreamID;
+                    return Status::ResourceExhausted;
+                }
                 stream.isAllocated = true;
+                ApplyStreamBudgets(admission.changedBudgets);
                 return Status::Success;
             } else {
                 ChipLogProgress(Camera, "Matching pre-allocated stream with ID: %d exists", outStreamID);
@@ -395,6 +499,7 @@ Protocols::InteractionModel::Status CameraAVStreamManager::AudioStreamDeallocate
     for (AudioStream  &stream : mCameraDeviceHAL->GetCameraHALInterface().GetAvailableAudioStreams()) {
         if (stream.audioStreamParams.audioStreamID == streamID && stream.isAllocated) {
             stream.isAllocated = false;
+            ApplyStreamBudgets(mStreamAdmission.Release(Camera::StreamKind::kAudio, streamID));
             return Status::Success;
         }
     }
@@ -432,28 +537,44 @@ Protocols::InteractionModel::Status CameraAVStreamManager::SnapshotStreamAllocat
         return Status::Success;
     }
 
-    uint32_t candidateEncodedPixelRate = 0;
-    bool encoderRequired               = false;
-    if (allocateArgs.encodedPixels) {
-        candidateEncodedPixelRate +=
-            allocateArgs.maxFrameRate * allocateArgs.maxResolution.height * allocateArgs.maxResolution.width;
-        if (allocateArgs.hardwareEncoder) {
-            encoderRequired = true;
-        }
-    }
-
-    if (!GetCameraAVStreamManagementCluster()->IsResourceAvailableForStreamAllocation(candidateEncodedPixelRate, encoderRequired)) {
-        return Status::ResourceExhausted;
-    }
+    // Snapshots are pulled on demand, they only take an encoder and encoded pixel rate
+    InitStreamAdmission();
+    Camera::StreamAdmissionRequest request = {
+        Camera::StreamKind::kSnapshot,
+        kInvalidStreamID,
+        0,
+        allocateArgs.encodedPixels && allocateArgs.hardwareEncoder,
+        allocateArgs.maxFrameRate,
+        allocateArgs.maxFrameRate,
+        allocateArgs.encodedPixels ? static_cast<uint32_t>(allocateArgs.maxResolution.width) * allocateArgs.maxResolution.height
+                                   : 0,
+        0,
+        0,
+    };
 
     // If no pre-allocated stream matches, try allocating a new one.
     if (mCameraDeviceHAL->GetCameraHALInterface().AllocateSnapshotStream(allocateArgs, outStreamID) == CameraError::SUCCESS) {
+        request.streamID = outStreamID;
+        if (mStreamAdmission.Admit(request).decision == Camera::AdmissionDecision::kRejected) {
+            // Hand the new stream back to the HAL, it stays available for a later allocation
+            for (auto  &stream : mCameraDeviceHAL->GetCameraHALInterface().GetAvailableSnapshotStreams()) {
+                if (stream.snapshotStreamParams.snapshotStreamID == outStreamID) {
+                    stream.isAllocated = false;
+                }
+            }
+            outStreamID = kInvalidStreamID;
+            return Status::ResourceExhausted;
+        }
         return Status::Success;
     }
 
     // Try to find an unused compatible available stream
     for (auto  &stream : mCameraDeviceHAL->GetCameraHALInterface().GetAvailableSnapshotStreams()) {
         if (!stream.isAllocated && stream.IsCompatible(allocateArgs)) {
+            request.streamID = stream.snapshotStreamParams.snapshotStreamID;
+            if (mStreamAdmission.Admit(request).decision == Camera::AdmissionDecision::kRejected) {
+                return Status::ResourceExhausted;
+            }
             stream.isAllocated = true;
             outStreamID        = stream.snapshotStreamParams.snapshotStreamID;
 
@@ -478,12 +599,10 @@ Protocols::InteractionModel::Status CameraAVStreamManager::SnapshotStreamModify(
 {
     for (SnapshotStream  &stream : mCameraDeviceHAL->GetCameraHALInterface().GetAvailableSnapshotStreams()) {
         if (stream.snapshotStreamParams.snapshotStreamID == streamID && stream.isAllocated) {
-            // TODO: Link with HAL APIs to return error
-            if (waterMarkEnabled.HasValue()) {
-                stream.snapshotStreamParams.watermarkEnabled = waterMarkEnabled;
-            }
-            if (osdEnabled.HasValue()) {
-                stream.snapshotStreamParams.OSDEnabled = osdEnabled;
+            if (mCameraDeviceHAL->GetCameraHALInterface().SetSnapshotStreamOverlays(stream, waterMarkEnabled, osdEnabled) !=
+                    CameraError::SUCCESS) {
+                ChipLogError(Camera, "Failed to modify snapshot stream with ID: %d", streamID);
+                return Status::Failure;
             }
             ChipLogError(Camera, "Modified snapshot stream with ID: %d", streamID);
             return Status::Success;
@@ -504,6 +623,7 @@ Protocols::InteractionModel::Status CameraAVStreamManager::SnapshotStreamDealloc
                 return Status::InvalidInState;
             }
             stream.isAllocated = false;
+            mStreamAdmission.Release(Camera::StreamKind::kSnapshot, streamID);
 
             return Status::Success;
         }
@@ -519,6 +639,14 @@ void CameraAVStreamManager::OnStreamUsagePrioritiesChanged()
     ChipLogProgress(Camera, "Stream usage priorities changed");
     mCameraDeviceHAL->GetCameraHALInterface().SetStreamUsagePriorities(
         GetCameraAVStreamManagementCluster()->GetStreamUsagePriorities());
+
+    // The bandwidth left after the minimum bit rates goes to the streams in the new priority order
+    InitStreamAdmission();
+    std::vector<uint8_t> priorities;
+    for (StreamUsageEnum usage : GetCameraAVStreamManagementCluster()->GetStreamUsagePriorities()) {
+        priorities.push_back(to_underlying(usage));
+    }
+    ApplyStreamBudgets(mStreamAdmission.SetStreamUsagePriorities(priorities));
 }
 
 void CameraAVStreamManager::OnAttributeChanged(AttributeId attributeId)
@@ -639,6 +767,26 @@ CameraAVStreamManager::AllocatedVideoStreamsLoaded()
             ChipLogProgress(Camera, "HAL Video Stream ID %u marked as allocated from persisted state.",
                             halStream.videoStreamParams.videoStreamID);
 
+            // Account for the persisted stream, it is kept even if it no longer fits
+            InitStreamAdmission();
+            Camera::StreamAdmissionResult admission = mStreamAdmission.Admit({
+                Camera::StreamKind::kVideo,
+                it->videoStreamID,
+                to_underlying(it->streamUsage),
+                true /* encoderRequired */,
+                it->minFrameRate,
+                it->maxFrameRate,
+                static_cast<uint32_t>(it->maxResolution.width) * it->maxResolution.height,
+                it->minBitRate,
+                it->maxBitRate,
+            });
+            if (admission.decision == Camera::AdmissionDecision::kRejected) {
+                ChipLogError(Camera, "Persisted video stream %u exceeds the stream resources", it->videoStreamID);
+            } else {
+                ApplyStreamBudgets({ admission.budget });
+                ApplyStreamBudgets(admission.changedBudgets);
+            }
+
             // Signal for starting the video stream
             OnVideoStreamAllocated(*it, StreamAllocationAction::kNewAllocation);
         }
@@ -663,6 +811,24 @@ CameraAVStreamManager::AllocatedAudioStreamsLoaded()
             halStream.isAllocated = true;
             ChipLogProgress(Camera, "HAL Audio Stream ID %u marked as allocated from persisted state.",
                             halStream.audioStreamParams.audioStreamID);
+
+            InitStreamAdmission();
+            Camera::StreamAdmissionResult admission = mStreamAdmission.Admit({
+                Camera::StreamKind::kAudio,
+                it->audioStreamID,
+                to_underlying(it->streamUsage),
+                false /* encoderRequired */,
+                0,
+                0,
+                0,
+                it->bitRate,
+                it->bitRate,
+            });
+            if (admission.decision == Camera::AdmissionDecision::kRejected) {
+                ChipLogError(Camera, "Persisted audio stream %u exceeds the uplink budget", it->audioStreamID);
+            } else {
+                ApplyStreamBudgets(admission.changedBudgets);
+            }
         }
     }
 
@@ -672,9 +838,44 @@ CameraAVStreamManager::AllocatedAudioStreamsLoaded()
 CHIP_ERROR
 CameraAVStreamManager::AllocatedSnapshotStreamsLoaded()
 {
-    ChipLogError(Camera, "Allocated snapshot streams could not be loaded: %" CHIP_ERROR_FORMAT,
-                 CHIP_ERROR_NOT_IMPLEMENTED.Format());
-    return CHIP_ERROR_NOT_IMPLEMENTED;
+    const std::vector<SnapshotStreamStruct>  &persistedStreams = GetCameraAVStreamManagementCluster()->GetAllocatedSnapshotStreams();
+    auto  &halStreams                                          = mCameraDeviceHAL->GetCameraHALInterface().GetAvailableSnapshotStreams();
+
+    for (auto  &halStream : halStreams) {
+        auto it = std::find_if(persistedStreams.begin(), persistedStreams.end(), [&](const SnapshotStreamStruct & persistedStream) {
+            return persistedStream.snapshotStreamID == halStream.snapshotStreamParams.snapshotStreamID;
+        });
+
+        if (it != persistedStreams.end()) {
+            // Found in persisted streams, mark as allocated in HAL
+            halStream.isAllocated                           = true;
+            halStream.snapshotStreamParams.watermarkEnabled = it->watermarkEnabled;
+            halStream.snapshotStreamParams.OSDEnabled       = it->OSDEnabled;
+            ChipLogProgress(Camera, "HAL Snapshot Stream ID %u marked as allocated from persisted state.",
+                            halStream.snapshotStreamParams.snapshotStreamID);
+
+            // Account for the encoder and pixel rate of the persisted stream, it is kept even if it no longer fits
+            InitStreamAdmission();
+            Camera::StreamAdmissionResult admission = mStreamAdmission.Admit({
+                Camera::StreamKind::kSnapshot,
+                it->snapshotStreamID,
+                0,
+                it->encodedPixels && it->hardwareEncoder,
+                it->frameRate,
+                it->frameRate,
+                it->encodedPixels ? static_cast<uint32_t>(it->maxResolution.width) * it->maxResolution.height : 0,
+                0,
+                0,
+            });
+            if (admission.decision == Camera::AdmissionDecision::kRejected) {
+                ChipLogError(Camera, "Persisted snapshot stream %u exceeds the stream resources", it->snapshotStreamID);
+            } else {
+                ApplyStreamBudgets(admission.changedBudgets);
+            }
+        }
+    }
+
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR
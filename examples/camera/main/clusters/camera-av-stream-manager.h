@@ -19,6 +19,7 @@
 
 #include "camera-avstream-controller.h"
 #include "camera-device-interface.h"
+#include "camera-stream-admission.h"
 #include <app/clusters/camera-av-stream-management-server/CameraAVStreamManagementCluster.h>
 #include <app/util/config.h>
 #include <vector>
@@ -106,7 +107,17 @@ public:
 
     void SetCameraDeviceHAL(CameraDeviceInterface * aCameraDevice);
 
+    /**
+     * Report the measured uplink throughput in bps, 0 to go back to the MaxNetworkBandwidth. The bit rate budgets of the
+     * allocated streams are shared again within the new uplink budget.
+     */
+    void OnUplinkBandwidthMeasured(uint32_t bps) override;
+
 private:
+    void InitStreamAdmission();
+
+    void ApplyStreamBudgets(const std::vector<Camera::StreamBudget>  &budgets);
+
     CHIP_ERROR AllocatedVideoStreamsLoaded();
 
     CHIP_ERROR AllocatedAudioStreamsLoaded();
@@ -114,6 +125,9 @@ private:
     CHIP_ERROR AllocatedSnapshotStreamsLoaded();
 
     CameraDeviceInterface * mCameraDeviceHAL = nullptr;
+
+    // Encoder, encoded pixel rate and uplink bandwidth admission of the allocated streams
+    Camera::StreamAdmissionScheduler mStreamAdmission;
 };
 
 } // namespace CameraAvStreamManagement
@@ -19,10 +19,13 @@
 
 #include "webrtc-kvs_esp_port.h"
 #include "webrtc-kvs_esp_port_utils.h"
+#include <algorithm>
 #include <app/server/Server.h>
 #include <controller/InvokeInteraction.h>
+#include <esp_heap_caps.h>
 #include <iostream>
 #include <lib/support/logging/CHIPLogging.h>
+#include <sstream>
 #include <webrtc-transport.h>
 #include <webrtc_bridge.h>
 
@@ -36,7 +39,57 @@ extern bool deferred_offer;
 namespace {
 
 // Constants
-constexpr uint16_t kMaxConcurrentWebRTCSessions = 3;
+constexpr uint16_t kMaxConcurrentWebRTCSessions = CONFIG_CAMERA_WEBRTC_MAX_SESSIONS;
+constexpr size_t kSessionHeapBudget             = CONFIG_CAMERA_WEBRTC_SESSION_HEAP_BUDGET;
+constexpr uint64_t kBitsPerKilobit              = 1000;
+
+// Bandwidth in bps accepted by the b=TIAS (bps) and b=AS (kbps) lines of an SDP. A session level line caps the
+// session, the media level lines add up. 0 if the SDP does not limit every media.
+uint32_t GetSdpBandwidthLimit(const std::string  &sdp)
+{
+    uint64_t sessionLimit = 0;
+    uint64_t mediaLimit   = 0;
+    uint64_t mediaTotal   = 0;
+    bool inMedia          = false;
+    bool mediaUnlimited   = false;
+
+    auto endMedia = [&]() {
+        if (inMedia) {
+            mediaTotal += mediaLimit;
+            mediaUnlimited |= (mediaLimit == 0);
+        }
+    };
+
+    std::istringstream lines(sdp);
+    std::string line;
+    while (std::getline(lines, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        uint64_t limit = 0;
+        if (line.compare(0, 2, "m=") == 0) {
+            endMedia();
+            inMedia    = true;
+            mediaLimit = 0;
+            continue;
+        } else if (line.compare(0, 7, "b=TIAS:") == 0) {
+            limit = strtoull(line.c_str() + 7, nullptr, 10);
+        } else if (line.compare(0, 5, "b=AS:") == 0) {
+            limit = strtoull(line.c_str() + 5, nullptr, 10) * kBitsPerKilobit;
+        } else {
+            continue;
+        }
+        uint64_t  &current = inMedia ? mediaLimit : sessionLimit;
+        current           = current ? std::min(current, limit) : limit;
+    }
+    endMedia();
+
+    uint64_t limit = sessionLimit;
+    if (inMedia && !mediaUnlimited) {
+        limit = sessionLimit ? std::min(sessionLimit, mediaTotal) : mediaTotal;
+    }
+    return static_cast<uint32_t>(std::min<uint64_t>(limit, UINT32_MAX));
+}
 
 } // namespace
 
@@ -48,6 +101,7 @@ void WebRTCProviderManager::SetCameraDevice(CameraDeviceInterface * aCameraDevic
 void WebRTCProviderManager::Init()
 {
     ChipLogProgress(Camera, "Initializing WebRTC PeerConnection");
+    mSessions.Init(kMaxConcurrentWebRTCSessions, kSessionHeapBudget);
     // Register our handler for signaling messages
     webrtc_bridge_register_handler((webrtc_bridge_msg_cb_t) &webrtc_bridge_message_received_cb);
 }
@@ -55,8 +109,7 @@ void WebRTCProviderManager::Init()
 void WebRTCProviderManager::CloseConnection()
 {
     // Clean up all the Webrtc Transports
-    mWebrtcTransportMap.clear();
-    mSessionIdMap.clear();
+    mSessions.Clear();
 }
 
 void WebRTCProviderManager::SetWebRTCTransportProvider(WebRTCTransportProviderCluster * webRTCTransportProvider)
@@ -118,25 +171,18 @@ WebRTCProviderManager::HandleSolicitOffer(const OfferRequestArgs  &args, WebRTCS
     requestArgs.audioStreamId         = audioStreamID;
     requestArgs.peerId                = ScopedNodeId(args.peerNodeId, args.fabricIndex);
 
-    if (transport == nullptr) {
-        mWebrtcTransportMap[args.sessionId]                            = std::unique_ptr<WebrtcTransport>(new WebrtcTransport());
-        mSessionIdMap[ScopedNodeId(args.peerNodeId, args.fabricIndex)] = args.sessionId;
-        transport                                                      = mWebrtcTransportMap[args.sessionId].get();
-        transport->SetCallbacks(
-        [this](const std::string & sdp, SDPType type, const uint16_t sessionId) {
-            this->OnLocalDescription(sdp, type, sessionId);
-        },
-        [this](bool connected, const uint16_t sessionId) {
-            this->OnConnectionStateChanged(connected, sessionId);
-        });
-    }
-
-    transport->SetRequestArgs(requestArgs);
-
     // Check resource availability before proceeding
     // If we cannot allocate resources, send End command with OutOfResources
     // reason
-    if (mWebrtcTransportMap.size() > kMaxConcurrentWebRTCSessions) {
+    bool admitted = transport != nullptr || CanAdmitSession();
+
+    if (transport == nullptr) {
+        transport = CreateTransport(requestArgs);
+    } else {
+        transport->SetRequestArgs(requestArgs);
+    }
+
+    if (!admitted) {
         ChipLogProgress(Camera, "Resource exhaustion detected: maximum WebRTC sessions (%u)", kMaxConcurrentWebRTCSessions);
 
         transport->SetCommandType(WebrtcTransport::CommandType::kEnd);
@@ -249,30 +295,21 @@ WebRTCProviderManager::HandleProvideOffer(const ProvideOfferRequestArgs  &args,
 
     WebrtcTransport * transport = GetTransport(args.sessionId);
     if (transport == nullptr) {
-        mWebrtcTransportMap[args.sessionId]                            = std::unique_ptr<WebrtcTransport>(new WebrtcTransport());
-        mSessionIdMap[ScopedNodeId(args.peerNodeId, args.fabricIndex)] = args.sessionId;
-        transport                                                      = mWebrtcTransportMap[args.sessionId].get();
-        transport->SetCallbacks(
-        [this](const std::string & sdp, SDPType type, const uint16_t sessionId) {
-            this->OnLocalDescription(sdp, type, sessionId);
-        },
-        [this](bool connected, const uint16_t sessionId) {
-            this->OnConnectionStateChanged(connected, sessionId);
-        });
-    }
-
-    // Check resource availability before proceeding
-    // If we cannot allocate resources, respond with a response status of
-    // RESOURCE_EXHAUSTED
-    if (mWebrtcTransportMap.size() > kMaxConcurrentWebRTCSessions) {
-        ChipLogProgress(Camera,
-                        "Resource exhaustion detected in ProvideOffer: maximum "
-                        "WebRTC sessions (%u)",
-                        kMaxConcurrentWebRTCSessions);
-        return CHIP_IM_GLOBAL_STATUS(ResourceExhausted);
+        // Check resource availability before proceeding
+        // If we cannot allocate resources, respond with a response status of
+        // RESOURCE_EXHAUSTED. No transport is created for the rejected session.
+        if (!CanAdmitSession()) {
+            ChipLogProgress(Camera,
+                            "Resource exhaustion detected in ProvideOffer: maximum "
+                            "WebRTC sessions (%u)",
+                            kMaxConcurrentWebRTCSessions);
+            return CHIP_IM_GLOBAL_STATUS(ResourceExhausted);
+        }
+        transport = CreateTransport(requestArgs);
+    } else {
+        transport->SetRequestArgs(requestArgs);
     }
 
-    transport->SetRequestArgs(requestArgs);
     transport->Start();
     transport->AddTracks();
 
@@ -286,6 +323,7 @@ WebRTCProviderManager::HandleProvideOffer(const ProvideOfferRequestArgs  &args,
         transport->GetPeerConnection()->SetRemoteDescription(args.sdp, SDPType::Offer);
         transport->GetPeerConnection()->CreateAnswer();
     }
+    UpdateUplinkBandwidth(transport, args.sdp);
 
     return CHIP_NO_ERROR;
 }
@@ -316,6 +354,7 @@ WebRTCProviderManager::HandleProvideAnswer(uint16_t sessionId, const std::string
     }
 
     transport->GetPeerConnection()->SetRemoteDescription(sdpAnswer, SDPType::Answer);
+    UpdateUplinkBandwidth(transport, sdpAnswer);
 
     transport->MoveToState(WebrtcTransport::State::SendingICECandidates);
     ScheduleICECandidatesSend(sessionId);
@@ -372,24 +411,14 @@ CHIP_ERROR WebRTCProviderManager::HandleEndSession(uint16_t sessionId, WebRTCEnd
         ChipLogError(Camera, "Session ID %u does not match the current sessions", sessionId);
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
-    if (transport != nullptr) {
-        ChipLogProgress(Camera, "Delete Webrtc Transport for the session: %u", sessionId);
-
-        // Release the Video and Audio Streams from the CameraAVStreamManagement
-        // cluster and update the reference counts.
-        // TODO: Lookup the sessionID to get the Video/Audio StreamID
-        ReleaseAudioVideoStreams(sessionId);
-
-        UnregisterWebrtcTransport(sessionId);
-        mWebrtcTransportMap.erase(sessionId);
-        WebrtcTransport::RequestArgs args = transport->GetRequestArgs();
-        mSessionIdMap.erase(ScopedNodeId(args.peerNodeId, args.fabricIndex));
-    }
 
     if (transport->ClosePeerConnection()) {
         ChipLogProgress(Camera, "Closing peer connection: %u", sessionId);
     }
 
+    ChipLogProgress(Camera, "Delete Webrtc Transport for the session: %u", sessionId);
+    DestroyTransport(sessionId);
+
     return CHIP_NO_ERROR;
 }
 
@@ -677,8 +706,8 @@ void WebRTCProviderManager::OnDeviceConnected(void * context, Messaging::Exchang
     // Derive sessionId from sessionHandle by looking up the peer ScopedNodeId
     // (NodeId + FabricIndex)
     ScopedNodeId peerScopedNodeId = sessionHandle->GetPeer();
-    auto sessionIt                = self->mSessionIdMap.find(peerScopedNodeId);
-    if (sessionIt == self->mSessionIdMap.end()) {
+    uint16_t sessionId            = 0;
+    if (!self->mSessions.GetPeerSession(peerScopedNodeId, sessionId)) {
         ChipLogError(Camera,
                      "OnDeviceConnected:: no session found for peer ScopedNodeId: "
                      "[%d:" ChipLogFormatX64 "]",
@@ -686,7 +715,6 @@ void WebRTCProviderManager::OnDeviceConnected(void * context, Messaging::Exchang
         return;
     }
 
-    uint16_t sessionId          = sessionIt->second;
     WebrtcTransport * transport = self->GetTransport(sessionId);
     if (transport == nullptr) {
         ChipLogError(Camera, "OnDeviceConnected:: transport not found for sessionId: %u", sessionId);
@@ -724,18 +752,11 @@ void WebRTCProviderManager::OnDeviceConnected(void * context, Messaging::Exchang
         }
 
         err = self->SendEndCommand(exchangeMgr, sessionHandle, sessionId, endReason);
-        // Release the Video and Audio Streams from the CameraAVStreamManagement
-        // cluster and update the reference counts.
-        self->ReleaseAudioVideoStreams(sessionId);
-        self->UnregisterWebrtcTransport(sessionId);
-        WebrtcTransport::RequestArgs args = transport->GetRequestArgs();
-        self->mSessionIdMap.erase(ScopedNodeId(args.peerNodeId, args.fabricIndex));
-
         transport->MoveToState(WebrtcTransport::State::Idle);
 
         // remove from current sessions list
         self->mWebRTCTransportProvider->RemoveSession(sessionId);
-        self->mWebrtcTransportMap.erase(sessionId);
+        self->DestroyTransport(sessionId);
         break;
     }
     default:
@@ -757,14 +778,82 @@ void WebRTCProviderManager::OnDeviceConnectionFailure(void * context, const Scop
 
 WebrtcTransport * WebRTCProviderManager::GetTransport(uint16_t sessionId)
 {
-    WebrtcTransport * transport = nullptr;
-    if (mWebrtcTransportMap.find(sessionId) != mWebrtcTransportMap.end()) {
-        transport = mWebrtcTransportMap[sessionId].get();
+    return mSessions.Get(sessionId);
+}
+
+bool WebRTCProviderManager::CanAdmitSession()
+{
+    size_t freeHeap = heap_caps_get_free_size(MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL);
+    if (mSessions.CanAdmit(freeHeap)) {
+        return true;
     }
+    if (mSessions.Size() < kMaxConcurrentWebRTCSessions) {
+        ChipLogProgress(Camera, "Free heap %u below the session budget %u", static_cast<unsigned>(freeHeap),
+                        static_cast<unsigned>(kSessionHeapBudget));
+    }
+    return false;
+}
 
+WebrtcTransport * WebRTCProviderManager::CreateTransport(const WebrtcTransport::RequestArgs  &args)
+{
+    WebrtcTransport * transport = mSessions.Insert(args.sessionId, args.peerId, std::make_unique<WebrtcTransport>());
+
+    transport->SetRequestArgs(args);
+    transport->SetCallbacks(
+    [this](const std::string & sdp, SDPType type, const uint16_t sessionId) {
+        this->OnLocalDescription(sdp, type, sessionId);
+    },
+    [this](bool connected, const uint16_t sessionId) {
+        this->OnConnectionStateChanged(connected, sessionId);
+    });
+
+    ChipLogProgress(Camera, "WebRTC session %u created, sessions: %u, free heap: %u", args.sessionId,
+                    static_cast<unsigned>(mSessions.Size()),
+                    static_cast<unsigned>(heap_caps_get_free_size(MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL)));
     return transport;
 }
 
+void WebRTCProviderManager::DestroyTransport(uint16_t sessionId)
+{
+    WebrtcTransport * transport = GetTransport(sessionId);
+    if (transport == nullptr) {
+        return;
+    }
+
+    // Release the Video and Audio Streams from the CameraAVStreamManagement
+    // cluster and update the reference counts.
+    ReleaseAudioVideoStreams(sessionId);
+    UnregisterWebrtcTransport(sessionId);
+
+    mSessions.Erase(sessionId, transport->GetRequestArgs().peerId);
+    UpdateUplinkBandwidth(nullptr, std::string());
+
+    ChipLogProgress(Camera, "WebRTC session %u destroyed, sessions: %u, free heap: %u", sessionId,
+                    static_cast<unsigned>(mSessions.Size()),
+                    static_cast<unsigned>(heap_caps_get_free_size(MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL)));
+}
+
+void WebRTCProviderManager::UpdateUplinkBandwidth(WebrtcTransport * transport, const std::string  &remoteSdp)
+{
+    if (transport != nullptr) {
+        transport->SetPeerBandwidthLimit(GetSdpBandwidthLimit(remoteSdp));
+    }
+    VerifyOrReturn(mCameraDevice != nullptr, ChipLogError(Camera, "CameraDeviceInterface not initialized"));
+
+    // Each peer caps what it receives, the streams can use the sum of the caps unless one session is not limited
+    uint64_t uplinkBandwidth = 0;
+    for (const auto  &entry : mSessions) {
+        uint32_t limit = entry.second->GetPeerBandwidthLimit();
+        if (limit == 0) {
+            uplinkBandwidth = 0;
+            break;
+        }
+        uplinkBandwidth += limit;
+    }
+    mCameraDevice->GetCameraAVStreamMgmtController().OnUplinkBandwidthMeasured(
+        static_cast<uint32_t>(std::min<uint64_t>(uplinkBandwidth, UINT32_MAX)));
+}
+
 void WebRTCProviderManager::LiveStreamPrivacyModeChanged(bool privacyModeEnabled)
 {
     mSoftLiveStreamPrivacyEnabled = privacyModeEnabled;
@@ -772,7 +861,7 @@ void WebRTCProviderManager::LiveStreamPrivacyModeChanged(bool privacyModeEnabled
     if (privacyModeEnabled) {
         WebrtcTransport * transport = nullptr;
         uint16_t sessionId          = 0;
-        for (auto  &mapEntry : mWebrtcTransportMap) {
+        for (auto  &mapEntry : mSessions) {
             sessionId = mapEntry.first;
 
             transport = (WebrtcTransport *) mapEntry.second.get();
@@ -810,9 +899,9 @@ WebRTCProviderManager::SendOfferCommand(Messaging::ExchangeManager  &exchangeMgr
 
     // Build the command
     WebRTCTransportRequestor::Commands::Offer::Type command;
-    command.webRTCSessionID = sessionId;
-    std::string localSdp    = transport->GetLocalDescription();
-    command.sdp             = CharSpan::fromCharString(localSdp.c_str());
+    command.webRTCSessionID     = sessionId;
+    const std::string  &localSdp = transport->GetLocalDescription();
+    command.sdp                 = CharSpan(localSdp.data(), localSdp.size());
 
     WebrtcTransport::RequestArgs args = transport->GetRequestArgs();
     // Now invoke the command using the found session handle
@@ -876,27 +965,14 @@ void WebRTCProviderManager::OnConnectionStateChanged(bool connected, const uint1
             // Connection was closed/disconnected by the peer - clean up the session
             ChipLogProgress(Camera, "Peer connection closed for session %u, cleaning up resources", sessionId);
 
-            // Release the Video and Audio Streams from the CameraAVStreamManagement
-            // cluster and update the reference counts.
-            ReleaseAudioVideoStreams(sessionId);
-
-            // Capture args before unregistering in case the transport is invalidated
-            WebrtcTransport::RequestArgs args = transport->GetRequestArgs();
-
-            // Unregister the transport from the media controller
-            UnregisterWebrtcTransport(sessionId);
-
-            // Remove from session maps
-            mSessionIdMap.erase(ScopedNodeId(args.peerNodeId, args.fabricIndex));
-
             // Remove from current sessions list in the WebRTC Transport Provider
             // This MUST be called on the Matter thread with the stack lock held
             if (mWebRTCTransportProvider != nullptr) {
                 mWebRTCTransportProvider->RemoveSession(sessionId);
             }
 
-            // Finally, remove and destroy the transport
-            mWebrtcTransportMap.erase(sessionId);
+            // Release the streams, remove from the session maps and destroy the transport
+            DestroyTransport(sessionId);
 
             ChipLogProgress(Camera, "Session %u cleanup completed", sessionId);
         });
@@ -921,9 +997,9 @@ CHIP_ERROR WebRTCProviderManager::SendAnswerCommand(Messaging::ExchangeManager
 
     // Build the command
     WebRTCTransportRequestor::Commands::Answer::Type command;
-    command.webRTCSessionID = sessionId;
-    std::string localSdp    = transport->GetLocalDescription();
-    command.sdp             = CharSpan::fromCharString(localSdp.c_str());
+    command.webRTCSessionID     = sessionId;
+    const std::string  &localSdp = transport->GetLocalDescription();
+    command.sdp                 = CharSpan(localSdp.data(), localSdp.size());
 
     WebrtcTransport::RequestArgs requestArgs = transport->GetRequestArgs();
     // Now invoke the command using the found session handle
@@ -950,7 +1026,7 @@ CHIP_ERROR WebRTCProviderManager::SendICECandidatesCommand(Messaging::ExchangeMa
         ChipLogError(Camera, "WebTransport not found for the sessionId: %u", sessionId);
         return CHIP_ERROR_INTERNAL;
     }
-    std::vector<std::string> localCandidates = transport->GetCandidates();
+    const std::vector<std::string>  &localCandidates = transport->GetCandidates();
     // Build the command
     WebRTCTransportRequestor::Commands::ICECandidates::Type command;
 
@@ -960,8 +1036,9 @@ CHIP_ERROR WebRTCProviderManager::SendICECandidatesCommand(Messaging::ExchangeMa
     }
 
     std::vector<ICECandidateStruct> iceCandidateStructList;
+    iceCandidateStructList.reserve(localCandidates.size());
     for (const auto  &candidate : localCandidates) {
-        ICECandidateStruct iceCandidate = { CharSpan::fromCharString(candidate.c_str()) };
+        ICECandidateStruct iceCandidate = { CharSpan(candidate.data(), candidate.size()) };
         iceCandidateStructList.push_back(iceCandidate);
     }
 
@@ -18,6 +18,7 @@
 #pragma once
 
 #include "camera-device-interface.h"
+#include "webrtc-session-table.h"
 #include <app-common/zap-generated/cluster-enums.h>
 #include <app/CASESessionManager.h>
 #include <app/clusters/webrtc-transport-provider-server/WebRTCTransportProviderCluster.h>
@@ -111,6 +112,18 @@ private:
 
     void UnregisterWebrtcTransport(uint16_t sessionId);
 
+    // Whether a new session fits in the session cap and the heap budget
+    bool CanAdmitSession();
+
+    // Create the transport of a new session, indexed by session ID and by peer
+    WebrtcTransport * CreateTransport(const WebrtcTransport::RequestArgs  &args);
+
+    // Release the streams of a session and destroy its transport
+    void DestroyTransport(uint16_t sessionId);
+
+    // Record the bandwidth the peer accepts from its SDP and report the uplink budget of all the sessions
+    void UpdateUplinkBandwidth(WebrtcTransport * transport, const std::string  &remoteSdp);
+
     CHIP_ERROR SendOfferCommand(chip::Messaging::ExchangeManager  &exchangeMgr, const chip::SessionHandle  &sessionHandle,
                                 uint16_t sessionId);
 
@@ -140,9 +153,8 @@ private:
     chip::Callback::Callback<chip::OnDeviceConnected> mOnConnectedCallback;
     chip::Callback::Callback<chip::OnDeviceConnectionFailure> mOnConnectionFailureCallback;
 
-    std::unordered_map<uint16_t, std::unique_ptr<WebrtcTransport>> mWebrtcTransportMap;
-    // This is to retrieve the sessionIds for a given NodeId
-    std::map<ScopedNodeId, uint16_t> mSessionIdMap;
+    // The transports by session ID, and the sessionIds for a given NodeId
+    Camera::WebRTCSessionTable<WebrtcTransport, ScopedNodeId> mSessions;
 
     WebRTCTransportProviderCluster * mWebRTCTransportProvider = nullptr;
 
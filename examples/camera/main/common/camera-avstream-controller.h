@@ -50,6 +50,14 @@ public:
         const Optional<DataModel::Nullable<uint16_t>> &videoStreamId,
         const Optional<DataModel::Nullable<uint16_t>> &audioStreamId,
         uint32_t &outBandwidthbps) = 0;
+
+    /**
+     * @brief Reports the uplink bandwidth available to the streams, as limited by
+     * the peers of the WebRTC sessions.
+     *
+     * @param bps Uplink bandwidth in bps, 0 if it is not limited.
+     */
+    virtual void OnUplinkBandwidthMeasured(uint32_t bps) = 0;
 };
 
 } // namespace CameraAvStreamManagement
@@ -28,6 +28,8 @@ struct VideoStream {
     viewport;        // Stream specific viewport, defaults to the camera viewport
     void * videoContext; // Platform-specific context object associated with
     // video stream;
+    uint16_t targetFrameRate = 0; // Frame rate admitted for the stream, 0 if the stream is not admitted
+    uint32_t targetBitRate   = 0; // Bit rate budget of the stream, shared again as streams come and go
 
     bool IsCompatible(const VideoStreamStruct  &inputParams) const
     {
@@ -244,6 +246,10 @@ public:
         virtual CameraError SetViewport(VideoStream  &stream,
                                         const chip::app::Clusters::Globals::Structs::ViewportStruct::Type  &viewPort) = 0;
 
+        // Set the watermark and OSD of a snapshot stream, the values which are not provided are left unchanged
+        virtual CameraError SetSnapshotStreamOverlays(SnapshotStream  &stream, const chip::Optional<bool>  &watermarkEnabled,
+                                                      const chip::Optional<bool>  &osdEnabled) = 0;
+
         // Does camera have a speaker
         virtual bool HasSpeaker() = 0;
 
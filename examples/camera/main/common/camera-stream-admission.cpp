@@ -0,0 +1,204 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "camera-stream-admission.h"
+
+#include <algorithm>
+
+using namespace Camera;
+
+void StreamAdmissionScheduler::Init(uint8_t maxEncoders, uint32_t maxEncodedPixelRate, uint32_t maxNetworkBandwidthbps)
+{
+    mMaxEncoders         = maxEncoders;
+    mMaxEncodedPixelRate = maxEncodedPixelRate;
+    mMaxNetworkBandwidth = maxNetworkBandwidthbps;
+    mInitialized         = true;
+}
+
+std::vector<StreamBudget> StreamAdmissionScheduler::SetStreamUsagePriorities(const std::vector<uint8_t> &priorities)
+{
+    std::vector<AdmittedStream> before = mStreams;
+    mPriorities                        = priorities;
+    return Rebalance(before);
+}
+
+std::vector<StreamBudget> StreamAdmissionScheduler::UpdateMeasuredUplink(uint32_t bps)
+{
+    std::vector<AdmittedStream> before = mStreams;
+    mMeasuredUplink                    = bps;
+    return Rebalance(before);
+}
+
+uint32_t StreamAdmissionScheduler::GetUplinkBudget() const
+{
+    return mMeasuredUplink ? std::min(mMeasuredUplink, mMaxNetworkBandwidth) : mMaxNetworkBandwidth;
+}
+
+size_t StreamAdmissionScheduler::PriorityRank(uint8_t streamUsage) const
+{
+    auto it = std::find(mPriorities.begin(), mPriorities.end(), streamUsage);
+    return static_cast<size_t>(it - mPriorities.begin());
+}
+
+StreamAdmissionScheduler::AdmittedStream *StreamAdmissionScheduler::Find(StreamKind kind, uint16_t streamID)
+{
+    auto it = std::find_if(mStreams.begin(), mStreams.end(), [&](const AdmittedStream &stream) {
+        return stream.budget.kind == kind && stream.budget.streamID == streamID;
+    });
+    return it == mStreams.end() ? nullptr : &(*it);
+}
+
+const StreamBudget *StreamAdmissionScheduler::GetBudget(StreamKind kind, uint16_t streamID) const
+{
+    auto it = std::find_if(mStreams.begin(), mStreams.end(), [&](const AdmittedStream &stream) {
+        return stream.budget.kind == kind && stream.budget.streamID == streamID;
+    });
+    return it == mStreams.end() ? nullptr : &it->budget;
+}
+
+std::vector<StreamAdmissionScheduler::AdmittedStream *> StreamAdmissionScheduler::SortByPriority()
+{
+    std::vector<AdmittedStream *> byPriority;
+    for (auto &stream : mStreams) {
+        byPriority.push_back(&stream);
+    }
+    std::sort(byPriority.begin(), byPriority.end(), [this](const AdmittedStream *a, const AdmittedStream *b) {
+        size_t rankA = PriorityRank(a->request.streamUsage);
+        size_t rankB = PriorityRank(b->request.streamUsage);
+        return rankA != rankB ? rankA < rankB : a->order < b->order;
+    });
+    return byPriority;
+}
+
+bool StreamAdmissionScheduler::DistributeFrameRates()
+{
+    uint64_t minPixelRate = 0;
+    for (auto &stream : mStreams) {
+        stream.budget.frameRate = stream.request.minFrameRate;
+        minPixelRate += static_cast<uint64_t>(stream.request.pixelsPerFrame) * stream.request.minFrameRate;
+    }
+    if (minPixelRate > mMaxEncodedPixelRate) {
+        return false;
+    }
+
+    uint64_t remaining = mMaxEncodedPixelRate - minPixelRate;
+    for (AdmittedStream *stream : SortByPriority()) {
+        uint64_t extra = stream->request.maxFrameRate - stream->request.minFrameRate;
+        if (stream->request.pixelsPerFrame) {
+            extra = std::min<uint64_t>(extra, remaining / stream->request.pixelsPerFrame);
+            remaining -= extra * stream->request.pixelsPerFrame;
+        }
+        stream->budget.frameRate = static_cast<uint16_t>(stream->request.minFrameRate + extra);
+    }
+    return true;
+}
+
+bool StreamAdmissionScheduler::DistributeBandwidth()
+{
+    uint64_t budget     = GetUplinkBudget();
+    uint64_t minBitRate = 0;
+    for (auto &stream : mStreams) {
+        stream.budget.bitRate = stream.request.minBitRate;
+        minBitRate += stream.request.minBitRate;
+    }
+    if (minBitRate > budget) {
+        // Already admitted streams keep their minimum, new streams are rejected by the caller
+        return false;
+    }
+
+    uint64_t remaining = budget - minBitRate;
+    for (AdmittedStream *stream : SortByPriority()) {
+        uint64_t extra = std::min<uint64_t>(remaining, stream->request.maxBitRate - stream->request.minBitRate);
+        stream->budget.bitRate += static_cast<uint32_t>(extra);
+        remaining -= extra;
+    }
+    return true;
+}
+
+std::vector<StreamBudget> StreamAdmissionScheduler::Rebalance(const std::vector<AdmittedStream> &before)
+{
+    DistributeFrameRates();
+    DistributeBandwidth();
+
+    std::vector<StreamBudget> changed;
+    for (const auto &stream : mStreams) {
+        auto it = std::find_if(before.begin(), before.end(), [&](const AdmittedStream &old) {
+            return old.budget.kind == stream.budget.kind && old.budget.streamID == stream.budget.streamID;
+        });
+        if (it != before.end() &&
+                (it->budget.bitRate != stream.budget.bitRate || it->budget.frameRate != stream.budget.frameRate)) {
+            changed.push_back(stream.budget);
+        }
+    }
+    return changed;
+}
+
+StreamAdmissionResult StreamAdmissionScheduler::Admit(const StreamAdmissionRequest &request)
+{
+    StreamAdmissionResult result = { AdmissionDecision::kRejected, { request.kind, request.streamID, 0, 0 }, {} };
+
+    // A reused stream is already accounted for
+    if (AdmittedStream *stream = Find(request.kind, request.streamID)) {
+        result.decision = AdmissionDecision::kAdmitted;
+        result.budget   = stream->budget;
+        return result;
+    }
+
+    uint8_t usedEncoders = 0;
+    for (const auto &stream : mStreams) {
+        if (stream.request.encoderRequired) {
+            usedEncoders++;
+        }
+    }
+    if (request.encoderRequired && usedEncoders >= mMaxEncoders) {
+        return result;
+    }
+
+    StreamAdmissionRequest admitted    = request;
+    admitted.minFrameRate              = std::min(request.minFrameRate, request.maxFrameRate);
+    admitted.minBitRate                = std::min(request.minBitRate, request.maxBitRate);
+    std::vector<AdmittedStream> before = mStreams;
+    mStreams.push_back({ admitted, { request.kind, request.streamID, 0, 0 }, mNextOrder++ });
+    if (!DistributeFrameRates() || !DistributeBandwidth()) {
+        mStreams = before;
+        DistributeFrameRates();
+        DistributeBandwidth();
+        return result;
+    }
+
+    result.budget         = mStreams.back().budget;
+    result.decision       = (result.budget.frameRate < request.maxFrameRate || result.budget.bitRate < request.maxBitRate)
+                            ? AdmissionDecision::kDowngraded
+                            : AdmissionDecision::kAdmitted;
+    result.changedBudgets = Rebalance(before);
+    return result;
+}
+
+std::vector<StreamBudget> StreamAdmissionScheduler::Release(StreamKind kind, uint16_t streamID)
+{
+    std::vector<AdmittedStream> before = mStreams;
+    mStreams.erase(std::remove_if(mStreams.begin(), mStreams.end(),
+                                  [&](const AdmittedStream &stream) {
+                                      return stream.budget.kind == kind && stream.budget.streamID == streamID;
+                                  }),
+                   mStreams.end());
+    if (mStreams.size() == before.size()) {
+        return {};
+    }
+    return Rebalance(before);
+}
@@ -0,0 +1,136 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Camera {
+
+enum class StreamKind : uint8_t {
+    kVideo,
+    kAudio,
+    kSnapshot,
+};
+
+/**
+ * A stream allocation request as seen by the admission scheduler. Stream usages are the underlying values of
+ * StreamUsageEnum so that the scheduler does not depend on the cluster objects.
+ */
+struct StreamAdmissionRequest {
+    StreamKind kind;
+    uint16_t streamID;
+    uint8_t streamUsage;
+    bool encoderRequired;
+    uint16_t minFrameRate;
+    uint16_t maxFrameRate;
+    uint32_t pixelsPerFrame; // 0 for the streams which are not pixel encoded
+    uint32_t minBitRate;     // Lowest bit rate the stream accepts, equal to maxBitRate if it cannot be downgraded
+    uint32_t maxBitRate;
+};
+
+enum class AdmissionDecision : uint8_t {
+    kAdmitted,   // Admitted with the requested frame rate and bit rate
+    kDowngraded, // Admitted with a lower frame rate or bit rate
+    kRejected,
+};
+
+struct StreamBudget {
+    StreamKind kind;
+    uint16_t streamID;
+    uint16_t frameRate;
+    uint32_t bitRate;
+};
+
+struct StreamAdmissionResult {
+    AdmissionDecision decision;
+    StreamBudget budget;
+    // Budgets of the already admitted streams which changed to make room for the new stream
+    std::vector<StreamBudget> changedBudgets;
+};
+
+/**
+ * Admission of the camera streams against the encoder count, the encoded pixel rate and the uplink bandwidth.
+ *
+ * The encoded pixel rate and the bandwidth are shared by stream usage priority: every admitted stream gets its minimum
+ * frame rate and bit rate, and what is left goes to the streams in StreamUsagePriorities order up to their maximum, so
+ * the lower priority streams are the ones downgraded. They get their frame rate and bit rate back once the higher
+ * priority streams are released. A stream whose minimum bit rate, frame rate or encoder does not fit is rejected. The
+ * uplink budget is the configured maximum network bandwidth, lowered to the measured uplink throughput once one is
+ * reported.
+ */
+class StreamAdmissionScheduler {
+public:
+    void Init(uint8_t maxEncoders, uint32_t maxEncodedPixelRate, uint32_t maxNetworkBandwidthbps);
+
+    bool IsInitialized() const { return mInitialized; }
+
+    /**
+     * Set the stream usage priorities, highest priority first. The usages which are not in the list come last.
+     * @return the budgets which changed.
+     */
+    std::vector<StreamBudget> SetStreamUsagePriorities(const std::vector<uint8_t> &priorities);
+
+    /**
+     * Report a measured uplink throughput, 0 to go back to the configured maximum network bandwidth.
+     * @return the budgets which changed.
+     */
+    std::vector<StreamBudget> UpdateMeasuredUplink(uint32_t bps);
+
+    uint32_t GetUplinkBudget() const;
+
+    StreamAdmissionResult Admit(const StreamAdmissionRequest &request);
+
+    /**
+     * Release an admitted stream, the freed pixel rate and bandwidth go back to the downgraded streams.
+     * @return the budgets which changed.
+     */
+    std::vector<StreamBudget> Release(StreamKind kind, uint16_t streamID);
+
+    /** @return the budget of an admitted stream, nullptr if it is not admitted */
+    const StreamBudget *GetBudget(StreamKind kind, uint16_t streamID) const;
+
+private:
+    struct AdmittedStream {
+        StreamAdmissionRequest request;
+        StreamBudget budget;
+        uint32_t order; // Admission order, breaks the ties between streams of the same priority
+    };
+
+    size_t PriorityRank(uint8_t streamUsage) const;
+    AdmittedStream *Find(StreamKind kind, uint16_t streamID);
+    std::vector<AdmittedStream *> SortByPriority();
+    // Share the encoded pixel rate, false if the minimum frame rates do not fit
+    bool DistributeFrameRates();
+    // Share the uplink budget, false if the minimum bit rates do not fit
+    bool DistributeBandwidth();
+    std::vector<StreamBudget> Rebalance(const std::vector<AdmittedStream> &before);
+
+    bool mInitialized             = false;
+    uint8_t mMaxEncoders          = 0;
+    uint32_t mMaxEncodedPixelRate = 0;
+    uint32_t mMaxNetworkBandwidth = 0;
+    uint32_t mMeasuredUplink      = 0;
+    uint32_t mNextOrder           = 0;
+    std::vector<uint8_t> mPriorities;
+    std::vector<AdmittedStream> mStreams;
+};
+
+} // namespace Camera
@@ -0,0 +1,107 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <unordered_map>
+
+namespace Camera {
+
+/**
+ * The WebRTC sessions of the provider, indexed by session ID and by peer, with their admission against a session cap
+ * and a heap budget.
+ *
+ * A session is looked up by ID in constant time. The peer index keeps the latest session of each peer, it is only
+ * dropped with the session it points to. The transport and the peer ID types are template parameters so that the
+ * table does not depend on the Matter SDK.
+ */
+template <typename Transport, typename PeerId>
+class WebRTCSessionTable {
+public:
+    using SessionMap = std::unordered_map<uint16_t, std::unique_ptr<Transport>>;
+
+    void Init(uint16_t maxSessions, size_t heapBudget)
+    {
+        mMaxSessions = maxSessions;
+        mHeapBudget  = heapBudget;
+        mSessions.reserve(maxSessions);
+    }
+
+    // Whether a new session fits in the session cap and leaves at least the heap budget of the free heap
+    bool CanAdmit(size_t freeHeap) const { return mSessions.size() < mMaxSessions && freeHeap >= mHeapBudget; }
+
+    Transport * Get(uint16_t sessionId) const
+    {
+        auto it = mSessions.find(sessionId);
+        return it == mSessions.end() ? nullptr : it->second.get();
+    }
+
+    // Latest session of the peer, false if the peer has none
+    bool GetPeerSession(const PeerId  &peer, uint16_t  &sessionId) const
+    {
+        auto it = mPeerSessions.find(peer);
+        if (it == mPeerSessions.end()) {
+            return false;
+        }
+        sessionId = it->second;
+        return true;
+    }
+
+    Transport * Insert(uint16_t sessionId, const PeerId  &peer, std::unique_ptr<Transport> transport)
+    {
+        Transport * result   = transport.get();
+        mSessions[sessionId] = std::move(transport);
+        mPeerSessions[peer]  = sessionId;
+        return result;
+    }
+
+    // The peer entry is only dropped while it still points to this session, the peer may have started a newer one
+    void Erase(uint16_t sessionId, const PeerId  &peer)
+    {
+        auto peerIt = mPeerSessions.find(peer);
+        if (peerIt != mPeerSessions.end() && peerIt->second == sessionId) {
+            mPeerSessions.erase(peerIt);
+        }
+        mSessions.erase(sessionId);
+    }
+
+    void Clear()
+    {
+        mSessions.clear();
+        mPeerSessions.clear();
+    }
+
+    size_t Size() const { return mSessions.size(); }
+    uint16_t GetMaxSessions() const { return mMaxSessions; }
+    size_t GetHeapBudget() const { return mHeapBudget; }
+
+    typename SessionMap::const_iterator begin() const { return mSessions.begin(); }
+    typename SessionMap::const_iterator end() const { return mSessions.end(); }
+
+private:
+    uint16_t mMaxSessions = 0;
+    size_t mHeapBudget    = 0;
+    SessionMap mSessions;
+    std::map<PeerId, uint16_t> mPeerSessions;
+};
+
+} // namespace Camera
@@ -29,8 +29,6 @@ using namespace chip::app::Clusters::WebRTCTransportProvider;
 
 using namespace Camera;
 
-static size_t gSDPLength       = CONFIG_MAX_LARGE_BUFFER_SIZE_BYTES;
-static size_t gCandidateLength = 1024;
 static char peerClientId[SS_MAX_SIGNALING_CLIENT_ID_LEN + 1];
 
 extern CameraDevice gCameraDevice;
@@ -87,76 +85,64 @@ void KVSWebRTCPeerConnection::SetRemoteDescription(const std::string  &sdp, SDPT
 {
     // handles SDP Offer received from webrtc requestor.
     // Send SDP to KVSWebRTCManager.
-    char * sdp_json = (char *) malloc(gSDPLength);
     std::unique_ptr<signaling_msg_t> message(new (std::nothrow) signaling_msg_t());
     if (message == nullptr) {
         ChipLogError(Camera, "SetRemoteDescription: failed to allocate signaling_msg_t");
         return;
     }
 
-    std::string escaped_sdp = json_escape(sdp);
-    size_t json_len         = 0;
+    // The JSON is escaped straight into a payload sized from the SDP, no fixed size buffer to overflow
+    const char * prefix = nullptr;
     if (type == SDPType::Offer) {
-        json_len = sprintf(sdp_json, "{\"type\": \"offer\", \"sdp\": \"%s\"}", escaped_sdp.c_str());
-        ChipLogProgress(Camera, "OFFER: \n%s\n", sdp_json);
+        prefix               = "{\"type\": \"offer\", \"sdp\": \"";
         message->messageType = SIGNALING_MSG_TYPE_OFFER;
     } else if (type == SDPType::Answer) {
-        json_len = sprintf(sdp_json, "{\"type\": \"answer\", \"sdp\": \"%s\"}", escaped_sdp.c_str());
-        ChipLogProgress(Camera, "ANSWER: \n%s\n", sdp_json);
+        prefix               = "{\"type\": \"answer\", \"sdp\": \"";
         message->messageType = SIGNALING_MSG_TYPE_ANSWER;
+    } else {
+        ChipLogError(Camera, "SetRemoteDescription: unsupported SDP type");
+        return;
     }
+    std::string sdp_json = make_signaling_json(prefix, sdp);
+    ChipLogProgress(Camera, "%s: \n%s\n", type == SDPType::Offer ? "OFFER" : "ANSWER", sdp_json.c_str());
 
-    message->version             = 0;
-    std::string peerConnectionId = this->GetPeerConnectionId();
-    snprintf(peerClientId, sizeof(peerClientId), "%s", peerConnectionId.c_str());
-    memcpy(message->peerClientId, peerClientId, sizeof(peerClientId));
-    message->payloadLen = json_len;
-    message->payload    = sdp_json;
-
-    size_t serialized_len = 0;
-    char * serialized_msg = serialize_signaling_message(message.get(), &serialized_len);
-    if (serialized_msg) {
-        webrtc_bridge_send_message(serialized_msg, serialized_len);
-    }
-
+    size_t serialized_len = SendSignalingMessage(message.get(), sdp_json);
     ChipLogProgress(Camera, "SDP LENGTH: %d", serialized_len);
-
-    free(sdp_json);
 }
 
 void KVSWebRTCPeerConnection::AddRemoteCandidate(const std::string  &candidate, const std::string  &mid)
 {
-
     // Send webrtc requestor's candidates to KVSWebRTCManager.
-    char * candidate_json = (char *) malloc(gCandidateLength);
-
-    std::string escaped_sdp = json_escape(std::string(candidate.begin(), candidate.end()));
-    size_t json_len         = sprintf(candidate_json, "{\"candidate\": \"%s\"}", escaped_sdp.c_str());
-
-    ChipLogProgress(Camera, "CANDIDATE: \n%s\n", candidate_json);
-
     std::unique_ptr<signaling_msg_t> message(new (std::nothrow) signaling_msg_t());
     if (message == nullptr) {
         ChipLogError(Camera, "AddRemoteCandidate: failed to allocate signaling_msg_t");
         return;
     }
+
+    std::string candidate_json = make_signaling_json("{\"candidate\": \"", candidate);
+    ChipLogProgress(Camera, "CANDIDATE: \n%s\n", candidate_json.c_str());
+
+    message->messageType  = SIGNALING_MSG_TYPE_ICE_CANDIDATE;
+    size_t serialized_len = SendSignalingMessage(message.get(), candidate_json);
+    ChipLogProgress(Camera, "Candidate length: %d", serialized_len);
+}
+
+size_t KVSWebRTCPeerConnection::SendSignalingMessage(signaling_msg_t * message, std::string  &payload)
+{
     message->version             = 0;
-    message->messageType         = SIGNALING_MSG_TYPE_ICE_CANDIDATE;
     std::string peerConnectionId = this->GetPeerConnectionId();
     snprintf(peerClientId, sizeof(peerClientId), "%s", peerConnectionId.c_str());
     memcpy(message->peerClientId, peerClientId, sizeof(peerClientId));
-    message->payloadLen = json_len;
-    message->payload    = candidate_json;
+    // The payload is only read while serializing, it stays owned by the caller
+    message->payloadLen = payload.size();
+    message->payload    = &payload[0];
 
     size_t serialized_len = 0;
-    char * serialized_msg = serialize_signaling_message(message.get(), &serialized_len);
+    char * serialized_msg = serialize_signaling_message(message, &serialized_len);
     if (serialized_msg) {
         webrtc_bridge_send_message(serialized_msg, serialized_len);
     }
-
-    ChipLogProgress(Camera, "Candidate length: %d", serialized_len);
-
-    free(candidate_json);
+    return serialized_len;
 }
 
 std::shared_ptr<WebRTCTrack> KVSWebRTCPeerConnection::AddTrack(MediaType mediaType)
@@ -19,6 +19,7 @@
 #include "webrtc-abstract.h"
 #include "webrtc-provider-manager.h"
 #include <lib/support/logging/CHIPLogging.h>
+#include <signaling_serializer.h>
 
 void webrtc_bridge_message_received_cb(void * data, int len);
 
@@ -52,5 +53,8 @@ public:
     std::string GetPeerConnectionId();
 
 private:
+    // Fill the common fields, serialize and send the message to the media adapter, returns the serialized length
+    size_t SendSignalingMessage(signaling_msg_t * message, std::string  &payload);
+
     std::shared_ptr<EspWebRTCPeerConnection> mPeerConnection;
 };
@@ -33,7 +33,6 @@ using namespace Camera;
 
 static const char * TAG = "webrtc-kvs_esp_port_utils";
 
-static size_t gSDPLength = CONFIG_MAX_LARGE_BUFFER_SIZE_BYTES;
 static char peerClientId[SS_MAX_SIGNALING_CLIENT_ID_LEN + 1];
 
 extern CameraDevice gCameraDevice;
@@ -101,45 +100,6 @@ static std::string json_unescape(const std::string  &input)
     return output;
 }
 
-std::string json_escape(const std::string  &input)
-{
-    std::string output;
-    for (char c : input) {
-        switch (c) {
-        case '\"':
-            output += "\\\"";
-            break;
-        case '\\':
-            output += "\\\\";
-            break;
-        case '\b':
-            output += "\\b";
-            break;
-        case '\f':
-            output += "\\f";
-            break;
-        case '\n':
-            output += "\\n";
-            break;
-        case '\r':
-            output += "\\r";
-            break;
-        case '\t':
-            output += "\\t";
-            break;
-        default:
-            if (static_cast<unsigned char>(c) < 0x20) {
-                char buf[7];
-                snprintf(buf, sizeof(buf), "\\u%04x", c);
-                output += buf;
-            } else {
-                output += c;
-            }
-        }
-    }
-    return output;
-}
-
 static int extract_sdp(const char * json, char * sdp_buf, size_t sdp_buf_len)
 {
     if (json == nullptr || sdp_buf == nullptr || sdp_buf_len == 0) {
@@ -221,21 +181,30 @@ void webrtc_bridge_message_received_cb(void * data, int len)
 
     deserialize_signaling_message((const char *) data, len, msg.get());
 
-    char sdp_buf[gSDPLength];
+    // The extracted value is never longer than the payload, size the buffer from it instead of the largest SDP
+    size_t sdp_buf_len = msg->payload ? strlen(msg->payload) + 1 : 0;
+    std::unique_ptr<char[]> sdp_buf(sdp_buf_len ? new (std::nothrow) char[sdp_buf_len] : nullptr);
+    if (sdp_buf == nullptr) {
+        ChipLogError(Camera, "webrtc_bridge_message_received_cb: no payload or failed to allocate %u bytes",
+                     static_cast<unsigned>(sdp_buf_len));
+        goto cleanup;
+    }
+    sdp_buf[0] = '\0';
+
     switch (msg->messageType) {
     case SIGNALING_MSG_TYPE_OFFER:
-        if (extract_sdp(msg->payload, sdp_buf, sizeof(sdp_buf)) == 0) {
-            ESP_LOGD(TAG, "Extracted SDP:\n%s\n", sdp_buf);
+        if (extract_sdp(msg->payload, sdp_buf.get(), sdp_buf_len) == 0) {
+            ESP_LOGD(TAG, "Extracted SDP:\n%s\n", sdp_buf.get());
         }
         break;
     case SIGNALING_MSG_TYPE_ANSWER:
-        if (extract_sdp(msg->payload, sdp_buf, sizeof(sdp_buf)) == 0) {
-            ESP_LOGD(TAG, "Extracted SDP:\n%s\n", sdp_buf);
+        if (extract_sdp(msg->payload, sdp_buf.get(), sdp_buf_len) == 0) {
+            ESP_LOGD(TAG, "Extracted SDP:\n%s\n", sdp_buf.get());
         }
         break;
     case SIGNALING_MSG_TYPE_ICE_CANDIDATE:
-        if (extract_candidate(msg->payload, sdp_buf, sizeof(sdp_buf)) == 0) {
-            ESP_LOGD(TAG, "Extracted Candidate:\n%s\n", sdp_buf);
+        if (extract_candidate(msg->payload, sdp_buf.get(), sdp_buf_len) == 0) {
+            ESP_LOGD(TAG, "Extracted Candidate:\n%s\n", sdp_buf.get());
         }
         break;
     default:
@@ -253,7 +222,7 @@ void webrtc_bridge_message_received_cb(void * data, int len)
 
         printf("Session ID: %u\n", sessionId);
 
-        std::string unescaped_msg = json_unescape(std::string(sdp_buf));
+        std::string unescaped_msg = json_unescape(std::string(sdp_buf.get()));
 
         ESP_LOGD(TAG, "unescaped msg: \n%s\n", unescaped_msg.c_str());
 
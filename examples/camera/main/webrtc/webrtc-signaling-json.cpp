@@ -0,0 +1,127 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <webrtc-signaling-json.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+static constexpr char kSignalingJsonSuffix[] = "\"}";
+
+// Width of each character once escaped: 2 for the short escapes, 6 for the other control characters as \u00XX
+struct JsonEscapeWidths {
+    uint8_t width[256];
+
+    constexpr JsonEscapeWidths() : width{}
+    {
+        for (int c = 0; c < 256; c++) {
+            width[c] = c < 0x20 ? 6 : 1;
+        }
+        for (char c : { '\"', '\\', '\b', '\f', '\n', '\r', '\t' }) {
+            width[static_cast<unsigned char>(c)] = 2;
+        }
+    }
+};
+
+static constexpr JsonEscapeWidths kJsonEscapeWidths;
+
+static uint8_t json_escape_width(char c)
+{
+    return kJsonEscapeWidths.width[static_cast<unsigned char>(c)];
+}
+
+size_t json_escaped_length(const std::string  &input)
+{
+    size_t len = 0;
+    for (char c : input) {
+        len += json_escape_width(c);
+    }
+    return len;
+}
+
+// Write the escaped input to out, which has room for its escaped length, and return the end of the output. An SDP
+// has two escaped characters per line, the characters in between are copied as one run.
+static char * json_escape_to(char * out, const std::string  &input)
+{
+    const char * run = input.data();
+    const char * end = run + input.size();
+    for (const char * p = run; p < end; p++) {
+        char c = *p;
+        if (json_escape_width(c) == 1) {
+            continue;
+        }
+        memcpy(out, run, p - run);
+        out += p - run;
+        run = p + 1;
+        *out++ = '\\';
+        switch (c) {
+        case '\"':
+        case '\\':
+            *out++ = c;
+            break;
+        case '\b':
+            *out++ = 'b';
+            break;
+        case '\f':
+            *out++ = 'f';
+            break;
+        case '\n':
+            *out++ = 'n';
+            break;
+        case '\r':
+            *out++ = 'r';
+            break;
+        case '\t':
+            *out++ = 't';
+            break;
+        default: {
+            char buf[6];
+            snprintf(buf, sizeof(buf), "u%04x", c);
+            memcpy(out, buf, 5);
+            out += 5;
+        }
+        }
+    }
+    memcpy(out, run, end - run);
+    return out + (end - run);
+}
+
+void json_escape_append(std::string  &output, const std::string  &input)
+{
+    size_t offset = output.size();
+    output.resize(offset + json_escaped_length(input));
+    json_escape_to(&output[offset], input);
+}
+
+std::string json_escape(const std::string  &input)
+{
+    std::string output;
+    json_escape_append(output, input);
+    return output;
+}
+
+std::string make_signaling_json(const char * prefix, const std::string  &value)
+{
+    size_t prefix_len = strlen(prefix);
+    std::string json(prefix_len + json_escaped_length(value) + sizeof(kSignalingJsonSuffix) - 1, '\0');
+    memcpy(&json[0], prefix, prefix_len);
+    char * out = json_escape_to(&json[prefix_len], value);
+    memcpy(out, kSignalingJsonSuffix, sizeof(kSignalingJsonSuffix) - 1);
+    return json;
+}
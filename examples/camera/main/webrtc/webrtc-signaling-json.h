@@ -0,0 +1,37 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+// Length of the input once escaped as a JSON string
+size_t json_escaped_length(const std::string  &input);
+
+std::string json_escape(const std::string  &input);
+
+// Append the escaped input to output, avoids the intermediate copy of json_escape()
+void json_escape_append(std::string  &output, const std::string  &input);
+
+/**
+ * Build the JSON payload of a signaling message, the prefix followed by the escaped value and the closing "}, for
+ * example the prefix {"candidate": " for an ICE candidate. The payload is allocated once with its final size, so
+ * the SDP or the candidate is written to it exactly once.
+ */
+std::string make_signaling_json(const char * prefix, const std::string  &value);
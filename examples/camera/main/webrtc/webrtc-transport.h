@@ -86,24 +86,25 @@ public:
         return mPeerConnection;
     }
 
-    std::string GetLocalDescription()
+    // The SDP and the candidates are returned by reference, they are only read while encoding the commands
+    const std::string  &GetLocalDescription() const
     {
         return mLocalSdp;
     }
 
     void SetSdpAnswer(std::string localSdp)
     {
-        mLocalSdp = localSdp;
+        mLocalSdp = std::move(localSdp);
     }
 
-    std::vector<std::string> GetCandidates()
+    const std::vector<std::string>  &GetCandidates() const
     {
         return mLocalCandidates;
     }
 
     void SetCandidates(std::vector<std::string> candidates)
     {
-        mLocalCandidates = candidates;
+        mLocalCandidates = std::move(candidates);
     }
 
     void AddRemoteCandidate(const std::string  &candidate, const std::string  &mid);
@@ -126,6 +127,17 @@ public:
     void SetRequestArgs(const RequestArgs  &args);
     RequestArgs  &GetRequestArgs();
 
+    // Bandwidth in bps the peer accepts for the session, from its SDP, 0 if it is not limited
+    void SetPeerBandwidthLimit(uint32_t bps)
+    {
+        mPeerBandwidthLimit = bps;
+    }
+
+    uint32_t GetPeerBandwidthLimit() const
+    {
+        return mPeerBandwidthLimit;
+    }
+
 private:
     CommandType mCommandType = CommandType::kUndefined;
     State mState             = State::Idle;
@@ -136,6 +148,7 @@ private:
     std::string mLocalSdp;
     SDPType mLocalSdpType;
     std::vector<std::string> mLocalCandidates;
+    uint32_t mPeerBandwidthLimit = 0;
 
     RequestArgs mRequestArgs;
     OnTransportLocalDescriptionCallback mOnLocalDescription = nullptr;
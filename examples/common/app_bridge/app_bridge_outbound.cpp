@@ -0,0 +1,201 @@
+// Copyright 2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <esp_check.h>
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <inttypes.h>
+#include <stdlib.h>
+
+#include <app_bridge_outbound.h>
+
+static const char *TAG = "app_bridge_outbound";
+
+typedef struct {
+    bool pending;
+    uint16_t endpoint_id;
+    uint32_t cluster_id;
+    uint32_t attribute_id;
+    esp_matter_attr_val_t val;
+    /* Order of the first post, the changes are sent oldest first */
+    uint32_t sequence;
+    /* Time of the last post, for the latency of the final value */
+    int64_t post_time;
+} outbound_entry_t;
+
+struct app_bridge_outbound {
+    app_bridge_outbound_config_t config;
+    outbound_entry_t *entries;
+    uint32_t next_sequence;
+    app_bridge_outbound_stats_t stats;
+    portMUX_TYPE lock;
+    TaskHandle_t task;
+};
+
+static bool is_scalar_type(esp_matter_val_type_t type)
+{
+    switch (type & ~ESP_MATTER_VAL_NULLABLE_BASE) {
+    case ESP_MATTER_VAL_TYPE_ARRAY:
+    case ESP_MATTER_VAL_TYPE_CHAR_STRING:
+    case ESP_MATTER_VAL_TYPE_OCTET_STRING:
+    case ESP_MATTER_VAL_TYPE_LONG_CHAR_STRING:
+    case ESP_MATTER_VAL_TYPE_LONG_OCTET_STRING:
+        return false;
+    default:
+        return true;
+    }
+}
+
+/* Take the oldest pending change, false if none is pending */
+static bool take_oldest(app_bridge_outbound *outbound, outbound_entry_t *entry)
+{
+    outbound_entry_t *oldest = NULL;
+    taskENTER_CRITICAL(&outbound->lock);
+    for (uint16_t i = 0; i < outbound->config.max_pending; i++) {
+        outbound_entry_t *current = &outbound->entries[i];
+        if (current->pending && (!oldest || (int32_t)(current->sequence - oldest->sequence) < 0)) {
+            oldest = current;
+        }
+    }
+    if (oldest) {
+        *entry = *oldest;
+        oldest->pending = false;
+    }
+    taskEXIT_CRITICAL(&outbound->lock);
+    return oldest != NULL;
+}
+
+static void outbound_task(void *pvParameters)
+{
+    app_bridge_outbound *outbound = (app_bridge_outbound *)pvParameters;
+    outbound_entry_t entry;
+
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        /* Collect the rest of a transition or of a group command fan-out */
+        if (outbound->config.coalesce_ms) {
+            vTaskDelay(pdMS_TO_TICKS(outbound->config.coalesce_ms));
+        }
+        /* The changes posted while sending replace the pending ones and are sent in the same round */
+        while (take_oldest(outbound, &entry)) {
+            esp_err_t err = outbound->config.send_cb(entry.endpoint_id, entry.cluster_id, entry.attribute_id,
+                                                     &entry.val, outbound->config.ctx);
+            if (err != ESP_OK) {
+                ESP_LOGW(TAG, "%s: Failed to send the change of ep: 0x%x, cluster: 0x%" PRIx32 ", att: 0x%" PRIx32,
+                         outbound->config.name, entry.endpoint_id, entry.cluster_id, entry.attribute_id);
+            }
+            taskENTER_CRITICAL(&outbound->lock);
+            if (err == ESP_OK) {
+                outbound->stats.sent_count++;
+                outbound->stats.last_latency_ms = (uint32_t)((esp_timer_get_time() - entry.post_time) / 1000);
+            } else {
+                outbound->stats.failed_count++;
+            }
+            taskEXIT_CRITICAL(&outbound->lock);
+            if (outbound->config.min_interval_ms) {
+                vTaskDelay(pdMS_TO_TICKS(outbound->config.min_interval_ms));
+            }
+        }
+        ulTaskNotifyTake(pdTRUE, 0);
+        ESP_LOGD(TAG, "%s: posted: %" PRIu32 ", coalesced: %" PRIu32 ", sent: %" PRIu32 ", failed: %" PRIu32
+                 ", latency: %" PRIu32 " ms", outbound->config.name, outbound->stats.posted_count,
+                 outbound->stats.coalesced_count, outbound->stats.sent_count, outbound->stats.failed_count,
+                 outbound->stats.last_latency_ms);
+    }
+}
+
+esp_err_t app_bridge_outbound_create(const app_bridge_outbound_config_t *config, app_bridge_outbound_handle_t *handle)
+{
+    ESP_RETURN_ON_FALSE(config && handle && config->send_cb && config->max_pending > 0, ESP_ERR_INVALID_ARG, TAG,
+                        "Invalid arguments");
+    app_bridge_outbound *outbound = (app_bridge_outbound *)calloc(1, sizeof(app_bridge_outbound));
+    ESP_RETURN_ON_FALSE(outbound, ESP_ERR_NO_MEM, TAG, "Failed to allocate the outbound scheduler");
+    outbound->entries = (outbound_entry_t *)calloc(config->max_pending, sizeof(outbound_entry_t));
+    if (!outbound->entries) {
+        free(outbound);
+        ESP_LOGE(TAG, "Failed to allocate the pending changes");
+        return ESP_ERR_NO_MEM;
+    }
+    outbound->config = *config;
+    outbound->lock = portMUX_INITIALIZER_UNLOCKED;
+    if (xTaskCreate(outbound_task, config->name, config->task_stack_size, outbound, config->task_priority,
+                    &outbound->task) != pdPASS) {
+        free(outbound->entries);
+        free(outbound);
+        ESP_LOGE(TAG, "Failed to create the outbound task");
+        return ESP_ERR_NO_MEM;
+    }
+    *handle = outbound;
+    return ESP_OK;
+}
+
+esp_err_t app_bridge_outbound_post(app_bridge_outbound_handle_t handle, uint16_t endpoint_id, uint32_t cluster_id,
+                                   uint32_t attribute_id, const esp_matter_attr_val_t *val)
+{
+    ESP_RETURN_ON_FALSE(handle && val, ESP_ERR_INVALID_ARG, TAG, "Invalid arguments");
+    ESP_RETURN_ON_FALSE(is_scalar_type(val->type), ESP_ERR_NOT_SUPPORTED, TAG, "Only scalar values can be posted");
+
+    esp_err_t err = ESP_OK;
+    outbound_entry_t *entry = NULL;
+    taskENTER_CRITICAL(&handle->lock);
+    handle->stats.posted_count++;
+    for (uint16_t i = 0; i < handle->config.max_pending; i++) {
+        outbound_entry_t *current = &handle->entries[i];
+        if (current->pending && current->endpoint_id == endpoint_id && current->cluster_id == cluster_id &&
+                current->attribute_id == attribute_id) {
+            entry = current;
+            break;
+        }
+        if (!entry && !current->pending) {
+            entry = current;
+        }
+    }
+    if (!entry) {
+        handle->stats.dropped_count++;
+        err = ESP_ERR_NO_MEM;
+    } else if (entry->pending) {
+        /* Last value wins, the change keeps its place in the send order */
+        entry->val = *val;
+        entry->post_time = esp_timer_get_time();
+        handle->stats.coalesced_count++;
+    } else {
+        entry->pending = true;
+        entry->endpoint_id = endpoint_id;
+        entry->cluster_id = cluster_id;
+        entry->attribute_id = attribute_id;
+        entry->val = *val;
+        entry->sequence = handle->next_sequence++;
+        entry->post_time = esp_timer_get_time();
+    }
+    taskEXIT_CRITICAL(&handle->lock);
+
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "%s: Too many pending changes, dropping the change of ep: 0x%x", handle->config.name,
+                 endpoint_id);
+        return err;
+    }
+    xTaskNotifyGive(handle->task);
+    return ESP_OK;
+}
+
+esp_err_t app_bridge_outbound_get_stats(app_bridge_outbound_handle_t handle, app_bridge_outbound_stats_t *stats)
+{
+    ESP_RETURN_ON_FALSE(handle && stats, ESP_ERR_INVALID_ARG, TAG, "Invalid arguments");
+    taskENTER_CRITICAL(&handle->lock);
+    *stats = handle->stats;
+    taskEXIT_CRITICAL(&handle->lock);
+    return ESP_OK;
+}
@@ -0,0 +1,83 @@
+// Copyright 2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <esp_err.h>
+#include <esp_matter_attribute_utils.h>
+#include <stdint.h>
+
+/** Outbound scheduler of the attribute changes forwarded to the bridged devices of one radio
+ *
+ * The Matter attribute callbacks post the changes, the scheduler task sends them to the radio:
+ * - A change of the same attribute of the same endpoint which is still pending replaces the pending one, so a
+ *   transition only sends its last value.
+ * - The changes posted within `coalesce_ms` of the first one are sent together. A group command reaching many
+ *   bridged endpoints is collected as a whole and its frames are spread at `min_interval_ms` instead of being sent
+ *   as a burst.
+ */
+typedef struct app_bridge_outbound *app_bridge_outbound_handle_t;
+
+/** Send one attribute change to the bridged device of `endpoint_id`, called from the scheduler task */
+typedef esp_err_t (*app_bridge_outbound_send_cb_t)(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id,
+                                                   const esp_matter_attr_val_t *val, void *ctx);
+
+typedef struct {
+    /** Name of the scheduler task */
+    const char *name;
+    /** Window in which the changes are collected before sending */
+    uint32_t coalesce_ms;
+    /** Minimum gap between two frames on the radio */
+    uint32_t min_interval_ms;
+    /** Maximum number of pending attribute changes */
+    uint16_t max_pending;
+    /** Stack size of the scheduler task */
+    uint32_t task_stack_size;
+    /** Priority of the scheduler task */
+    uint8_t task_priority;
+    /** Callback sending a change to the radio */
+    app_bridge_outbound_send_cb_t send_cb;
+    /** Context passed to send_cb */
+    void *ctx;
+} app_bridge_outbound_config_t;
+
+typedef struct {
+    /** Attribute changes posted */
+    uint32_t posted_count;
+    /** Attribute changes which replaced a pending change */
+    uint32_t coalesced_count;
+    /** Attribute changes sent to the radio */
+    uint32_t sent_count;
+    /** Attribute changes which send_cb failed to send, e.g. because the device was removed */
+    uint32_t failed_count;
+    /** Attribute changes dropped because max_pending changes were already pending */
+    uint32_t dropped_count;
+    /** Latency from the post to the send of the last change sent, in milliseconds */
+    uint32_t last_latency_ms;
+} app_bridge_outbound_stats_t;
+
+/** Create an outbound scheduler and its task */
+esp_err_t app_bridge_outbound_create(const app_bridge_outbound_config_t *config, app_bridge_outbound_handle_t *handle);
+
+/** Post an attribute change, the value is copied. Only the scalar value types are supported.
+ *
+ * @return ESP_OK on success.
+ * @return ESP_ERR_NOT_SUPPORTED if the value is a string or an array.
+ * @return ESP_ERR_NO_MEM if max_pending changes are already pending.
+ */
+esp_err_t app_bridge_outbound_post(app_bridge_outbound_handle_t handle, uint16_t endpoint_id, uint32_t cluster_id,
+                                   uint32_t attribute_id, const esp_matter_attr_val_t *val);
+
+/** Get the counters of the scheduler */
+esp_err_t app_bridge_outbound_get_stats(app_bridge_outbound_handle_t handle, app_bridge_outbound_stats_t *stats);
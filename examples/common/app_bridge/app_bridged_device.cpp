@@ -14,12 +14,19 @@
 
 #include <esp_log.h>
 #include <esp_matter.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <inttypes.h>
 #include <nvs.h>
 #include <string.h>
 
 #include <app_bridged_device.h>
+#include <app_bridged_device_index.h>
 #include <esp_matter_mem.h>
+#include <esp_matter_startup_profiler.h>
 #include <nvs_key_allocator.h>
+#include <platform/CHIPDeviceLayer.h>
 
 // The bridge app can be used only when MAX_BRIDGED_DEVICE_COUNT > 0
 #if defined(MAX_BRIDGED_DEVICE_COUNT) && MAX_BRIDGED_DEVICE_COUNT > 0
@@ -43,7 +50,103 @@ using namespace esp_matter;
 
 static const char *TAG = "app_bridged_device";
 app_bridged_device_t *g_bridged_device_list = NULL;
-static uint8_t g_current_bridged_device_count = 0;
+static uint16_t g_current_bridged_device_count = 0;
+
+/** Bridged Device Indexes **/
+
+namespace {
+using app_bridge::hash_bytes;
+
+/* Only the part of the address which is used for the lookups of the device type is hashed and compared */
+uint32_t hash_address(app_bridged_device_type_t type, const app_bridged_device_address_t &addr)
+{
+    uint32_t hash = hash_bytes(&type, sizeof(type));
+    switch (type) {
+    case ESP_MATTER_BRIDGED_DEVICE_TYPE_ZIGBEE:
+        return hash_bytes(&addr.zigbee_shortaddr, sizeof(addr.zigbee_shortaddr), hash);
+    case ESP_MATTER_BRIDGED_DEVICE_TYPE_BLEMESH:
+        return hash_bytes(&addr.blemesh_addr, sizeof(addr.blemesh_addr), hash);
+    case ESP_MATTER_BRIDGED_DEVICE_TYPE_ESPNOW:
+        return hash_bytes(addr.espnow_macaddr, sizeof(addr.espnow_macaddr), hash);
+    case ESP_MATTER_BRIDGED_DEVICE_TYPE_RAINMAKER:
+        return hash_bytes(addr.rainmaker_node_id, strnlen(addr.rainmaker_node_id, sizeof(addr.rainmaker_node_id)),
+                          hash);
+    default:
+        return hash;
+    }
+}
+
+bool is_same_address(app_bridged_device_type_t type, const app_bridged_device_address_t &addr1,
+                     const app_bridged_device_address_t &addr2)
+{
+    switch (type) {
+    case ESP_MATTER_BRIDGED_DEVICE_TYPE_ZIGBEE:
+        return addr1.zigbee_shortaddr == addr2.zigbee_shortaddr;
+    case ESP_MATTER_BRIDGED_DEVICE_TYPE_BLEMESH:
+        return addr1.blemesh_addr == addr2.blemesh_addr;
+    case ESP_MATTER_BRIDGED_DEVICE_TYPE_ESPNOW:
+        return memcmp(addr1.espnow_macaddr, addr2.espnow_macaddr, sizeof(addr1.espnow_macaddr)) == 0;
+    case ESP_MATTER_BRIDGED_DEVICE_TYPE_RAINMAKER:
+        return strncmp(addr1.rainmaker_node_id, addr2.rainmaker_node_id, sizeof(addr1.rainmaker_node_id)) == 0;
+    default:
+        return false;
+    }
+}
+
+uint32_t hash_device_address(const app_bridged_device_t *dev)
+{
+    return hash_address(dev->dev_type, dev->dev_addr);
+}
+
+uint32_t hash_device_endpoint_id(const app_bridged_device_t *dev)
+{
+    /* Bridged endpoint IDs are mostly allocated in sequence, so the ID itself spreads well over the slots */
+    return endpoint::get_id(dev->dev->endpoint);
+}
+
+using bridged_device_index = app_bridge::device_index<app_bridged_device_t, MAX_BRIDGED_DEVICE_COUNT>;
+
+bridged_device_index s_address_index(hash_device_address);
+bridged_device_index s_endpoint_index(hash_device_endpoint_id);
+
+void add_to_registry(app_bridged_device_t *dev)
+{
+    dev->next = g_bridged_device_list;
+    g_bridged_device_list = dev;
+    g_current_bridged_device_count++;
+    s_address_index.insert(dev);
+    s_endpoint_index.insert(dev);
+}
+
+/* A lazily resumed device gets its device type on first access. The flag is only a hint to skip the stack lock,
+ * esp_matter_bridge::complete_resume() takes the lock and checks it again. */
+app_bridged_device_t *complete_resume(app_bridged_device_t *dev)
+{
+    if (dev && dev->dev->resume_pending) {
+        esp_matter_bridge::complete_resume(dev->dev);
+    }
+    return dev;
+}
+
+app_bridged_device_t *find_device_by_address(app_bridged_device_type_t type, const app_bridged_device_address_t &addr)
+{
+    return complete_resume(s_address_index.find(hash_address(type, addr), [&](const app_bridged_device_t *dev) {
+        return dev->dev_type == type && dev->dev && is_same_address(type, dev->dev_addr, addr);
+    }));
+}
+
+app_bridged_device_t *find_device_by_endpoint_id(app_bridged_device_type_t type, uint16_t endpoint_id)
+{
+    return complete_resume(s_endpoint_index.find(endpoint_id, [&](const app_bridged_device_t *dev) {
+        return dev->dev_type == type && dev->dev && endpoint::get_id(dev->dev->endpoint) == endpoint_id;
+    }));
+}
+
+uint16_t get_endpoint_id(const app_bridged_device_t *dev, uint16_t invalid_id)
+{
+    return dev ? endpoint::get_id(dev->dev->endpoint) : invalid_id;
+}
+} // namespace
 
 /** Persistent Bridged Device Info **/
 
@@ -55,11 +158,8 @@ static esp_err_t app_bridge_store_bridged_device_info(app_bridged_device_t *brid
         return ESP_ERR_INVALID_ARG;
     }
     nvs_handle_t handle;
-    err = nvs_open_from_partition(CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME, ESP_MATTER_BRIDGE_NAMESPACE, NVS_READWRITE,
-                                  &handle);
+    err = esp_matter_bridge::open_storage(&handle);
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Error opening partition %s namespace %s. Err: %d", CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME,
-                 ESP_MATTER_BRIDGE_NAMESPACE, err);
         return err;
     }
     uint16_t endpoint_id = endpoint::get_id(bridged_device->dev->endpoint);
@@ -73,8 +173,7 @@ static esp_err_t app_bridge_store_bridged_device_info(app_bridged_device_t *brid
     if (err != ESP_OK) {
         ESP_LOGE(TAG, "Error storing the device type");
     }
-    nvs_commit(handle);
-    nvs_close(handle);
+    esp_matter_bridge::close_storage(handle);
     return err;
 }
 
@@ -115,23 +214,21 @@ static esp_err_t app_bridge_erase_bridged_device_info(uint16_t endpoint_id)
 {
     esp_err_t err = ESP_OK;
     nvs_handle_t handle;
-    err = nvs_open_from_partition(CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME, ESP_MATTER_BRIDGE_NAMESPACE, NVS_READWRITE,
-                                  &handle);
+    err = esp_matter_bridge::open_storage(&handle);
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Error opening partition %s namespace %s. Err: %d", CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME,
-                 ESP_MATTER_BRIDGE_NAMESPACE, err);
         return err;
     }
-    err = nvs_erase_key(handle, esp_matter_bridge::nvs_key_allocator::endpoint_dev_addr(endpoint_id).KeyName());
+    err = esp_matter_bridge::erase_storage_key(
+        handle, esp_matter_bridge::nvs_key_allocator::endpoint_dev_addr(endpoint_id).KeyName());
     if (err != ESP_OK) {
         ESP_LOGE(TAG, "Error erasing the device address");
     }
-    err = nvs_erase_key(handle, esp_matter_bridge::nvs_key_allocator::endpoint_dev_type(endpoint_id).KeyName());
+    err = esp_matter_bridge::erase_storage_key(
+        handle, esp_matter_bridge::nvs_key_allocator::endpoint_dev_type(endpoint_id).KeyName());
     if (err != ESP_OK) {
         ESP_LOGE(TAG, "Error erasing the device type");
     }
-    nvs_commit(handle);
-    nvs_close(handle);
+    esp_matter_bridge::close_storage(handle);
     return err;
 }
 
@@ -198,9 +295,7 @@ app_bridged_device_t *app_bridge_create_bridged_device(node_t *node, uint16_t pa
 
     new_dev->dev_type = bridged_device_type;
     new_dev->dev_addr = bridged_device_address;
-    new_dev->next = g_bridged_device_list;
-    g_bridged_device_list = new_dev;
-    g_current_bridged_device_count++;
+    add_to_registry(new_dev);
 
     if (ESP_OK != app_bridge_store_bridged_device_info(new_dev)) {
         ESP_LOGW(TAG, "Failed to store the bridged device information");
@@ -222,6 +317,9 @@ esp_err_t app_bridge_initialize(node_t *node, esp_matter_bridge::bridge_device_t
 
     uint16_t matter_endpoint_id_array[MAX_BRIDGED_DEVICE_COUNT];
     esp_matter_bridge::get_bridged_endpoint_ids(matter_endpoint_id_array);
+    // Resume all the bridged endpoints with one PartsList report and one storage commit for the failed ones
+    bool storage_batch = esp_matter_bridge::begin_storage_batch() == ESP_OK;
+    endpoint::begin_batch();
     for (size_t idx = 0; idx < MAX_BRIDGED_DEVICE_COUNT; ++idx) {
         if (matter_endpoint_id_array[idx] != chip::kInvalidEndpointId) {
             app_bridged_device_type_t device_type;
@@ -247,24 +345,24 @@ esp_err_t app_bridge_initialize(node_t *node, esp_matter_bridge::bridge_device_t
             }
             new_dev->dev_type = device_type;
             new_dev->dev_addr = device_addr;
-            new_dev->next = g_bridged_device_list;
-            g_bridged_device_list = new_dev;
-            g_current_bridged_device_count++;
+            add_to_registry(new_dev);
 
             // Enable the resumed endpoint
             esp_matter::endpoint::enable(new_dev->dev->endpoint);
         }
     }
+    endpoint::end_batch();
+    if (storage_batch) {
+        esp_matter_bridge::end_storage_batch();
+    }
+    startup_profiler::add_milestone("bridge_resumed");
     return ESP_OK;
 }
 
-esp_err_t app_bridge_remove_device(app_bridged_device_t *bridged_device)
+/* Drop the device from the app registry and erase its app information, the bridged device itself is kept */
+static esp_err_t app_bridge_unregister_device(app_bridged_device_t *bridged_device)
 {
-    esp_err_t error = ESP_OK;
     app_bridged_device_t *current_dev = NULL;
-    if (!bridged_device) {
-        return ESP_ERR_INVALID_ARG;
-    }
     if (g_bridged_device_list == bridged_device) {
         // The delete bridged device is on the head of device list
         g_bridged_device_list = bridged_device->next;
@@ -276,15 +374,32 @@ esp_err_t app_bridge_remove_device(app_bridged_device_t *bridged_device)
             }
             current_dev = current_dev->next;
         }
-        if (current_dev->next == bridged_device) {
+        if (current_dev && current_dev->next == bridged_device) {
             current_dev->next = bridged_device->next;
         } else {
             return ESP_ERR_NOT_FOUND;
         }
     }
+    // Drop the device from the indexes while its endpoint is still valid, the endpoint ID is the key of one of them
+    s_address_index.remove(bridged_device);
+    s_endpoint_index.remove(bridged_device);
+    g_current_bridged_device_count--;
 
     uint16_t endpoint_id = endpoint::get_id(bridged_device->dev->endpoint);
     app_bridge_erase_bridged_device_info(endpoint_id);
+    return ESP_OK;
+}
+
+esp_err_t app_bridge_remove_device(app_bridged_device_t *bridged_device)
+{
+    esp_err_t error = ESP_OK;
+    if (!bridged_device) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    error = app_bridge_unregister_device(bridged_device);
+    if (error != ESP_OK) {
+        return error;
+    }
 
     // Remove the bridged device from the node.
     error = esp_matter_bridge::remove_device(bridged_device->dev);
@@ -296,176 +411,277 @@ esp_err_t app_bridge_remove_device(app_bridged_device_t *bridged_device)
     return error;
 }
 
-/** ZigBee Device APIs */
-app_bridged_device_t *app_bridge_get_device_by_zigbee_shortaddr(uint16_t zigbee_shortaddr)
+esp_err_t app_bridge_create_bridged_devices(node_t *node, uint16_t parent_endpoint_id,
+                                            const app_bridged_device_config_t *configs, size_t count,
+                                            app_bridged_device_t **bridged_devices)
 {
-    app_bridged_device_t *current_dev = g_bridged_device_list;
-    while (current_dev) {
-        if (current_dev->dev_type == ESP_MATTER_BRIDGED_DEVICE_TYPE_ZIGBEE && current_dev->dev &&
-                current_dev->dev_addr.zigbee_shortaddr == zigbee_shortaddr) {
-            return current_dev;
+    if (!configs || !bridged_devices) {
+        ESP_LOGE(TAG, "configs and bridged_devices cannot be NULL");
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (count > MAX_BRIDGED_DEVICE_COUNT - g_current_bridged_device_count) {
+        ESP_LOGE(TAG, "The device list is full, could not add %u bridged devices", (unsigned)count);
+        return ESP_ERR_NO_MEM;
+    }
+    int64_t start_time = esp_timer_get_time();
+    // The bridged devices are created by esp_matter_bridge::create_devices(), the app devices are their private data
+    uint32_t *device_type_ids = (uint32_t *)esp_matter_mem_calloc(count, sizeof(uint32_t));
+    void **priv_data = (void **)esp_matter_mem_calloc(count, sizeof(void *));
+    esp_matter_bridge::device_t **devices =
+        (esp_matter_bridge::device_t **)esp_matter_mem_calloc(count, sizeof(esp_matter_bridge::device_t *));
+    esp_err_t err = device_type_ids && priv_data && devices ? ESP_OK : ESP_ERR_NO_MEM;
+    for (size_t idx = 0; idx < count; ++idx) {
+        bridged_devices[idx] = NULL;
+        if (err != ESP_OK) {
+            continue;
+        }
+        bridged_devices[idx] = (app_bridged_device_t *)esp_matter_mem_calloc(1, sizeof(app_bridged_device_t));
+        if (!bridged_devices[idx]) {
+            err = ESP_ERR_NO_MEM;
+            continue;
+        }
+        bridged_devices[idx]->priv_data = configs[idx].priv_data;
+        bridged_devices[idx]->dev_type = configs[idx].bridged_device_type;
+        bridged_devices[idx]->dev_addr = configs[idx].bridged_device_address;
+        device_type_ids[idx] = configs[idx].matter_device_type_id;
+        priv_data[idx] = bridged_devices[idx];
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to alloc memory for the bridged devices");
+    } else {
+        err = esp_matter_bridge::begin_storage_batch();
+    }
+
+    size_t created_count = 0;
+    if (err == ESP_OK) {
+        // The app information is stored and the endpoints are enabled in the same batches as the creation, so the
+        // storage is committed once and the PartsList change is reported once for all of them
+        endpoint::begin_batch();
+        err = esp_matter_bridge::create_devices(node, parent_endpoint_id, count, device_type_ids, priv_data, devices);
+        for (size_t idx = 0; idx < count; ++idx) {
+            if (!devices[idx]) {
+                continue;
+            }
+            bridged_devices[idx]->dev = devices[idx];
+            add_to_registry(bridged_devices[idx]);
+            if (ESP_OK != app_bridge_store_bridged_device_info(bridged_devices[idx])) {
+                ESP_LOGW(TAG, "Failed to store the bridged device information");
+            }
+            esp_matter::endpoint::enable(devices[idx]->endpoint);
+            created_count++;
+        }
+        endpoint::end_batch();
+        esp_err_t batch_err = esp_matter_bridge::end_storage_batch();
+        err = err != ESP_OK ? err : batch_err;
+    }
+    // Free the app devices whose bridged device could not be created
+    for (size_t idx = 0; idx < count; ++idx) {
+        if (bridged_devices[idx] && !bridged_devices[idx]->dev) {
+            esp_matter_mem_free(bridged_devices[idx]);
+            bridged_devices[idx] = NULL;
         }
-        current_dev = current_dev->next;
     }
-    return NULL;
+    esp_matter_mem_free(device_type_ids);
+    esp_matter_mem_free(priv_data);
+    esp_matter_mem_free(devices);
+    ESP_LOGI(TAG, "Created %u of %u bridged devices in %" PRId64 " ms", (unsigned)created_count, (unsigned)count,
+             (esp_timer_get_time() - start_time) / 1000);
+    return err;
 }
 
-uint16_t app_bridge_get_matter_endpointid_by_zigbee_shortaddr(uint16_t zigbee_shortaddr)
+esp_err_t app_bridge_remove_devices(app_bridged_device_t **bridged_devices, size_t count)
 {
-    app_bridged_device_t *current_dev = g_bridged_device_list;
-    while (current_dev) {
-        if (current_dev->dev_type == ESP_MATTER_BRIDGED_DEVICE_TYPE_ZIGBEE && current_dev->dev &&
-                current_dev->dev_addr.zigbee_shortaddr == zigbee_shortaddr) {
-            return esp_matter::endpoint::get_id(current_dev->dev->endpoint);
+    if (!bridged_devices) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_matter_bridge::device_t **devices =
+        (esp_matter_bridge::device_t **)esp_matter_mem_calloc(count, sizeof(esp_matter_bridge::device_t *));
+    if (!devices) {
+        ESP_LOGE(TAG, "Failed to alloc memory for the removed bridged devices");
+        return ESP_ERR_NO_MEM;
+    }
+    esp_err_t err = esp_matter_bridge::begin_storage_batch();
+    if (err != ESP_OK) {
+        esp_matter_mem_free(devices);
+        return err;
+    }
+    endpoint::begin_batch();
+    esp_err_t remove_err = ESP_OK;
+    for (size_t idx = 0; idx < count; ++idx) {
+        if (!bridged_devices[idx]) {
+            continue;
+        }
+        if (app_bridge_unregister_device(bridged_devices[idx]) == ESP_OK) {
+            devices[idx] = bridged_devices[idx]->dev;
+            esp_matter_mem_free(bridged_devices[idx]);
+        } else {
+            remove_err = ESP_ERR_NOT_FOUND;
         }
-        current_dev = current_dev->next;
+        bridged_devices[idx] = NULL;
     }
-    return 0xFFFF;
+    // The bridged devices are removed by esp_matter_bridge::remove_devices() in the same batches
+    err = esp_matter_bridge::remove_devices(devices, count);
+    endpoint::end_batch();
+    esp_err_t batch_err = esp_matter_bridge::end_storage_batch();
+    esp_matter_mem_free(devices);
+    if (remove_err != ESP_OK) {
+        return remove_err;
+    }
+    return err != ESP_OK ? err : batch_err;
 }
 
-uint16_t app_bridge_get_zigbee_shortaddr_by_matter_endpointid(uint16_t matter_endpointid)
+/** Join Storage Batch **/
+
+namespace {
+/* The join batch is opened by the tasks of the bridged networks and ended from the Matter thread */
+SemaphoreHandle_t get_join_batch_mutex()
 {
-    app_bridged_device_t *current_dev = g_bridged_device_list;
-    while (current_dev) {
-        if ((current_dev->dev_type == ESP_MATTER_BRIDGED_DEVICE_TYPE_ZIGBEE) && current_dev->dev &&
-                (esp_matter::endpoint::get_id(current_dev->dev->endpoint) == matter_endpointid)) {
-            return current_dev->dev_addr.zigbee_shortaddr;
+    static StaticSemaphore_t mutex_buffer;
+    static SemaphoreHandle_t mutex = xSemaphoreCreateMutexStatic(&mutex_buffer);
+    return mutex;
+}
+
+bool s_join_batch_open = false;
+esp_timer_handle_t s_join_batch_timer = NULL;
+
+void end_join_batch_work(intptr_t arg)
+{
+    xSemaphoreTake(get_join_batch_mutex(), portMAX_DELAY);
+    if (s_join_batch_open) {
+        s_join_batch_open = false;
+        esp_matter_bridge::end_storage_batch();
+    }
+    xSemaphoreGive(get_join_batch_mutex());
+}
+
+void join_batch_timer_cb(void *arg)
+{
+    if (chip::DeviceLayer::PlatformMgr().ScheduleWork(end_join_batch_work) != CHIP_NO_ERROR) {
+        ESP_LOGE(TAG, "Failed to schedule the end of the join storage batch");
+    }
+}
+} // namespace
+
+esp_err_t app_bridge_join_storage_batch()
+{
+    esp_err_t err = ESP_OK;
+    xSemaphoreTake(get_join_batch_mutex(), portMAX_DELAY);
+    if (!s_join_batch_timer) {
+        esp_timer_create_args_t timer_args = {
+            .callback = join_batch_timer_cb,
+            .arg = NULL,
+            .dispatch_method = ESP_TIMER_TASK,
+            .name = "bridge_join",
+            .skip_unhandled_events = true,
+        };
+        err = esp_timer_create(&timer_args, &s_join_batch_timer);
+        if (err != ESP_OK) {
+            // Without the timer the batch could not be ended, so the device is stored on its own
+            ESP_LOGE(TAG, "Failed to create the join storage batch timer");
+            s_join_batch_timer = NULL;
+            xSemaphoreGive(get_join_batch_mutex());
+            return err;
         }
-        current_dev = current_dev->next;
     }
-    return 0xFFFF;
+    if (!s_join_batch_open) {
+        err = esp_matter_bridge::begin_storage_batch();
+        s_join_batch_open = err == ESP_OK;
+    }
+    if (s_join_batch_open) {
+        // Restart the quiet period
+        esp_timer_stop(s_join_batch_timer);
+        esp_timer_start_once(s_join_batch_timer, (uint64_t)CONFIG_ESP_MATTER_BRIDGE_STORAGE_BATCH_TIMEOUT_MS * 1000);
+    }
+    xSemaphoreGive(get_join_batch_mutex());
+    return err;
+}
+
+/** ZigBee Device APIs */
+app_bridged_device_t *app_bridge_get_device_by_zigbee_shortaddr(uint16_t zigbee_shortaddr)
+{
+    return find_device_by_address(ESP_MATTER_BRIDGED_DEVICE_TYPE_ZIGBEE,
+                                  app_bridge_zigbee_address(0, zigbee_shortaddr));
+}
+
+uint16_t app_bridge_get_matter_endpointid_by_zigbee_shortaddr(uint16_t zigbee_shortaddr)
+{
+    return get_endpoint_id(app_bridge_get_device_by_zigbee_shortaddr(zigbee_shortaddr), 0xFFFF);
+}
+
+uint16_t app_bridge_get_zigbee_shortaddr_by_matter_endpointid(uint16_t matter_endpointid)
+{
+    app_bridged_device_t *dev = find_device_by_endpoint_id(ESP_MATTER_BRIDGED_DEVICE_TYPE_ZIGBEE, matter_endpointid);
+    return dev ? dev->dev_addr.zigbee_shortaddr : 0xFFFF;
+}
+
+app_bridged_device_t *app_bridge_get_zigbee_device_by_matter_endpointid(uint16_t matter_endpointid)
+{
+    return find_device_by_endpoint_id(ESP_MATTER_BRIDGED_DEVICE_TYPE_ZIGBEE, matter_endpointid);
 }
 
 /** BLE Mesh Device APIs */
 app_bridged_device_t *app_bridge_get_device_by_blemesh_addr(uint16_t blemesh_addr)
 {
-    app_bridged_device_t *current_dev = g_bridged_device_list;
-    while (current_dev) {
-        if ((current_dev->dev_type == ESP_MATTER_BRIDGED_DEVICE_TYPE_BLEMESH) && current_dev->dev &&
-                (current_dev->dev_addr.blemesh_addr == blemesh_addr)) {
-            return current_dev;
-        }
-        current_dev = current_dev->next;
-    }
-    return NULL;
+    return find_device_by_address(ESP_MATTER_BRIDGED_DEVICE_TYPE_BLEMESH, app_bridge_blemesh_address(blemesh_addr));
 }
 
 uint16_t app_bridge_get_matter_endpointid_by_blemesh_addr(uint16_t blemesh_addr)
 {
-    app_bridged_device_t *current_dev = g_bridged_device_list;
-    while (current_dev) {
-        if ((current_dev->dev_type == ESP_MATTER_BRIDGED_DEVICE_TYPE_BLEMESH) && current_dev->dev &&
-                (current_dev->dev_addr.blemesh_addr == blemesh_addr)) {
-            return esp_matter::endpoint::get_id(current_dev->dev->endpoint);
-        }
-        current_dev = current_dev->next;
-    }
-    return 0xFFFF;
+    return get_endpoint_id(app_bridge_get_device_by_blemesh_addr(blemesh_addr), 0xFFFF);
 }
 
 uint16_t app_bridge_get_blemesh_addr_by_matter_endpointid(uint16_t matter_endpointid)
 {
-    app_bridged_device_t *current_dev = g_bridged_device_list;
-    while (current_dev) {
-        if ((current_dev->dev_type == ESP_MATTER_BRIDGED_DEVICE_TYPE_BLEMESH) && current_dev->dev &&
-                (esp_matter::endpoint::get_id(current_dev->dev->endpoint) == matter_endpointid)) {
-            return current_dev->dev_addr.blemesh_addr;
-        }
-        current_dev = current_dev->next;
-    }
-    return 0xFFFF;
+    app_bridged_device_t *dev = find_device_by_endpoint_id(ESP_MATTER_BRIDGED_DEVICE_TYPE_BLEMESH, matter_endpointid);
+    return dev ? dev->dev_addr.blemesh_addr : 0xFFFF;
 }
 
 /** ESP-NOW Device APIs */
 app_bridged_device_t *app_bridge_get_device_by_espnow_macaddr(uint8_t espnow_macaddr[6])
 {
-    app_bridged_device_t *current_dev = g_bridged_device_list;
-    while (current_dev) {
-        if ((current_dev->dev_type == ESP_MATTER_BRIDGED_DEVICE_TYPE_ESPNOW) && current_dev->dev &&
-                !memcmp(current_dev->dev_addr.espnow_macaddr, espnow_macaddr, 6)) {
-            return current_dev;
-        }
-        current_dev = current_dev->next;
-    }
-    return NULL;
+    app_bridged_device_address_t addr = {
+        .espnow_macaddr = {0},
+    };
+    memcpy(addr.espnow_macaddr, espnow_macaddr, sizeof(addr.espnow_macaddr));
+    return find_device_by_address(ESP_MATTER_BRIDGED_DEVICE_TYPE_ESPNOW, addr);
 }
 
 uint16_t app_bridge_get_matter_endpointid_by_espnow_macaddr(uint8_t espnow_macaddr[6])
 {
-    app_bridged_device_t *current_dev = g_bridged_device_list;
-    while (current_dev) {
-        if ((current_dev->dev_type == ESP_MATTER_BRIDGED_DEVICE_TYPE_ESPNOW) && current_dev->dev &&
-                !memcmp(current_dev->dev_addr.espnow_macaddr, espnow_macaddr, 6)) {
-            return esp_matter::endpoint::get_id(current_dev->dev->endpoint);
-        }
-        current_dev = current_dev->next;
-    }
-    return chip::kInvalidEndpointId;
+    return get_endpoint_id(app_bridge_get_device_by_espnow_macaddr(espnow_macaddr), chip::kInvalidEndpointId);
 }
 
 uint8_t *app_bridge_get_espnow_macaddr_by_matter_endpointid(uint16_t matter_endpointid)
 {
-    app_bridged_device_t *current_dev = g_bridged_device_list;
-    while (current_dev) {
-        if ((current_dev->dev_type == ESP_MATTER_BRIDGED_DEVICE_TYPE_ESPNOW) && current_dev->dev &&
-                (esp_matter::endpoint::get_id(current_dev->dev->endpoint) == matter_endpointid)) {
-            return current_dev->dev_addr.espnow_macaddr;
-        }
-        current_dev = current_dev->next;
-    }
-    return NULL;
+    app_bridged_device_t *dev = find_device_by_endpoint_id(ESP_MATTER_BRIDGED_DEVICE_TYPE_ESPNOW, matter_endpointid);
+    return dev ? dev->dev_addr.espnow_macaddr : NULL;
 }
 
 /** Rainmaker Device APIs */
 app_bridged_device_t *app_bridge_get_device_by_rainmaker_node_id(char rainmaker_node_id[32])
 {
-    app_bridged_device_t *current_dev = g_bridged_device_list;
-    while (current_dev) {
-        if ((current_dev->dev_type == ESP_MATTER_BRIDGED_DEVICE_TYPE_RAINMAKER) && current_dev->dev &&
-                !memcmp(current_dev->dev_addr.rainmaker_node_id, rainmaker_node_id, 32)) {
-            return current_dev;
-        }
-        current_dev = current_dev->next;
-    }
-    return NULL;
+    app_bridged_device_address_t addr = {
+        .rainmaker_node_id = {0},
+        .rainmaker_node_name = {0},
+    };
+    strncpy(addr.rainmaker_node_id, rainmaker_node_id, sizeof(addr.rainmaker_node_id));
+    return find_device_by_address(ESP_MATTER_BRIDGED_DEVICE_TYPE_RAINMAKER, addr);
 }
 
 uint16_t app_bridge_get_matter_endpointid_by_rainmaker_node_id(char rainmaker_node_id[32])
 {
-    app_bridged_device_t *current_dev = g_bridged_device_list;
-    while (current_dev) {
-        if ((current_dev->dev_type == ESP_MATTER_BRIDGED_DEVICE_TYPE_RAINMAKER) && current_dev->dev &&
-                !memcmp(current_dev->dev_addr.rainmaker_node_id, rainmaker_node_id, strlen(rainmaker_node_id))) {
-            return esp_matter::endpoint::get_id(current_dev->dev->endpoint);
-        }
-        current_dev = current_dev->next;
-    }
-    return chip::kInvalidEndpointId;
+    return get_endpoint_id(app_bridge_get_device_by_rainmaker_node_id(rainmaker_node_id), chip::kInvalidEndpointId);
 }
 
 char* app_bridge_get_rainmaker_node_id_by_matter_endpointid(uint16_t matter_endpointid)
 {
-    app_bridged_device_t *current_dev = g_bridged_device_list;
-    while (current_dev) {
-        if ((current_dev->dev_type == ESP_MATTER_BRIDGED_DEVICE_TYPE_RAINMAKER) && current_dev->dev &&
-                (esp_matter::endpoint::get_id(current_dev->dev->endpoint) == matter_endpointid)) {
-            return current_dev->dev_addr.rainmaker_node_id;
-        }
-        current_dev = current_dev->next;
-    }
-    return NULL;
+    app_bridged_device_t *dev = find_device_by_endpoint_id(ESP_MATTER_BRIDGED_DEVICE_TYPE_RAINMAKER, matter_endpointid);
+    return dev ? dev->dev_addr.rainmaker_node_id : NULL;
 }
 
 char* app_bridge_get_rainmaker_node_name_by_matter_endpointid(uint16_t matter_endpointid)
 {
-    app_bridged_device_t *current_dev = g_bridged_device_list;
-    while (current_dev) {
-        if ((current_dev->dev_type == ESP_MATTER_BRIDGED_DEVICE_TYPE_RAINMAKER) && current_dev->dev &&
-                (esp_matter::endpoint::get_id(current_dev->dev->endpoint) == matter_endpointid)) {
-            return current_dev->dev_addr.rainmaker_node_name;
-        }
-        current_dev = current_dev->next;
-    }
-    return NULL;
+    app_bridged_device_t *dev = find_device_by_endpoint_id(ESP_MATTER_BRIDGED_DEVICE_TYPE_RAINMAKER, matter_endpointid);
+    return dev ? dev->dev_addr.rainmaker_node_name : NULL;
 }
 #endif
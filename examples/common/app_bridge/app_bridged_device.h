@@ -66,6 +66,18 @@ typedef struct app_bridged_device {
     void *priv_data;
 } app_bridged_device_t;
 
+/* Bridged Device Config, used to create bridged devices in bulk */
+typedef struct {
+    /** Matter device type id of the bridged endpoint */
+    uint32_t matter_device_type_id;
+    /** Type of Bridged Device */
+    app_bridged_device_type_t bridged_device_type;
+    /** Address of Bridged Device */
+    app_bridged_device_address_t bridged_device_address;
+    /* User initialization data */
+    void *priv_data;
+} app_bridged_device_config_t;
+
 /** Bridged Device's Address APIs */
 app_bridged_device_address_t app_bridge_zigbee_address(uint8_t zigbee_endpointid, uint16_t zigbee_shortaddr);
 
@@ -86,6 +98,23 @@ esp_err_t app_bridge_initialize(node_t *node, esp_matter_bridge::bridge_device_t
 
 esp_err_t app_bridge_remove_device(app_bridged_device_t *bridged_device);
 
+/** Create and enable `count` bridged devices with one bridged endpoint id array store and one PartsList report.
+ * The devices which could not be created are set to NULL in `bridged_devices`.
+ */
+esp_err_t app_bridge_create_bridged_devices(node_t *node, uint16_t parent_endpoint_id,
+                                            const app_bridged_device_config_t *configs, size_t count,
+                                            app_bridged_device_t **bridged_devices);
+
+/** Remove `count` bridged devices with one bridged endpoint id array store and one PartsList report */
+esp_err_t app_bridge_remove_devices(app_bridged_device_t **bridged_devices, size_t count);
+
+/** Join the bridged devices which are created close in time to one bridge storage batch.
+ * The batch is opened by the first call and committed once no call is made for
+ * CONFIG_ESP_MATTER_BRIDGE_STORAGE_BATCH_TIMEOUT_MS, so a network which announces many devices at once stores the
+ * bridged endpoint id array once. Call it before `app_bridge_create_bridged_device()` in the join handlers.
+ */
+esp_err_t app_bridge_join_storage_batch();
+
 /** ZigBee Device APIs */
 app_bridged_device_t *app_bridge_get_device_by_zigbee_shortaddr(uint16_t zigbee_shortaddr);
 
@@ -93,6 +122,8 @@ uint16_t app_bridge_get_matter_endpointid_by_zigbee_shortaddr(uint16_t zigbee_sh
 
 uint16_t app_bridge_get_zigbee_shortaddr_by_matter_endpointid(uint16_t matter_endpointid);
 
+app_bridged_device_t *app_bridge_get_zigbee_device_by_matter_endpointid(uint16_t matter_endpointid);
+
 /** BLE Mesh Device APIs */
 app_bridged_device_t *app_bridge_get_device_by_blemesh_addr(uint16_t blemesh_addr);
 
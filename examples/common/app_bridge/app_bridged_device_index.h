@@ -0,0 +1,108 @@
+// Copyright 2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace app_bridge {
+
+/** FNV-1a hash of the bytes, `hash` can be the hash of the preceding bytes */
+inline uint32_t hash_bytes(const void *data, size_t len, uint32_t hash = 2166136261u)
+{
+    const uint8_t *bytes = (const uint8_t *)data;
+    for (size_t i = 0; i < len; ++i) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+/* Keep the load factor at or below 0.5 so that the probe sequences stay short and an empty slot always exists */
+constexpr size_t get_index_capacity(size_t count)
+{
+    size_t capacity = 1;
+    while (capacity < 2 * count) {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+/**
+ * Open addressing index of up to `Count` devices with linear probing.
+ *
+ * Removing a device shifts the following entries of its probe sequence back, so lookups never have to skip
+ * tombstones. The capacity is derived from `Count` and the index never has to grow.
+ */
+template <typename Device, size_t Count>
+class device_index {
+public:
+    typedef uint32_t (*hash_fn_t)(const Device *dev);
+
+    explicit constexpr device_index(hash_fn_t hash_fn) : m_hash_fn(hash_fn), m_slots{} {}
+
+    void insert(Device *dev)
+    {
+        size_t idx = m_hash_fn(dev) & k_mask;
+        while (m_slots[idx]) {
+            idx = (idx + 1) & k_mask;
+        }
+        m_slots[idx] = dev;
+    }
+
+    void remove(Device *dev)
+    {
+        size_t idx = m_hash_fn(dev) & k_mask;
+        while (m_slots[idx] && m_slots[idx] != dev) {
+            idx = (idx + 1) & k_mask;
+        }
+        if (!m_slots[idx]) {
+            return;
+        }
+        size_t next = idx;
+        while (true) {
+            next = (next + 1) & k_mask;
+            if (!m_slots[next]) {
+                break;
+            }
+            size_t home = m_hash_fn(m_slots[next]) & k_mask;
+            /* Skip the entries whose home slot lies cyclically in (idx, next], they are still reachable */
+            bool reachable = idx <= next ? (idx < home && home <= next) : (idx < home || home <= next);
+            if (!reachable) {
+                m_slots[idx] = m_slots[next];
+                idx = next;
+            }
+        }
+        m_slots[idx] = nullptr;
+    }
+
+    template <typename Match>
+    Device *find(uint32_t hash, Match match) const
+    {
+        for (size_t idx = hash & k_mask; m_slots[idx]; idx = (idx + 1) & k_mask) {
+            if (match(m_slots[idx])) {
+                return m_slots[idx];
+            }
+        }
+        return nullptr;
+    }
+
+private:
+    static constexpr size_t k_capacity = get_index_capacity(Count);
+    static constexpr size_t k_mask = k_capacity - 1;
+    hash_fn_t m_hash_fn;
+    Device *m_slots[k_capacity];
+};
+
+} // namespace app_bridge
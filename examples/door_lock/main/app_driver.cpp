@@ -7,19 +7,25 @@
 */
 
 #include <esp_log.h>
+#include <inttypes.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include <esp_matter.h>
+#include <esp_matter_console.h>
 #include "bsp/esp-bsp.h"
 
 #include <app_priv.h>
+#include <door_lock_manager.h>
 
 static const char *TAG = "app_driver";
 
 using namespace chip::app::Clusters;
 using namespace esp_matter;
 
+extern uint16_t door_lock_endpoint_id;
+
 esp_err_t app_driver_attribute_update(app_driver_handle_t driver_handle, uint16_t endpoint_id, uint32_t cluster_id,
                                       uint32_t attribute_id, esp_matter_attr_val_t *val)
 {
@@ -35,3 +41,71 @@ app_driver_handle_t app_driver_button_init()
 
     return (app_driver_handle_t)btns[0];
 }
+
+#if CONFIG_ENABLE_CHIP_SHELL
+/* Provision users with a PIN each in one bulk update and check that it costs one commit */
+static esp_err_t app_driver_provision_users(uint16_t count)
+{
+    lock::ScopedChipStackLock lock(portMAX_DELAY);
+    BoltLockManager &manager = BoltLockMgr();
+    uint32_t write_count = manager.GetRecordWriteCount();
+    uint32_t commit_count = manager.GetCommitCount();
+    bool success = true;
+
+    manager.BeginBulkUpdate();
+    for (uint16_t index = 1; index <= count && success; ++index) {
+        char name[DOOR_LOCK_MAX_USER_NAME_SIZE];
+        char pin[7];
+        snprintf(name, sizeof(name), "user%u", index);
+        snprintf(pin, sizeof(pin), "%06u", index);
+        CredentialStruct credential = { CredentialTypeEnum::kPin, index };
+        success = manager.SetCredential(door_lock_endpoint_id, index, kUndefinedFabricIndex, kUndefinedFabricIndex,
+                                        DlCredentialStatus::kOccupied, CredentialTypeEnum::kPin,
+                                        ByteSpan(reinterpret_cast<const uint8_t *>(pin), strlen(pin))) &&
+                  manager.SetUser(door_lock_endpoint_id, index, kUndefinedFabricIndex, kUndefinedFabricIndex,
+                                  CharSpan::fromCharString(name), index, UserStatusEnum::kOccupiedEnabled,
+                                  UserTypeEnum::kUnrestrictedUser, CredentialRuleEnum::kSingle, &credential, 1);
+    }
+    CHIP_ERROR err = manager.EndBulkUpdate();
+
+    write_count = manager.GetRecordWriteCount() - write_count;
+    commit_count = manager.GetCommitCount() - commit_count;
+    ESP_LOGI(TAG, "Provisioned %u users: %" PRIu32 " records written with %" PRIu32 " commits", count, write_count,
+             commit_count);
+    if (!success || err != CHIP_NO_ERROR) {
+        ESP_LOGE(TAG, "Failed to provision the users");
+        return ESP_FAIL;
+    }
+    // Each user and its PIN are one record each, all written by the commit of the bulk update
+    if (write_count != 2u * count || commit_count != 1) {
+        ESP_LOGE(TAG, "Unexpected flash writes for the bulk update, expected %u records with 1 commit", 2u * count);
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t app_driver_doorlock_console_handler(int argc, char **argv)
+{
+    if (argc == 2 && strncmp(argv[0], "provision", sizeof("provision")) == 0) {
+        int count = atoi(argv[1]);
+        if (count <= 0 || count > kMaxCredentialsPerUser || count > kMaxUsers) {
+            ESP_LOGE(TAG, "The user count must be between 1 and %u", kMaxCredentialsPerUser);
+            return ESP_ERR_INVALID_ARG;
+        }
+        return app_driver_provision_users(count);
+    }
+    ESP_LOGE(TAG, "Incorrect arguments. Usage: matter esp doorlock provision <user_count>");
+    return ESP_ERR_INVALID_ARG;
+}
+
+void app_driver_register_commands()
+{
+    static const esp_matter::console::command_t doorlock_command = {
+        .name = "doorlock",
+        .description = "Provision door lock users with a PIN each in one bulk update. "
+        "Usage: matter esp doorlock provision <user_count>",
+        .handler = app_driver_doorlock_console_handler,
+    };
+    esp_matter::console::add_commands(&doorlock_command, 1);
+}
+#endif // CONFIG_ENABLE_CHIP_SHELL
@@ -42,6 +42,11 @@ app_driver_handle_t app_driver_button_init();
 esp_err_t app_driver_attribute_update(app_driver_handle_t driver_handle, uint16_t endpoint_id, uint32_t cluster_id,
                                       uint32_t attribute_id, esp_matter_attr_val_t *val);
 
+#if CONFIG_ENABLE_CHIP_SHELL
+/** Register the door lock console commands */
+void app_driver_register_commands();
+#endif
+
 /** The definition and invocation of this function are intended to resolve the issue:
  * unable to link and call the callback functions defined in the door_lock_callbacks.cpp file.
 */
@@ -10,8 +10,11 @@
 
 #include <platform/ESP32/ESP32Config.h>
 #include <app-common/zap-generated/attributes/Accessors.h>
+#include <algorithm>
+#include <cstdio>
 #include <cstring>
 #include <esp_log.h>
+#include <nvs.h>
 
 static const char *TAG = "doorlock_manager";
 
@@ -26,6 +29,48 @@ using namespace chip::DeviceLayer::Internal;
 using namespace ESP32DoorLock::LockInitParams;
 using namespace chip::Protocols::InteractionModel;
 
+namespace {
+constexpr char kRecordNamespace[] = "doorlock";
+
+// NVS record of one user, the spans in info are fixed up to point to the manager's arrays when loading
+struct UserRecord {
+    EmberAfPluginDoorLockUserInfo info;
+    char name[DOOR_LOCK_MAX_USER_NAME_SIZE];
+    CredentialStruct credentials[kMaxCredentialsPerUser];
+};
+
+// NVS record of one credential, the span in info is fixed up to point to the manager's array when loading
+struct CredentialRecord {
+    EmberAfPluginDoorLockCredentialInfo info;
+    uint8_t data[kMaxCredentialSize];
+};
+
+void UserRecordKey(char (&key)[NVS_KEY_NAME_MAX_SIZE], uint16_t userIndex)
+{
+    snprintf(key, sizeof(key), "user%u", userIndex);
+}
+
+void CredentialRecordKey(char (&key)[NVS_KEY_NAME_MAX_SIZE], uint16_t credentialIndex)
+{
+    snprintf(key, sizeof(key), "cred%u", credentialIndex);
+}
+
+void WeekdayScheduleRecordKey(char (&key)[NVS_KEY_NAME_MAX_SIZE], uint16_t userIndex, uint8_t scheduleIndex)
+{
+    snprintf(key, sizeof(key), "wday%u_%u", userIndex, scheduleIndex);
+}
+
+void YeardayScheduleRecordKey(char (&key)[NVS_KEY_NAME_MAX_SIZE], uint16_t userIndex, uint8_t scheduleIndex)
+{
+    snprintf(key, sizeof(key), "yday%u_%u", userIndex, scheduleIndex);
+}
+
+void HolidayScheduleRecordKey(char (&key)[NVS_KEY_NAME_MAX_SIZE], uint8_t holidayIndex)
+{
+    snprintf(key, sizeof(key), "hday%u", holidayIndex);
+}
+} // namespace
+
 CHIP_ERROR BoltLockManager::Init(DataModel::Nullable<DoorLock::DlLockState> state,
                                  LockParam lockParam)
 {
@@ -93,6 +138,39 @@ bool BoltLockManager::IsValidHolidayScheduleIndex(uint8_t scheduleIndex)
 
 bool BoltLockManager::ReadConfigValues()
 {
+    if (ReadLegacyConfigValues()) {
+        // Move the whole tables stored by the previous firmware to per-record storage
+        ESP_LOGI(TAG, "Migrating the door lock tables to per-record storage");
+        mDirtyUsers.set();
+        mDirtyCredentials.set();
+        mDirtyWeekdaySchedules.set();
+        mDirtyYeardaySchedules.set();
+        mDirtyHolidaySchedules.set();
+        if (PersistDirtyRecords() == CHIP_NO_ERROR) {
+            ESP32Config::ClearConfigValue(ESP32Config::kConfigKey_LockUser);
+            ESP32Config::ClearConfigValue(ESP32Config::kConfigKey_Credential);
+            ESP32Config::ClearConfigValue(ESP32Config::kConfigKey_LockUserName);
+            ESP32Config::ClearConfigValue(ESP32Config::kConfigKey_CredentialData);
+            ESP32Config::ClearConfigValue(ESP32Config::kConfigKey_UserCredentials);
+            ESP32Config::ClearConfigValue(ESP32Config::kConfigKey_WeekDaySchedules);
+            ESP32Config::ClearConfigValue(ESP32Config::kConfigKey_YearDaySchedules);
+            ESP32Config::ClearConfigValue(ESP32Config::kConfigKey_HolidaySchedules);
+        }
+        return true;
+    }
+    LoadRecords();
+    return true;
+}
+
+bool BoltLockManager::ReadLegacyConfigValues()
+{
+    if (!ESP32Config::ConfigValueExists(ESP32Config::kConfigKey_LockUser) &&
+            !ESP32Config::ConfigValueExists(ESP32Config::kConfigKey_Credential) &&
+            !ESP32Config::ConfigValueExists(ESP32Config::kConfigKey_WeekDaySchedules) &&
+            !ESP32Config::ConfigValueExists(ESP32Config::kConfigKey_YearDaySchedules) &&
+            !ESP32Config::ConfigValueExists(ESP32Config::kConfigKey_HolidaySchedules)) {
+        return false;
+    }
     size_t outLen;
     ESP32Config::ReadConfigValueBin(ESP32Config::kConfigKey_LockUser, reinterpret_cast<uint8_t *>(&mLockUsers),
                                     sizeof(EmberAfPluginDoorLockUserInfo) * MATTER_ARRAY_SIZE(mLockUsers), outLen);
@@ -123,9 +201,195 @@ bool BoltLockManager::ReadConfigValues()
     ESP32Config::ReadConfigValueBin(ESP32Config::kConfigKey_HolidaySchedules, reinterpret_cast<uint8_t *>(&(mHolidaySchedule)),
                                     sizeof(EmberAfPluginDoorLockHolidaySchedule) * LockParams.numberOfHolidaySchedules, outLen);
 
+    // The legacy tables stored the spans as they were, point them to the arrays of this firmware
+    for (uint16_t i = 0; i < kMaxUsers; i++) {
+        mLockUsers[i].userName = CharSpan(mUserNames[i], std::min<size_t>(mLockUsers[i].userName.size(),
+                                                                           DOOR_LOCK_MAX_USER_NAME_SIZE));
+        mLockUsers[i].credentials = Span<const CredentialStruct>(
+                                        mCredentials[i], std::min<size_t>(mLockUsers[i].credentials.size(), kMaxCredentialsPerUser));
+    }
+    for (uint16_t i = 0; i < kMaxCredentials; i++) {
+        mLockCredentials[i].credentialData = ByteSpan(
+                                                 mCredentialData[i], std::min<size_t>(mLockCredentials[i].credentialData.size(), kMaxCredentialSize));
+    }
     return true;
 }
 
+void BoltLockManager::LoadRecords()
+{
+    nvs_handle_t handle;
+    if (nvs_open(kRecordNamespace, NVS_READONLY, &handle) != ESP_OK) {
+        // Nothing has been stored yet
+        return;
+    }
+    char key[NVS_KEY_NAME_MAX_SIZE];
+    size_t len;
+
+    for (uint16_t i = 0; i < kMaxUsers; i++) {
+        UserRecord record;
+        len = sizeof(record);
+        UserRecordKey(key, i);
+        if (nvs_get_blob(handle, key, &record, &len) != ESP_OK || len != sizeof(record)) {
+            continue;
+        }
+        memcpy(mUserNames[i], record.name, sizeof(mUserNames[i]));
+        memcpy(mCredentials[i], record.credentials, sizeof(mCredentials[i]));
+        mLockUsers[i] = record.info;
+        mLockUsers[i].userName = CharSpan(mUserNames[i], std::min<size_t>(record.info.userName.size(),
+                                                                           DOOR_LOCK_MAX_USER_NAME_SIZE));
+        mLockUsers[i].credentials = Span<const CredentialStruct>(
+                                        mCredentials[i], std::min<size_t>(record.info.credentials.size(), kMaxCredentialsPerUser));
+    }
+
+    for (uint16_t i = 0; i < kMaxCredentials; i++) {
+        CredentialRecord record;
+        len = sizeof(record);
+        CredentialRecordKey(key, i);
+        if (nvs_get_blob(handle, key, &record, &len) != ESP_OK || len != sizeof(record)) {
+            continue;
+        }
+        memcpy(mCredentialData[i], record.data, sizeof(mCredentialData[i]));
+        mLockCredentials[i] = record.info;
+        mLockCredentials[i].credentialData = ByteSpan(
+                                                 mCredentialData[i], std::min<size_t>(record.info.credentialData.size(), kMaxCredentialSize));
+    }
+
+    for (uint16_t user = 0; user < kMaxUsers; user++) {
+        for (uint8_t i = 0; i < kMaxWeekdaySchedulesPerUser; i++) {
+            len = sizeof(mWeekdaySchedule[user][i]);
+            WeekdayScheduleRecordKey(key, user, i);
+            nvs_get_blob(handle, key, &mWeekdaySchedule[user][i], &len);
+        }
+        for (uint8_t i = 0; i < kMaxYeardaySchedulesPerUser; i++) {
+            len = sizeof(mYeardaySchedule[user][i]);
+            YeardayScheduleRecordKey(key, user, i);
+            nvs_get_blob(handle, key, &mYeardaySchedule[user][i], &len);
+        }
+    }
+
+    for (uint8_t i = 0; i < kMaxHolidaySchedules; i++) {
+        len = sizeof(mHolidaySchedule[i]);
+        HolidayScheduleRecordKey(key, i);
+        nvs_get_blob(handle, key, &mHolidaySchedule[i], &len);
+    }
+    nvs_close(handle);
+}
+
+CHIP_ERROR BoltLockManager::PersistDirtyRecords()
+{
+    if (mBulkUpdateDepth > 0) {
+        return CHIP_NO_ERROR;
+    }
+    if (mDirtyUsers.none() && mDirtyCredentials.none() && mDirtyWeekdaySchedules.none() &&
+            mDirtyYeardaySchedules.none() && mDirtyHolidaySchedules.none()) {
+        return CHIP_NO_ERROR;
+    }
+
+    nvs_handle_t handle;
+    esp_err_t err = nvs_open(kRecordNamespace, NVS_READWRITE, &handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to open the door lock storage, err:%d", err);
+        return CHIP_ERROR_PERSISTED_STORAGE_FAILED;
+    }
+
+    size_t bytesWritten = 0;
+    size_t recordCount = 0;
+    char key[NVS_KEY_NAME_MAX_SIZE];
+    // Occupied records are written, the records of available entries are erased
+    auto writeRecord = [&](bool occupied, const void *data, size_t len) {
+        esp_err_t ret = occupied ? nvs_set_blob(handle, key, data, len) : nvs_erase_key(handle, key);
+        if (ret == ESP_ERR_NVS_NOT_FOUND) {
+            ret = ESP_OK;
+        }
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to store the door lock record %s, err:%d", key, ret);
+            err = err == ESP_OK ? ret : err;
+            return;
+        }
+        bytesWritten += occupied ? len : 0;
+        recordCount++;
+    };
+
+    for (uint16_t i = 0; i < kMaxUsers; i++) {
+        if (!mDirtyUsers.test(i)) {
+            continue;
+        }
+        UserRecord record;
+        record.info = mLockUsers[i];
+        memcpy(record.name, mUserNames[i], sizeof(record.name));
+        memcpy(record.credentials, mCredentials[i], sizeof(record.credentials));
+        UserRecordKey(key, i);
+        writeRecord(mLockUsers[i].userStatus != UserStatusEnum::kAvailable, &record, sizeof(record));
+    }
+
+    for (uint16_t i = 0; i < kMaxCredentials; i++) {
+        if (!mDirtyCredentials.test(i)) {
+            continue;
+        }
+        CredentialRecord record;
+        record.info = mLockCredentials[i];
+        memcpy(record.data, mCredentialData[i], sizeof(record.data));
+        CredentialRecordKey(key, i);
+        writeRecord(mLockCredentials[i].status != DlCredentialStatus::kAvailable, &record, sizeof(record));
+    }
+
+    for (uint16_t user = 0; user < kMaxUsers; user++) {
+        for (uint8_t i = 0; i < kMaxWeekdaySchedulesPerUser; i++) {
+            if (mDirtyWeekdaySchedules.test(user * kMaxWeekdaySchedulesPerUser + i)) {
+                WeekdayScheduleRecordKey(key, user, i);
+                writeRecord(mWeekdaySchedule[user][i].status != DlScheduleStatus::kAvailable, &mWeekdaySchedule[user][i],
+                            sizeof(mWeekdaySchedule[user][i]));
+            }
+        }
+        for (uint8_t i = 0; i < kMaxYeardaySchedulesPerUser; i++) {
+            if (mDirtyYeardaySchedules.test(user * kMaxYeardaySchedulesPerUser + i)) {
+                YeardayScheduleRecordKey(key, user, i);
+                writeRecord(mYeardaySchedule[user][i].status != DlScheduleStatus::kAvailable, &mYeardaySchedule[user][i],
+                            sizeof(mYeardaySchedule[user][i]));
+            }
+        }
+    }
+
+    for (uint8_t i = 0; i < kMaxHolidaySchedules; i++) {
+        if (mDirtyHolidaySchedules.test(i)) {
+            HolidayScheduleRecordKey(key, i);
+            writeRecord(mHolidaySchedule[i].status != DlScheduleStatus::kAvailable, &mHolidaySchedule[i],
+                        sizeof(mHolidaySchedule[i]));
+        }
+    }
+
+    if (err == ESP_OK) {
+        err = nvs_commit(handle);
+    }
+    nvs_close(handle);
+    if (err != ESP_OK) {
+        // Keep the records dirty so that they are written with the next change
+        return CHIP_ERROR_PERSISTED_STORAGE_FAILED;
+    }
+
+    mDirtyUsers.reset();
+    mDirtyCredentials.reset();
+    mDirtyWeekdaySchedules.reset();
+    mDirtyYeardaySchedules.reset();
+    mDirtyHolidaySchedules.reset();
+    mRecordWriteCount += recordCount;
+    mCommitCount++;
+    ESP_LOGD(TAG, "Stored %u door lock records, %u bytes", recordCount, bytesWritten);
+    return CHIP_NO_ERROR;
+}
+
+void BoltLockManager::BeginBulkUpdate()
+{
+    mBulkUpdateDepth++;
+}
+
+CHIP_ERROR BoltLockManager::EndBulkUpdate()
+{
+    VerifyOrReturnError(mBulkUpdateDepth > 0, CHIP_ERROR_INCORRECT_STATE);
+    mBulkUpdateDepth--;
+    return PersistDirtyRecords();
+}
+
 bool BoltLockManager::Lock(EndpointId endpointId, const Optional<ByteSpan>  &pin, OperationErrorEnum  &err)
 {
     return setLockState(endpointId, DlLockState::kLocked, pin, err);
@@ -219,14 +483,10 @@ bool BoltLockManager::SetUser(EndpointId endpointId, uint16_t userIndex, FabricI
     userInStorage.credentials = Span<const CredentialStruct>(mCredentials[userIndex], totalCredentials);
 
     // Save user information in NVM flash
-    ESP32Config::WriteConfigValueBin(ESP32Config::kConfigKey_LockUser, reinterpret_cast<const uint8_t *>(&mLockUsers),
-                                     sizeof(EmberAfPluginDoorLockUserInfo) * LockParams.numberOfUsers);
-
-    ESP32Config::WriteConfigValueBin(ESP32Config::kConfigKey_UserCredentials, reinterpret_cast<const uint8_t *>(mCredentials),
-                                     sizeof(CredentialStruct) * LockParams.numberOfUsers * LockParams.numberOfCredentialsPerUser);
-
-    ESP32Config::WriteConfigValueBin(ESP32Config::kConfigKey_LockUserName, reinterpret_cast<const uint8_t *>(mUserNames),
-                                     sizeof(mUserNames));
+    mDirtyUsers.set(userIndex);
+    if (PersistDirtyRecords() != CHIP_NO_ERROR) {
+        ESP_LOGE(TAG, "Failed to store the user [endpoint=%d,index=%d]", endpointId, userIndex);
+    }
 
     ESP_LOGI(TAG, "Successfully set the user [mEndpointId=%d,index=%d]", endpointId, userIndex);
 
@@ -287,6 +547,11 @@ bool BoltLockManager::SetCredential(EndpointId endpointId, uint16_t credentialIn
              "[credentialStatus=%u,credentialType=%u,credentialDataSize=%u,creator=%d,modifier=%d]",
              to_underlying(credentialStatus), to_underlying(credentialType), credentialData.size(), creator, modifier);
 
+    if (credentialData.size() > kMaxCredentialSize) {
+        ESP_LOGE(TAG, "Cannot set credential - credential data is too long [dataSize=%u]", credentialData.size());
+        return false;
+    }
+
     auto  &credentialInStorage = mLockCredentials[credentialIndex];
 
     credentialInStorage.status         = credentialStatus;
@@ -298,11 +563,10 @@ bool BoltLockManager::SetCredential(EndpointId endpointId, uint16_t credentialIn
     credentialInStorage.credentialData = ByteSpan{ mCredentialData[credentialIndex], credentialData.size() };
 
     // Save credential information in NVM flash
-    ESP32Config::WriteConfigValueBin(ESP32Config::kConfigKey_Credential, reinterpret_cast<const uint8_t *>(&mLockCredentials),
-                                     sizeof(EmberAfPluginDoorLockCredentialInfo) * LockParams.numberOfCredentialsPerUser);
-
-    ESP32Config::WriteConfigValueBin(ESP32Config::kConfigKey_CredentialData, reinterpret_cast<const uint8_t *>(&mCredentialData),
-                                     sizeof(mCredentialData));
+    mDirtyCredentials.set(credentialIndex);
+    if (PersistDirtyRecords() != CHIP_NO_ERROR) {
+        ESP_LOGE(TAG, "Failed to store the credential [credentialIndex=%d]", credentialIndex);
+    }
 
     ESP_LOGI(TAG, "Successfully set the credential [credentialType=%u]", to_underlying(credentialType));
 
@@ -356,9 +620,10 @@ DlStatus BoltLockManager::SetWeekdaySchedule(EndpointId endpointId, uint8_t week
     scheduleInStorage.status               = status;
 
     // Save schedule information in NVM flash
-    ESP32Config::WriteConfigValueBin(ESP32Config::kConfigKey_WeekDaySchedules, reinterpret_cast<const uint8_t *>(mWeekdaySchedule),
-                                     sizeof(EmberAfPluginDoorLockWeekDaySchedule) * LockParams.numberOfWeekdaySchedulesPerUser *
-                                     LockParams.numberOfUsers);
+    mDirtyWeekdaySchedules.set(userIndex * kMaxWeekdaySchedulesPerUser + weekdayIndex);
+    if (PersistDirtyRecords() != CHIP_NO_ERROR) {
+        ESP_LOGE(TAG, "Failed to store the schedule");
+    }
 
     return DlStatus::kSuccess;
 }
@@ -404,9 +669,10 @@ DlStatus BoltLockManager::SetYeardaySchedule(EndpointId endpointId, uint8_t year
     scheduleInStorage.status                  = status;
 
     // Save schedule information in NVM flash
-    ESP32Config::WriteConfigValueBin(ESP32Config::kConfigKey_YearDaySchedules, reinterpret_cast<const uint8_t *>(mYeardaySchedule),
-                                     sizeof(EmberAfPluginDoorLockYearDaySchedule) * LockParams.numberOfYeardaySchedulesPerUser *
-                                     LockParams.numberOfUsers);
+    mDirtyYeardaySchedules.set(userIndex * kMaxYeardaySchedulesPerUser + yearDayIndex);
+    if (PersistDirtyRecords() != CHIP_NO_ERROR) {
+        ESP_LOGE(TAG, "Failed to store the schedule");
+    }
 
     return DlStatus::kSuccess;
 }
@@ -447,9 +713,10 @@ DlStatus BoltLockManager::SetHolidaySchedule(EndpointId endpointId, uint8_t holi
     scheduleInStorage.status                  = status;
 
     // Save schedule information in NVM flash
-    ESP32Config::WriteConfigValueBin(ESP32Config::kConfigKey_HolidaySchedules,
-                                     reinterpret_cast<const uint8_t *>(&(mHolidaySchedule)),
-                                     sizeof(EmberAfPluginDoorLockHolidaySchedule) * LockParams.numberOfHolidaySchedules);
+    mDirtyHolidaySchedules.set(holidayIndex);
+    if (PersistDirtyRecords() != CHIP_NO_ERROR) {
+        ESP_LOGE(TAG, "Failed to store the schedule");
+    }
 
     return DlStatus::kSuccess;
 }
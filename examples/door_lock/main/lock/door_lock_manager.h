@@ -9,6 +9,7 @@
 #pragma once
 #include <app/clusters/door-lock-server/door-lock-server.h>
 
+#include <bitset>
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -155,6 +156,15 @@ public:
 
     bool ReadConfigValues();
 
+    /* Users, credentials and schedules set between BeginBulkUpdate() and EndBulkUpdate() are written to the flash
+     * once, by EndBulkUpdate(). Use it to provision many users at once. The calls can be nested. */
+    void BeginBulkUpdate();
+    CHIP_ERROR EndBulkUpdate();
+
+    // Records written and commits done since boot, used to check the flash cost of the updates
+    uint32_t GetRecordWriteCount() const { return mRecordWriteCount; }
+    uint32_t GetCommitCount() const { return mCommitCount; }
+
 private:
     friend BoltLockManager  &BoltLockMgr();
 
@@ -170,6 +180,21 @@ private:
 
     static BoltLockManager sLock;
     ESP32DoorLock::LockInitParams::LockParam LockParams;
+
+    // Each user, credential and schedule is stored as its own NVS record, only the changed records are written
+    bool ReadLegacyConfigValues();
+    void LoadRecords();
+    // Write the dirty records to the flash with a single commit, does nothing during a bulk update
+    CHIP_ERROR PersistDirtyRecords();
+
+    std::bitset<kMaxUsers> mDirtyUsers;
+    std::bitset<kMaxCredentials> mDirtyCredentials;
+    std::bitset<kMaxUsers * kMaxWeekdaySchedulesPerUser> mDirtyWeekdaySchedules;
+    std::bitset<kMaxUsers * kMaxYeardaySchedulesPerUser> mDirtyYeardaySchedules;
+    std::bitset<kMaxHolidaySchedules> mDirtyHolidaySchedules;
+    uint8_t mBulkUpdateDepth = 0;
+    uint32_t mRecordWriteCount = 0;
+    uint32_t mCommitCount = 0;
 };
 
 inline BoltLockManager  &BoltLockMgr()
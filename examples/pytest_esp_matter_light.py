@@ -12,6 +12,7 @@ from pytest_embedded import Dut
 import os
 import yaml
 import sys
+import json
 
 sys.path.append(os.path.abspath(os.path.join(os.path.dirname(__file__), '../tools/ci')))
 from pytest_cert_helper import *
@@ -23,6 +24,14 @@ OT_BR_EXAMPLE_PATH = str(pathlib.Path(__file__).parent)+'/thread_border_router'
 OT_DATASET_HEXSTR = '0e08000000000001000035060004001fffe00708fdb824be22185de50c0402a0f7f8051020112014020519772011201402051977030d41706f6c6c6f6e54687265616404101fefc90ee1637d47ca75f87ec24f9403000300000f0208201120140205197701022201'
 pytest_build_dir = CURRENT_DIR_LIGHT
 pytest_matter_thread_dir = CURRENT_DIR_LIGHT+'|'+OT_BR_EXAMPLE_PATH
+# Startup budget of the C6 light in milliseconds, built with the startup profiler of sdkconfig.defaults.esp32c6.
+# The phases are the top-level records of the profiler, the BLE advertising timeout bounds the whole boot.
+STARTUP_BUDGET_MS = {
+    'esp_matter_start': 1500,
+    'chip_init_task': 3000,
+    'server_init': 1000,
+    'endpoint_enable_all': 500,
+}
 
 gitlab_api = GitLabAPI()
 PYTEST_SSID = gitlab_api.ci_gitlab_pytest_ssid
@@ -151,6 +160,31 @@ def test_matter_commissioning_c6(dut:Dut, certification_tests: str, ci_branch: s
       assert False
 
 
+@pytest.mark.esp32c6
+@pytest.mark.esp_matter_dut
+@pytest.mark.parametrize(
+    ' count, app_path, target, erase_all', [
+        ( 1, pytest_build_dir, 'esp32c6', 'y'),
+    ],
+    indirect=True,
+)
+
+# Cold boot to commissionable within the startup budget
+def test_matter_startup_budget_c6(dut:Dut) -> None:
+    light = dut
+    light.expect(r'Configuring CHIPoBLE advertising', timeout=20)
+    time.sleep(2)
+    light.write('matter esp diagnostics startup-profile json')
+    records = json.loads(light.expect(r'(\[\{"name".*\}\])', timeout=10).group(1))
+    print(json.dumps(records, indent=1))
+    for name, budget_ms in STARTUP_BUDGET_MS.items():
+        record = next((record for record in records if record['name'] == name), None)
+        assert record is not None, f'{name} is not in the startup profile'
+        elapsed_ms = record['duration_us'] / 1000
+        print(f'{name}: {elapsed_ms:.1f} ms, budget {budget_ms} ms')
+        assert elapsed_ms <= budget_ms, f'{name} took {elapsed_ms:.1f} ms, over the budget of {budget_ms} ms'
+
+
 # get the host interface name
 def get_host_interface_name() -> str:
     home_dir = os.path.expanduser("~")
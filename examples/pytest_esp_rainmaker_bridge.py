@@ -0,0 +1,239 @@
+# SPDX-License-Identifier: CC0-1.0
+
+# Sync cycle test of the rainmaker bridge against a local mock of the rainmaker API.
+#
+# The DUT runs examples/bridge_apps/esp_rainmaker_bridge built with sdkconfig.ci.sync_test and is connected to the
+# Wi-Fi network of the runner with the "matter esp wifi connect" console command. The bridge is pointed to the mock
+# server with the "matter esp rainmaker cloud" console command, the mock server counts the requests and the bytes it
+# serves and the bridge logs the requests, bytes and attribute updates of each sync cycle.
+
+import json
+import os
+import pathlib
+import re
+import socket
+import sys
+import threading
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from urllib.parse import parse_qs, urlparse
+
+import pytest
+from pytest_embedded import Dut
+
+sys.path.append(os.path.abspath(os.path.join(os.path.dirname(__file__), '../tools/ci')))
+from gitlab_api import GitLabAPI
+
+RAINMAKER_BRIDGE_DIR = str(pathlib.Path(__file__).parent) + '/bridge_apps/esp_rainmaker_bridge'
+gitlab_api = GitLabAPI()
+PYTEST_SSID = gitlab_api.ci_gitlab_pytest_ssid
+PYTEST_PASSPHRASE = gitlab_api.ci_gitlab_pytest_passphrase
+NODE_COUNT = 100
+PAGE_SIZE = 25
+PAGE_COUNT = (NODE_COUNT + PAGE_SIZE - 1) // PAGE_SIZE
+# Latency of the node config requests of the mock server once it is slowed down
+CONFIG_LATENCY_S = 0.5
+SYNC_CYCLE_RE = re.compile(r'Sync cycle (\d+): (\d+) nodes in (\d+) ms, (\d+) requests, (\d+) bytes sent, '
+                           r'(\d+) bytes received, (\d+) attribute updates')
+
+
+class MockRainmaker:
+    def __init__(self, node_count: int) -> None:
+        self.lock = threading.Lock()
+        self.nodes = {
+            f'node{i:03d}': {'Power': True, 'Brightness': 50, 'connected': True}
+            for i in range(node_count)
+        }
+        self.request_count = 0
+        self.rx_bytes = 0
+        self.tx_bytes = 0
+        # Changing the token expires the one the bridge holds, its requests then get a 401 until it logs in again
+        self.access_token = 'mock-access-token'
+        self.login_count = 0
+        self.config_latency = 0.0
+        self.config_in_flight = 0
+        self.config_max_in_flight = 0
+
+    def count(self, rx_bytes: int, tx_bytes: int) -> None:
+        with self.lock:
+            self.request_count += 1
+            self.rx_bytes += rx_bytes
+            self.tx_bytes += tx_bytes
+
+    def nodes_page(self, start_id: str) -> dict:
+        with self.lock:
+            ids = sorted(self.nodes)
+            start = ids.index(start_id) if start_id in ids else 0
+            page = ids[start:start + PAGE_SIZE]
+            details = [{
+                'id': node_id,
+                'params': {'Light': {'Power': self.nodes[node_id]['Power'],
+                                     'Brightness': self.nodes[node_id]['Brightness']}},
+                'status': {'connectivity': {'connected': self.nodes[node_id]['connected']}},
+            } for node_id in page]
+            body = {'node_details': details, 'total': len(ids)}
+            if start + PAGE_SIZE < len(ids):
+                body['next_id'] = ids[start + PAGE_SIZE]
+            return body
+
+
+def make_handler(mock: MockRainmaker) -> type:
+    class Handler(BaseHTTPRequestHandler):
+        def log_message(self, format: str, *args: object) -> None:
+            pass
+
+        def reply(self, body: dict, rx_bytes: int) -> None:
+            data = json.dumps(body).encode()
+            self.send_response(200)
+            self.send_header('Content-Type', 'application/json')
+            self.send_header('Content-Length', str(len(data)))
+            self.end_headers()
+            self.wfile.write(data)
+            mock.count(rx_bytes, len(data))
+
+        def read_body(self) -> bytes:
+            return self.rfile.read(int(self.headers.get('Content-Length', 0)))
+
+        def authorized(self, rx_bytes: int) -> bool:
+            with mock.lock:
+                access_token = mock.access_token
+            if self.headers.get('Authorization') == access_token:
+                return True
+            data = json.dumps({'status': 'failure', 'description': 'Unauthorized'}).encode()
+            self.send_response(401)
+            self.send_header('Content-Type', 'application/json')
+            self.send_header('Content-Length', str(len(data)))
+            self.end_headers()
+            self.wfile.write(data)
+            mock.count(rx_bytes, len(data))
+            return False
+
+        def reply_config(self) -> None:
+            with mock.lock:
+                latency = mock.config_latency
+                mock.config_in_flight += 1
+                mock.config_max_in_flight = max(mock.config_max_in_flight, mock.config_in_flight)
+            time.sleep(latency)
+            with mock.lock:
+                mock.config_in_flight -= 1
+            self.reply({'devices': [{'name': 'Light', 'type': 'esp.device.lightbulb',
+                                     'params': [{'type': 'esp.param.power'},
+                                                {'type': 'esp.param.brightness'}]}]}, 0)
+
+        def do_GET(self) -> None:
+            url = urlparse(self.path)
+            query = parse_qs(url.query)
+            if url.path not in ('/v1/user/nodes', '/v1/user/nodes/config'):
+                self.send_error(404)
+            elif not self.authorized(0):
+                pass
+            elif url.path == '/v1/user/nodes':
+                self.reply(mock.nodes_page(query.get('start_id', [''])[0]), 0)
+            else:
+                self.reply_config()
+
+        def do_POST(self) -> None:
+            body = self.read_body()
+            if urlparse(self.path).path == '/v1/login2':
+                with mock.lock:
+                    mock.login_count += 1
+                    access_token = mock.access_token
+                self.reply({'status': 'success', 'accesstoken': access_token}, len(body))
+            else:
+                self.send_error(404)
+
+        def do_PUT(self) -> None:
+            body = self.read_body()
+            if urlparse(self.path).path != '/v1/user/nodes/params':
+                self.send_error(404)
+            elif self.authorized(len(body)):
+                self.reply([{'node_id': node['node_id'], 'status': 'success'} for node in json.loads(body)],
+                           len(body))
+
+    return Handler
+
+
+def get_host_ip(dut_ip: str) -> str:
+    # The address of the interface which routes to the DUT
+    with socket.socket(socket.AF_INET, socket.SOCK_DGRAM) as sock:
+        sock.connect((dut_ip, 80))
+        return str(sock.getsockname()[0])
+
+
+def expect_sync_cycle(dut: Dut) -> tuple:
+    match = dut.expect(SYNC_CYCLE_RE, timeout=120)
+    cycle, nodes, duration_ms, requests, tx_bytes, rx_bytes, updates = (
+        int(match.group(i).decode()) for i in range(1, 8))
+    print(f'Sync cycle {cycle}: {nodes} nodes in {duration_ms} ms, {requests} requests, {tx_bytes} bytes sent, '
+          f'{rx_bytes} bytes received, {updates} attribute updates')
+    return nodes, requests, updates, duration_ms
+
+
+@pytest.mark.esp32s3
+@pytest.mark.esp_matter_dut
+@pytest.mark.parametrize(
+    ' count, app_path, target, config', [
+        (1, RAINMAKER_BRIDGE_DIR, 'esp32s3', 'sync_test'),
+    ],
+    indirect=True,
+)
+def test_rainmaker_bridge_sync_cycle(dut: Dut) -> None:
+    dut.expect('main_task: Returned from app_main()', timeout=60)
+    dut.write(f'matter esp wifi connect {PYTEST_SSID} {PYTEST_PASSPHRASE}')
+    dut_ip = dut.expect(r'Connected with IP Address:(\d+\.\d+\.\d+\.\d+)', timeout=60).group(1).decode()
+    mock = MockRainmaker(NODE_COUNT)
+    server = ThreadingHTTPServer(('0.0.0.0', 0), make_handler(mock))
+    threading.Thread(target=server.serve_forever, daemon=True).start()
+    try:
+        dut.write(f'matter esp rainmaker cloud http://{get_host_ip(dut_ip)}:{server.server_port} mock-refresh-token')
+
+        # The first complete cycle creates the bridged devices and pushes the initial state of every node
+        nodes, _, updates, _ = expect_sync_cycle(dut)
+        while nodes < NODE_COUNT:
+            nodes, _, updates, _ = expect_sync_cycle(dut)
+        assert updates > 0
+
+        # Nothing changed: one node details request per page and no attribute update
+        _, requests, updates, _ = expect_sync_cycle(dut)
+        assert requests == PAGE_COUNT
+        assert updates == 0
+
+        # Only the changed params are pushed to Matter
+        with mock.lock:
+            for node_id in sorted(mock.nodes)[:10]:
+                mock.nodes[node_id]['Power'] = False
+        _, requests, updates, _ = expect_sync_cycle(dut)
+        assert requests == PAGE_COUNT
+        assert updates == 10
+
+        # A node going offline updates Reachable only
+        with mock.lock:
+            mock.nodes[sorted(mock.nodes)[-1]]['connected'] = False
+        _, requests, updates, _ = expect_sync_cycle(dut)
+        assert updates == 1
+
+        # Nodes added back while the server is slow and the token has expired: the HTTP workers fetch their configs in
+        # parallel and log in again only once between them
+        readded = sorted(mock.nodes)[:8]
+        with mock.lock:
+            saved = {node_id: mock.nodes.pop(node_id) for node_id in readded}
+        nodes, _, _, _ = expect_sync_cycle(dut)
+        assert nodes == NODE_COUNT - len(readded)
+        with mock.lock:
+            mock.nodes.update(saved)
+            mock.config_latency = CONFIG_LATENCY_S
+            mock.access_token = 'mock-access-token-2'
+            login_count = mock.login_count
+        total_ms = 0
+        while nodes < NODE_COUNT:
+            nodes, _, _, duration_ms = expect_sync_cycle(dut)
+            total_ms += duration_ms
+        print(f'{len(readded)} node configs fetched in {total_ms} ms with up to {mock.config_max_in_flight} '
+              f'requests in flight, {mock.login_count - login_count} logins')
+        assert mock.config_max_in_flight > 1
+        assert total_ms < len(readded) * CONFIG_LATENCY_S * 1000
+        assert mock.login_count == login_count + 1
+        print(f'Mock server: {mock.request_count} requests, {mock.rx_bytes} bytes received, '
+              f'{mock.tx_bytes} bytes sent')
+    finally:
+        server.shutdown()
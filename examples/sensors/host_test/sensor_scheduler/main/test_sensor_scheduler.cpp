@@ -0,0 +1,250 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+
+#include <drivers/sensor_interval.h>
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unity.h>
+
+/* Defaults of shtc3_sensor_config_t and of the SHTC3 options of the example */
+static constexpr uint32_t k_min_interval_ms = 5000;
+static constexpr uint32_t k_max_interval_ms = 60000;
+static constexpr uint32_t k_idle_interval_ms = 30000;
+static constexpr float k_temperature_threshold = 0.1f;
+static constexpr float k_humidity_threshold = 0.5f;
+
+/* Charge of one SHTC3 measurement: typical values of the SHTC3 datasheet, 430 uA for the 12.1 ms of a normal mode
+   measurement. Between the measurements the sensor sleeps at 0.3 uA. */
+static constexpr double k_sensor_measure_ua = 430;
+static constexpr double k_sensor_measure_ms = 12.1;
+static constexpr double k_sensor_sleep_ua = 0.3;
+
+/* Charge of waking the SoC up for a measurement, an assumption of the model: 3 steps (wake up, measure, read) of
+   1 ms each at 10 mA. The sleep current of the SoC is not counted, it does not depend on the sampling. */
+static constexpr double k_soc_step_ma = 10;
+static constexpr double k_soc_step_ms = 1;
+static constexpr uint32_t k_steps_per_measurement = 3;
+
+static constexpr uint32_t k_seconds_per_day = 24 * 3600;
+
+typedef struct {
+    float temperature;
+    float humidity;
+} sample_t;
+
+typedef sample_t (*trace_fn_t)(uint32_t t);
+
+static float noise(uint32_t t, uint32_t seed)
+{
+    /* Deterministic noise in [-1, 1], so that the traces do not depend on the order of the calls */
+    uint32_t x = (t + 1) * 2654435761u ^ seed * 40503u;
+    x ^= x >> 15;
+    x *= 2246822519u;
+    x ^= x >> 13;
+    return (x & 0xFFFF) / 32767.5f - 1.0f;
+}
+
+static float ramp(uint32_t t, uint32_t start_s, uint32_t duration_s)
+{
+    if (t <= start_s) {
+        return 0;
+    }
+    return t >= start_s + duration_s ? 1.0f : static_cast<float>(t - start_s) / duration_s;
+}
+
+/* A room of a home: diurnal swing, heating in the morning and in the evening, a shower raising the humidity */
+static sample_t home_trace(uint32_t t)
+{
+    float day = 2.0f * static_cast<float>(M_PI) * (static_cast<float>(t) / k_seconds_per_day - 0.25f);
+    float temperature = 20.0f + 1.5f * sinf(day) + 0.01f * noise(t, 1);
+    temperature += 2.0f * (ramp(t, 6 * 3600, 1800) - ramp(t, 9 * 3600, 3600));
+    temperature += 1.5f * (ramp(t, 18 * 3600, 1800) - ramp(t, 23 * 3600, 3600));
+    float humidity = 45.0f - 4.0f * sinf(day) + 0.05f * noise(t, 2);
+    humidity += 20.0f * (ramp(t, 7 * 3600, 600) - ramp(t, 7 * 3600 + 600, 2400));
+    return { temperature, humidity };
+}
+
+/* A closet or a storage room, only the slow diurnal swing and the noise of the sensor */
+static sample_t quiet_trace(uint32_t t)
+{
+    float day = 2.0f * static_cast<float>(M_PI) * (static_cast<float>(t) / k_seconds_per_day - 0.25f);
+    return { 18.0f + 0.5f * sinf(day) + 0.01f * noise(t, 3), 50.0f + 0.05f * noise(t, 4) };
+}
+
+typedef enum {
+    SAMPLING_FIXED,    /* The fixed 5 s timer of the driver before the scheduler */
+    SAMPLING_ADAPTIVE, /* The adaptive interval, always in ICD active mode */
+    SAMPLING_ICD,      /* The adaptive interval with the idle interval, ICD active 60 s every 10 minutes */
+} sampling_t;
+
+typedef struct {
+    uint32_t measurements;
+    double average_ua;
+    float max_temperature_error;
+    float max_humidity_error;
+    /* Share of the day where the last measured value is off by more than the threshold */
+    double stale_share;
+} simulation_result_t;
+
+static bool icd_active_at(sampling_t sampling, uint32_t t)
+{
+    return sampling != SAMPLING_ICD || t % 600 < 60;
+}
+
+/* Step the day by one second, the intervals are multiples of a second. The next measurement is rescheduled when the
+   ICD mode changes, as the scheduler task does. */
+static simulation_result_t simulate_day(trace_fn_t trace, sampling_t sampling)
+{
+    sensor_interval_t interval;
+    sensor_interval_init(&interval, k_min_interval_ms, sampling == SAMPLING_FIXED ? k_min_interval_ms
+                                                                                  : k_max_interval_ms,
+                         sampling == SAMPLING_ICD ? k_idle_interval_ms : 0);
+
+    simulation_result_t result = {};
+    sample_t measured = trace(0);
+    uint32_t last_s = 0;
+    uint32_t next_s = 0;
+    bool has_previous = false;
+    bool prev_icd_active = icd_active_at(sampling, 0);
+    uint32_t stale_seconds = 0;
+
+    for (uint32_t t = 0; t < k_seconds_per_day; t++) {
+        bool icd_active = icd_active_at(sampling, t);
+        if (icd_active != prev_icd_active) {
+            next_s = last_s + sensor_interval_get(&interval, icd_active) / 1000;
+            prev_icd_active = icd_active;
+        }
+        sample_t truth = trace(t);
+        if (t >= next_s) {
+            /* The activity of shtc3_activity() */
+            float activity = 0;
+            if (has_previous) {
+                float temperature_activity = fabsf(truth.temperature - measured.temperature) /
+                                             k_temperature_threshold;
+                float humidity_activity = fabsf(truth.humidity - measured.humidity) / k_humidity_threshold;
+                activity = temperature_activity > humidity_activity ? temperature_activity : humidity_activity;
+            }
+            has_previous = true;
+            measured = truth;
+            sensor_interval_update(&interval, activity);
+            result.measurements++;
+            last_s = t;
+            next_s = t + sensor_interval_get(&interval, icd_active) / 1000;
+        }
+
+        float temperature_error = fabsf(truth.temperature - measured.temperature);
+        float humidity_error = fabsf(truth.humidity - measured.humidity);
+        result.max_temperature_error = fmaxf(result.max_temperature_error, temperature_error);
+        result.max_humidity_error = fmaxf(result.max_humidity_error, humidity_error);
+        stale_seconds += temperature_error > k_temperature_threshold || humidity_error > k_humidity_threshold;
+    }
+
+    double measure_charge_uas = result.measurements * (k_sensor_measure_ua * k_sensor_measure_ms +
+                                                       k_steps_per_measurement * k_soc_step_ma * 1000 * k_soc_step_ms) /
+                                1000;
+    result.average_ua = measure_charge_uas / k_seconds_per_day + k_sensor_sleep_ua;
+    result.stale_share = static_cast<double>(stale_seconds) / k_seconds_per_day;
+    return result;
+}
+
+static void print_result(const char * trace_name, const char * sampling_name, const simulation_result_t &result)
+{
+    printf("sensor_scheduler: %s trace, %s: %" PRIu32 " measurements per day, %.2f uA average, %.2f mAh per day, "
+           "max error %.3f C and %.2f %%RH, %.2f %% of the day off by more than the threshold\n", trace_name,
+           sampling_name, result.measurements, result.average_ua, result.average_ua * 24 / 1000,
+           result.max_temperature_error, result.max_humidity_error, result.stale_share * 100);
+}
+
+static void test_interval_follows_activity(void)
+{
+    sensor_interval_t interval;
+    sensor_interval_init(&interval, k_min_interval_ms, k_max_interval_ms, k_idle_interval_ms);
+    TEST_ASSERT_EQUAL(k_min_interval_ms, sensor_interval_get(&interval, true));
+
+    /* Stable values double the interval up to the maximum */
+    uint32_t expected_ms = k_min_interval_ms;
+    for (int i = 0; i < 6; i++) {
+        sensor_interval_update(&interval, 0);
+        expected_ms = expected_ms * 2 < k_max_interval_ms ? expected_ms * 2 : k_max_interval_ms;
+        TEST_ASSERT_EQUAL(expected_ms, sensor_interval_get(&interval, true));
+    }
+
+    /* A significant change drops it back to the minimum */
+    sensor_interval_update(&interval, 1.0f);
+    TEST_ASSERT_EQUAL(k_min_interval_ms, sensor_interval_get(&interval, true));
+
+    /* A small change right after large ones keeps it at the minimum, the recent activity is still high */
+    sensor_interval_init(&interval, k_min_interval_ms, k_max_interval_ms, 0);
+    for (int i = 0; i < 4; i++) {
+        sensor_interval_update(&interval, 1.5f);
+    }
+    sensor_interval_update(&interval, 0.95f);
+    TEST_ASSERT_EQUAL(k_min_interval_ms, sensor_interval_get(&interval, true));
+    sensor_interval_update(&interval, 0);
+    TEST_ASSERT_EQUAL(2 * k_min_interval_ms, sensor_interval_get(&interval, true));
+}
+
+static void test_idle_interval_only_applies_in_idle_mode(void)
+{
+    sensor_interval_t interval;
+    sensor_interval_init(&interval, k_min_interval_ms, k_max_interval_ms, k_idle_interval_ms);
+    TEST_ASSERT_EQUAL(k_min_interval_ms, sensor_interval_get(&interval, true));
+    TEST_ASSERT_EQUAL(k_idle_interval_ms, sensor_interval_get(&interval, false));
+
+    /* Above the idle interval the mode does not matter */
+    for (int i = 0; i < 6; i++) {
+        sensor_interval_update(&interval, 0);
+    }
+    TEST_ASSERT_EQUAL(k_max_interval_ms, sensor_interval_get(&interval, false));
+
+    /* A sensor which is only triggered stays so */
+    sensor_interval_init(&interval, 0, 0, 0);
+    sensor_interval_update(&interval, 0);
+    TEST_ASSERT_EQUAL(0, sensor_interval_get(&interval, false));
+}
+
+static void simulate_trace(const char * trace_name, trace_fn_t trace)
+{
+    simulation_result_t fixed = simulate_day(trace, SAMPLING_FIXED);
+    simulation_result_t adaptive = simulate_day(trace, SAMPLING_ADAPTIVE);
+    simulation_result_t icd = simulate_day(trace, SAMPLING_ICD);
+    print_result(trace_name, "fixed 5 s interval", fixed);
+    print_result(trace_name, "adaptive interval", adaptive);
+    print_result(trace_name, "adaptive interval with ICD idle mode", icd);
+
+    TEST_ASSERT_EQUAL(k_seconds_per_day / (k_min_interval_ms / 1000), fixed.measurements);
+    TEST_ASSERT_TRUE(adaptive.measurements < fixed.measurements);
+    TEST_ASSERT_TRUE(icd.measurements <= adaptive.measurements);
+    TEST_ASSERT_TRUE(adaptive.average_ua < fixed.average_ua);
+    TEST_ASSERT_TRUE(icd.average_ua <= adaptive.average_ua);
+}
+
+static void simulate_current_per_day(void)
+{
+    simulate_trace("home", home_trace);
+    simulate_trace("quiet", quiet_trace);
+
+    /* The change which starts after a stable period is seen late, up to the maximum interval, then the interval
+       follows it. The measured values stay within the thresholds for all but a small share of the day. */
+    simulation_result_t adaptive = simulate_day(home_trace, SAMPLING_ADAPTIVE);
+    simulation_result_t icd = simulate_day(home_trace, SAMPLING_ICD);
+    TEST_ASSERT_TRUE(adaptive.max_temperature_error < 2 * k_temperature_threshold);
+    TEST_ASSERT_TRUE(adaptive.stale_share < 0.01);
+    TEST_ASSERT_TRUE(icd.stale_share < 0.01);
+}
+
+extern "C" void app_main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_interval_follows_activity);
+    RUN_TEST(test_idle_interval_only_applies_in_idle_mode);
+    RUN_TEST(simulate_current_per_day);
+    exit(UNITY_END());
+}
@@ -22,6 +22,11 @@
 // drivers implemented by this example
 #include <drivers/shtc3.h>
 #include <drivers/pir.h>
+#include <drivers/sensor_scheduler.h>
+
+#if CHIP_CONFIG_ENABLE_ICD_SERVER
+#include <app/icd/server/ICDStateObserver.h>
+#endif
 
 static const char *TAG = "app_main";
 
@@ -30,23 +35,19 @@ using namespace esp_matter::attribute;
 using namespace esp_matter::endpoint;
 using namespace chip::app::Clusters;
 
+static measurement::measurement_t *s_temperature_measurement = nullptr;
+static measurement::measurement_t *s_humidity_measurement = nullptr;
+static measurement::measurement_t *s_occupancy_measurement = nullptr;
+
+// The samples go through the measurement pipelines, which only write the attribute on the Matter thread
+// when the value changed by more than the deadband.
+
 // Application cluster specification, 7.18.2.11. Temperature
 // represents a temperature on the Celsius scale with a resolution of 0.01°C.
 // temp = (temperature in °C) x 100
 static void temp_sensor_notification(uint16_t endpoint_id, float temp, void *user_data)
 {
-    // schedule the attribute update so that we can report it from matter thread
-    chip::DeviceLayer::SystemLayer().ScheduleLambda([endpoint_id, temp]() {
-        attribute_t * attribute = attribute::get(endpoint_id,
-                                                 TemperatureMeasurement::Id,
-                                                 TemperatureMeasurement::Attributes::MeasuredValue::Id);
-
-        esp_matter_attr_val_t val = esp_matter_invalid(NULL);
-        attribute::get_val(attribute, &val);
-        val.val.i16 = static_cast<int16_t>(temp * 100);
-
-        attribute::update(endpoint_id, TemperatureMeasurement::Id, TemperatureMeasurement::Attributes::MeasuredValue::Id, &val);
-    });
+    measurement::submit(s_temperature_measurement, static_cast<int16_t>(temp * 100));
 }
 
 // Application cluster specification, 2.6.4.1. MeasuredValue Attribute
@@ -54,36 +55,28 @@ static void temp_sensor_notification(uint16_t endpoint_id, float temp, void *use
 // humidity = (humidity in %) x 100
 static void humidity_sensor_notification(uint16_t endpoint_id, float humidity, void *user_data)
 {
-    // schedule the attribute update so that we can report it from matter thread
-    chip::DeviceLayer::SystemLayer().ScheduleLambda([endpoint_id, humidity]() {
-        attribute_t * attribute = attribute::get(endpoint_id,
-                                                 RelativeHumidityMeasurement::Id,
-                                                 RelativeHumidityMeasurement::Attributes::MeasuredValue::Id);
-
-        esp_matter_attr_val_t val = esp_matter_invalid(NULL);
-        attribute::get_val(attribute, &val);
-        val.val.u16 = static_cast<uint16_t>(humidity * 100);
-
-        attribute::update(endpoint_id, RelativeHumidityMeasurement::Id, RelativeHumidityMeasurement::Attributes::MeasuredValue::Id, &val);
-    });
+    measurement::submit(s_humidity_measurement, static_cast<uint16_t>(humidity * 100));
 }
 
 static void occupancy_sensor_notification(uint16_t endpoint_id, bool occupancy, void *user_data)
 {
-    // schedule the attribute update so that we can report it from matter thread
-    chip::DeviceLayer::SystemLayer().ScheduleLambda([endpoint_id, occupancy]() {
-        attribute_t * attribute = attribute::get(endpoint_id,
-                                                 OccupancySensing::Id,
-                                                 OccupancySensing::Attributes::Occupancy::Id);
-
-        esp_matter_attr_val_t val = esp_matter_invalid(NULL);
-        attribute::get_val(attribute, &val);
-        val.val.b = occupancy;
-
-        attribute::update(endpoint_id, OccupancySensing::Id, OccupancySensing::Attributes::Occupancy::Id, &val);
-    });
+    measurement::submit(s_occupancy_measurement, occupancy);
 }
 
+#if CHIP_CONFIG_ENABLE_ICD_SERVER
+// Sample the sensors less often while the ICD is in idle mode
+class SensorIcdObserver : public chip::app::ICDStateObserver
+{
+public:
+    void OnEnterActiveMode() override { sensor_scheduler_set_icd_active(true); }
+    void OnEnterIdleMode() override { sensor_scheduler_set_icd_active(false); }
+    void OnTransitionToIdle() override {}
+    void OnICDModeChange() override {}
+};
+
+static SensorIcdObserver s_icd_observer;
+#endif
+
 static esp_err_t factory_reset_button_register()
 {
     button_handle_t push_button;
@@ -124,6 +117,12 @@ static void app_event_cb(const ChipDeviceEvent *event, intptr_t arg)
         open_commissioning_window_if_necessary();
         break;
 
+#if CHIP_CONFIG_ENABLE_ICD_SERVER
+    case chip::DeviceLayer::DeviceEventType::kServerReady:
+        chip::Server::GetInstance().GetICDManager().RegisterObserver(&s_icd_observer);
+        break;
+#endif
+
     case chip::DeviceLayer::DeviceEventType::kBLEDeinitialized:
         ESP_LOGI(TAG, "BLE deinitialized and memory reclaimed");
         break;
@@ -177,6 +176,32 @@ extern "C" void app_main()
     endpoint_t * humidity_sensor_ep = humidity_sensor::create(node, &humidity_sensor_config, ENDPOINT_FLAG_NONE, NULL);
     ABORT_APP_ON_FAILURE(humidity_sensor_ep != nullptr, ESP_LOGE(TAG, "Failed to create humidity_sensor endpoint"));
 
+    measurement::config_t temp_measurement_config = {
+        .endpoint_id = endpoint::get_id(temp_sensor_ep),
+        .cluster_id = TemperatureMeasurement::Id,
+        .attribute_id = TemperatureMeasurement::Attributes::MeasuredValue::Id,
+        .type = ESP_MATTER_VAL_TYPE_NULLABLE_INT16,
+        .deadband = CONFIG_SENSOR_TEMPERATURE_DEADBAND,
+        .min_interval_ms = CONFIG_SENSOR_MIN_REPORT_INTERVAL_MS,
+        .max_interval_ms = CONFIG_SENSOR_MAX_REPORT_INTERVAL_MS,
+        .average_count = CONFIG_SENSOR_AVERAGE_SAMPLES,
+    };
+    s_temperature_measurement = measurement::create(&temp_measurement_config);
+    ABORT_APP_ON_FAILURE(s_temperature_measurement != nullptr, ESP_LOGE(TAG, "Failed to create temperature measurement"));
+
+    measurement::config_t humidity_measurement_config = {
+        .endpoint_id = endpoint::get_id(humidity_sensor_ep),
+        .cluster_id = RelativeHumidityMeasurement::Id,
+        .attribute_id = RelativeHumidityMeasurement::Attributes::MeasuredValue::Id,
+        .type = ESP_MATTER_VAL_TYPE_NULLABLE_UINT16,
+        .deadband = CONFIG_SENSOR_HUMIDITY_DEADBAND,
+        .min_interval_ms = CONFIG_SENSOR_MIN_REPORT_INTERVAL_MS,
+        .max_interval_ms = CONFIG_SENSOR_MAX_REPORT_INTERVAL_MS,
+        .average_count = CONFIG_SENSOR_AVERAGE_SAMPLES,
+    };
+    s_humidity_measurement = measurement::create(&humidity_measurement_config);
+    ABORT_APP_ON_FAILURE(s_humidity_measurement != nullptr, ESP_LOGE(TAG, "Failed to create humidity measurement"));
+
     // initialize temperature and humidity sensor driver (shtc3)
     static shtc3_sensor_config_t shtc3_config = {
         .temperature = {
@@ -187,6 +212,8 @@ extern "C" void app_main()
             .cb = humidity_sensor_notification,
             .endpoint_id = endpoint::get_id(humidity_sensor_ep),
         },
+        .max_interval_ms = CONFIG_SHTC3_MAX_INTERVAL_MS,
+        .idle_interval_ms = CONFIG_SHTC3_IDLE_INTERVAL_MS,
     };
     err = shtc3_sensor_init(&shtc3_config);
     ABORT_APP_ON_FAILURE(err == ESP_OK, ESP_LOGE(TAG, "Failed to initialize temperature sensor driver"));
@@ -201,6 +228,20 @@ extern "C" void app_main()
     endpoint_t * occupancy_sensor_ep = occupancy_sensor::create(node, &occupancy_sensor_config, ENDPOINT_FLAG_NONE, NULL);
     ABORT_APP_ON_FAILURE(occupancy_sensor_ep != nullptr, ESP_LOGE(TAG, "Failed to create occupancy_sensor endpoint"));
 
+    // every occupancy change is written, without delay
+    measurement::config_t occupancy_measurement_config = {
+        .endpoint_id = endpoint::get_id(occupancy_sensor_ep),
+        .cluster_id = OccupancySensing::Id,
+        .attribute_id = OccupancySensing::Attributes::Occupancy::Id,
+        .type = ESP_MATTER_VAL_TYPE_BITMAP8,
+        .deadband = 0,
+        .min_interval_ms = 0,
+        .max_interval_ms = 0,
+        .average_count = 1,
+    };
+    s_occupancy_measurement = measurement::create(&occupancy_measurement_config);
+    ABORT_APP_ON_FAILURE(s_occupancy_measurement != nullptr, ESP_LOGE(TAG, "Failed to create occupancy measurement"));
+
     // initialize occupancy sensor driver (pir)
     static pir_sensor_config_t pir_config = {
         .cb = occupancy_sensor_notification,
@@ -12,28 +12,46 @@
 #include <lib/support/CodeUtils.h>
 
 #include <drivers/pir.h>
+#include <drivers/sensor_scheduler.h>
 
 #define PIR_SENSOR_PIN (static_cast<gpio_num_t>(CONFIG_PIR_DATA_PIN))
 
 typedef struct {
     pir_sensor_config_t *config;
+    sensor_scheduler_handle_t scheduler;
+    bool occupancy;
     bool is_initialized;
 } pir_sensor_ctx_t;
 
 static pir_sensor_ctx_t s_ctx;
 
-static void IRAM_ATTR pir_gpio_handler(void *arg)
+// The level is read from the scheduler task, so the application callback does not run in interrupt context
+static sensor_step_result_t pir_measurement_step(uint8_t step, void *arg)
 {
-    static bool occupancy = false;
+    auto *ctx = (pir_sensor_ctx_t *) arg;
     bool new_occupancy = gpio_get_level(PIR_SENSOR_PIN);
 
     // we only need to notify application layer if occupancy changed
-    if (occupancy != new_occupancy) {
-        occupancy = new_occupancy;
-        if (s_ctx.config->cb) {
-            s_ctx.config->cb(s_ctx.config->endpoint_id, new_occupancy, s_ctx.config->user_data);
+    if (ctx->occupancy != new_occupancy) {
+        ctx->occupancy = new_occupancy;
+        if (ctx->config->cb) {
+            ctx->config->cb(ctx->config->endpoint_id, new_occupancy, ctx->config->user_data);
         }
     }
+
+    sensor_step_result_t result = {
+        .status = SENSOR_STEP_DONE,
+        .wait_ms = 0,
+        .activity = 0,
+    };
+    return result;
+}
+
+static void IRAM_ATTR pir_gpio_handler(void *arg)
+{
+    if (s_ctx.scheduler) {
+        sensor_scheduler_trigger_from_isr(s_ctx.scheduler);
+    }
 }
 
 static void pir_gpio_init(gpio_num_t pin)
@@ -57,8 +75,23 @@ esp_err_t pir_sensor_init(pir_sensor_config_t *config)
         return ESP_ERR_INVALID_STATE;
     }
 
+    s_ctx.config = config;
     pir_gpio_init(PIR_SENSOR_PIN);
 
-    s_ctx.config = config;
+    // sampled on the GPIO interrupts only
+    sensor_scheduler_config_t scheduler_config = {
+        .name = "pir",
+        .step_cb = pir_measurement_step,
+        .ctx = &s_ctx,
+        .min_interval_ms = 0,
+        .max_interval_ms = 0,
+        .idle_interval_ms = 0,
+    };
+    esp_err_t err = sensor_scheduler_add(&scheduler_config, &s_ctx.scheduler);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    s_ctx.is_initialized = true;
     return ESP_OK;
 }
@@ -0,0 +1,42 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+
+#include <drivers/sensor_interval.h>
+
+// weight of the latest measurement in the recent activity, 1/4
+#define SENSOR_ACTIVITY_WEIGHT 0.25f
+
+void sensor_interval_init(sensor_interval_t *interval, uint32_t min_interval_ms, uint32_t max_interval_ms,
+                          uint32_t idle_interval_ms)
+{
+    interval->min_interval_ms = min_interval_ms;
+    interval->max_interval_ms = max_interval_ms;
+    interval->idle_interval_ms = idle_interval_ms;
+    interval->interval_ms = min_interval_ms;
+    interval->activity = 0;
+}
+
+void sensor_interval_update(sensor_interval_t *interval, float activity)
+{
+    interval->activity += SENSOR_ACTIVITY_WEIGHT * (activity - interval->activity);
+    if (activity >= 1.0f || interval->activity >= 1.0f) {
+        interval->interval_ms = interval->min_interval_ms;
+    } else if (interval->interval_ms < interval->max_interval_ms) {
+        uint32_t interval_ms = interval->interval_ms * 2;
+        interval->interval_ms = interval_ms < interval->max_interval_ms ? interval_ms : interval->max_interval_ms;
+    }
+}
+
+uint32_t sensor_interval_get(const sensor_interval_t *interval, bool icd_active)
+{
+    uint32_t interval_ms = interval->interval_ms;
+    if (!icd_active && interval_ms < interval->idle_interval_ms) {
+        interval_ms = interval->idle_interval_ms;
+    }
+    return interval_ms;
+}
@@ -0,0 +1,48 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+
+// This file implements the adaptive sampling interval of the sensor scheduler.
+//
+// It only depends on the C library, so that the interval policy can be simulated on the host.
+
+#pragma once
+
+#include <stdint.h>
+
+typedef struct {
+    // sampling interval while the values change, 0 to only sample when triggered
+    uint32_t min_interval_ms;
+    // sampling interval while the values are stable
+    uint32_t max_interval_ms;
+    // minimum sampling interval while the ICD is in idle mode, 0 for no limit
+    uint32_t idle_interval_ms;
+    // current sampling interval, between min_interval_ms and max_interval_ms
+    uint32_t interval_ms;
+    // recent activity, the moving average of the activity of the measurements
+    float activity;
+} sensor_interval_t;
+
+/**
+ * @brief Start sampling at min_interval_ms with no recent activity.
+ */
+void sensor_interval_init(sensor_interval_t *interval, uint32_t min_interval_ms, uint32_t max_interval_ms,
+                          uint32_t idle_interval_ms);
+
+/**
+ * @brief Adapt the sampling interval to the activity of the latest measurement: it drops to min_interval_ms while
+ *        the values change and doubles up to max_interval_ms while they are stable.
+ *
+ * @param activity - Change of the values since the previous measurement, relative to the change the driver considers
+ *                   significant.
+ */
+void sensor_interval_update(sensor_interval_t *interval, float activity);
+
+/**
+ * @brief Interval to the next measurement, which does not go below idle_interval_ms while the ICD is in idle mode.
+ */
+uint32_t sensor_interval_get(const sensor_interval_t *interval, bool icd_active);
@@ -0,0 +1,193 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <inttypes.h>
+
+#include <drivers/sensor_interval.h>
+#include <drivers/sensor_scheduler.h>
+
+static const char * TAG = "sensor_scheduler";
+
+#define SENSOR_SCHEDULER_MAX_SENSORS 4
+#define SENSOR_SCHEDULER_TASK_STACK_SIZE 3072
+#define SENSOR_SCHEDULER_TASK_PRIORITY 5
+
+struct sensor_scheduler_sensor {
+    sensor_scheduler_config_t config;
+    // step of the running measurement, -1 when no measurement is running
+    int16_t step;
+    // time of the next step or measurement, 0 when the sensor only samples when triggered
+    int64_t next_us;
+    int64_t last_measurement_us;
+    sensor_interval_t interval;
+    volatile bool triggered;
+};
+
+typedef struct {
+    sensor_scheduler_sensor sensors[SENSOR_SCHEDULER_MAX_SENSORS];
+    uint8_t sensor_count;
+    bool icd_active;
+    portMUX_TYPE lock;
+    TaskHandle_t task;
+} sensor_scheduler_ctx_t;
+
+static sensor_scheduler_ctx_t s_ctx = {
+    .sensor_count = 0,
+    .icd_active = true,
+    .lock = portMUX_INITIALIZER_UNLOCKED,
+    .task = NULL,
+};
+
+static void sensor_schedule_next(sensor_scheduler_sensor *sensor, bool icd_active)
+{
+    uint32_t interval_ms = sensor_interval_get(&sensor->interval, icd_active);
+    sensor->next_us = interval_ms ? sensor->last_measurement_us + (int64_t)interval_ms * 1000 : 0;
+}
+
+static void sensor_run_step(sensor_scheduler_sensor *sensor, int64_t now, bool icd_active)
+{
+    if (sensor->step < 0) {
+        sensor->step = 0;
+        sensor->last_measurement_us = now;
+    }
+
+    sensor_step_result_t result = sensor->config.step_cb((uint8_t)sensor->step, sensor->config.ctx);
+    switch (result.status) {
+    case SENSOR_STEP_WAIT:
+        sensor->step++;
+        sensor->next_us = now + (int64_t)result.wait_ms * 1000;
+        return;
+    case SENSOR_STEP_DONE:
+        sensor_interval_update(&sensor->interval, result.activity);
+        break;
+    case SENSOR_STEP_FAILED:
+        ESP_LOGW(TAG, "%s: measurement failed at step %d", sensor->config.name, sensor->step);
+        break;
+    }
+    sensor->step = -1;
+    sensor_schedule_next(sensor, icd_active);
+    ESP_LOGD(TAG, "%s: next measurement in %" PRIu32 " ms", sensor->config.name,
+             sensor_interval_get(&sensor->interval, icd_active));
+}
+
+static void sensor_scheduler_task(void *arg)
+{
+    bool prev_icd_active = true;
+    while (true) {
+        int64_t now = esp_timer_get_time();
+        int64_t next_us = INT64_MAX;
+
+        taskENTER_CRITICAL(&s_ctx.lock);
+        uint8_t sensor_count = s_ctx.sensor_count;
+        bool icd_active = s_ctx.icd_active;
+        taskEXIT_CRITICAL(&s_ctx.lock);
+
+        for (uint8_t i = 0; i < sensor_count; i++) {
+            sensor_scheduler_sensor *sensor = &s_ctx.sensors[i];
+
+            // the idle interval is applied to, or lifted from, the next measurement
+            if (icd_active != prev_icd_active && sensor->step < 0 && sensor->next_us) {
+                sensor_schedule_next(sensor, icd_active);
+            }
+
+            taskENTER_CRITICAL(&s_ctx.lock);
+            bool triggered = sensor->triggered;
+            sensor->triggered = false;
+            taskEXIT_CRITICAL(&s_ctx.lock);
+
+            bool running = sensor->step >= 0;
+            if ((triggered && !running) || (sensor->next_us && now >= sensor->next_us)) {
+                sensor_run_step(sensor, now, icd_active);
+            }
+            if (sensor->next_us && sensor->next_us < next_us) {
+                next_us = sensor->next_us;
+            }
+        }
+
+        prev_icd_active = icd_active;
+
+        TickType_t wait = portMAX_DELAY;
+        if (next_us != INT64_MAX) {
+            now = esp_timer_get_time();
+            int64_t wait_ms = next_us > now ? (next_us - now + 999) / 1000 : 0;
+            wait = pdMS_TO_TICKS(wait_ms);
+            // do not spin until a deadline shorter than a tick
+            if (wait == 0 && wait_ms > 0) {
+                wait = 1;
+            }
+        }
+        // a trigger, a new sensor or an ICD mode change wakes the task up early
+        if (wait) {
+            ulTaskNotifyTake(pdTRUE, wait);
+        }
+    }
+}
+
+esp_err_t sensor_scheduler_add(const sensor_scheduler_config_t *config, sensor_scheduler_handle_t *handle)
+{
+    if (config == NULL || handle == NULL || config->step_cb == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (config->max_interval_ms < config->min_interval_ms) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (s_ctx.task == NULL) {
+        if (xTaskCreate(sensor_scheduler_task, "sensor_scheduler", SENSOR_SCHEDULER_TASK_STACK_SIZE, NULL,
+                        SENSOR_SCHEDULER_TASK_PRIORITY, &s_ctx.task) != pdPASS) {
+            ESP_LOGE(TAG, "Failed to create the scheduler task");
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    taskENTER_CRITICAL(&s_ctx.lock);
+    if (s_ctx.sensor_count >= SENSOR_SCHEDULER_MAX_SENSORS) {
+        taskEXIT_CRITICAL(&s_ctx.lock);
+        ESP_LOGE(TAG, "Too many sensors");
+        return ESP_ERR_NO_MEM;
+    }
+    sensor_scheduler_sensor *sensor = &s_ctx.sensors[s_ctx.sensor_count];
+    sensor->config = *config;
+    sensor->step = -1;
+    sensor_interval_init(&sensor->interval, config->min_interval_ms, config->max_interval_ms, config->idle_interval_ms);
+    sensor->triggered = true;
+    sensor->next_us = 0;
+    s_ctx.sensor_count++;
+    taskEXIT_CRITICAL(&s_ctx.lock);
+
+    *handle = sensor;
+    xTaskNotifyGive(s_ctx.task);
+    return ESP_OK;
+}
+
+void IRAM_ATTR sensor_scheduler_trigger_from_isr(sensor_scheduler_handle_t handle)
+{
+    BaseType_t higher_priority_task_woken = pdFALSE;
+    taskENTER_CRITICAL_ISR(&s_ctx.lock);
+    handle->triggered = true;
+    taskEXIT_CRITICAL_ISR(&s_ctx.lock);
+    vTaskNotifyGiveFromISR(s_ctx.task, &higher_priority_task_woken);
+    portYIELD_FROM_ISR(higher_priority_task_woken);
+}
+
+void sensor_scheduler_set_icd_active(bool active)
+{
+    taskENTER_CRITICAL(&s_ctx.lock);
+    bool changed = s_ctx.icd_active != active;
+    s_ctx.icd_active = active;
+    taskEXIT_CRITICAL(&s_ctx.lock);
+
+    if (changed && s_ctx.task) {
+        // the task reschedules the next measurements
+        xTaskNotifyGive(s_ctx.task);
+    }
+}
@@ -0,0 +1,78 @@
+/*
+   This example code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+
+// This file implements the sampling scheduler shared by the sensor drivers.
+//
+// All the sensors are sampled from one task, which only wakes up when a sensor is due. A measurement is a
+// non-blocking state machine: each step starts an operation on the sensor and returns how long to wait for it,
+// so the conversion time of a sensor does not hold the task or the other sensors.
+//
+// The sampling interval of a sensor adapts to its recent activity: it drops to min_interval_ms while the values
+// change and doubles up to max_interval_ms while they are stable. While the ICD is in idle mode, the interval does
+// not go below idle_interval_ms.
+
+#pragma once
+
+#include <esp_err.h>
+#include <esp_attr.h>
+#include <stdint.h>
+
+typedef struct sensor_scheduler_sensor *sensor_scheduler_handle_t;
+
+typedef enum {
+    // wait for wait_ms and call the step function again
+    SENSOR_STEP_WAIT,
+    // the measurement completed, activity is set
+    SENSOR_STEP_DONE,
+    // the measurement failed, it is retried at the next interval
+    SENSOR_STEP_FAILED,
+} sensor_step_status_t;
+
+typedef struct {
+    sensor_step_status_t status;
+    uint32_t wait_ms;
+    // Change of the values since the previous measurement, relative to the change the driver considers
+    // significant. 1.0 and more keeps the sensor at min_interval_ms.
+    float activity;
+} sensor_step_result_t;
+
+// One step of a measurement, `step` is 0 for the first step and increments with every SENSOR_STEP_WAIT
+using sensor_step_cb_t = sensor_step_result_t (*)(uint8_t step, void *ctx);
+
+typedef struct {
+    const char *name;
+    sensor_step_cb_t step_cb;
+    void *ctx;
+    // sampling interval while the values change, 0 to only sample when triggered
+    uint32_t min_interval_ms;
+    // sampling interval while the values are stable
+    uint32_t max_interval_ms;
+    // minimum sampling interval while the ICD is in idle mode, 0 for no limit
+    uint32_t idle_interval_ms;
+} sensor_scheduler_config_t;
+
+/**
+ * @brief Add a sensor to the scheduler, the scheduler task is created with the first sensor.
+ *        The first measurement starts right away.
+ *
+ * @return esp_err_t - ESP_OK on success,
+ *                     ESP_ERR_INVALID_ARG if config or handle is NULL
+ *                     ESP_ERR_NO_MEM if the maximum number of sensors is reached
+ */
+esp_err_t sensor_scheduler_add(const sensor_scheduler_config_t *config, sensor_scheduler_handle_t *handle);
+
+/**
+ * @brief Start a measurement of the sensor now, from an interrupt handler.
+ *        The trigger is ignored while a measurement of the sensor is running.
+ */
+void IRAM_ATTR sensor_scheduler_trigger_from_isr(sensor_scheduler_handle_t handle);
+
+/**
+ * @brief Set the ICD operating mode, the idle mode enforces the idle_interval_ms of the sensors.
+ */
+void sensor_scheduler_set_icd_active(bool active);
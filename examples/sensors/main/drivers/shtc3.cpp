@@ -8,12 +8,12 @@
 
 #include <esp_err.h>
 #include <esp_log.h>
-#include <esp_timer.h>
-#include <esp_random.h>
 #include <driver/i2c.h>
+#include <math.h>
 
 #include <lib/support/CodeUtils.h>
 
+#include <drivers/sensor_scheduler.h>
 #include <drivers/shtc3.h>
 
 static const char * TAG = "shtc3";
@@ -25,9 +25,26 @@ static const char * TAG = "shtc3";
 
 #define SHTC3_SENSOR_ADDR 0x70      /*!< I2C address of SHTC3 sensor */
 
+#define SHTC3_CMD_WAKEUP 0x3517
+#define SHTC3_CMD_SLEEP 0xB098
+#define SHTC3_CMD_MEASURE 0x7866    /*!< Normal mode, temperature first, clock stretching disabled */
+
+#define SHTC3_WAKEUP_TIME_MS 1      /*!< 240 us max */
+#define SHTC3_MEASUREMENT_TIME_MS 13 /*!< 12.1 ms max in normal mode */
+#define SHTC3_I2C_TIMEOUT_MS 100
+
+enum {
+    SHTC3_STEP_WAKEUP,
+    SHTC3_STEP_MEASURE,
+    SHTC3_STEP_READ,
+};
+
 typedef struct {
     shtc3_sensor_config_t *config;
-    esp_timer_handle_t timer;
+    sensor_scheduler_handle_t scheduler;
+    bool has_previous = false;
+    float previous_temp;
+    float previous_humidity;
     bool is_initialized = false;
 } shtc3_sensor_ctx_t;
 
@@ -55,32 +72,29 @@ static esp_err_t shtc3_init_i2c()
     return i2c_driver_install(I2C_MASTER_NUM, I2C_MODE_MASTER, 0, 0, 0);
 }
 
-static esp_err_t shtc3_read(uint8_t *data, size_t size)
+static esp_err_t shtc3_write_cmd(uint16_t cmd)
 {
-    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
-    i2c_master_start(cmd);
-    i2c_master_write_byte(cmd, (SHTC3_SENSOR_ADDR << 1) | I2C_MASTER_WRITE, true /* enable_ack */);
-    // Read temperature first then humidity, with clock stretching enabled
-    i2c_master_write_byte(cmd, 0x7C, true /* enable_ack */);
-    i2c_master_write_byte(cmd, 0xA2, true /* enable_ack */);
-    i2c_master_stop(cmd);
-    i2c_master_cmd_begin(I2C_MASTER_NUM, cmd, pdMS_TO_TICKS(1000));
-    i2c_cmd_link_delete(cmd);
-    cmd = NULL;
-
-    // Wait for measurement to complete
-    vTaskDelay(pdMS_TO_TICKS(15));
-
-    cmd = i2c_cmd_link_create();
-    i2c_master_start(cmd);
-    i2c_master_write_byte(cmd, (SHTC3_SENSOR_ADDR << 1) | I2C_MASTER_READ, true /* enable_ack */);
-    i2c_master_read(cmd, data, size, I2C_MASTER_LAST_NACK);
-    i2c_master_stop(cmd);
-    i2c_master_cmd_begin(I2C_MASTER_NUM, cmd, pdMS_TO_TICKS(1000));
-    i2c_cmd_link_delete(cmd);
-    cmd = NULL;
+    i2c_cmd_handle_t handle = i2c_cmd_link_create();
+    i2c_master_start(handle);
+    i2c_master_write_byte(handle, (SHTC3_SENSOR_ADDR << 1) | I2C_MASTER_WRITE, true /* enable_ack */);
+    i2c_master_write_byte(handle, cmd >> 8, true /* enable_ack */);
+    i2c_master_write_byte(handle, cmd & 0xFF, true /* enable_ack */);
+    i2c_master_stop(handle);
+    esp_err_t err = i2c_master_cmd_begin(I2C_MASTER_NUM, handle, pdMS_TO_TICKS(SHTC3_I2C_TIMEOUT_MS));
+    i2c_cmd_link_delete(handle);
+    return err;
+}
 
-    return ESP_OK;
+static esp_err_t shtc3_read(uint8_t *data, size_t size)
+{
+    i2c_cmd_handle_t handle = i2c_cmd_link_create();
+    i2c_master_start(handle);
+    i2c_master_write_byte(handle, (SHTC3_SENSOR_ADDR << 1) | I2C_MASTER_READ, true /* enable_ack */);
+    i2c_master_read(handle, data, size, I2C_MASTER_LAST_NACK);
+    i2c_master_stop(handle);
+    esp_err_t err = i2c_master_cmd_begin(I2C_MASTER_NUM, handle, pdMS_TO_TICKS(SHTC3_I2C_TIMEOUT_MS));
+    i2c_cmd_link_delete(handle);
+    return err;
 }
 
 // Temperature in degree Celsius
@@ -95,43 +109,70 @@ static float shtc3_get_humidity(uint16_t raw_humidity)
     return 100.0f * (static_cast<float>(raw_humidity) / 65535.0f);
 }
 
-static esp_err_t shtc3_get_read_temp_and_humidity(float  &temp, float  &humidity)
+static float shtc3_activity(shtc3_sensor_ctx_t *ctx, float temp, float humidity)
 {
-    // foreach temperature and humidity: two bytes data, one byte for checksum
-    uint8_t data[6] = {0};
-
-    esp_err_t err = shtc3_read(data, sizeof(data));
-    if (err != ESP_OK) {
-        return err;
+    float activity = 0;
+    if (ctx->has_previous) {
+        float temp_activity = fabsf(temp - ctx->previous_temp) / ctx->config->temperature_threshold;
+        float humidity_activity = fabsf(humidity - ctx->previous_humidity) / ctx->config->humidity_threshold;
+        activity = temp_activity > humidity_activity ? temp_activity : humidity_activity;
     }
-
-    uint16_t raw_temp = (data[0] << 8) | data[1];
-    uint16_t raw_humidity = (data[3] << 8) | data[4];
-
-    temp = shtc3_get_temp(raw_temp);
-    humidity = shtc3_get_humidity(raw_humidity);
-
-    return ESP_OK;
+    ctx->has_previous = true;
+    ctx->previous_temp = temp;
+    ctx->previous_humidity = humidity;
+    return activity;
 }
 
-static void timer_cb_internal(void *arg)
+// The measurement runs in steps so that the scheduler task is not blocked while the sensor converts:
+// wake up the sensor, start the measurement, then read the result and put the sensor back to sleep.
+static sensor_step_result_t shtc3_measurement_step(uint8_t step, void *arg)
 {
     auto *ctx = (shtc3_sensor_ctx_t *) arg;
-    if (!(ctx && ctx->config)) {
-        return;
-    }
+    sensor_step_result_t result = {
+        .status = SENSOR_STEP_FAILED,
+        .wait_ms = 0,
+        .activity = 0,
+    };
+
+    switch (step) {
+    case SHTC3_STEP_WAKEUP:
+        VerifyOrReturnValue(shtc3_write_cmd(SHTC3_CMD_WAKEUP) == ESP_OK, result, ESP_LOGE(TAG, "Failed to wake up"));
+        result.status = SENSOR_STEP_WAIT;
+        result.wait_ms = SHTC3_WAKEUP_TIME_MS;
+        break;
+
+    case SHTC3_STEP_MEASURE:
+        // Read temperature first then humidity, the bus is not held by clock stretching while the sensor converts
+        VerifyOrReturnValue(shtc3_write_cmd(SHTC3_CMD_MEASURE) == ESP_OK, result,
+                            ESP_LOGE(TAG, "Failed to start the measurement"));
+        result.status = SENSOR_STEP_WAIT;
+        result.wait_ms = SHTC3_MEASUREMENT_TIME_MS;
+        break;
+
+    case SHTC3_STEP_READ: {
+        // foreach temperature and humidity: two bytes data, one byte for checksum
+        uint8_t data[6] = {0};
+        esp_err_t err = shtc3_read(data, sizeof(data));
+        shtc3_write_cmd(SHTC3_CMD_SLEEP);
+        VerifyOrReturnValue(err == ESP_OK, result, ESP_LOGE(TAG, "Failed to read the measurement, err:%d", err));
+
+        uint16_t raw_temp = (data[0] << 8) | data[1];
+        uint16_t raw_humidity = (data[3] << 8) | data[4];
+        float temp = shtc3_get_temp(raw_temp);
+        float humidity = shtc3_get_humidity(raw_humidity);
 
-    float temp, humidity;
-    esp_err_t err = shtc3_get_read_temp_and_humidity(temp, humidity);
-    if (err != ESP_OK) {
-        return;
-    }
-    if (ctx->config->temperature.cb) {
         ctx->config->temperature.cb(ctx->config->temperature.endpoint_id, temp, ctx->config->user_data);
-    }
-    if (ctx->config->humidity.cb) {
         ctx->config->humidity.cb(ctx->config->humidity.endpoint_id, humidity, ctx->config->user_data);
+
+        result.status = SENSOR_STEP_DONE;
+        result.activity = shtc3_activity(ctx, temp, humidity);
+        break;
     }
+
+    default:
+        break;
+    }
+    return result;
 }
 
 esp_err_t shtc3_sensor_init(shtc3_sensor_config_t *config)
@@ -155,20 +196,17 @@ esp_err_t shtc3_sensor_init(shtc3_sensor_config_t *config)
     // keep the pointer to config
     s_ctx.config = config;
 
-    esp_timer_create_args_t args = {
-        .callback = timer_cb_internal,
-        .arg = &s_ctx,
+    sensor_scheduler_config_t scheduler_config = {
+        .name = TAG,
+        .step_cb = shtc3_measurement_step,
+        .ctx = &s_ctx,
+        .min_interval_ms = config->interval_ms,
+        .max_interval_ms = config->max_interval_ms,
+        .idle_interval_ms = config->idle_interval_ms,
     };
-
-    err = esp_timer_create(&args, &s_ctx.timer);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "esp_timer_create failed, err:%d", err);
-        return err;
-    }
-
-    err = esp_timer_start_periodic(s_ctx.timer, config->interval_ms * 1000);
+    err = sensor_scheduler_add(&scheduler_config, &s_ctx.scheduler);
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "esp_timer_start_periodic failed: %d", err);
+        ESP_LOGE(TAG, "sensor_scheduler_add failed, err:%d", err);
         return err;
     }
 
@@ -19,14 +19,14 @@ using shtc3_sensor_cb_t = void (*)(uint16_t endpoint_id, float value, void *user
 
 typedef struct {
     struct {
-        // This callback functon will be called periodically to report the temperature.
+        // This callback functon will be called after every measurement to report the temperature.
         shtc3_sensor_cb_t cb = NULL;
         // endpoint_id associated with temperature sensor
         uint16_t endpoint_id;
     } temperature;
 
     struct {
-        // This callback functon will be called periodically to report the humidity.
+        // This callback functon will be called after every measurement to report the humidity.
         shtc3_sensor_cb_t cb = NULL;
         // endpoint_id associated with humidity sensor
         uint16_t endpoint_id;
@@ -35,8 +35,19 @@ typedef struct {
     // user data
     void *user_data = NULL;
 
-    // polling interval in milliseconds, defaults to 5000 ms
+    // polling interval in milliseconds while the values change, defaults to 5000 ms
     uint32_t interval_ms = 5000;
+
+    // polling interval in milliseconds once the values are stable, defaults to 60000 ms
+    uint32_t max_interval_ms = 60000;
+
+    // minimum polling interval in milliseconds while the ICD is in idle mode, 0 for no limit
+    uint32_t idle_interval_ms = 0;
+
+    // changes from one measurement to the next which keep the polling interval at interval_ms,
+    // in degree Celsius and in percentage
+    float temperature_threshold = 0.1f;
+    float humidity_threshold = 0.5f;
 } shtc3_sensor_config_t;
 
 /**
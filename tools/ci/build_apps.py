@@ -48,6 +48,14 @@ MAINFEST_FILES = [
     str(PROJECT_ROOT / 'examples' / '.build-rules.yml'),
 ]
 
+# The sync test build of the rainmaker bridge is only built for its pytest job, the default build is not a pytest app
+PYTEST_S3_APPS = [
+    {"target": "esp32s3", "name": "esp_rainmaker_bridge", "config": "sync_test"},
+]
+MAINFEST_FILES = [
+    str(PROJECT_ROOT / 'examples' / '.build-rules.yml'),
+]
+
 # Exclude list for no-pytest apps in CI on merge request or branch pipelines.
 # The below examples will be built on main branch pipeline.
 NO_PYTEST_REMAINING_APPS = [
@@ -111,6 +119,12 @@ def _is_c2_pytest_app(app: App) -> bool:
             return True
     return False
 
+def _is_s3_pytest_app(app: App) -> bool:
+    for pytest_app in PYTEST_S3_APPS:
+        if app.name == pytest_app["name"] and app.target == pytest_app["target"] and app.config_name == pytest_app["config"]:
+            return True
+    return False
+
 # Function to check for no_pytest excluded list apps.
 def _is_no_pytest_remaining_app(app: App) -> bool:
     for no_pytest_app in NO_PYTEST_REMAINING_APPS:
@@ -140,9 +154,9 @@ def main(args: argparse.Namespace) -> None:
     apps = get_cmake_apps(args.paths, args.target, args.config)
 
     # no_pytest and only_pytest can not be both True
-    assert not (args.no_pytest and args.pytest_c6 and args.pytest_h2 and args.pytest_c3 and args.pytest_c2)
+    assert not (args.no_pytest and args.pytest_c6 and args.pytest_h2 and args.pytest_c3 and args.pytest_c2 and args.pytest_s3)
     if args.no_pytest:
-        apps_for_build = [app for app in apps if not (_is_c6_pytest_app(app) or _is_h2_pytest_app(app) or _is_no_pytest_remaining_app(app))]
+        apps_for_build = [app for app in apps if not (_is_c6_pytest_app(app) or _is_h2_pytest_app(app) or _is_s3_pytest_app(app) or _is_no_pytest_remaining_app(app))]
     elif args.pytest_c6:
         apps_for_build = [app for app in apps if _is_c6_pytest_app(app)]
     elif args.pytest_h2:
@@ -151,6 +165,8 @@ def main(args: argparse.Namespace) -> None:
         apps_for_build = [app for app in apps if _is_c3_pytest_app(app)]
     elif args.pytest_c2:
         apps_for_build = [app for app in apps if _is_c2_pytest_app(app)]
+    elif args.pytest_s3:
+        apps_for_build = [app for app in apps if _is_s3_pytest_app(app)]
     elif args.no_pytest_remaining:
         apps_for_build = [app for app in apps if _is_no_pytest_remaining_app(app)]
     else:
@@ -238,6 +254,11 @@ if __name__ == '__main__':
         action="store_true",
         help='Only build pytest apps, definded in PYTEST_C2_APPS',
     )
+    parser.add_argument(
+        '--pytest_s3',
+        action="store_true",
+        help='Only build pytest apps, definded in PYTEST_S3_APPS',
+    )
     parser.add_argument(
         '--collect-size-info',
         type=argparse.FileType('w'),